@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file           : pipeline_benchmark.c
+  * @brief          : Throughput of the input pipeline on the host
+  ******************************************************************************
+  * Runs the pipeline of the firmware with the host transport over two pipes.
+  * A sender thread takes the role of tools/eval.py: it sends the handshake
+  * and the pictures at the time a UART at the given baud rate needs for them,
+  * and checks the predictions. The network is replaced by a busy wait of the
+  * given inference time, which returns the sum of the pixels modulo 10.
+  *
+  * The pictures are sent once with one picture in flight, the way of the
+  * blocking loop, and once with AI_PIPELINE_BUFFERS pictures in flight.
+  * A third run starts with a picture cut off after TRUNCATED bytes, whose rest
+  * comes after the timeout filled with command bytes. The pipeline has to
+  * drop it without a prediction and drain the rest, the pictures after it
+  * are checked as before.
+  *
+  *   make -f Makefile.host benchmark [FRAMES=n] [INFERENCE_US=n] [BAUD=n]
+  ******************************************************************************
+  */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ai_pipeline.h"
+#include "uart_host.h"
+
+#define FIRMWARE_ID 2
+/* the bytes of the truncated frame that arrive in time, with its command */
+#define TRUNCATED 300
+
+static int frames = 25;
+static long inference_us = 40000;
+static long baud = 256000;
+
+static int to_board[2], from_board[2];
+static int window;
+static int truncated;
+static int errors;
+
+static double now(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint8_t expected(const uint8_t *picture)
+{
+  unsigned sum = 0;
+  int i;
+
+  for (i = 0; i < AI_PIPELINE_PICTURE_SIZE; i++)
+    sum += picture[i];
+  return sum % 10;
+}
+
+static void make_picture(uint8_t *picture, int frame)
+{
+  int i;
+
+  for (i = 0; i < AI_PIPELINE_PICTURE_SIZE; i++)
+    picture[i] = (uint8_t)(i * 7 + frame * 13 + (i >> 3) * frame);
+}
+
+/* the network: busy for the inference time like the core of the target */
+static uint8_t process_picture(const uint8_t *picture)
+{
+  double end = now() + inference_us * 1e-6;
+
+  while (now() < end)
+    ;
+  return expected(picture);
+}
+
+/* sends size bytes, after the time the UART needs for them (10 bits a byte) */
+static void send(const uint8_t *data, int size)
+{
+  usleep((useconds_t)(size * 10 * 1000000LL / baud));
+  if (write(to_board[1], data, size) != size)
+    errors++;
+}
+
+static void check_prediction(int frame)
+{
+  uint8_t picture[AI_PIPELINE_PICTURE_SIZE];
+  uint8_t pred;
+
+  make_picture(picture, frame);
+  if (read(from_board[0], &pred, 1) != 1 || pred != expected(picture))
+    errors++;
+}
+
+/* a picture that stops after TRUNCATED bytes, the rest arrives after the
+   timeout and would be handshakes and pictures if it was parsed */
+static void send_truncated(void)
+{
+  uint8_t picture[1 + AI_PIPELINE_PICTURE_SIZE];
+  int i;
+
+  picture[0] = AI_PIPELINE_CMD_PICTURE;
+  make_picture(&picture[1], frames);
+  send(picture, TRUNCATED);
+  usleep(2 * AI_PIPELINE_RX_TIMEOUT * 1000);
+
+  for (i = TRUNCATED; i < (int)sizeof(picture); i++)
+    picture[i] = i & 1 ? AI_PIPELINE_CMD_HANDSHAKE : AI_PIPELINE_CMD_PICTURE;
+  send(&picture[TRUNCATED], sizeof(picture) - TRUNCATED);
+  usleep(2 * AI_PIPELINE_RX_TIMEOUT * 1000);
+}
+
+static void *sender(void *arg)
+{
+  uint8_t picture[1 + AI_PIPELINE_PICTURE_SIZE];
+  uint8_t reply[2];
+  int frame;
+
+  (void)arg;
+  picture[0] = AI_PIPELINE_CMD_HANDSHAKE;
+  send(picture, 1);
+  if (read(from_board[0], reply, 2) != 2 || reply[0] != 'X' || reply[1] != FIRMWARE_ID)
+    errors++;
+  if (truncated)
+    send_truncated();
+
+  for (frame = 0; frame < frames; frame++)
+  {
+    if (frame >= window)
+      check_prediction(frame - window);
+    picture[0] = AI_PIPELINE_CMD_PICTURE;
+    make_picture(&picture[1], frame);
+    send(picture, sizeof(picture));
+  }
+  for (frame = frames - window; frame < frames; frame++)
+  {
+    if (frame >= 0)
+      check_prediction(frame);
+  }
+  close(to_board[1]);
+  return NULL;
+}
+
+/* runs the firmware loop until the sender is done, returns the time per picture in ms */
+static double run(int in_flight, int truncate)
+{
+  const ai_transport_t *transport;
+  pthread_t thread;
+  double start;
+
+  window = in_flight;
+  truncated = truncate;
+  if (pipe(to_board) != 0 || pipe(from_board) != 0)
+    exit(1);
+  transport = uart_host_open(to_board[0], from_board[1]);
+  if (transport == NULL)
+    exit(1);
+
+  ai_pipeline_init(transport, process_picture, FIRMWARE_ID);
+  ai_pipeline_start();
+  start = now();
+  pthread_create(&thread, NULL, sender, NULL);
+  while (ai_pipeline_poll())
+    ;
+  pthread_join(thread, NULL);
+  uart_host_close();
+
+  close(to_board[0]);
+  close(from_board[0]);
+  close(from_board[1]);
+  return (now() - start) / frames * 1e3;
+}
+
+int main(int argc, char **argv)
+{
+  double transfer, blocking, pipelined;
+  int run_errors;
+
+  if (argc > 1)
+    frames = atoi(argv[1]);
+  if (argc > 2)
+    inference_us = atol(argv[2]);
+  if (argc > 3)
+    baud = atol(argv[3]);
+
+  transfer = (1 + AI_PIPELINE_PICTURE_SIZE) * 10 * 1e3 / baud;
+  blocking = run(1, 0);
+  pipelined = run(AI_PIPELINE_BUFFERS, 0);
+  run_errors = errors;
+  run(AI_PIPELINE_BUFFERS, 1);
+
+  printf("%d pictures, transfer %.1f ms, inference %.1f ms\n", frames, transfer, inference_us * 1e-3);
+  printf("1 picture in flight   %6.1f ms/picture\n", blocking);
+  printf("%d pictures in flight  %6.1f ms/picture  (%.2fx)\n", AI_PIPELINE_BUFFERS, pipelined, blocking / pipelined);
+  printf("truncated picture     %s\n", errors == run_errors ? "dropped" : "not dropped");
+  printf("errors                %6d\n", errors);
+  return errors != 0;
+}
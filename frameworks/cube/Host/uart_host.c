@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file           : uart_host.c
+  * @brief          : Host stand-in of the UART transport of the input pipeline
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "uart_host.h"
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+/* signals a started receive to the reader and a completion to the main loop */
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static pthread_t reader, ticker;
+
+static int rx_fd, tx_fd;
+/* the started receive, NULL if none, and the bytes it got so far */
+static uint8_t *rx_data;
+static uint16_t rx_size, rx_count;
+/* the pipeline started its first receive, the transport is closing */
+static int started, closing;
+
+/* Private functions ---------------------------------------------------------*/
+static void uart_receive(uint8_t *data, uint16_t size)
+{
+  rx_data = data;
+  rx_size = size;
+  rx_count = 0;
+  started = 1;
+  pthread_cond_broadcast(&cond);
+}
+
+static void uart_transmit(const uint8_t *data, uint16_t size)
+{
+  ssize_t n;
+
+  while (size > 0)
+  {
+    n = write(tx_fd, data, size);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return;
+    data += n;
+    size -= n;
+  }
+}
+
+static void uart_lock(void)
+{
+  pthread_mutex_lock(&mutex);
+}
+
+static void uart_unlock(void)
+{
+  pthread_mutex_unlock(&mutex);
+}
+
+static void uart_wait(void)
+{
+  pthread_cond_wait(&cond, &mutex);
+}
+
+static void uart_abort(void)
+{
+  rx_data = NULL;
+}
+
+static uint16_t uart_remaining(void)
+{
+  return rx_data != NULL ? rx_size - rx_count : 0;
+}
+
+static uint32_t uart_time(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint32_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+
+static const ai_transport_t uart_transport = {
+  uart_receive, uart_transmit, uart_lock, uart_unlock, uart_wait,
+  uart_abort, uart_remaining, uart_time};
+
+/* the DMA: copies the bytes read into the buffer of the started receive as
+   they arrive and calls its completion once it is full, the bytes read while
+   no receive is started wait like in the receive register */
+static void *uart_reader(void *arg)
+{
+  uint8_t chunk[64];
+  ssize_t n, i, copy;
+
+  (void)arg;
+  for (;;)
+  {
+    n = read(rx_fd, chunk, sizeof(chunk));
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+
+    pthread_mutex_lock(&mutex);
+    for (i = 0; i < n; i += copy)
+    {
+      while (rx_data == NULL)
+        pthread_cond_wait(&cond, &mutex);
+      copy = rx_size - rx_count;
+      if (copy > n - i)
+        copy = n - i;
+      memcpy(&rx_data[rx_count], &chunk[i], copy);
+      rx_count += copy;
+      if (rx_count == rx_size)
+      {
+        rx_data = NULL;
+        ai_pipeline_rx_cplt();
+        pthread_cond_broadcast(&cond);
+      }
+    }
+    pthread_mutex_unlock(&mutex);
+  }
+
+  pthread_mutex_lock(&mutex);
+  ai_pipeline_rx_closed();
+  pthread_cond_broadcast(&cond);
+  pthread_mutex_unlock(&mutex);
+  return NULL;
+}
+
+/* the SysTick interrupt, once the pipeline is started: the main thread
+   initializes it without the lock */
+static void *uart_ticker(void *arg)
+{
+  int run, stop;
+
+  (void)arg;
+  for (;;)
+  {
+    usleep(1000);
+    pthread_mutex_lock(&mutex);
+    run = started;
+    stop = closing;
+    pthread_mutex_unlock(&mutex);
+    if (stop)
+      break;
+    if (run)
+      ai_pipeline_timer();
+  }
+  return NULL;
+}
+
+/**
+  * @brief Starts the reader and the ticker thread
+  * @retval the transport to pass to ai_pipeline_init(), NULL on failure
+  */
+const ai_transport_t *uart_host_open(int rx, int tx)
+{
+  rx_fd = rx;
+  tx_fd = tx;
+  rx_data = NULL;
+  started = 0;
+  closing = 0;
+  if (pthread_create(&reader, NULL, uart_reader, NULL) != 0)
+    return NULL;
+  if (pthread_create(&ticker, NULL, uart_ticker, NULL) != 0)
+    return NULL;
+  return &uart_transport;
+}
+
+/**
+  * @brief Waits for the reader thread, which ends at the end of the stream,
+  *        and stops the ticker thread
+  */
+void uart_host_close(void)
+{
+  pthread_join(reader, NULL);
+  pthread_mutex_lock(&mutex);
+  closing = 1;
+  pthread_mutex_unlock(&mutex);
+  pthread_join(ticker, NULL);
+}
@@ -0,0 +1,21 @@
+/**
+  ******************************************************************************
+  * @file           : uart_host.h
+  * @brief          : Host stand-in of the UART transport of the input pipeline
+  ******************************************************************************
+  * Reads from a file descriptor (a pipe, a socket or a serial device) in a
+  * thread, which takes the role of the DMA and its interrupt, and writes the
+  * replies to a second one. The completion callbacks of the pipeline run in
+  * the reader thread with the transport lock held. A second thread calls
+  * ai_pipeline_timer() every millisecond like the SysTick interrupt.
+  ******************************************************************************
+  */
+#ifndef __UART_HOST_H
+#define __UART_HOST_H
+
+#include "ai_pipeline.h"
+
+const ai_transport_t *uart_host_open(int rx_fd, int tx_fd);
+void uart_host_close(void);
+
+#endif /* __UART_HOST_H */
@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file           : ai_pipeline.h
+  * @brief          : Double buffered input pipeline of the application loop
+  ******************************************************************************
+  * The pictures are received in the background into two ping-pong buffers, so
+  * picture N+1 is received while the network processes picture N. The
+  * pipeline only depends on the transport below: on the target it is the
+  * UART with DMA (main.c), on the host a reader thread (Host/uart_host.c).
+  *
+  * Protocol, unchanged from the blocking loop:
+  *  - 's'                 : handshake, answered with 'X' and the firmware id
+  *  - 'c' + 784 bytes     : picture, answered with the prediction (1 byte)
+  * The host may send the next picture before it has read the prediction of
+  * the previous one, at most AI_PIPELINE_BUFFERS pictures are in flight.
+  * A picture whose bytes stop for AI_PIPELINE_RX_TIMEOUT ms is dropped without
+  * a prediction, the bytes that follow are dropped as well until the line is
+  * quiet for as long, then the next command is expected.
+  ******************************************************************************
+  */
+#ifndef __AI_PIPELINE_H
+#define __AI_PIPELINE_H
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define AI_PIPELINE_PICTURE_SIZE 784 /* MMNIST images have 28*28 pixels */
+#define AI_PIPELINE_BUFFERS 2
+
+/* ms without a byte that end a picture or the draining of the line */
+#define AI_PIPELINE_RX_TIMEOUT 100
+
+#define AI_PIPELINE_CMD_HANDSHAKE 's'
+#define AI_PIPELINE_CMD_PICTURE 'c'
+
+/**
+  * @brief Transport of the pipeline.
+  * receive() starts a background receive and returns immediately, its end is
+  * reported with ai_pipeline_rx_cplt(). It is called from ai_pipeline_rx_cplt()
+  * or with the lock taken. transmit() blocks until the data is sent.
+  * lock() masks the completion callbacks, wait() is called locked and returns
+  * locked once a completion callback could have run.
+  * abort() stops the started receive without a completion callback and
+  * remaining() returns the bytes it still has to receive, both are called
+  * locked. time() counts milliseconds.
+  */
+typedef struct {
+  void (*receive)(uint8_t *data, uint16_t size);
+  void (*transmit)(const uint8_t *data, uint16_t size);
+  void (*lock)(void);
+  void (*unlock)(void);
+  void (*wait)(void);
+  void (*abort)(void);
+  uint16_t (*remaining)(void);
+  uint32_t (*time)(void);
+} ai_transport_t;
+
+/* runs the network on a received picture and returns the prediction */
+typedef uint8_t (*ai_pipeline_process_t)(const uint8_t *picture);
+
+void ai_pipeline_init(const ai_transport_t *transport, ai_pipeline_process_t process, uint8_t firmware);
+void ai_pipeline_start(void);
+int ai_pipeline_poll(void);
+
+/* called every millisecond, e.g. from the SysTick interrupt */
+void ai_pipeline_timer(void);
+
+/* completion callbacks of the transport */
+void ai_pipeline_rx_cplt(void);
+void ai_pipeline_rx_error(void);
+void ai_pipeline_rx_closed(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __AI_PIPELINE_H */
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file           : ai_pipeline.c
+  * @brief          : Double buffered input pipeline of the application loop
+  ******************************************************************************
+  * The receive side runs in the completion callbacks of the transport: it
+  * reads a command byte, then a picture into the next free buffer and marks
+  * it ready. The main loop, ai_pipeline_poll(), runs the network on the ready
+  * buffers in the order they were received and frees them again. If both
+  * buffers are in use when a picture command arrives, its receive is started
+  * as soon as the main loop frees a buffer.
+  *
+  * ai_pipeline_timer() watches the bytes a picture receive still has to get.
+  * If they don't change for AI_PIPELINE_RX_TIMEOUT ms, the receive is aborted
+  * like on a receive error: the partial picture is dropped and the line is
+  * drained, the bytes are received one by one and dropped until none arrived
+  * for AI_PIPELINE_RX_TIMEOUT ms. The receive of one byte that is pending
+  * then is the one of the next command.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "ai_pipeline.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum {
+  BUFFER_FREE,
+  BUFFER_RECEIVING,
+  BUFFER_READY,
+  BUFFER_BUSY
+} buffer_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const ai_transport_t *transport;
+static ai_pipeline_process_t process;
+static uint8_t firmware;
+
+static uint8_t pictures[AI_PIPELINE_BUFFERS][AI_PIPELINE_PICTURE_SIZE];
+static volatile buffer_state_t state[AI_PIPELINE_BUFFERS];
+
+/* buffers are filled and processed in turn */
+static volatile uint8_t rx_index;
+static uint8_t process_index;
+
+static uint8_t command;
+static volatile uint8_t rx_picture;
+static volatile uint8_t rx_waiting;
+static volatile uint8_t handshake;
+static volatile uint8_t closed;
+static volatile uint8_t draining;
+
+/* the bytes the picture receive still has to get, the time they changed or
+   the time of the last byte while draining */
+static uint16_t rx_remaining;
+static uint32_t rx_time;
+
+/* Private functions ---------------------------------------------------------*/
+static void receive_command(void)
+{
+  rx_picture = 0;
+  transport->receive(&command, 1);
+}
+
+/* called from a completion callback or locked */
+static void receive_picture(void)
+{
+  if (state[rx_index] != BUFFER_FREE)
+  {
+    rx_waiting = 1;
+    return;
+  }
+  state[rx_index] = BUFFER_RECEIVING;
+  rx_picture = 1;
+  rx_remaining = AI_PIPELINE_PICTURE_SIZE;
+  rx_time = transport->time();
+  transport->receive(pictures[rx_index], AI_PIPELINE_PICTURE_SIZE);
+}
+
+/* called from a completion callback or locked */
+static void drain(void)
+{
+  draining = 1;
+  rx_time = transport->time();
+  receive_command();
+}
+
+/**
+  * @brief Sets the transport, the network and the firmware id sent on a handshake
+  */
+void ai_pipeline_init(const ai_transport_t *t, ai_pipeline_process_t p, uint8_t fw)
+{
+  uint8_t i;
+
+  transport = t;
+  process = p;
+  firmware = fw;
+  for (i = 0; i < AI_PIPELINE_BUFFERS; i++)
+    state[i] = BUFFER_FREE;
+  rx_index = 0;
+  process_index = 0;
+  rx_picture = 0;
+  rx_waiting = 0;
+  handshake = 0;
+  closed = 0;
+  draining = 0;
+}
+
+/**
+  * @brief Starts to receive the first command
+  */
+void ai_pipeline_start(void)
+{
+  transport->lock();
+  receive_command();
+  transport->unlock();
+}
+
+/**
+  * @brief Waits for a received picture or command and handles it
+  * @retval 0 once the transport is closed and all pictures are processed
+  */
+int ai_pipeline_poll(void)
+{
+  uint8_t reply[2];
+  uint8_t index = process_index;
+
+  transport->lock();
+  while (state[index] != BUFFER_READY && !handshake && !closed)
+    transport->wait();
+
+  if (state[index] != BUFFER_READY)
+  {
+    transport->unlock();
+    if (!handshake)
+      return 0;
+
+    /* handshake: receive 's' return 'X' and the firmware id */
+    handshake = 0;
+    reply[0] = 'X';
+    reply[1] = firmware;
+    transport->transmit(reply, 2);
+    return 1;
+  }
+  state[index] = BUFFER_BUSY;
+  transport->unlock();
+
+  /* the other buffer keeps receiving meanwhile */
+  reply[0] = process(pictures[index]);
+
+  transport->lock();
+  state[index] = BUFFER_FREE;
+  process_index = (index + 1) % AI_PIPELINE_BUFFERS;
+  if (rx_waiting)
+  {
+    rx_waiting = 0;
+    receive_picture();
+  }
+  transport->unlock();
+
+  /* return the prediction */
+  transport->transmit(reply, 1);
+  return 1;
+}
+
+/**
+  * @brief Receive completion callback of the transport
+  */
+void ai_pipeline_rx_cplt(void)
+{
+  if (draining)
+  {
+    rx_time = transport->time();
+    receive_command();
+  }
+  else if (rx_picture)
+  {
+    state[rx_index] = BUFFER_READY;
+    rx_index = (rx_index + 1) % AI_PIPELINE_BUFFERS;
+    receive_command();
+  }
+  else if (command == AI_PIPELINE_CMD_PICTURE)
+  {
+    receive_picture();
+  }
+  else
+  {
+    if (command == AI_PIPELINE_CMD_HANDSHAKE)
+      handshake = 1;
+    receive_command();
+  }
+}
+
+/**
+  * @brief Receive error callback of the transport, drops a partial picture and
+  *        drains the line
+  */
+void ai_pipeline_rx_error(void)
+{
+  if (rx_picture)
+    state[rx_index] = BUFFER_FREE;
+  rx_waiting = 0;
+  drain();
+}
+
+/**
+  * @brief The transport has no more data, ai_pipeline_poll() returns 0 once idle
+  */
+void ai_pipeline_rx_closed(void)
+{
+  if (rx_picture)
+    state[rx_index] = BUFFER_FREE;
+  rx_picture = 0;
+  rx_waiting = 0;
+  closed = 1;
+}
+
+/**
+  * @brief Aborts a picture receive that got no byte for AI_PIPELINE_RX_TIMEOUT
+  *        ms and ends the draining of the line once it was quiet for as long
+  */
+void ai_pipeline_timer(void)
+{
+  uint16_t remaining;
+  uint32_t now;
+
+  /* SysTick runs before the pipeline is initialized */
+  if (transport == NULL)
+    return;
+
+  transport->lock();
+  now = transport->time();
+  if (rx_picture)
+  {
+    remaining = transport->remaining();
+    if (remaining != rx_remaining)
+    {
+      rx_remaining = remaining;
+      rx_time = now;
+    }
+    else if (now - rx_time >= AI_PIPELINE_RX_TIMEOUT)
+    {
+      transport->abort();
+      ai_pipeline_rx_error();
+    }
+  }
+  else if (draining && now - rx_time >= AI_PIPELINE_RX_TIMEOUT)
+  {
+    /* the pending receive of one byte is the one of the next command */
+    draining = 0;
+  }
+  transport->unlock();
+}
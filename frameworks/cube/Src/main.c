@@ -54,6 +54,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "ai_pipeline.h"
 
 /* USER CODE END Includes */
 
@@ -64,7 +65,8 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-#define IMAGE_SIZE 784 /* MMNIST images have 28*28 pixels */
+#define IMAGE_SIZE AI_PIPELINE_PICTURE_SIZE
+#define FIRMWARE_ID 2 /* firmware id of the handshake, see tools/eval.py */
 
 /* USER CODE END PD */
 
@@ -77,14 +79,17 @@
 CRC_HandleTypeDef hcrc;
 
 UART_HandleTypeDef huart4;
+DMA_HandleTypeDef hdma_uart4_rx;
 
 /* USER CODE BEGIN PV */
+static float mnist[IMAGE_SIZE];
 
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_CRC_Init(void);
 void MX_UART4_Init(void);
 /* USER CODE BEGIN PFP */
@@ -93,7 +98,82 @@ void MX_UART4_Init(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/* UART4 transport of the input pipeline, the pictures are received by DMA */
+static void uart_receive(uint8_t *data, uint16_t size)
+{
+  if (HAL_UART_Receive_DMA(&huart4, data, size) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/* HAL_UART_Transmit() holds the handle lock, a receive started by the DMA
+   interrupt meanwhile would fail, so the data register is written directly */
+static void uart_transmit(const uint8_t *data, uint16_t size)
+{
+  while (size--)
+  {
+    while (__HAL_UART_GET_FLAG(&huart4, UART_FLAG_TXE) == RESET)
+      ;
+    huart4.Instance->DR = *data++;
+  }
+}
+
+static void uart_lock(void)
+{
+  __disable_irq();
+}
+
+static void uart_unlock(void)
+{
+  __enable_irq();
+}
+
+/* sleeps until an interrupt is pending and lets it run */
+static void uart_wait(void)
+{
+  __WFI();
+  __enable_irq();
+  __ISB();
+  __disable_irq();
+}
+
+/* stops the DMA receive without calling its completion */
+static void uart_abort(void)
+{
+  HAL_UART_AbortReceive(&huart4);
+}
+
+static uint16_t uart_remaining(void)
+{
+  return (uint16_t)__HAL_DMA_GET_COUNTER(huart4.hdmarx);
+}
+
+static const ai_transport_t uart_transport = {
+  uart_receive, uart_transmit, uart_lock, uart_unlock, uart_wait,
+  uart_abort, uart_remaining, HAL_GetTick};
+
+/* runs the neural network on a picture received by the pipeline */
+static uint8_t process_picture(const uint8_t *inputPicture)
+{
+  uint8_t pred;
+  uint16_t i;
+
+  /* scale into float range [0, 1] */
+  for (i = 0; i < IMAGE_SIZE; i++)
+    mnist[i] = ((float)inputPicture[i]) / 255.0f;
+
+  /* start time measurement */
+  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_SET);
+
+  /* run neural network to get a prediction of inputPicture */
+  pred = MX_X_CUBE_AI_Process(mnist);
+
+  /* stop time measurement */
+  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_RESET);
 
+  return pred;
+}
 /* USER CODE END 0 */
 
 /**
@@ -103,10 +183,7 @@ void MX_UART4_Init(void);
 int main(void)
 {
   /* USER CODE BEGIN 1 */
-  uint8_t pred;
-  uint16_t i;
-  float mnist[IMAGE_SIZE * 2];
-  uint8_t inputPicture[IMAGE_SIZE * 2];
+
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -122,6 +199,7 @@ int main(void)
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
+  MX_DMA_Init();
   MX_UART4_Init();
 
   /* USER CODE END SysInit */
@@ -136,45 +214,13 @@ int main(void)
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
+  ai_pipeline_init(&uart_transport, process_picture, FIRMWARE_ID);
+  ai_pipeline_start();
+
+  /* the next picture is received while the network runs */
   while (1)
   {
-    /* receive command */
-    if (HAL_UART_Receive(&huart4, &pred, 1, 200) != HAL_OK)
-      continue;
-
-    switch (pred - 0)
-    {
-    case 's':
-      /* handshake: receive 's' return 'X' */
-      pred = 'X' + 0;
-      HAL_UART_Transmit(&huart4, &pred, 1, 1000);
-      pred = 2;
-      HAL_UART_Transmit(&huart4, &pred, 1, 1000);
-      break;
-
-    case 'c':
-      /* receive a picture from host */
-      if (HAL_UART_Receive(&huart4, inputPicture, IMAGE_SIZE, 200) == HAL_OK)
-      {
-
-        /* scale into float range [0, 1] */
-        for (i = 0; i < IMAGE_SIZE; i++)
-          mnist[i] = ((float)inputPicture[i]) / 255.0;
-
-        /* start time measurement */
-        HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_SET);
-
-        /* run neural network to get a prediction of inputPicture */
-        pred = MX_X_CUBE_AI_Process(mnist);
-
-        /* stop time measurement */
-        HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_RESET);
-
-        /* return the prediction */
-        HAL_UART_Transmit(&huart4, &pred, 1U, 1000);
-      }
-      break;
-    }
+    ai_pipeline_poll();
   }
   /* USER CODE END WHILE */
 }
@@ -297,8 +343,38 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 }
 
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Stream2_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
+
+}
+
 /* USER CODE BEGIN 4 */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == UART4)
+  {
+    ai_pipeline_rx_cplt();
+  }
+}
 
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == UART4)
+  {
+    ai_pipeline_rx_error();
+  }
+}
 /* USER CODE END 4 */
 
 /**
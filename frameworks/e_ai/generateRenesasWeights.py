@@ -21,21 +21,96 @@ issues are fixed!
 import numpy as np
 import tensorflow as tf
 
+# --------------------------------------------------------------------------------------------------
+# int8 quantization (DNN_INT8)
+# --------------------------------------------------------------------------------------------------
+# the input pixels are the uint8 image shifted to int8
+INPUT_SCALE = 1 / 255
+INPUT_ZERO_POINT = -128
+# percentiles of the largest output of each calibration image, which bound the output range
+OUTPUT_PERCENTILES = (0.1, 99.9)
+
+
+def quantize_multiplier(real_multiplier):
+    """ Returns multiplier and shift of real_multiplier = multiplier * 2^(shift - 31) """
+    mantissa, shift = np.frexp(real_multiplier)
+    multiplier = int(np.round(mantissa * (1 << 31)))
+    if multiplier == (1 << 31):
+        multiplier //= 2
+        shift += 1
+    return multiplier, int(shift)
+
+
+def output_range(kernel, bias, x):
+    """ Returns the range of the dense layer output on the calibration data x.
+    Only the largest output of an image is its prediction, the range is the one of these,
+    so the 256 steps resolve the outputs which compete for it. The outputs below saturate,
+    their softmax is 0 anyway, and the few above the percentile saturate as well """
+    out = (x.dot(kernel) + bias).max(axis=1)
+    return np.percentile(out, OUTPUT_PERCENTILES[0]), np.percentile(out, OUTPUT_PERCENTILES[1])
+
+
+def quantize_dense(kernel, bias, x):
+    """ Returns the int8 weights (F x D), the int32 biases, the requantization
+    (multiplier, shift, zero point) and the scale of the output of a dense layer """
+    kernel = kernel.astype(np.float64)
+    bias = bias.astype(np.float64)
+    # weights: symmetric, per layer
+    weight_scale = np.abs(kernel).max() / 127
+    weights = np.clip(np.round(kernel / weight_scale), -127, 127).astype(np.int64)
+    # biases: scale of the products, the zero point of the input is folded in
+    biases = np.round(bias / (INPUT_SCALE * weight_scale)).astype(np.int64) \
+        - INPUT_ZERO_POINT * weights.sum(axis=0)
+    # output: asymmetric over the range, which includes 0
+    out_min, out_max = output_range(kernel, bias, x)
+    out_min, out_max = min(out_min, 0), max(out_max, 0)
+    out_scale = (out_max - out_min) / 255
+    out_zero_point = int(np.clip(np.round(-128 - out_min / out_scale), -128, 127))
+    multiplier, shift = quantize_multiplier(INPUT_SCALE * weight_scale / out_scale)
+    return np.transpose(weights), biases, (multiplier, shift, out_zero_point), out_scale
+
+
+def softmax_exp_table(in_scale):
+    """ Returns exp(-i * in_scale) in Q15 for the int8 softmax, i = 0..255 """
+    return np.round(np.exp(-np.arange(256) * in_scale) * (1 << 15)).astype(np.int64)
+
+
 # --------------------------------------------------------------------------------------------------
 # write weights in renesas format
 # --------------------------------------------------------------------------------------------------
 model = tf.keras.models.load_model('../neural_networks/mnist_min.h5')
 W = model.get_weights()
+# calibration data for the output range of the int8 layer
+(X_TRAIN, _), (_, _) = tf.keras.datasets.mnist.load_data()
+X_CALIB = X_TRAIN.reshape(X_TRAIN.shape[0], -1) / 255
 FP = 'target/Inc/weights.h'
 with open(FP, 'w') as f:
     f.write('#ifndef WEIGHTS_H_\n#define WEIGHTS_H_\n')
-    f.write('TPrecision ip1_weights[] = {')
-    np.transpose(W[0]).tofile(f, sep=", ", format="%.12f")
+    # the keras kernel is D x F, which is the transposed layout innerproduct() reads.
+    # it is written as it is and stays in flash, dnn_compute() does not transpose it.
+    f.write('const TPrecision ip1_weights_trans[] = {')
+    W[0].tofile(f, sep=", ", format="%.12f")
     f.write('};\n')
 
-    f.write('TPrecision ip1_biases[] = {')
+    f.write('const TPrecision ip1_biases[] = {')
     np.transpose(W[1]).tofile(f, sep=", ", format="%.12f")
     f.write('};\n')
+
+    # int8 network, only the one of the build is linked
+    weights, biases, quant, out_scale = quantize_dense(W[0], W[1], X_CALIB)
+    f.write('const TQuant ip1_weights_int8[] = {')
+    weights.tofile(f, sep=", ", format="%d")
+    f.write('};\n')
+
+    f.write('const TsInt ip1_biases_int32[] = {')
+    biases.tofile(f, sep=", ", format="%d")
+    f.write('};\n')
+
+    f.write('const TQuantParams ip1_quant = {%d, %d, %d};\n' % quant)
+
+    f.write('const TuShort softmax1_exp_table[] = {')
+    softmax_exp_table(out_scale).tofile(f, sep=", ", format="%d")
+    f.write('};\n')
     f.write('#endif\n')
 
 print('\n\n Done \n\n')
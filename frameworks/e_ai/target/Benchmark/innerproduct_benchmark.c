@@ -0,0 +1,112 @@
+/*
+innerproduct_benchmark :
+	Measures innerproduct() on the host against the triple loop it replaced, which is kept
+	below as the reference. The shapes are the mnist dense layer, batches of it (N > 1) and
+	layers with F not a multiple of 8, where the last tile overlaps the one before. The data
+	is random, both run on the same, the outputs have to be the same bit for bit.
+	The vectors of the host are the ones of OPT, e.g. OPT="-O2 -mavx" for AVX.
+
+	make -f Makefile.host innerproduct [RUNS=n]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Typedef.h"
+#include "layer_graph.h"
+
+#define MAX_SIZE	(8 * 784)
+
+static TPrecision data[MAX_SIZE];
+static TPrecision weight_trans[MAX_SIZE * 4];
+static TPrecision biases[64];
+static TPrecision out_ref[MAX_SIZE];
+static TPrecision out[MAX_SIZE];
+
+/* N, D, F */
+static const TsInt shapes[][3] = {
+	{1, 784, 10},
+	{4, 784, 10},
+	{7, 784, 10},
+	{1, 784, 8},
+	{3, 100, 13},
+	{5, 37, 3},
+	{8, 64, 24},
+	{6, 256, 21},
+};
+
+static double now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* the innerproduct() before it was tiled */
+static void innerproduct_ref(const TPrecision *data,const TPrecision *weight_trans, const TPrecision *biases,TPrecision *out,TsInt *shapes){
+	TsInt iRow, iColumn;
+	TsInt iInneritr;
+	TsInt N = shapes[0];
+	TsInt D = shapes[1];
+	TsInt F = shapes[2];
+	TPrecision dSum = 0;
+
+	for(iRow=0; iRow<N; iRow++)
+	{
+		for(iColumn=0; iColumn<F; iColumn++)
+		{
+			dSum = 0;
+			for(iInneritr=0; iInneritr<D;iInneritr++)
+			{
+				dSum += data[(iRow*D)+iInneritr] * weight_trans[(iInneritr*F)+iColumn];
+			}
+			out[(iRow*F)+iColumn] = dSum + biases[iColumn];
+		}
+	}
+}
+
+/* runs the layer runs times and returns the time per input row in ns */
+static double run(void (*layer)(const TPrecision *, const TPrecision *, const TPrecision *, TPrecision *, TsInt *),
+		TPrecision *output, TsInt *shape, TsInt runs)
+{
+	TsInt r;
+	double start = now();
+
+	for(r = 0; r < runs; r++)
+		layer(data, weight_trans, biases, output, shape);
+	return (now() - start) / ((double)runs * shape[0]) * 1e9;
+}
+
+int main(int argc, char **argv)
+{
+	TsInt runs = argc > 1 ? atoi(argv[1]) : 1000;
+	TsInt i, s, mismatch, mismatches = 0;
+	double t_ref, t_tiled;
+
+	srand(1);
+	for(i = 0; i < MAX_SIZE; i++)
+		data[i] = (TPrecision)rand() / RAND_MAX;
+	for(i = 0; i < MAX_SIZE * 4; i++)
+		weight_trans[i] = (TPrecision)rand() / RAND_MAX - 0.5f;
+	for(i = 0; i < 64; i++)
+		biases[i] = (TPrecision)rand() / RAND_MAX - 0.5f;
+
+	printf("   N     D     F   triple loop      tiled\n");
+	for(s = 0; s < (TsInt)(sizeof(shapes) / sizeof(shapes[0])); s++)
+	{
+		/* the shapes of the network are N, D, F, D */
+		TsInt shape[4] = {shapes[s][0], shapes[s][1], shapes[s][2], shapes[s][1]};
+		TsInt size = shape[0] * shape[2];
+
+		memset(out, 0, sizeof(out));
+		t_ref = run(innerproduct_ref, out_ref, shape, runs);
+		t_tiled = run(innerproduct, out, shape, runs);
+		mismatch = memcmp(out, out_ref, size * sizeof(TPrecision)) != 0;
+		mismatches += mismatch;
+		printf("%4d  %4d  %4d   %8.1f ns  %8.1f ns  (%.1fx)%s\n", shape[0], shape[1], shape[2],
+				t_ref, t_tiled, t_ref / t_tiled, mismatch ? "  mismatch" : "");
+	}
+	printf("mismatches          %8d\n", mismatches);
+	return mismatches != 0;
+}
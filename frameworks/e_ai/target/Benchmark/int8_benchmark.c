@@ -0,0 +1,193 @@
+/*
+int8_benchmark :
+	Compares the int8 network (dnn_compute_int8()) with the float one (dnn_compute()) on the
+	host: the time per image and how often both predict the same class. The images are
+	digits drawn like the mnist ones, strokes of random width, slant and position in the
+	20 x 20 box centered in the 28 x 28 image. The benchmarks are built with
+	DNN_ARGMAX_ONLY, the predictions are the argmax of the logits. Ties of the int8 logits,
+	which go to the lowest class, are counted apart.
+
+	make -f Makefile.host int8 [INT8_RUNS=n]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "Typedef.h"
+#include "layer_shapes.h"
+
+#define CLASSES		10
+#define IMAGES		2000
+#define SIDE		28
+#define PIXELS		(SIDE * SIDE)
+#define MAX_POINTS	16
+
+/* the minimal agreement of the int8 and float predictions, the int8 weights alone
+   change about 0.6 % of the predictions of these images */
+#define MIN_AGREEMENT	0.985
+
+/* the digits as one stroke through the points, in a unit box with x to the right and y down */
+typedef struct {
+	float x, y;
+} point_t;
+
+#define END	{-1, -1}
+
+static const point_t strokes[CLASSES][MAX_POINTS] = {
+	{{0.5f, 0.0f}, {0.8f, 0.15f}, {0.9f, 0.5f}, {0.8f, 0.85f}, {0.5f, 1.0f}, {0.2f, 0.85f}, {0.1f, 0.5f}, {0.2f, 0.15f}, {0.5f, 0.0f}, END},
+	{{0.35f, 0.15f}, {0.55f, 0.0f}, {0.55f, 1.0f}, END},
+	{{0.15f, 0.25f}, {0.35f, 0.03f}, {0.7f, 0.03f}, {0.85f, 0.25f}, {0.75f, 0.5f}, {0.15f, 1.0f}, {0.9f, 1.0f}, END},
+	{{0.15f, 0.1f}, {0.7f, 0.0f}, {0.85f, 0.25f}, {0.45f, 0.5f}, {0.85f, 0.72f}, {0.7f, 0.97f}, {0.15f, 0.92f}, END},
+	{{0.7f, 1.0f}, {0.7f, 0.0f}, {0.1f, 0.7f}, {0.9f, 0.7f}, END},
+	{{0.85f, 0.03f}, {0.25f, 0.03f}, {0.2f, 0.45f}, {0.65f, 0.42f}, {0.85f, 0.68f}, {0.7f, 0.95f}, {0.15f, 0.93f}, END},
+	{{0.75f, 0.0f}, {0.35f, 0.35f}, {0.15f, 0.75f}, {0.35f, 1.0f}, {0.7f, 0.97f}, {0.82f, 0.72f}, {0.6f, 0.53f}, {0.2f, 0.7f}, END},
+	{{0.1f, 0.03f}, {0.9f, 0.03f}, {0.4f, 1.0f}, END},
+	{{0.5f, 0.5f}, {0.8f, 0.3f}, {0.7f, 0.05f}, {0.5f, 0.0f}, {0.3f, 0.05f}, {0.2f, 0.3f}, {0.5f, 0.5f}, {0.85f, 0.72f}, {0.7f, 0.97f}, {0.5f, 1.0f}, {0.3f, 0.97f}, {0.15f, 0.72f}, {0.5f, 0.5f}, END},
+	{{0.8f, 0.3f}, {0.5f, 0.55f}, {0.2f, 0.4f}, {0.25f, 0.1f}, {0.5f, 0.0f}, {0.8f, 0.15f}, {0.8f, 0.3f}, {0.7f, 1.0f}, END},
+};
+
+static unsigned char images[IMAGES][PIXELS];
+static TsInt labels[IMAGES];
+
+static double now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static float uniform(float min, float max)
+{
+	return min + (max - min) * rand() / (float)RAND_MAX;
+}
+
+/* distance of (x, y) to the segment a-b */
+static float distance(float x, float y, point_t a, point_t b)
+{
+	float dx = b.x - a.x, dy = b.y - a.y;
+	float t = ((x - a.x) * dx + (y - a.y) * dy) / (dx * dx + dy * dy + 1e-6f);
+	t = t < 0 ? 0 : (t > 1 ? 1 : t);
+	dx = a.x + t * dx - x;
+	dy = a.y + t * dy - y;
+	return sqrtf(dx * dx + dy * dy);
+}
+
+/* draws the digit into image, with a random pen, slant, size and position */
+static void draw(unsigned char *image, TsInt digit)
+{
+	point_t p[MAX_POINTS];
+	TsInt i, n, x, y;
+	float size = uniform(14, 20), slant = uniform(-0.3f, 0.3f), width = uniform(0.8f, 1.8f);
+	float cx = SIDE / 2 + uniform(-1.5f, 1.5f), cy = SIDE / 2 + uniform(-1.5f, 1.5f);
+
+	for(n = 0; n < MAX_POINTS && strokes[digit][n].x >= 0; n++)
+	{
+		float u = strokes[digit][n].x + uniform(-0.05f, 0.05f) - 0.5f;
+		float v = strokes[digit][n].y + uniform(-0.05f, 0.05f) - 0.5f;
+		p[n].x = cx + size * (0.75f * u - slant * v);
+		p[n].y = cy + size * v;
+	}
+	for(y = 0; y < SIDE; y++)
+	{
+		for(x = 0; x < SIDE; x++)
+		{
+			float d = 1e9f, ink;
+			for(i = 1; i < n; i++)
+			{
+				float di = distance(x + 0.5f, y + 0.5f, p[i - 1], p[i]);
+				d = di < d ? di : d;
+			}
+			ink = width + 0.5f - d;
+			ink = ink < 0 ? 0 : (ink > 1 ? 1 : ink);
+			image[y * SIDE + x] = (unsigned char)(ink * 255 + 0.5f);
+		}
+	}
+}
+
+/* return the class of the largest output, the lowest one of equal outputs */
+static TsInt argmax_float(const TPrecision *data)
+{
+	TsInt i, max = 0;
+	for(i = 1; i < CLASSES; i++)
+	{
+		if(data[i] > data[max])
+			max = i;
+	}
+	return max;
+}
+
+/* tie tells if other outputs are equal to the largest one */
+static TsInt argmax_int8(const TQuant *data, TsInt *tie)
+{
+	TsInt i, max = 0;
+	*tie = 0;
+	for(i = 1; i < CLASSES; i++)
+	{
+		if(data[i] > data[max])
+		{
+			max = i;
+			*tie = 0;
+		}
+		else if(data[i] == data[max])
+			*tie = 1;
+	}
+	return max;
+}
+
+int main(int argc, char **argv)
+{
+	TsInt runs = argc > 1 ? atoi(argv[1]) : 10;
+	TsInt r, s, p, tie, agree = 0, ties = 0, correct = 0;
+	TsInt classes_float[IMAGES], classes_int8[IMAGES];
+	static TPrecision input_float[PIXELS];
+	static TQuant input_int8[PIXELS];
+	TPrecision out_float[CLASSES];
+	TQuant out_int8[CLASSES];
+	double start, t_float = 0, t_int8 = 0;
+
+	srand(1);
+	for(s = 0; s < IMAGES; s++)
+	{
+		labels[s] = s % CLASSES;
+		draw(images[s], labels[s]);
+	}
+
+	for(r = 0; r < runs; r++)
+	{
+		for(s = 0; s < IMAGES; s++)
+		{
+			/* the inputs of main.c */
+			for(p = 0; p < PIXELS; p++)
+			{
+				input_float[p] = (float)images[s][p] / 255;
+				input_int8[p] = (TQuant)(images[s][p] - 128);
+			}
+			start = now();
+			dnn_compute(input_float, out_float);
+			classes_float[s] = argmax_float(out_float);
+			t_float += now() - start;
+
+			start = now();
+			dnn_compute_int8(input_int8, out_int8);
+			classes_int8[s] = argmax_int8(out_int8, &tie);
+			t_int8 += now() - start;
+			if(r == 0)
+				ties += tie;
+		}
+	}
+
+	for(s = 0; s < IMAGES; s++)
+	{
+		agree += classes_int8[s] == classes_float[s];
+		correct += classes_float[s] == labels[s];
+	}
+
+	printf("%d images, %d runs\n", IMAGES, runs);
+	printf("float network       %8.1f us\n", t_float / ((double)runs * IMAGES) * 1e6);
+	printf("int8 network        %8.1f us\n", t_int8 / ((double)runs * IMAGES) * 1e6);
+	printf("float predictions   %8d of %d as drawn\n", correct, IMAGES);
+	printf("int8 agreement      %8d of %d (%d ties of the int8 logits)\n", agree, IMAGES, ties);
+	return agree < MIN_AGREEMENT * IMAGES;
+}
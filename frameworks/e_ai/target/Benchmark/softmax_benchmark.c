@@ -0,0 +1,103 @@
+/*
+softmax_benchmark :
+	Measures the output stage of the network on the host: softmax() with exp() of libm,
+	softmax_fast() and the argmax of the logits only (DNN_ARGMAX_ONLY). The logits are
+	random, in the range of the ones of the mnist dense layer. Every variant runs on the
+	same logits, the times are per call of the output stage including the argmax.
+
+	make -f Makefile.host benchmark [RUNS=n]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "Typedef.h"
+#include "layer_graph.h"
+
+#define CLASSES		10
+#define SETS		1024
+
+static TPrecision logits[SETS][CLASSES];
+static TPrecision probs_libm[SETS][CLASSES];
+static TPrecision probs_fast[SETS][CLASSES];
+static TsInt argmax_libm[SETS];
+static TsInt argmax_fast[SETS];
+static TsInt argmax_only[SETS];
+
+static double now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static TsInt argmax(const TPrecision *data, TsInt size)
+{
+	TsInt i, max = 0;
+	for(i = 1; i < size; i++)
+	{
+		if(data[i] > data[max])
+			max = i;
+	}
+	return max;
+}
+
+/* runs the output stage over all sets, runs times, and returns the time per call in ns */
+static double run(void (*stage)(TPrecision *, TsInt), TPrecision out[SETS][CLASSES], TsInt *classes, TsInt runs)
+{
+	TsInt r, s;
+	double start, time = 0;
+
+	for(r = 0; r < runs; r++)
+	{
+		memcpy(out, logits, sizeof(logits));
+		start = now();
+		for(s = 0; s < SETS; s++)
+		{
+			if(stage != NULL)
+				stage(out[s], CLASSES);
+			classes[s] = argmax(out[s], CLASSES);
+		}
+		time += now() - start;
+	}
+	return time / ((double)runs * SETS) * 1e9;
+}
+
+int main(int argc, char **argv)
+{
+	TsInt runs = argc > 1 ? atoi(argv[1]) : 1000;
+	TsInt s, c, mismatches = 0;
+	double t_libm, t_fast, t_argmax, max_error = 0;
+	static TPrecision out[SETS][CLASSES];
+
+	srand(1);
+	for(s = 0; s < SETS; s++)
+	{
+		for(c = 0; c < CLASSES; c++)
+			logits[s][c] = (TPrecision)rand() / RAND_MAX * 30.0f - 20.0f;
+	}
+
+	t_libm = run(softmax, probs_libm, argmax_libm, runs);
+	t_fast = run(softmax_fast, probs_fast, argmax_fast, runs);
+	t_argmax = run(NULL, out, argmax_only, runs);
+
+	for(s = 0; s < SETS; s++)
+	{
+		for(c = 0; c < CLASSES; c++)
+		{
+			double error = fabs(probs_fast[s][c] - probs_libm[s][c]);
+			if(error > max_error)
+				max_error = error;
+		}
+		mismatches += (argmax_fast[s] != argmax_libm[s]) + (argmax_only[s] != argmax_libm[s]);
+	}
+
+	printf("%d classes, %d x %d calls\n", CLASSES, runs, SETS);
+	printf("softmax (libm exp)  %8.1f ns\n", t_libm);
+	printf("softmax_fast        %8.1f ns  (%.1fx, max error of a probability %.2g)\n", t_fast, t_libm / t_fast, max_error);
+	printf("argmax only         %8.1f ns  (%.1fx)\n", t_argmax, t_libm / t_argmax);
+	printf("argmax mismatches   %8d\n", mismatches);
+	return mismatches != 0;
+}
@@ -41,4 +41,15 @@ typedef double		 TDouble;
 
 typedef float TPrecision;
 
+/* int8 data of the quantized network (DNN_INT8), real value = scale * (q - zero_point) */
+typedef signed char TQuant;
+
+/* requantization of an int32 accumulator to the int8 output of a layer:
+   out = zero_point + acc * multiplier * 2^(shift - 31), multiplier in [2^30, 2^31) */
+typedef struct {
+	TsInt multiplier;
+	TsInt shift;
+	TsInt zero_point;
+} TQuantParams;
+
 #endif
\ No newline at end of file
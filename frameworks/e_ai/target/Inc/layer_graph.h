@@ -35,8 +35,11 @@ Description	: Declarations of all functions
 #ifndef FUNCTIONS_H_
 #define FUNCTIONS_H_
    
-void innerproduct(TPrecision *,TPrecision *, TPrecision *,TPrecision *,TsInt *);
+void innerproduct(const TPrecision *,const TPrecision *, const TPrecision *,TPrecision *,TsInt *);
 void softmax( TPrecision *, TsInt  );
+void softmax_fast( TPrecision *, TsInt  );
 void transpose( TPrecision *,TPrecision *,TsInt*);
+void innerproduct_int8(const TQuant *,const TQuant *, const TsInt *,TQuant *,TsInt *,const TQuantParams *);
+void softmax_int8( TQuant *, TsInt, const TuShort * );
 
 #endif
@@ -30,7 +30,17 @@
 #ifndef LAYER_SHAPES_H_
 #define LAYER_SHAPES_H_
 
+/* run the int8 network instead of the float one (make INT8=1) */
+#ifndef DNN_INT8
+#define DNN_INT8 0
+#endif
+
+/* skip the softmax, the outputs are the logits, which have the same argmax (make ARGMAX_ONLY=1) */
+#ifndef DNN_ARGMAX_ONLY
+#define DNN_ARGMAX_ONLY 0
+#endif
 
 void dnn_compute(TPrecision* input_img, TPrecision* ip1_out);
+void dnn_compute_int8(const TQuant* input_img, TQuant* ip1_out);
 
 #endif
@@ -1,5 +1,9 @@
 #ifndef WEIGHTS_H_
 #define WEIGHTS_H_
-TPrecision ip1_weights[] = {0.018667995930, 0.059371449053, -0.025514069945, -0.030562266707, -0.071564994752, -0.084544830024, -0.079564385116, -0.076922439039, -0.085307031870, -0.041354667395, 0.065358318388, 0.079380176961, 0.016916435212, -0.164530888200, -0.026671778411, -0.074697598815, -0.009639270604, 0.008743122220, -0.034359596670, -0.042144518346, -0.084212996066, 0.007669046521, 0.002151705325, 0.009229861200, -0.040067136288, -0.044752325863, -0.005247391760, 0.030985772610, -0.016799032688, -0.042251337320, -0.038342710584, 0.013296872377, -0.028118366376, -0.023391956463, 0.000424430065, -0.107378616929, -0.045708462596, -0.041817843914, -0.170169711113, 0.094182953238, 0.113302543759, 0.075228326023, -0.302513331175, 0.080345526338, -0.021703897044, 0.056644670665, -0.189680531621, -0.225364074111, -0.241257488728, -0.262499243021, -0.081518888474, 0.015146377496, 0.079833902419, -0.011083677411, -0.063341043890, 0.079714991152, 0.031253777444, 0.032514303923, -0.002335875062, 0.035963911563, 0.052836950868, -0.164594590664, -0.266673028469, -0.209267616272, -0.340938597918, -0.397833734751, -0.739445567131, -0.216504946351, -0.200665026903, -0.452844172716, -0.721890926361, -0.813230812550, -0.512231171131, -0.836532056332, -0.708374857903, -0.651004374027, -0.600087881088, -0.398342669010, -0.276868790388, -0.238671943545, -0.051953751594, 0.001133495593, 0.046977855265, -0.033008377999, 0.082551576197, -0.062390074134, -0.019621456042, 0.071789517999, -0.116349153221, -0.124795764685, -0.327280789614, -0.213609278202, -0.074091061950, -0.180279403925, -0.164118707180, -0.120240315795, -0.050314575434, -0.045494765043, 0.001703208429, -0.080460079014, 0.000448171457, -0.082364387810, -0.237114027143, -0.337490439415, -0.286988675594, -0.402581214905, -0.466781437397, -0.194545850158, -0.203291267157, -0.019876778126, -0.216474503279, 0.013127937913, -0.062647797167, -0.028705658391, 0.003087054938, -0.071418680251, -0.206720724702, -0.197653904557, -0.209334418178, -0.082830116153, 0.045632060617, 0.058179374784, -0.113877385855, 0.038722138852, -0.156356617808, 0.030031187460, -0.044431701303, 0.065632224083, -0.043471284211, 0.038802780211, -0.009103761055, -0.067550688982, -0.147716760635, -0.197323322296, 0.010490179993, -0.164341002703, -0.365861147642, -0.367927402258, -0.172754257917, -0.042509976774, -0.026113431901, 0.086147703230, -0.225293293595, -0.153959229589, -0.424649536610, -0.366256028414, -0.146474376321, -0.089421935380, -0.040501039475, 0.012961494736, -0.021907815710, -0.050094217062, 0.022640373558, 0.037747479975, 0.182991400361, 0.023680130020, 0.121546834707, 0.088776879013, 0.195628494024, 0.021397527307, -0.023073006421, -0.033232145011, -0.011700041592, -0.183849096298, -0.441391766071, -0.575763940811, -0.467468351126, -0.115931980312, 0.008327946067, -0.101540587842, -0.170204207301, -0.296464562416, -0.430560171604, -0.077919706702, -0.009873051196, 0.002946550027, -0.066439419985, -0.224345952272, 0.021220099181, -0.058119717985, -0.057958886027, 0.195799320936, 0.150805890560, 0.068953126669, 0.139795586467, 0.169638514519, 0.219389677048, 0.113910220563, 0.087671227753, 0.229182466865, 0.137506633997, -0.089346081018, -0.510910689831, -0.900333404541, -0.558169722557, -0.212668254972, 0.016010763124, -0.270118445158, -0.201054930687, -0.145114287734, -0.566865861416, -0.062613949180, 0.024628994986, -0.131911888719, -0.183179676533, -0.070719800889, 0.038291778415, 0.092514492571, 0.012764912099, 0.027333591133, 0.051137335598, -0.011030101217, 0.115569874644, 0.229559838772, 0.174652338028, 0.191195920110, -0.017911572009, 0.097641110420, 0.116494111717, 0.161463454366, -0.188783392310, -0.852886378765, -0.693037807941, -0.104245871305, 0.095242753625, -0.293150424957, -0.052338995039, -0.021031308919, -0.475818336010, -0.090794235468, -0.022098219022, -0.136720240116, -0.051797579974, 0.042757634073, 0.001995565137, -0.012167795561, 0.111237578094, 0.076438426971, 0.140435412526, 0.213574513793, 0.317015945911, 0.230964705348, 0.141704306006, 0.166252806783, 0.111446008086, 0.027596183121, 0.110286936164, 0.214355453849, -0.029595730826, -0.963766574860, -0.817524552345, -0.294146001339, -0.021398317069, -0.186949044466, 0.176697909832, -0.053317170590, -0.226652488112, -0.054340589792, -0.167418792844, -0.148563459516, -0.096489675343, -0.025683980435, 0.039982832968, -0.081425391138, -0.021482584998, 0.066458038986, 0.084680795670, 0.010041452013, 0.154970020056, 0.284025996923, 0.332219690084, 0.197179600596, 0.179104700685, -0.024848155677, 0.108407996595, 0.301119118929, 0.073793791234, -0.817535996437, -0.882678806782, -0.302991002798, -0.131748840213, -0.154698729515, 0.020516065881, -0.070310667157, -0.199444070458, -0.036489009857, -0.071466997266, -0.097912423313, -0.022253165022, 0.017163045704, -0.122545577586, 0.038133148104, -0.023460067809, 0.025086455047, 0.006819765083, -0.179643779993, -0.107983514667, 0.107965268195, 0.188546329737, 0.076289005578, 0.147586211562, 0.066075213253, 0.148787140846, 0.232124164701, 0.128966152668, -0.628343760967, -0.704290986061, -0.050258073956, -0.090676769614, 0.058921404183, -0.133724942803, -0.136652544141, -0.237030044198, -0.219854533672, -0.046229016036, -0.019364701584, -0.079254612327, -0.132166653872, -0.067433141172, 0.021030526608, -0.101070888340, -0.110355652869, -0.445858806372, -0.530313134193, -0.417805910110, -0.094792976975, -0.057716373354, 0.117877796292, 0.116035461426, 0.232104122639, 0.253197938204, 0.243584826589, 0.195844933391, -0.333906352520, -0.554842770100, -0.109910480678, -0.065621532500, 0.047976732254, 0.006560755894, -0.165340781212, -0.173763513565, -0.075140088797, 0.035316813737, 0.023092482239, -0.042770434171, -0.106871023774, -0.039544101804, -0.015754247084, -0.041595257819, -0.145103618503, -0.557223081589, -0.758094787598, -0.708629667759, -0.155357837677, -0.118684135377, -0.057205669582, 0.022221595049, 0.148530542850, 0.263750255108, 0.249866217375, 0.422553092241, -0.106827661395, -0.422495752573, -0.283374786377, -0.035166986287, 0.026234962046, -0.067796126008, -0.170378550887, -0.021535079926, -0.073617987335, 0.213093653321, 0.136528328061, 0.038585621864, 0.052254199982, 0.132708892226, 0.012831433676, 0.045594196767, -0.383009642363, -0.694553852081, -0.745211482048, -0.595762670040, -0.193393319845, -0.075709797442, -0.047818720341, -0.230364874005, 0.004434859380, 0.132449299097, 0.272929757833, 0.397446423769, 0.039146773517, -0.305672317743, -0.217921897769, -0.056037541479, -0.006164305843, -0.052162498236, -0.278746843338, -0.057348448783, 0.213486626744, 0.102737233043, 0.242612868547, 0.174574151635, 0.145822405815, 0.039945818484, 0.125607147813, 0.060793239623, -0.369612216949, -0.714058637619, -0.785742402077, -0.584518313408, -0.234511941671, -0.062557443976, -0.164467439055, 0.015838494524, 0.060387354344, 0.078489050269, 0.241587042809, 0.280492544174, 0.077902160585, -0.487221270800, -0.232325285673, -0.069581992924, 0.020051408559, -0.274330914021, -0.462542623281, 0.071542225778, 0.239969804883, 0.102564394474, 0.261666625738, 0.219372838736, 0.189126521349, 0.255873262882, 0.117554530501, -0.169808372855, -0.588623940945, -0.805862843990, -0.730445981026, -0.410598188639, -0.240515768528, 0.023905713111, -0.055603347719, 0.104129001498, -0.006790249143, 0.114568799734, 0.253328174353, 0.303219199181, -0.080634877086, -0.374869823456, -0.195283010602, -0.137779235840, -0.128168627620, -0.211549356580, -0.259587913752, -0.040000244975, 0.151048719883, 0.121199943125, 0.151843860745, 0.239698246121, 0.181861549616, 0.212594702840, 0.142013579607, -0.316632002592, -0.722629725933, -0.692569017410, -0.486313909292, -0.204117029905, -0.094007998705, 0.015923671424, -0.011873381212, 0.124900363386, 0.104463435709, 0.053069252521, 0.136430457234, -0.059069167823, -0.301384687424, -0.483887434006, -0.072156727314, 0.055924378335, -0.135686352849, -0.383503764868, -0.362524539232, 0.085027411580, 0.120821610093, 0.105712264776, 0.177879109979, 0.146168202162, 0.259879976511, 0.313664466143, 0.102868415415, -0.240281865001, -0.681342780590, -0.632921576500, -0.393683165312, -0.126036554575, -0.027266807854, -0.013136858121, -0.050065837801, 0.054816182703, 0.001240204787, 0.107309013605, 0.092624597251, -0.002774922410, -0.165528923273, -0.379351466894, 0.026813510805, -0.113798692822, -0.187196537852, -0.308108240366, -0.405616611242, -0.130672022700, -0.035630647093, 0.090743735433, 0.076810352504, 0.117406599224, 0.209384903312, 0.260302662849, 0.041021391749, -0.246088892221, -0.547465741634, -0.445699870586, -0.209972575307, -0.089064322412, -0.035717010498, 0.035158056766, -0.015806555748, -0.126977100968, 0.015322599560, 0.094990782440, -0.005326363724, -0.142453432083, -0.262898415327, -0.169704228640, -0.238750845194, 0.003106378717, 0.026545999572, -0.124385379255, -0.400733441114, -0.168871209025, -0.010562012903, 0.101947359741, 0.066838398576, 0.108878813684, 0.106448478997, 0.284180343151, 0.278515815735, 0.042362630367, -0.232594728470, -0.189077287912, -0.080783583224, -0.143737941980, 0.036800254136, -0.111806601286, -0.142627447844, 0.018003767356, -0.012358058244, 0.065208196640, -0.049322556704, -0.121921896935, -0.421182602644, -0.284949153662, -0.091829709709, -0.016714572906, 0.104439303279, -0.060053952038, -0.210885569453, -0.098286814988, 0.041871640831, -0.050253998488, -0.024121187627, 0.103334546089, 0.044538132846, 0.322929263115, 0.262831866741, 0.197580620646, 0.089109137654, 0.031534057111, -0.052935287356, -0.096738718450, -0.031279511750, -0.148012816906, -0.112102195621, -0.114567682147, -0.046512231231, -0.008987994865, -0.128964766860, -0.116742901504, -0.401119202375, -0.249381020665, -0.012107966468, -0.009589383379, -0.147566601634, -0.191235944629, -0.176327273250, -0.093796819448, -0.006402982399, 0.054551705718, 0.018783843145, -0.014278124087, 0.044697955251, 0.100126236677, 0.293033689260, 0.268618673086, 0.026981484145, 0.035647563636, -0.045293908566, -0.042753022164, -0.146783083677, -0.173071846366, -0.167842328548, -0.177483618259, 0.055071972311, -0.094320394099, -0.186035245657, -0.203857764602, -0.340345680714, 0.174064055085, 0.027386726812, 0.013248530217, 0.012087499723, -0.184004560113, -0.255376607180, -0.449124544859, -0.092637985945, -0.007730823476, -0.003443258815, 0.024624623358, 0.128648191690, 0.101023413241, 0.164536356926, 0.101137168705, 0.201649382710, 0.175479009748, 0.120365552604, 0.062828697264, -0.048382379115, -0.205318912864, -0.033223439008, -0.100522197783, -0.163772568107, -0.006487559993, -0.070498980582, -0.162034526467, -0.305718600750, 0.067549191415, 0.140237659216, -0.008367180824, 0.062537290156, -0.030973246321, -0.352153837681, -0.492591798306, -0.215151309967, -0.104839563370, 0.064986377954, 0.023088665679, 0.150783792138, 0.201928123832, 0.235738992691, 0.269229054451, 0.291533619165, 0.101026326418, 0.078162990510, 0.060207508504, -0.013591377996, -0.153080672026, -0.361515223980, -0.366683721542, -0.263191580772, -0.209901615977, -0.291352421045, -0.333325475454, -0.213920176029, -0.154133021832, -0.010477721691, -0.023412667215, 0.075653918087, -0.113185830414, -0.086932189763, -0.276848763227, -0.218701511621, -0.312433093786, -0.302769213915, -0.192095994949, -0.053290497512, -0.038658559322, -0.031071657315, 0.188463628292, 0.143224254251, 0.022883636877, -0.018083637580, -0.164029404521, -0.112371064723, -0.395696610212, -0.463958263397, -0.537666261196, -0.578941941261, -0.427384376526, -0.569055140018, -0.469232380390, -0.210314512253, -0.002304145368, -0.019749060273, 0.045821167529, 0.040385372937, -0.002750915242, -0.148944452405, -0.293934851885, -0.578276216984, -0.587685644627, -0.533481657505, -0.635196030140, -0.684954881668, -0.822732865810, -0.637488842010, -0.827667415142, -0.740915954113, -0.850029826164, -0.827506780624, -0.863364517689, -0.693364799023, -0.752830684185, -0.779650986195, -0.574612200260, -0.518496453762, -0.474145025015, -0.435582041740, -0.293335229158, 0.056615341455, 0.000532352424, 0.041824541986, 0.037907265127, 0.001095801592, -0.033722475171, -0.044724259526, -0.155690297484, -0.178334176540, -0.364394009113, -0.430303007364, -0.618655323982, -0.741170048714, -0.774325370789, -0.714354813099, -0.609513461590, -0.606997370720, -0.573058664799, -0.589863479137, -0.605344116688, -0.563989341259, -0.563216924667, -0.357842117548, -0.291852027178, -0.473926842213, -0.209144815803, -0.277165055275, -0.028845990077, 0.072192400694, -0.043689023703, -0.011376567185, -0.077066563070, -0.065027624369, -0.029889766127, 0.069450728595, -0.110858149827, -0.069498598576, -0.070255488157, -0.073892436922, -0.137570947409, -0.056065034121, -0.229509890079, -0.187544941902, -0.154172033072, -0.230900928378, -0.245944082737, -0.201863169670, -0.092373959720, -0.119595870376, -0.104425586760, -0.043351393193, -0.215970739722, -0.291401356459, -0.162816569209, -0.100580923259, 0.001566894352, 0.018939852715, -0.025469426066, 0.013279482722, 0.000447072089, -0.070190668106, 0.034806296229, -0.052220311016, 0.048653207719, -0.011683411896, -0.051696766168, -0.083123266697, -0.002751268446, -0.031057067215, 0.073986046016, 0.059553898871, 0.025504052639, -0.014830965549, -0.010430654511, -0.057336237282, 0.018706440926, 0.085530556738, -0.073550291359, 0.050696484745, -0.058888044208, 0.016283169389, -0.068080142140, -0.080872267485, -0.050949651748, -0.039886720479, 0.011696554720, 0.073228694499, 0.045213736594, -0.058163583279, -0.085971757770, -0.049467526376, -0.002637157449, 0.071674652398, -0.083483137190, -0.061460550874, -0.090378150344, -0.137600198388, -0.196122586727, -0.058006573468, -0.101654291153, -0.049199648201, 0.187106922269, 0.166304528713, -0.311332941055, -0.325378805399, -0.040335111320, -0.094471491873, -0.100157067180, -0.051871035248, -0.003725465387, -0.079840265214, -0.074986986816, -0.078647255898, -0.067339107394, 0.033867716789, 0.034501194954, -0.064790800214, 0.073802918196, -0.080461107194, -0.054212484509, -0.045838549733, -0.140480428934, -0.243283212185, -0.315776973963, -0.325105994940, -0.464784801006, -0.358971834183, -0.040513843298, 0.144439995289, 0.207229271531, 0.286443173885, 0.264836847782, -0.028333459049, -0.094126485288, -0.067475065589, -0.106769062579, -0.305843353271, -0.203341931105, -0.102741546929, -0.055987168103, 0.017774077132, -0.022426046431, 0.072362042964, 0.032083876431, 0.024996988475, 0.132100269198, 0.137032002211, -0.205015257001, -0.308588117361, -0.317528724670, -0.370287746191, -0.511806190014, -0.293288737535, -0.414609670639, -0.548031687737, -0.238293722272, -0.145786002278, -0.150865778327, 0.007348457817, 0.036530002952, -0.184652522206, -0.333059042692, -0.305358350277, -0.350975483656, -0.383793681860, -0.513386189938, -0.462890416384, -0.409659802914, -0.271185457706, -0.134918913245, 0.006506673992, 0.043975465000, 0.046140044928, 0.047837194055, 0.071389578283, 0.133448526263, 0.005852313247, -0.072647422552, -0.177953511477, -0.077990546823, -0.072560139000, -0.116854950786, -0.277117431164, -0.084933459759, 0.058770809323, 0.097574695945, -0.047692481428, -0.011208874173, -0.075261801481, -0.093327991664, 0.092490486801, 0.083584994078, 0.020633729175, -0.049106430262, -0.069567643106, -0.386280566454, -0.521194517612, -0.228713586926, -0.074482113123, 0.015427872539, 0.049749784172, 0.107126213610, 0.129634246230, 0.216079890728, 0.164022222161, 0.042654372752, -0.081394746900, -0.255216270685, -0.369413554668, -0.239915251732, -0.313391655684, -0.213949650526, -0.015434996225, -0.041003838181, 0.004365267232, -0.119471497834, -0.271613717079, -0.093560151756, -0.067546404898, 0.052485693246, 0.180312037468, 0.174891948700, 0.063561134040, -0.068096563220, -0.689814448357, -0.353952735662, -0.056906685233, -0.004260256886, -0.059557177126, -0.217038288713, -0.023336542770, 0.063551023602, -0.079730793834, -0.081048488617, -0.314440906048, -0.348847359419, -0.373603403568, -0.185444042087, -0.140626981854, -0.176607668400, -0.175713688135, -0.230384722352, -0.214533075690, -0.331892967224, -0.243884846568, -0.078438602388, -0.034091774374, 0.010397348553, 0.071612387896, 0.022375470027, -0.023093737662, -0.180064231157, -0.920245707035, -0.389670848846, -0.107164129615, 0.062926962972, -0.155291661620, -0.125126481056, -0.222979292274, 0.014265587553, -0.328797370195, -0.400333404541, -0.256309151649, -0.399644702673, -0.293521195650, -0.208877697587, -0.147068604827, -0.066658861935, -0.206283792853, -0.197946190834, -0.329146832228, -0.285536408424, -0.147204309702, -0.209155514836, -0.050038360059, -0.063655957580, -0.046272352338, -0.088360100985, -0.105720616877, -0.599339962006, -0.784951329231, -0.433275192976, -0.147901996970, -0.100193627179, -0.122818693519, -0.086064517498, -0.251811951399, -0.008917411789, -0.282445371151, -0.384746521711, -0.276652991772, -0.359782636166, -0.428124636412, -0.267678141594, -0.220542892814, -0.062686637044, 0.022068427876, 0.009390391409, 0.061314139515, -0.033424597234, -0.083058208227, -0.077515959740, -0.036688387394, -0.224394500256, -0.175949871540, -0.205270081758, -0.434237122536, -0.772990107536, -0.778815209866, -0.460606217384, -0.167962998152, -0.125590056181, -0.063606895506, -0.210242420435, -0.228141978383, -0.106602944434, -0.454219967127, -0.300093948841, -0.178531110287, -0.175696194172, -0.298337817192, -0.190716400743, -0.093034431338, -0.097838193178, 0.056015603244, 0.216196596622, 0.304127365351, 0.206338658929, -0.016528358683, -0.062452267855, -0.189335837960, -0.254473775625, -0.316437661648, -0.387119263411, -0.653677523136, -0.594073593616, -0.878806829453, -0.287778407335, -0.170089215040, -0.120734371245, 0.005479841027, -0.201825946569, -0.243395000696, -0.257902562618, -0.552274405956, -0.485027104616, -0.220612809062, -0.213818565011, -0.228722706437, -0.135645702481, 0.013894460164, -0.073732472956, 0.186607524753, 0.500326633453, 0.626372992992, 0.282581388950, -0.022332873195, -0.225467562675, -0.202635571361, -0.283990174532, -0.315343350172, -0.498396277428, -0.667467057705, -1.033917546272, -0.444216459990, -0.224533051252, 0.140836134553, 0.035849831998, 0.125745207071, 0.056523889303, -0.170562043786, -0.192681849003, -0.268410801888, -0.498798191547, -0.357541143894, -0.227336704731, -0.245982721448, -0.151594370604, -0.143112540245, -0.114517152309, 0.232534155250, 0.534618258476, 0.510767519474, 0.210961550474, -0.020177764818, -0.043030358851, -0.150662407279, -0.175125077367, -0.174898147583, -0.335057914257, -0.336624950171, -0.711083173752, -0.176931932569, -0.186380878091, 0.055020265281, 0.000316853228, -0.117296725512, -0.218428626657, -0.096961960196, -0.065509565175, -0.241902396083, -0.107823923230, -0.033757131547, -0.126535668969, -0.214902713895, -0.308943390846, -0.457294464111, -0.163497954607, 0.301222085953, 0.592491507530, 0.556329488754, 0.069799467921, -0.055839933455, -0.070371747017, -0.225300505757, -0.228155001998, -0.129531696439, -0.114698156714, -0.149626314640, -0.616686224937, -0.277889996767, -0.236739665270, 0.016852403060, 0.054430428892, -0.174059659243, -0.220680490136, 0.176999643445, 0.033508218825, -0.247844144702, -0.062960185111, -0.181272044778, -0.036677654833, -0.221344619989, -0.540179371834, -0.486423283815, -0.208856582642, 0.345164895058, 0.482983469963, 0.343226969242, 0.165179878473, 0.003653986845, -0.197931110859, -0.314982235432, -0.273075789213, -0.164754152298, -0.293709725142, -0.547594249249, -0.657980084419, -0.395678997040, -0.216313302517, -0.133849784732, -0.109529219568, -0.033007480204, 0.120114609599, 0.178852498531, 0.194027930498, -0.172157019377, -0.328195631504, -0.257996857166, -0.033395230770, -0.250618249178, -0.546773970127, -0.550729155540, -0.088057674468, 0.342680722475, 0.543846130371, 0.431119829416, 0.021036183462, -0.186053812504, -0.390714675188, -0.460220962763, -0.384158581495, -0.225781008601, -0.183783918619, -0.284798473120, -0.168908551335, -0.159441754222, -0.049215864390, -0.109458483756, 0.055845521390, -0.029893880710, 0.176957666874, 0.176838055253, 0.066660739481, -0.471503227949, -0.539074301720, -0.129332646728, 0.001879553311, -0.270512551069, -0.508212745190, -0.192708522081, 0.051968902349, 0.427315711975, 0.464725226164, 0.186655759811, -0.007772982586, -0.371152907610, -0.536510348320, -0.683649361134, -0.594346463680, -0.271988540888, -0.503960311413, -0.574435174465, -0.444962859154, -0.303567618132, -0.296515345573, -0.221026554704, -0.083453141153, 0.004563826602, 0.200007230043, -0.172732472420, -0.109663933516, -0.424484729767, -0.483740270138, -0.312801033258, -0.247864037752, -0.158220008016, -0.114606536925, -0.213051185012, -0.071881815791, 0.324015200138, 0.449610292912, 0.081328570843, -0.216531962156, -0.588499426842, -0.548769474030, -0.536029100418, -0.396452635527, -0.204145252705, -0.404261231422, -0.440986841917, -0.241219982505, -0.461429595947, -0.195183217525, -0.302688449621, 0.026107005775, 0.048462796956, 0.079538971186, -0.218245938420, -0.161002203822, -0.599486172199, -0.632687687874, -0.537160456181, -0.128941208124, -0.177827104926, -0.104486748576, -0.205000028014, 0.063100770116, 0.267052382231, 0.385377854109, -0.078719541430, -0.351739257574, -0.587299406528, -0.471214205027, -0.198910474777, -0.141385972500, -0.208873838186, -0.007361719850, -0.244768232107, -0.141053840518, -0.358716577291, -0.093624912202, -0.199256837368, -0.024695273489, 0.205696687102, -0.144479840994, -0.259614259005, -0.675233602524, -0.818703651428, -0.760148227215, -0.392392516136, -0.075730562210, -0.073845058680, -0.138818800449, -0.215741723776, 0.038352310658, 0.252253115177, 0.177594378591, -0.069460555911, -0.394308209419, -0.233198896050, -0.066165208817, -0.143616333604, 0.105912037194, -0.074858285487, -0.184659734368, -0.126005843282, -0.129313170910, -0.064431570470, 0.054429292679, 0.184421151876, 0.182080462575, 0.088401228189, -0.088040359318, -0.234110459685, -0.677887678146, -0.786907494068, -0.435129165649, -0.155856013298, -0.061655879021, -0.003586582839, -0.064874626696, -0.004696262535, -0.060907293111, 0.053268823773, 0.042449161410, -0.112185314298, -0.083118729293, -0.001417065505, 0.087892629206, 0.128162652254, 0.112333431840, 0.018922094256, -0.076989606023, -0.034486867487, 0.115259252489, 0.147696703672, 0.048793166876, 0.270977079868, -0.067616827786, -0.133700847626, -0.123289525509, -0.203282162547, -0.348702400923, -0.490629881620, -0.090460337698, -0.083226628602, -0.036828424782, 0.124502055347, 0.051342561841, 0.006703981198, 0.070417381823, -0.089160867035, 0.011064142920, -0.029484216124, 0.170966282487, 0.176468312740, 0.300414621830, 0.189018994570, 0.127051740885, 0.002035655547, -0.123641192913, -0.169408932328, 0.070065341890, 0.050135180354, -0.041199643165, 0.106548033655, 0.048624906689, 0.016723996028, -0.192339822650, 0.001624465338, 0.140283524990, 0.253878206015, 0.213266879320, 0.076505951583, 0.084794439375, 0.006382486783, 0.103437758982, -0.013655425049, -0.206424087286, -0.211453199387, -0.045532625169, 0.011269079521, 0.086501620710, 0.124133259058, 0.169741123915, 0.160789474845, 0.207075908780, 0.090082436800, -0.296540141106, -0.268262803555, 0.110765881836, 0.141047522426, -0.123512513936, 0.034780669957, 0.180537045002, 0.092069759965, -0.121670864522, 0.021782863885, 0.161872670054, 0.498674422503, 0.217170655727, 0.108762390912, 0.078041367233, 0.000831713958, -0.049379318953, -0.288121163845, -0.362663656473, -0.300596565008, -0.151908054948, 0.060911841691, 0.103572905064, 0.142654836178, 0.254178911448, 0.170835673809, 0.166539520025, -0.009236478247, -0.322860926390, -0.233461737633, 0.049594338983, -0.011046605185, 0.222660958767, 0.065556608140, -0.052351817489, 0.075301013887, -0.008518832736, -0.193178057671, -0.090370185673, 0.257632732391, 0.299678444862, 0.029545463622, -0.077541321516, -0.007079944480, -0.150441691279, -0.208422034979, -0.094741508365, -0.201162755489, -0.076813757420, -0.043221738189, 0.156913712621, 0.322415411472, 0.040684517473, 0.064442925155, -0.042667850852, -0.181057319045, -0.314035207033, -0.409953117371, -0.285447090864, -0.057672947645, 0.144126445055, 0.085271544755, 0.006045550108, -0.080193690956, 0.015298640355, -0.280517309904, -0.433960676193, -0.070133358240, -0.030890872702, -0.227172404528, -0.223027393222, -0.228620603681, -0.304155170918, -0.280081629753, -0.227244615555, -0.393424481153, -0.329098135233, -0.259828120470, -0.516901016235, -0.045509707183, 0.023091962561, -0.020019693300, -0.148796260357, -0.077517583966, -0.317059874535, -0.378144532442, -0.112682409585, 0.023498225957, 0.201581522822, -0.015086583793, -0.071920171380, 0.001105166972, -0.018747746944, -0.251939594746, -0.429543584585, -0.656879603863, -0.666303277016, -0.608503758907, -0.446259796619, -0.517319858074, -0.947901606560, -1.089581251144, -0.593971610069, -0.645703554153, -0.564863622189, -0.652874350548, -0.998765707016, -0.913719475269, -0.841969907284, -0.634594857693, -0.526536047459, -0.201591402292, -0.205876842141, -0.170047581196, -0.149933144450, -0.005239645950, -0.073150135577, 0.064612425864, -0.011639885604, -0.085264876485, -0.062986806035, -0.149917557836, -0.218460753560, -0.404287695885, -0.428459018469, -0.413296669722, -0.585604131222, -0.731902718544, -0.521265983582, -0.570674479008, -0.785076200962, -0.758756995201, -0.589697897434, -0.294687479734, -0.476532548666, -0.751718938351, -0.357472240925, -0.454968303442, -0.327378898859, -0.155909821391, -0.221342623234, -0.112152457237, 0.031543977559, 0.065384082496, -0.032081343234, 0.015847399831, 0.005297258496, 0.038736037910, 0.053823612630, -0.053446456790, -0.016050156206, -0.001594838104, 0.037782527506, 0.038761880249, -0.009479341097, -0.005903806537, -0.190039038658, -0.156988233328, -0.164097651839, -0.119497500360, -0.297583311796, -0.085229590535, -0.062715545297, -0.068888977170, -0.219787493348, -0.272470951080, -0.093322567642, -0.074621096253, -0.052636269480, -0.081448666751, -0.011638268828, -0.059753105044, -0.065664872527, -0.015894152224, 0.031374752522, -0.071548394859, -0.031904246658, 0.067052297294, 0.075599111617, -0.073500633240, -0.003451921046, -0.011738210917, 0.073963753879, -0.009136199951, 0.005365237594, 0.060553811491, -0.170337080956, -0.011240878142, 0.089330121875, 0.111044235528, -0.041933968663, 0.066342718899, 0.021777942777, 0.050523720682, -0.055623546243, 0.006584294140, 0.040667198598, 0.006622672081, 0.078209914267, 0.055483736098, 0.070531807840, -0.064419642091, 0.049854777753, 0.026570364833, 0.033542782068, -0.073575705290, -0.115833356977, -0.150850176811, -0.228710666299, -0.158022776246, -0.140882238746, -0.109624706209, -0.312408596277, -0.233718693256, -0.416391521692, -0.365804165602, -0.060347709805, -0.003796007717, 0.353802144527, 0.067913837731, -0.322232156992, -0.335472553968, -0.253564119339, -0.325167834759, -0.181926950812, -0.109648935497, 0.019085921347, -0.041267205030, 0.061300076544, 0.050799451768, -0.030629977584, 0.032090984285, 0.064358144999, -0.220695614815, -0.168977290392, -0.153854921460, -0.120734810829, -0.140408173203, 0.011717699468, 0.117698445916, -0.020472301170, 0.027094421908, 0.069677978754, 0.067482024431, -0.022430261597, 0.077151313424, 0.095418259501, 0.080868497491, -0.107913941145, -0.205694228411, -0.196356326342, -0.191652521491, -0.348330825567, -0.027443425730, 0.134857848287, 0.122630149126, -0.016469888389, -0.034202083945, 0.014675095677, -0.061362754554, -0.088976368308, -0.220116719604, -0.252337396145, -0.052912387997, -0.039257783443, 0.035530358553, 0.132510334253, 0.307100117207, 0.260615795851, 0.329744756222, 0.329451292753, 0.318186610937, 0.168199092150, 0.125606164336, 0.163917675614, 0.012575652450, -0.162478223443, -0.207750141621, -0.312776774168, -0.208073675632, -0.351571172476, -0.580675661564, -0.140299066901, 0.014675681479, -0.064426496625, 0.022813364863, 0.084293060005, -0.160494968295, -0.153528556228, -0.261089831591, -0.213460803032, 0.010643961839, 0.161208227277, 0.135156258941, 0.069712549448, 0.290801435709, 0.147861123085, 0.202632501721, 0.240775406361, 0.094844788313, 0.230344042182, 0.078827328980, 0.058369062841, 0.097454696894, 0.019561115652, -0.093740507960, -0.159595683217, -0.259401649237, -0.434101939201, -0.640455484390, -0.472225457430, -0.003003361635, -0.111252829432, -0.199445039034, -0.021584115922, -0.030863326043, -0.052408035845, -0.139981567860, 0.032708521932, 0.022779423743, 0.048684425652, 0.083551347256, 0.132265642285, 0.097255647182, 0.090833604336, 0.129563987255, 0.167513921857, 0.176700219512, 0.210628956556, 0.112462840974, 0.274049490690, 0.138868644834, 0.089484497905, -0.029958931729, -0.011461798102, -0.086555689573, -0.061094909906, -0.315951794386, -0.512981832027, -0.275397956371, -0.136795476079, -0.118786230683, -0.066071487963, -0.137040123343, -0.128648981452, -0.117819644511, 0.092111602426, 0.154036000371, 0.035463292152, 0.128541305661, 0.026549547911, 0.151060044765, 0.037655536085, 0.037240084261, -0.003786769696, 0.089566804469, 0.028413260356, 0.076197773218, 0.121592916548, -0.027793431655, 0.033719167113, -0.038460042328, -0.091909125447, -0.026420144364, -0.129640892148, -0.584619939327, -0.625407040119, -0.500869870186, -0.383642047644, -0.174960598350, 0.069158963859, -0.183028906584, 0.077173538506, 0.102266125381, 0.319959312677, 0.075898066163, 0.130834370852, -0.014461672865, 0.101067736745, -0.003713351209, 0.014127023518, 0.108502790332, 0.043063901365, 0.054755471647, -0.011098722927, 0.023854205385, -0.006436596625, -0.199434950948, -0.068343877792, -0.022529970855, -0.068742543459, -0.040054351091, 0.074888892472, -0.492107927799, -0.645208299160, -0.337495505810, -0.447029262781, -0.298803538084, -0.058682132512, 0.084242321551, -0.056478947401, 0.012197962031, 0.230650469661, 0.135497659445, 0.040185965598, 0.055616524071, 0.079343497753, -0.011290499941, 0.157692179084, 0.118020378053, -0.051342945546, 0.001594973262, 0.011407839134, 0.068142123520, -0.026707334444, -0.040583092719, -0.091046661139, 0.072148136795, -0.021330853924, 0.018280528486, -0.075721785426, -0.097941853106, -0.923614621162, -1.002435922623, -0.481384634972, -0.242982521653, 0.044288754463, -0.342106521130, -0.148736029863, 0.101278305054, 0.135460197926, 0.208309531212, -0.016763076186, -0.045015983284, -0.075963005424, 0.106056518853, 0.091876365244, 0.016786083579, 0.023658543825, 0.069380089641, 0.109961688519, 0.155393332243, 0.115086615086, -0.012662408873, 0.071409568191, -0.033743098378, 0.003582319478, -0.112386174500, -0.054520428181, -0.163841292262, -0.882823348045, -0.860802173615, -0.258986622095, -0.305133044720, 0.000018124014, -0.225797966123, -0.114662565291, 0.116608537734, -0.071583390236, 0.119592078030, 0.052534282207, -0.171619385481, -0.086004890501, -0.111295200884, -0.164498701692, -0.071475483477, -0.206415936351, -0.250218838453, -0.217813581228, -0.158212080598, 0.024566577747, 0.055119358003, 0.029880670831, 0.011576637626, -0.001137561863, -0.115793280303, -0.122707724571, -0.240656405687, -0.605909407139, -0.386472016573, -0.192047178745, -0.294921845198, 0.056072127074, -0.195618480444, -0.239152982831, -0.148626670241, -0.110438793898, -0.026857398450, -0.127350464463, -0.378348469734, -0.413149863482, -0.440790891647, -0.550308465958, -0.630528330803, -0.569203197956, -0.707378387451, -0.593817234039, -0.365768343210, -0.241358891129, -0.185874715447, -0.066376343369, 0.013850861229, -0.016479954123, -0.004444922321, -0.057233873755, -0.253889828920, -0.216403082013, 0.126124650240, -0.079158701003, -0.234262034297, 0.034487668425, -0.169566124678, -0.179669082165, -0.327801436186, -0.254767268896, -0.414117425680, -0.783948838711, -0.761655211449, -0.633843779564, -0.612532436848, -0.496625393629, -0.537144422531, -0.590078592300, -0.482865184546, -0.462590366602, -0.335434764624, -0.350833982229, -0.307933688164, -0.152057006955, -0.032206520438, -0.083803296089, -0.112553119659, -0.148974865675, -0.306296139956, 0.110387086868, 0.333459377289, 0.393797725439, 0.264504253864, -0.089521914721, -0.126425072551, -0.054593149573, -0.274485945702, -0.644074499607, -0.773852586746, -0.860307514668, -0.742730140686, -0.384490191936, -0.272707819939, -0.191064819694, -0.078457728028, -0.065409213305, -0.100576005876, -0.162172555923, -0.240606516600, -0.322579443455, -0.165943622589, -0.196599423885, -0.076449476182, -0.115272223949, -0.099067263305, -0.182335212827, -0.238191798329, 0.282960265875, 0.559526860714, 0.712669789791, 0.232046872377, -0.139487043023, -0.204624563456, -0.213052079082, -0.169829800725, -0.389733970165, -0.615070223808, -0.340729892254, -0.217417389154, -0.127518206835, -0.139711573720, -0.111468590796, 0.066959619522, -0.061852995306, 0.154947847128, -0.062923111022, -0.108641050756, -0.110220506787, -0.190001577139, -0.136427298188, -0.151102200150, -0.064363881946, -0.164246305823, -0.166843906045, -0.008575768210, 0.205698698759, 0.522000193596, 0.683893084526, 0.290355026722, -0.090143300593, -0.045733485371, -0.209024727345, 0.081819497049, 0.081538870931, 0.090484187007, 0.096435241401, 0.028173726052, 0.008553157561, 0.022506944835, -0.051779843867, 0.046633847058, 0.016505181789, 0.200073406100, 0.058530718088, -0.032519046217, -0.099064834416, -0.079595640302, -0.100893467665, 0.000733195979, -0.194860562682, -0.129480019212, -0.174266204238, -0.144777566195, 0.278796017170, 0.549501895905, 0.600349128246, 0.363602519035, 0.062321722507, -0.136247128248, -0.042127430439, 0.251233667135, 0.210807442665, 0.283301085234, 0.213180840015, -0.066357672215, -0.087753519416, 0.099204003811, 0.060964711010, 0.148993954062, 0.259717673063, 0.177432820201, 0.035430505872, 0.024039136246, 0.104050904512, 0.037718068808, 0.016667727381, -0.034378439188, -0.106981351972, 0.128267928958, 0.081945307553, 0.040526576340, 0.375938385725, 0.735862374306, 0.662962377071, 0.270344972610, 0.025954902172, -0.230440691113, 0.006654180121, 0.267778366804, 0.245207712054, 0.209877356887, 0.205958187580, 0.132090136409, -0.052953336388, 0.155272379518, 0.162812933326, 0.230469286442, 0.303714424372, 0.225690558553, 0.023694010451, 0.008102076128, -0.029163345695, -0.040311567485, 0.035969238728, 0.014395121485, -0.079950198531, 0.102911338210, 0.094510927796, 0.115244410932, 0.308186501265, 0.718379378319, 0.527758896351, 0.326608210802, -0.099486738443, -0.182777985930, -0.160164952278, 0.021481370553, 0.299033254385, 0.267573714256, 0.195312798023, 0.214020773768, 0.111513219774, 0.123354047537, 0.181231871247, 0.116013698280, 0.233410045505, 0.191706329584, 0.072444453835, 0.048882819712, 0.069493807852, 0.183916285634, 0.097751632333, 0.027428152040, 0.046101026237, 0.041069123894, 0.119099378586, 0.325752615929, 0.511539459229, 0.766943871975, 0.306647062302, 0.288912862539, -0.074674732983, -0.236644864082, -0.177637577057, -0.079398646951, 0.077665597200, 0.109283074737, 0.081887699664, 0.245893716812, 0.115735143423, 0.188312530518, 0.142868980765, 0.239503577352, 0.169884800911, 0.158896312118, 0.090303100646, 0.114165857434, 0.099548436701, 0.176029503345, 0.015278608538, -0.035820074379, 0.051088422537, 0.184289515018, 0.257362067699, 0.173178374767, 0.223901540041, 0.565819263458, 0.398405075073, 0.195418238640, -0.025257073343, -0.075254447758, 0.022411687300, -0.092343978584, 0.200778454542, 0.096660874784, 0.084927029908, 0.289856106043, 0.204689189792, 0.125449866056, 0.137476295233, 0.244652152061, 0.067903652787, 0.080562509596, 0.061383698136, -0.010865794495, 0.075831301510, -0.058538325131, 0.129522994161, 0.216442450881, 0.099047839642, 0.178059488535, 0.189815238118, 0.139795526862, 0.247511550784, 0.449108541012, 0.131255045533, -0.087826013565, -0.071662627161, -0.031136337668, 0.066616393626, 0.106001488864, 0.045455195010, -0.017840456218, 0.108936190605, 0.066779695451, 0.073706671596, 0.266952484846, 0.103440120816, 0.138456061482, 0.061000335962, 0.011399385519, -0.062420360744, -0.060204684734, 0.056773878634, 0.164492934942, 0.212947592139, 0.315607815981, 0.117669224739, 0.042273249477, 0.192517280579, 0.367821961641, 0.245647326112, 0.269810527563, 0.143971800804, -0.006514090113, -0.174436748028, -0.133526101708, 0.015388466418, 0.201344132423, 0.171735823154, 0.011852595955, 0.154348850250, 0.238247245550, 0.173531636596, 0.177908271551, 0.162083208561, 0.142404243350, -0.032616339624, 0.004888983909, -0.064959675074, -0.052055489272, -0.043401148170, 0.014573941007, 0.180117025971, 0.165418624878, 0.202832877636, 0.140406012535, 0.263773500919, 0.111750967801, 0.205421790481, 0.150291457772, -0.110904455185, 0.017336256802, -0.032620020211, -0.012394443154, -0.059642750770, -0.168777853251, -0.114431396127, -0.038221344352, 0.021480491385, -0.001909951447, 0.113922730088, 0.033276509494, 0.012493004091, 0.089945405722, -0.055363830179, -0.022153008729, -0.045472901314, -0.146189197898, -0.029271442443, -0.005231271032, 0.182049423456, 0.203260719776, 0.216302722692, 0.237771481276, 0.212740540504, 0.238232299685, 0.188568145037, 0.066713333130, -0.201443016529, -0.024807680398, 0.039077393711, -0.032893016934, -0.157863035798, -0.409321248531, -0.450990200043, -0.543397843838, -0.457123756409, -0.305208504200, -0.229231506586, -0.186928093433, -0.153798878193, -0.189788162708, 0.065690487623, -0.102128408849, 0.057425979525, -0.075699597597, -0.063024252653, 0.082343630493, 0.105646051466, 0.021491652355, -0.027324995026, 0.061458088458, 0.025218131021, -0.015346908011, 0.487061768770, 0.368769913912, 0.166310787201, 0.031984016299, -0.053185977042, 0.023744314909, -0.014574675821, -0.208328545094, -0.547800123692, -0.778808891773, -0.361664742231, -0.495480686426, -0.859684646130, -0.869813263416, -0.687186479568, -0.722549080849, -0.443810045719, -0.293813347816, -0.205448776484, -0.089084200561, -0.167713090777, -0.272775143385, -0.272552430630, -0.394436597824, -0.284733951092, -0.290983408689, -0.461029231548, -0.393769055605, -0.169407263398, 0.077924698591, 0.063344433904, 0.032202839851, 0.072247304022, -0.008406311274, 0.060128606856, -0.058052878827, -0.218529790640, -0.300295710564, -0.319625526667, -0.430987685919, -0.566882848740, -0.409373134375, -0.548839390278, -0.434025824070, -0.637166619301, -0.681023478508, -0.766016006470, -0.615407049656, -0.583729326725, -0.443977326155, -0.722080886364, -0.624520301819, -0.512934565544, -0.535982847214, -0.237291380763, -0.210771128535, 0.054140273482, 0.056864250451, 0.068012334406, 0.010944813490, -0.076144136488, 0.068998865783, 0.014969736338, -0.072230100632, -0.025285854936, 0.027720075101, -0.079744040966, -0.036071542650, -0.012828222476, -0.097527422011, -0.273394137621, -0.253394454718, -0.148325830698, -0.210145562887, -0.118713490665, -0.056879315525, -0.181275591254, -0.090158648789, -0.177901327610, -0.253308951855, -0.202705755830, -0.347784996033, -0.223934918642, -0.181113511324, 0.080628283322, -0.044871479273, 0.003631360829, 0.002216100693, 0.070837847888, 0.048890821636, 0.044306732714, -0.073409751058, 0.035421513021, -0.035976976156, 0.054706089199, 0.085692860186, 0.046343944967, -0.039491690695, -0.036426510662, -0.030934974551, -0.167215555906, -0.080280736089, -0.142273500562, 0.002275194973, 0.038883067667, -0.016292832792, 0.002353236079, 0.028528556228, 0.011454746127, 0.041220299900, 0.056843124330, -0.047226831317, 0.028221301734, -0.085158199072, -0.073183245957, -0.038250129670, 0.050197891891, 0.036357581615, -0.009917557240, 0.022961907089, 0.076269924641, 0.052952688187, 0.013236791827, 0.005884860642, -0.221685752273, -0.153637006879, -0.200567424297, -0.243632420897, -0.256268888712, -0.217977687716, -0.181479543447, -0.197752028704, -0.431187480688, -0.264916360378, -0.162313699722, -0.015354009345, -0.127915948629, -0.312300741673, -0.122613608837, -0.084210328758, -0.019017986953, 0.065449722111, 0.026763133705, 0.029143609107, -0.029516499490, 0.011831745505, 0.071504265070, 0.048474118114, -0.080224432051, -0.133597090840, -0.168812379241, -0.320106238127, -0.372873365879, -0.449552357197, -0.240128636360, -0.003207281698, 0.010275404900, -0.204132735729, -0.232556596398, -0.226715952158, -0.268387377262, -0.193956509233, -0.181624755263, -0.266235023737, -0.351682513952, -0.347517669201, -0.369332641363, -0.126905828714, -0.023425161839, 0.064966857433, 0.066390730441, 0.081972546875, 0.005845904350, 0.078983761370, -0.085527621210, -0.243235781789, -0.115693509579, 0.105960845947, 0.155148774385, 0.171958625317, 0.152440845966, 0.032018508762, 0.094417370856, 0.333706766367, 0.320030987263, 0.247362270951, 0.243317350745, 0.258843690157, 0.141043826938, 0.173118248582, 0.198669597507, 0.126173868775, 0.165784239769, -0.236637219787, -0.497712254524, -0.403786003590, -0.260249733925, -0.073989197612, 0.041173007339, -0.020106159151, 0.030173480511, 0.055050600320, 0.030670098960, 0.279517740011, 0.334495812654, 0.357976883650, 0.325922429562, 0.264393150806, 0.228026449680, 0.237558946013, 0.234166041017, 0.216744512320, 0.311469346285, 0.214071705937, 0.170674636960, 0.170451298356, 0.214696511626, 0.027966801077, 0.139732390642, 0.023206189275, -0.124837271869, -0.217314630747, -0.224305868149, -0.757631838322, -0.625540912151, -0.315014749765, -0.154208347201, -0.102393656969, 0.069341368973, 0.058896042407, 0.024297470227, 0.172125160694, 0.240819260478, 0.342725664377, 0.306039124727, 0.231596693397, 0.174893051386, 0.112525716424, 0.133703306317, 0.129639253020, 0.039670173079, 0.153164774179, 0.044327974319, 0.119225658476, 0.179225459695, -0.034110095352, 0.080791391432, -0.060342337936, -0.128068029881, -0.182748600841, -0.236650124192, -0.364611566067, -0.549321055412, -0.718357741833, -0.171346768737, -0.072063185275, -0.034667972475, 0.036470372230, -0.047199215740, 0.285476535559, 0.229285404086, 0.190385073423, 0.214216068387, 0.120944209397, 0.055222876370, 0.158334359527, 0.264786928892, 0.046726159751, 0.082149691880, 0.129811823368, 0.172357574105, 0.144810602069, 0.089631766081, 0.089291751385, 0.090705320239, 0.016727374867, -0.070806391537, -0.073853231966, -0.155308604240, -0.363110780716, -0.315145760775, -0.865830361843, -0.375134825706, -0.043206352741, -0.028236402199, 0.310395121574, -0.202121794224, 0.097635403275, 0.246630355716, 0.271733134985, 0.121936127543, 0.102920316160, 0.103293024004, 0.069286070764, 0.007852321491, 0.095973536372, 0.147183150053, 0.058704908937, 0.118555627763, 0.158074304461, 0.094149544835, 0.051929611713, 0.057406056672, 0.051502082497, -0.021399861202, -0.094664908946, -0.234446033835, -0.266006886959, -0.674035072327, -0.965442299843, -0.428133040667, -0.106499254704, -0.067375928164, -0.120548620820, -0.104820519686, 0.086273506284, 0.224683806300, 0.149493426085, 0.128476291895, 0.045476168394, 0.000095936011, -0.012663577683, -0.036108590662, 0.035487316549, 0.058061968535, 0.053069896996, 0.072995565832, 0.188754871488, 0.139186769724, 0.086952984333, 0.103910364211, 0.134894251823, 0.090230889618, 0.012241986580, 0.047433353961, -0.376800924540, -0.970699667931, -1.154696822166, -0.413938105106, -0.118238106370, -0.028442561626, -0.172459453344, -0.066518977284, 0.201801151037, 0.380337983370, 0.028682067990, 0.076613560319, 0.065219283104, -0.058985475451, -0.038695164025, -0.205824270844, -0.360171467066, -0.275410830975, -0.035521175712, 0.172267213464, 0.305479198694, 0.186595082283, 0.113342307508, 0.091340817511, 0.113056883216, 0.246998116374, 0.184507071972, 0.182094916701, -0.193070784211, -1.556069731712, -0.589858651161, -0.353286832571, -0.283151745796, -0.098872639239, -0.220544904470, 0.061161428690, 0.305138975382, 0.113734208047, 0.051158621907, -0.038250196725, -0.150248706341, -0.220337867737, -0.439097285271, -0.375010699034, -0.495594531298, -0.355376631021, 0.002601902932, 0.075169622898, 0.150818511844, 0.180033490062, 0.096740037203, 0.217439115047, 0.104812912643, 0.228462815285, 0.126529082656, 0.117736794055, -0.071596540511, -1.072803616524, -0.367543101311, -0.550557971001, -0.043918527663, -0.093647122383, -0.150049388409, -0.022190535441, 0.405045807362, 0.104034185410, -0.224508300424, -0.292427062988, -0.412577688694, -0.525687932968, -0.419141799212, -0.359798014164, -0.258861362934, -0.185734227300, 0.083072692156, 0.152871772647, 0.126778468490, 0.075110517442, 0.078515209258, 0.057740561664, 0.135699734092, 0.089708857238, -0.117022439837, -0.156410872936, -0.308899551630, -0.815395355225, -0.136003345251, -0.292117059231, -0.072115622461, -0.115050472319, -0.278331458569, -0.386511206627, 0.100723981857, -0.134075835347, -0.294341385365, -0.356806367636, -0.391575455666, -0.317862242460, -0.100364252925, -0.069095313549, -0.070073753595, 0.057980407029, 0.049371495843, 0.193888977170, 0.091541670263, 0.008202302270, 0.118039250374, 0.125954225659, -0.077634163201, -0.141678586602, -0.394329696894, -0.528424620628, -0.523479163647, -0.590573072433, 0.095052778721, -0.203518480062, -0.145061120391, -0.165290743113, -0.219063237309, -0.400546222925, 0.010946798138, -0.306662470102, -0.405037850142, -0.281134963036, -0.379611909389, -0.257335692644, -0.122207932174, -0.169467836618, -0.078460574150, 0.005426578224, 0.175824776292, 0.140437856317, -0.020994473249, -0.007840956561, -0.011445367709, 0.003962338902, -0.094923682511, -0.311555683613, -0.475471764803, -0.637745916843, -0.319235146046, -0.336561083794, -0.134229630232, -0.261419236660, -0.255789816380, -0.037921298295, 0.031850550324, -0.097527600825, 0.016389541328, -0.168373018503, -0.313398510218, -0.412554025650, -0.370259135962, -0.141685903072, -0.173870697618, -0.135880559683, -0.178312852979, 0.067907556891, 0.078705847263, 0.058550555259, -0.007577968296, -0.015430011787, 0.017904845998, 0.045256502926, -0.114504046738, -0.195978239179, -0.164700672030, -0.216033026576, -0.248929142952, -0.149082049727, -0.325810372829, -0.263860523701, -0.177152812481, -0.182489976287, 0.069250583649, 0.307300120592, -0.017578851432, -0.005094696768, -0.135230794549, -0.213052749634, -0.329294234514, -0.264839053154, -0.217159375548, -0.191204115748, -0.041708204895, 0.077071391046, 0.108885653317, 0.090292073786, -0.055879451334, -0.087841965258, -0.131958305836, -0.044200167060, 0.115016780794, 0.106344468892, 0.094416216016, 0.144945010543, 0.227168112993, 0.057263750583, -0.805520176888, -0.053833514452, -0.123810648918, -0.146996498108, 0.234579548240, 0.257489681244, 0.088560223579, 0.113123431802, 0.105463981628, -0.219441071153, -0.243253201246, -0.372607707977, -0.295346856117, -0.214269638062, -0.065137133002, -0.036995600909, 0.102159291506, -0.072151936591, -0.154999434948, -0.194628745317, -0.057668253779, 0.144833236933, 0.170990124345, 0.161430418491, 0.081767350435, 0.196724370122, 0.219908520579, 0.337183982134, -0.651588380337, -0.493723899126, -0.326434463263, -0.054934464395, 0.156182661653, 0.173167943954, 0.402775108814, 0.340087532997, 0.021908856928, -0.055801011622, -0.126679331064, -0.312440633774, -0.438750386238, -0.485769867897, -0.433712184429, -0.258043825626, -0.305735707283, -0.394017159939, -0.235459417105, -0.060205291957, 0.145597845316, 0.076001033187, 0.239932537079, 0.039902623743, 0.141524687409, 0.266083091497, 0.233759775758, -0.154948085546, -0.631035387516, -0.472771227360, -0.255464285612, -0.254026830196, 0.171045139432, 0.230867058039, 0.504408121109, 0.218177363276, 0.185689613223, 0.102033033967, -0.168801426888, -0.150908797979, -0.293673336506, -0.479877740145, -0.497275739908, -0.464940726757, -0.325623154640, -0.268564790487, 0.042413812131, 0.183304622769, 0.187764182687, 0.174902990460, 0.120864719152, 0.080331049860, 0.246295854449, 0.215170189738, 0.075251884758, -0.343092858791, -0.834124982357, -0.455700457096, -0.237902671099, -0.053526513278, -0.092323310673, -0.072471722960, 0.479440242052, 0.271348685026, 0.237131476402, 0.164502561092, 0.015741238371, -0.042761918157, -0.132305726409, -0.131270423532, -0.271635204554, -0.345052361488, -0.239143744111, -0.116453990340, 0.051488220692, 0.147810205817, 0.223896309733, 0.166690886021, 0.181393712759, 0.095394574106, 0.139408379793, 0.107194550335, -0.048783995211, -0.161259114742, -0.907765984535, -0.445899426937, -0.221664130688, -0.046006593853, -0.003196011763, -0.131989151239, 0.390412151814, 0.176809728146, 0.157966181636, 0.175701469183, 0.088897250593, 0.080436721444, 0.101705826819, -0.126730695367, -0.141258627176, -0.256588101387, -0.105259567499, -0.000431261054, 0.095415703952, 0.057711318135, 0.137897238135, 0.257726997137, 0.085019640625, 0.226573511958, 0.011905045249, -0.000790606951, -0.019895389676, -0.265046745539, -0.898239910603, -0.142469257116, -0.046529542655, -0.162710905075, 0.107475571334, 0.071321092546, 0.323617875576, 0.136116743088, 0.101580001414, 0.116095557809, 0.156420245767, 0.083378858864, 0.011865938082, -0.053576987237, -0.122186928988, -0.128271624446, -0.034939594567, -0.052569597960, 0.052394367754, 0.100028179586, 0.061046019197, 0.147169575095, 0.132768645883, 0.060379501432, -0.145908191800, -0.100970029831, -0.233315125108, -0.513998568058, -0.624801754951, -0.112093031406, -0.070658892393, -0.052645854652, -0.011881994084, 0.189508005977, 0.339265316725, 0.214688256383, -0.009777890518, 0.065446779132, 0.028078719974, 0.041088368744, -0.035419944674, -0.006213862449, 0.091089099646, -0.036456175148, -0.082126393914, -0.073106095195, 0.030241696164, 0.148328244686, 0.054761450738, 0.122580088675, 0.138199090958, 0.027758792043, -0.085584342480, -0.107721455395, -0.223252594471, -0.509851932526, -0.244743570685, 0.064271762967, -0.071897588670, 0.052667386830, -0.039048105478, 0.266625523567, 0.497678518295, 0.326794028282, 0.204536974430, 0.223783493042, 0.196485012770, -0.010404991917, 0.136331200600, 0.141137242317, 0.168217778206, -0.083789288998, 0.066032543778, 0.057620123029, -0.056455299258, -0.067793451250, 0.075519010425, 0.179410129786, 0.003444098402, -0.069838806987, -0.142907157540, -0.307669818401, -0.347240507603, -0.261756986380, -0.148132756352, 0.036317825317, 0.052572019398, 0.050538472831, 0.074641652405, 0.069429554045, 0.372076183558, 0.369349807501, 0.261562973261, 0.370326191187, 0.376632809639, 0.205198705196, 0.144276887178, 0.269480228424, 0.202696278691, 0.251320689917, 0.189049124718, 0.197528555989, 0.076612763107, 0.114724539220, 0.050297975540, -0.129451543093, -0.175052732229, -0.163268700242, -0.135079577565, -0.133230283856, -0.116129837930, -0.234422251582, -0.260704725981, -0.086925752461, 0.082114912570, 0.044461645186, 0.045982174575, 0.155703231692, -0.137795075774, -0.056570902467, 0.185235798359, 0.271575868130, 0.363387316465, 0.522244155407, 0.544429838657, 0.445621997118, 0.407336384058, 0.472278982401, 0.333900600672, 0.193804785609, 0.085586912930, 0.116258017719, 0.015523590147, 0.019919425249, 0.162615284324, -0.139690056443, -0.218401849270, -0.069645084441, -0.325740367174, -0.210523739457, -0.066359385848, -0.059879899025, -0.083927832544, -0.003645077348, 0.055880151689, -0.012681327760, -0.159107431769, -0.169351324439, 0.025891376659, -0.014980412088, -0.063331052661, -0.053931344301, -0.241210281849, -0.077731229365, -0.163966700435, -0.159341037273, -0.171442329884, -0.180955618620, -0.147035688162, -0.007407695055, -0.084844917059, 0.020623957738, -0.024823363870, 0.028459571302, -0.069082878530, -0.145039826632, -0.282242834568, 0.052165269852, 0.028587857261, -0.035497676581, -0.067880868912, 0.048101402819, -0.054430317134, 0.010365664959, -0.075213909149, -0.011430462822, -0.117540799081, -0.162066668272, -0.150174662471, -0.239744096994, -0.342992931604, -0.527727603912, -0.614517271519, -0.448354333639, -0.500953614712, -0.506235897541, -0.604348480701, -0.576023817062, -0.505747795105, -0.371053427458, -0.369777262211, -0.342590153217, -0.291711419821, -0.139999151230, -0.040137041360, -0.006211437285, -0.008095286787, 0.008400633931, -0.056085124612, 0.063643805683, 0.071395300329, 0.084791935980, 0.040876246989, 0.031761981547, 0.006926797330, 0.009038545191, 0.076696075499, 0.052013330162, -0.047977134585, 0.012753471732, 0.084099911153, -0.130794361234, -0.164462089539, -0.105478882790, -0.015343267471, 0.055115811527, 0.031107656658, 0.027984797955, 0.053577043116, -0.025235332549, -0.070907771587, 0.044143311679, -0.084425449371, -0.064099416137, 0.080992199481, -0.002522811294, 0.024882249534, -0.030579511076, -0.047453235835, -0.057001128793, -0.036450721323, -0.067355968058, -0.086758866906, -0.245441898704, -0.240247964859, -0.254923045635, -0.422309815884, -0.293918341398, -0.445806533098, -0.611056566238, -0.468460768461, -0.220372974873, -0.352624356747, -0.455063253641, -0.456097424030, -0.432724833488, -0.213295936584, -0.260125219822, -0.210380792618, -0.150722250342, -0.129206016660, -0.026913642883, 0.036813728511, -0.024607557803, -0.059182222933, -0.011871702969, 0.082968287170, -0.107512116432, -0.143524855375, -0.256517827511, -0.093850083649, -0.307055026293, -0.399575352669, -0.469006627798, -0.641293048859, -0.705654442310, -0.984871745110, -0.885772466660, -0.536983370781, -0.480379790068, -0.544726014137, -0.493658691645, -0.485097169876, -0.813077032566, -0.624639570713, -0.511922895908, -0.291212141514, -0.217588320374, -0.362077683210, -0.317189633846, -0.027068784460, 0.039812631905, 0.074663601816, -0.021787248552, -0.049981664866, -0.049896996468, -0.190714821219, -0.324447274208, -0.380910754204, -0.405288130045, -0.324509203434, -0.465283274651, -0.691861152649, -0.662271261215, -0.715743064880, -0.917666792870, -1.022002816200, -0.714780628681, -0.644297897816, -0.564842760563, -0.417071223259, -0.393489867449, -0.199639186263, -0.097027964890, 0.009824882261, -0.033929549158, -0.017388740554, -0.214048787951, -0.186484619975, -0.145086362958, -0.047155886889, -0.076109252870, -0.028801277280, 0.027307944372, -0.191666796803, 0.109288685024, 0.090436659753, -0.243231728673, -0.184152320027, -0.286443501711, -0.289473205805, -0.562568366528, -0.422278165817, -0.393590360880, -0.239234551787, -0.287566393614, -0.394590973854, -0.232544258237, -0.114494584501, -0.207764849067, 0.144290566444, 0.184280604124, 0.193554922938, 0.338245630264, 0.249610722065, 0.276100546122, -0.115199431777, -0.130235433578, -0.188947007060, -0.027285851538, -0.045482300222, -0.267768889666, -0.084339246154, 0.208409816027, 0.072030089796, 0.038417402655, -0.056374859065, -0.106783866882, -0.083681337535, -0.137834683061, -0.130566373467, -0.165205657482, -0.235059678555, -0.068628877401, -0.068689353764, 0.026820667088, -0.019436515868, 0.049405246973, 0.052744761109, 0.041771911085, 0.000137919138, 0.225536882877, 0.356030017138, 0.136342063546, -0.132060155272, -0.228875309229, -0.216665372252, -0.026398405433, -0.098359510303, -0.333001554012, -0.238864153624, 0.116031795740, 0.097060881555, -0.055126730353, 0.025458887219, 0.006981987506, -0.009796452709, -0.184131652117, -0.272655427456, -0.289190560579, -0.412606477737, -0.426943957806, -0.404416322708, -0.426294535398, -0.239974468946, -0.290018290281, -0.101292803884, -0.093476183712, -0.075117945671, 0.101252533495, 0.303662210703, 0.077754296362, -0.208807900548, -0.048772554845, -0.355106681585, 0.030038997531, -0.120803914964, -0.291580706835, -0.117738649249, 0.104531623423, 0.120138265193, 0.047090012580, 0.022198030725, -0.061136465520, -0.040075637400, -0.175023630261, -0.258452534676, -0.345600187778, -0.389914810658, -0.474939256907, -0.436694651842, -0.384977579117, -0.334456682205, -0.202909082174, -0.147916957736, -0.160445481539, -0.079113475978, 0.085734970868, 0.166638419032, 0.046607788652, -0.080404207110, 0.054905191064, -0.403614819050, -0.052168305963, -0.179559871554, -0.098514012992, -0.173279538751, 0.040980681777, 0.076891131699, -0.008410026319, 0.022676993161, -0.153993815184, -0.036701388657, -0.133904635906, -0.151439204812, -0.206565737724, -0.299200326204, -0.437322676182, -0.474147439003, -0.304091066122, -0.192760288715, -0.122963003814, -0.110283516347, -0.041311997920, -0.074119120836, -0.028037967160, -0.037311311811, -0.148244082928, -0.134180232882, -0.223955616355, -0.210451066494, -0.150941684842, -0.221157029271, -0.072339065373, -0.479716539383, -0.344579309225, -0.091733984649, -0.178201198578, -0.139742851257, -0.092104397714, -0.088172584772, -0.098134145141, -0.132297769189, -0.074333943427, -0.223724514246, -0.509476900101, -0.431515932083, -0.058598194271, -0.152936741710, -0.045342307538, -0.056721199304, -0.008245340548, 0.007581822574, -0.116313144565, -0.127354234457, -0.485361635685, -0.423067748547, -0.453651666641, -0.260308951139, -0.137071311474, -0.225170791149, -0.352554976940, -0.478238165379, -0.203394293785, -0.276245981455, -0.205655544996, -0.128511562943, -0.061454694718, 0.070371232927, 0.021382415667, 0.061715438962, 0.116871245205, -0.249505177140, -0.675821185112, -0.270922690630, -0.043795868754, 0.081815235317, -0.006029657554, -0.055825904012, -0.118602678180, -0.098097749054, -0.104224592447, -0.487821757793, -0.543066382408, -0.610571086407, -0.446778267622, -0.276593357325, -0.142740920186, -0.355551511049, -0.442499846220, -0.242586269975, -0.191752359271, -0.104489728808, -0.043582227081, 0.070447474718, 0.147307604551, 0.235335171223, 0.218696355820, 0.226781278849, 0.281061887741, -0.424584329128, -0.715321898460, 0.046688422561, 0.231729477644, 0.057367358357, -0.007901136763, -0.109043389559, -0.186962127686, -0.108056999743, -0.212620586157, -0.475553363562, -0.734640836716, -0.568384110928, -0.368856102228, -0.181661158800, 0.063358254731, -0.304124385118, -0.439686447382, -0.240804523230, -0.373343646526, -0.096517316997, 0.051171679050, 0.191518157721, 0.170716136694, 0.271244198084, 0.352406352758, 0.435727804899, 0.520963490009, -0.183624595404, -0.361175715923, 0.066959746182, 0.302931278944, 0.140279665589, 0.003152494319, 0.026841783896, 0.094957537949, 0.114576354623, 0.066113226116, -0.326649606228, -0.224763140082, -0.215563073754, -0.307707935572, -0.269056826830, -0.024683548138, -0.172330543399, -0.296770542860, -0.296800553799, -0.068622104824, 0.164080217481, 0.306228399277, 0.272458612919, 0.321543425322, 0.330400109291, 0.350374042988, 0.581744730473, 0.287895083427, -0.143074795604, -0.081063635647, 0.209515348077, 0.247861504555, 0.190497741103, 0.227586224675, 0.127563014627, 0.175956442952, 0.189327418804, 0.214841410518, -0.131689652801, -0.269597709179, -0.104786403477, -0.266164600849, -0.137434914708, -0.191204532981, -0.098347961903, -0.372908502817, -0.117665983737, 0.283559799194, 0.238187938929, 0.234653547406, 0.252121955156, 0.247917383909, 0.213596105576, 0.300913900137, 0.351514816284, 0.172183066607, -0.129679813981, -0.040600318462, 0.056060478091, 0.331422328949, 0.435429722071, 0.182480201125, 0.212603554130, 0.228912800550, 0.058445490897, 0.002349418355, -0.213319838047, -0.221555814147, -0.250684350729, -0.482591807842, -0.237085536122, -0.066369585693, 0.086918585002, 0.172899812460, 0.068699821830, 0.192762792110, 0.174232602119, 0.225415974855, 0.219752803445, 0.371921390295, 0.244749501348, 0.117019340396, 0.249373197556, 0.104049354792, -0.101053006947, 0.020322406664, 0.295286446810, 0.427162617445, 0.293875366449, 0.204684540629, 0.201930388808, 0.015141543932, 0.024538515136, 0.002403597580, -0.117410235107, -0.568608462811, -0.442126929760, -0.076494529843, -0.155243590474, -0.171875715256, 0.008832298219, -0.244692295790, -0.208124071360, -0.265081703663, -0.060514643788, 0.026186572388, 0.261691927910, 0.258567154408, 0.130457654595, 0.049632627517, 0.020880457014, -0.052896056324, -0.011458977126, 0.211183160543, 0.379788488150, 0.424097508192, 0.197195842862, 0.172098711133, 0.089777052402, 0.099733777344, 0.041770860553, 0.025941452011, -0.242875993252, -0.420226275921, -0.449604004622, -0.328221976757, -0.277577519417, 0.063622452319, -0.022368960083, -0.052728559822, -0.489281505346, -0.297740668058, -0.217365950346, -0.039027847350, 0.096898853779, 0.216192424297, 0.099934674799, -0.099755600095, -0.038799207658, -0.008357638493, 0.220573037863, 0.393236249685, 0.357665717602, 0.262878388166, 0.155416622758, 0.075636096299, -0.026598267257, -0.025072671473, 0.021402793005, -0.143224477768, -0.231189042330, -0.314932256937, -0.632568895817, -0.249601349235, -0.223724901676, -0.265779137611, 0.048270504922, -0.048605278134, -0.369988739491, -0.270006775856, -0.140540495515, -0.152585282922, -0.077885329723, 0.043844919652, -0.064593844116, -0.156482994556, -0.101597383618, 0.026847036555, 0.198045387864, 0.160142242908, 0.238102674484, 0.115330316126, -0.047655116767, -0.060569029301, -0.153653979301, -0.039896585047, -0.026127424091, -0.368064373732, -0.227643117309, -0.363176137209, -0.555408060551, -0.168477892876, -0.076704896986, -0.084865078330, -0.192389354110, -0.116640456021, -0.113047599792, -0.244397535920, -0.093139439821, -0.131878837943, -0.284478873014, -0.300199806690, -0.433266192675, -0.405941188335, -0.325862348080, -0.216153725982, -0.156018406153, 0.101046845317, 0.103318855166, 0.018700519577, -0.120536118746, -0.158234283328, -0.151755735278, -0.210807114840, -0.181686580181, -0.536555886269, -0.492044746876, -0.410278081894, -0.556584596634, -0.089022487402, -0.032776091248, 0.007387489080, -0.105257548392, -0.059043664485, -0.072284840047, -0.199596360326, -0.405484825373, -0.301942616701, -0.449861854315, -0.462319254875, -0.402346372604, -0.437708377838, -0.311157405376, -0.230841994286, -0.221102774143, -0.074783913791, 0.014079054818, 0.027005912736, -0.064450293779, -0.100448302925, -0.187302216887, -0.220846921206, -0.089936502278, -0.271545916796, -0.475185930729, -0.442711681128, -0.394894182682, -0.219565033913, -0.136152833700, 0.031103145331, 0.002598490566, -0.084173478186, -0.307610869408, -0.355737566948, -0.224200591445, -0.603401243687, -0.536915183067, -0.270931005478, -0.231728658080, -0.182912558317, -0.126765847206, -0.264237523079, -0.252608567476, -0.108757458627, -0.108746543527, -0.092323832214, -0.020803250372, -0.025588091463, -0.120402224362, -0.043542828411, -0.082791365683, -0.163287088275, -0.135888755322, -0.164773702621, -0.315448850393, -0.164102002978, -0.072326749563, 0.016799192876, 0.047283381224, -0.001600021962, -0.397506445646, -0.463716775179, -0.575159788132, -0.408763587475, -0.289064496756, -0.211258009076, -0.261341601610, -0.138423725963, -0.192014768720, -0.156803965569, -0.208499655128, -0.164136230946, -0.058059964329, -0.057327814400, -0.021301563829, -0.014812430367, 0.073787659407, 0.109099440277, 0.116040565073, 0.027157811448, -0.108837135136, -0.085589811206, -0.284345805645, 0.087119802833, 0.001828674227, 0.038772456348, -0.083711169660, 0.018762504682, -0.192874729633, -0.457163512707, -0.498757898808, -0.141404852271, -0.161448210478, -0.024773949757, -0.037284616381, -0.064459219575, -0.086596794426, -0.182642832398, -0.144284203649, -0.092293784022, -0.042528923601, 0.024174017832, 0.048089127988, 0.189566582441, 0.081833720207, 0.136012405157, 0.119891099632, -0.183173283935, -0.203474789858, -0.178957432508, -0.142846912146, 0.176346868277, -0.067511349916, -0.077192828059, -0.011482335627, -0.025595929474, -0.180964708328, -0.454426705837, -0.126484140754, 0.002047348768, -0.121014222503, -0.093668833375, -0.022954208776, -0.053912106901, 0.026794727892, -0.137492731214, -0.120541267097, -0.118344992399, -0.139006391168, 0.010714632459, -0.118334963918, -0.033393703401, 0.077909499407, 0.020957987756, 0.013217261061, -0.025397367775, -0.071117006242, -0.379464209080, 0.033656280488, -0.143357664347, 0.035181425512, 0.061733447015, 0.002517111599, -0.045757073909, -0.076651602983, -0.069825001061, -0.208988234401, -0.226153299212, -0.477278560400, -0.456370621920, -0.394468098879, -0.247729659081, -0.333844691515, -0.441005617380, -0.388695806265, -0.277525186539, -0.277708768845, -0.411320358515, -0.454991430044, -0.346906751394, -0.440820604563, -0.422623604536, -0.409380763769, -0.268042474985, 0.021679909900, -0.344437628984, -0.135390371084, -0.210440516472, -0.047506768256, -0.000222116709, 0.025875084102, -0.047270040959, -0.057035811245, -0.003354124259, -0.042396165431, -0.217432454228, -0.596761226654, -0.764828741550, -0.825811743736, -0.714763224125, -0.951405763626, -0.928427398205, -1.035563588142, -1.258314251900, -0.907779514790, -1.051024794579, -1.010654926300, -0.927344143391, -0.818143010139, -0.852409243584, -0.481884062290, -0.548404991627, -0.088133335114, 0.005914272275, -0.067551858723, -0.035487812012, 0.068584434688, 0.030357040465, 0.075141437352, -0.043045040220, -0.046625167131, -0.092550098896, -0.070161074400, -0.184218868613, -0.227156281471, -0.136141628027, -0.232559606433, -0.420769065619, -0.348132073879, -0.461731821299, -0.590358018875, -0.584590971470, -0.295453339815, -0.469818472862, -0.451122820377, -0.344158530235, -0.382923126221, -0.359064310789, -0.144662111998, -0.248725578189, -0.177554652095, 0.041948743165, -0.005812600255, 0.032933622599, 0.074654795229, 0.079327724874, 0.012513220310, 0.003691360354, -0.080607041717, -0.032870985568, 0.017362035811, -0.026910409331, 0.014278575778, -0.033177163452, -0.022786900401, -0.045699898154, 0.016264498234, -0.087534822524, -0.180749952793, 0.066838540137, -0.052558466792, 0.081536121666, 0.002439931035, -0.020522035658, 0.005942441523, 0.021417669952, 0.009140990674, 0.071251787245, 0.007431097329, -0.021560244262, 0.029389224946, 0.080222271383, 0.067328922451, -0.020956590772, 0.003067336977, -0.066543430090, 0.032140560448, 0.013517237268, -0.050936531276, -0.035267632455, 0.049623802304, -0.108981952071, -0.224047645926, -0.175457477570, -0.219251126051, -0.178619489074, -0.271748572588, -0.283175498247, -0.249154269695, -0.372791409492, -0.394817322493, -0.282164454460, -0.292148530483, -0.313908576965, -0.290352702141, -0.085309311748, -0.006925380323, 0.075624831021, 0.007480293512, 0.061024658382, -0.058737307787, -0.025900579989, -0.055500023067, -0.089871555567, -0.127941355109, -0.133596569300, -0.159095525742, -0.191253542900, -0.212908223271, -0.330821543932, -0.413761526346, -0.355193823576, -0.307432562113, -0.567364811897, -0.834882736206, -0.913015007973, -0.333648830652, -0.072250694036, 0.065377764404, -0.078383088112, -0.053537890315, -0.213925540447, -0.204178959131, -0.218435645103, -0.260497212410, -0.328876793385, -0.141881346703, -0.060074497014, 0.028664864600, 0.069110579789, 0.067853681743, -0.135139837861, 0.014364574105, 0.092542856932, -0.220874756575, -0.386377573013, -0.396831631660, -0.318776011467, -0.263634443283, -0.172846481204, -0.259012669325, -0.114435799420, -0.075123421848, -0.094722114503, -0.005166788585, -0.046515040100, -0.010341132991, 0.218912184238, 0.176141664386, 0.160522088408, 0.248054727912, 0.125652566552, -0.100168108940, -0.129019901156, 0.140809312463, 0.073515251279, -0.015693008900, -0.005722790956, -0.069625347853, -0.157556310296, -0.121792756021, -0.525077104568, -0.500692248344, -0.225574508309, -0.215737029910, -0.400653302670, -0.186285823584, -0.163446843624, -0.086238570511, -0.036418203264, -0.205828502774, -0.118598014116, 0.100144632161, 0.084881186485, 0.148511111736, 0.170207798481, 0.021597076207, -0.091567955911, 0.150002479553, 0.076527588069, 0.180369630456, 0.356871873140, 0.246056064963, 0.032764911652, -0.242979779840, 0.020267158747, 0.005077071488, -0.259202003479, -0.290619403124, -0.608753085136, -0.408534705639, -0.252536475658, -0.140922322869, -0.107406139374, -0.098686940968, 0.045386191458, 0.009671425447, -0.007949257270, -0.099661231041, -0.041370533407, -0.103993639350, 0.013097251765, 0.112859591842, 0.110603712499, 0.069981940091, 0.142995223403, 0.110433906317, 0.163690283895, 0.202798545361, 0.218355849385, 0.470138400793, 0.395497441292, 0.035950269550, 0.047839306295, -0.061098914593, -0.003102601739, -0.453387290239, -0.439735949039, -0.194939598441, -0.109562695026, -0.119151480496, -0.056986093521, 0.035390045494, 0.015849968418, 0.004389245994, 0.001830980647, 0.001754454919, 0.069497786462, -0.020855650306, -0.091786995530, 0.000779326423, 0.129417568445, 0.137540474534, 0.171441912651, 0.045049868524, 0.101302720606, 0.164440929890, 0.487445265055, 0.449459105730, 0.286389559507, 0.179373666644, 0.004374114797, -0.275830000639, -0.093944884837, -0.643116831779, -0.751905202866, -0.287212699652, -0.065743386745, -0.009628116153, 0.176141560078, 0.021696284413, 0.118187651038, 0.165807664394, 0.090864628553, -0.124548584223, 0.039048567414, -0.138393521309, 0.057059321553, 0.097928613424, 0.024228483438, 0.063645049930, 0.027982961386, 0.127465382218, 0.192279860377, 0.279280334711, 0.512166082859, 0.578111290932, 0.233146026731, 0.109680972993, -0.040454100817, -0.189471051097, -0.292237430811, -0.789364814758, -0.794220387936, -0.354197800159, -0.117517016828, -0.117668196559, 0.102862648666, 0.006402185652, 0.071286097169, 0.097048148513, 0.071167252958, -0.109617531300, -0.115000814199, -0.234789296985, -0.070373207331, -0.118793122470, -0.067562080920, 0.126898556948, 0.196808427572, 0.230990886688, 0.081126570702, 0.396987676620, 0.707179486752, 0.669787526131, 0.345163851976, 0.035792950541, -0.131341055036, -0.144523561001, -0.314539104700, -0.669503331184, -0.593977153301, -0.286505252123, -0.166083484888, -0.018962778151, 0.083528712392, 0.113032229245, 0.129870682955, 0.215153649449, 0.159272402525, -0.037255264819, -0.157620191574, -0.298663437366, -0.353355467319, -0.211860924959, -0.130855485797, -0.144692167640, -0.050362333655, 0.208523258567, 0.185896098614, 0.524094343185, 0.877437829971, 0.896280944347, 0.403565943241, 0.259485065937, -0.144148498774, -0.312091410160, -0.310509622097, -0.536059975624, -0.227348983288, -0.105528324842, -0.093293465674, 0.056258551776, 0.241596266627, 0.248070493340, 0.226389393210, 0.237811312079, 0.295880436897, 0.210838437080, -0.030933693051, -0.174954891205, -0.244112759829, -0.416255623102, -0.326981216669, -0.236522793770, -0.205448240042, -0.026261009276, -0.009497615509, 0.355697453022, 0.982548236847, 1.190746068954, 0.776485860348, 0.155544579029, -0.085376486182, -0.156798720360, -0.244268402457, -0.586917459965, -0.064826488495, -0.069771587849, 0.098435752094, 0.163137763739, 0.130811095238, 0.107159331441, 0.161303430796, 0.151585519314, 0.266512572765, 0.313912898302, 0.016440115869, -0.192747458816, -0.175896197557, -0.265248030424, -0.257446706295, -0.412910640240, -0.567567527294, -0.586479365826, -0.551319301128, -0.102493643761, 0.458543658257, 0.979477345943, 0.618989765644, 0.001325488905, -0.032844029367, -0.188559800386, -0.269189476967, -0.324745446444, -0.027718368918, 0.007110192906, 0.187365591526, 0.047592747957, -0.011288163252, 0.043031997979, 0.101709812880, 0.266673952341, 0.271018505096, 0.240759193897, -0.063234068453, -0.149394348264, -0.334865570068, -0.273721456528, -0.287464797497, -0.259437948465, -0.435050040483, -0.692321836948, -1.025760889053, -1.035341024399, -0.897044718266, -0.048319637775, 0.374728351831, -0.230663672090, -0.020048759878, -0.188170194626, -0.261033564806, -0.064966559410, 0.070384792984, 0.125990346074, 0.046954087913, 0.044479180127, -0.049693901092, -0.022878255695, 0.212818995118, 0.252272009850, 0.287366569042, 0.190801471472, -0.064795106649, -0.345799088478, -0.444367945194, -0.342076092958, -0.137217730284, -0.113646283746, -0.103117763996, -0.249820277095, -0.477178961039, -0.643987596035, -0.885180354118, -0.350507646799, 0.056571375579, -0.183985143900, 0.184832304716, -0.158643722534, -0.216766923666, -0.027292456478, 0.105795040727, -0.112766630948, -0.101313605905, -0.079051032662, -0.020648805425, 0.127273216844, 0.234776571393, 0.059650093317, 0.139877319336, -0.027010217309, -0.134504467249, -0.217816010118, -0.244120299816, -0.277629166842, -0.132995411754, -0.165514752269, -0.085929974914, -0.100663237274, -0.120892323554, -0.243103668094, -0.245632365346, -0.429064720869, -0.502962648869, -0.153386592865, 0.029866572469, -0.067293867469, -0.399535804987, -0.170353382826, -0.105942577124, -0.272577375174, -0.241710290313, -0.221659421921, -0.027311163023, 0.032793972641, 0.094075337052, 0.070951208472, 0.104691810906, -0.065639115870, -0.302952915430, -0.296426624060, -0.222795456648, -0.268138587475, 0.074841476977, -0.117494769394, -0.085306361318, -0.096430905163, -0.035496857017, 0.067580088973, 0.047047693282, -0.450546801090, -0.488602101803, -0.224560052156, -0.098780967295, -0.204417422414, -0.392452955246, -0.094185300171, -0.225881084800, -0.196296140552, -0.172160461545, -0.409491986036, -0.427510350943, -0.239852488041, -0.110686741769, -0.129263684154, -0.134425371885, -0.192586243153, -0.300029247999, -0.214033797383, -0.265753984451, -0.053833708167, -0.024831295013, 0.076984584332, 0.073625095189, -0.037671077996, 0.050137411803, 0.028298880905, 0.021380208433, -0.413181424141, -0.517527043819, -0.187352672219, -0.085679322481, -0.165111079812, -0.437882632017, 0.040727969259, 0.027292221785, 0.093540273607, 0.238576516509, -0.243688076735, -0.365742504597, -0.308276385069, -0.399202793837, -0.343390583992, -0.404256671667, -0.393651694059, -0.343299269676, -0.087056718767, -0.038016866893, 0.073913849890, 0.052337575704, -0.020666230470, 0.079966016114, -0.043917953968, 0.063125520945, 0.064559765160, 0.068440273404, -0.552955210209, -0.653842210770, -0.334083378315, -0.144061848521, -0.220381185412, -0.313053607941, 0.046937637031, 0.242269754410, 0.231158867478, 0.414344429970, 0.120974086225, -0.049898728728, -0.228302240372, -0.206947371364, -0.208230897784, -0.202791646123, -0.191393896937, 0.034942600876, -0.056205239147, 0.051167245954, 0.107032716274, 0.072018899024, 0.014388291165, 0.006913201418, 0.111847609282, 0.026381125674, 0.046655185521, 0.199785262346, -0.440770119429, -0.296360701323, -0.330723404884, -0.051372658461, -0.174302905798, 0.088706322014, 0.029313096777, 0.135279849172, 0.175670042634, 0.230368077755, 0.169479817152, 0.158718362451, 0.034423500299, 0.004517938942, 0.016358617693, -0.015297953971, -0.009648730978, -0.024130778387, 0.076744832098, -0.013539383188, -0.018919881433, 0.034875690937, 0.020358121023, 0.076583981514, 0.085223250091, 0.007795356214, 0.137476697564, 0.202602788806, -0.140962168574, -0.318080335855, -0.110671490431, -0.060368925333, -0.308347135782, 0.025034468621, 0.115909777582, 0.049926266074, 0.138709083200, 0.091604247689, -0.020323172212, 0.200517207384, 0.177527308464, 0.009572417475, 0.166294068098, 0.012715417892, 0.046740476042, -0.043628163636, -0.012294036336, 0.057882949710, 0.140068471432, 0.063425920904, 0.081299319863, -0.010150404647, 0.004627351183, 0.270467221737, 0.089222133160, -0.023219002411, -0.052673697472, -0.229809656739, 0.138292595744, 0.015948027372, -0.246407762170, -0.258401274681, 0.031832981855, 0.096045382321, 0.046452905983, 0.076175250113, 0.094780169427, 0.126305520535, 0.033140189946, 0.077903352678, 0.097376056015, 0.048013925552, 0.088421136141, 0.083818435669, 0.084165744483, 0.079922482371, 0.014315753244, 0.060015041381, -0.013482386246, 0.151697561145, 0.224635913968, 0.147070690989, 0.168944314122, 0.123632356524, 0.062175743282, -0.015727274120, -0.050596568733, -0.102868907154, -0.137044951320, -0.514087855816, -0.063505217433, 0.256619393826, -0.047014869750, -0.183419957757, -0.062638908625, -0.006601167377, 0.064718693495, 0.016022615135, 0.026188023388, 0.213471964002, 0.125449776649, 0.112133376300, 0.040559835732, 0.169437155128, 0.081414267421, 0.053104251623, 0.113442815840, 0.021151872352, 0.080219030380, 0.107696332037, 0.125793948770, 0.188929706812, -0.057948123664, 0.080527991056, -0.116039656103, 0.063025064766, 0.029919691384, -0.028139630333, 0.088996477425, 0.182919204235, 0.156870827079, -0.144472807646, -0.081462867558, 0.052172772586, 0.012500268407, 0.160517185926, 0.151387304068, 0.098421402276, 0.008850594051, 0.134192332625, 0.091102987528, 0.087390340865, 0.019838303328, -0.137600883842, -0.026520824060, 0.027026284486, -0.051445845515, 0.068004786968, 0.163772717118, 0.013300548308, -0.026374889538, 0.127633646131, -0.001853942871, -0.063235118985, -0.066666081548, -0.171471580863, 0.130076572299, 0.042358856648, 0.052723057568, -0.052674435079, -0.068099908531, 0.011278133839, 0.171530008316, 0.145878329873, 0.173716634512, 0.136409521103, 0.250273734331, 0.224173069000, 0.146048679948, 0.120649568737, 0.082299798727, 0.076126463711, 0.033406145871, -0.027220336720, -0.071079656482, 0.196000427008, 0.083476200700, 0.084876321256, -0.356011480093, -0.144141227007, -0.078749909997, -0.036072768271, -0.030417770147, -0.027452144772, 0.083368688822, 0.137874245644, -0.173565968871, -0.074965640903, -0.124878071249, -0.151376754045, 0.111887373030, 0.061102543026, 0.044965613633, 0.198016881943, 0.189154654741, 0.039781704545, 0.225486949086, 0.196662843227, 0.264619916677, 0.153644666076, 0.063299924135, 0.043862953782, 0.170190006495, 0.235766425729, 0.380694478750, 0.250286579132, -0.092447333038, -0.087219819427, -0.081375546753, -0.071748085320, -0.057003036141, -0.048223871738, 0.011318905279, -0.208926990628, -0.405363231897, -0.650173425674, -0.457699537277, -0.462739944458, -0.258894383907, -0.208528190851, 0.108749762177, 0.047221776098, -0.165428936481, -0.220287010074, 0.036188878119, -0.016293620691, -0.157109215856, -0.227413251996, -0.168314263225, -0.001500784769, -0.055990129709, -0.022232705727, -0.066094204783, -0.161840319633, 0.007062202785, 0.043860547245, 0.063302524388, -0.009886115789, 0.046150095761, 0.079666726291, 0.063070870936, 0.013279896230, -0.000969156390, -0.176923751831, -0.243683874607, -0.319938898087, -0.368423312902, 0.102550595999, 0.044758472592, 0.106356553733, -0.065350085497, -0.394227623940, -0.466210842133, -0.624112069607, -0.574382722378, -0.239610731602, -0.270023882389, -0.341323196888, -0.365901798010, -0.136024266481, -0.149063408375, 0.051242671907, -0.033761229366, 0.083199821413, 0.032411150634, 0.059543319046, -0.016816124320, 0.081607215106, 0.045258201659, 0.023188024759, 0.082652546465, -0.085977748036, -0.033028542995, 0.071809716523, 0.057433940470, 0.008552759886, 0.009990572929, 0.081089869142, 0.071265667677, -0.073220625520, -0.036193363369, -0.033833481371, 0.027077913284, -0.068498820066, -0.061135604978, 0.039101593196, -0.071642532945, 0.016317345202, -0.018234081566, 0.049873478711, 0.051349647343, -0.016607336700, 0.079136364162, -0.043032169342, -0.078479275107, -0.003811068833, 0.036770641804, 0.057568963617, 0.141913995147, 0.336682677269, 0.291690140963, 0.350323259830, 0.363716244698, 0.356919407845, 0.304132193327, 0.447566509247, 0.275951176882, 0.016787121072, 0.119000285864, -0.039810400456, 0.317588388920, 0.377572804689, 0.301637470722, 0.259509980679, 0.164310455322, 0.143489718437, 0.154029160738, -0.020004540682, -0.020141683519, 0.055558197200, 0.021381564438, 0.062389783561, -0.080597035587, 0.054655771703, 0.024856740609, 0.144615978003, 0.317738622427, 0.396400362253, 0.406036376953, 0.434482127428, 0.277554720640, 0.469612866640, 0.493242442608, 0.437782883644, 0.217164710164, 0.286826908588, 0.162354990840, 0.241037830710, 0.195781320333, 0.303008943796, 0.305057138205, 0.312070459127, 0.450079679489, 0.351257503033, 0.394748926163, 0.044962689281, -0.153124123812, 0.044148467481, 0.080509655178, -0.011595368385, -0.040331844240, 0.007399049588, 0.106897681952, 0.026517536491, 0.128377556801, 0.190698444843, 0.290567576885, 0.293959259987, 0.245340287685, 0.246106624603, 0.258848309517, 0.175114408135, 0.118396610022, 0.198833033442, 0.177472561598, 0.019951751456, 0.078074723482, 0.187967315316, 0.232068389654, 0.112434305251, 0.224723517895, 0.214081600308, 0.337938576937, 0.197967544198, -0.142823413014, 0.033452916890, -0.031745385379, 0.016449637711, -0.000600037980, -0.210512906313, -0.024447962642, 0.166516393423, 0.018020562828, 0.003063522978, -0.068402498960, 0.073931559920, 0.036067482084, -0.036166980863, -0.217184290290, -0.222292214632, -0.058602206409, -0.117562092841, -0.181418061256, 0.025853674859, 0.143326282501, 0.045186124742, 0.106827259064, 0.178887844086, 0.186797156930, 0.235694006085, 0.349994838238, -0.077691584826, -0.127893164754, -0.066520646214, 0.211436897516, -0.017827391624, 0.033652275801, 0.170530453324, -0.287769734859, 0.085984699428, -0.143366202712, -0.086448632181, -0.198415070772, 0.075386486948, -0.105949021876, 0.012595466338, -0.316702067852, -0.189623042941, -0.255978941917, -0.080017998815, -0.038982007653, -0.146280020475, -0.028634747490, 0.146503478289, 0.165779843926, 0.145780578256, 0.107186280191, 0.178223818541, 0.250831097364, 0.124876283109, 0.011001351289, 0.115197375417, 0.160337030888, 0.036552153528, -0.007861150429, -0.056664351374, -0.456159293652, -0.138907656074, -0.242161542177, -0.197016894817, -0.040009554476, -0.089344628155, -0.124862752855, -0.177411690354, -0.275444239378, -0.062332440168, -0.211929425597, -0.205990359187, -0.032631997019, -0.204558551311, -0.049680259079, -0.114262796938, -0.080676823854, 0.006228373852, 0.060157772154, -0.038247469813, 0.053176943213, 0.091940879822, -0.028198571876, -0.130950585008, 0.118884958327, 0.072037354112, -0.028662713245, -0.217879682779, -0.387465953827, 0.010400626808, -0.152902081609, -0.327889144421, -0.026360383257, -0.129737868905, -0.148744001985, -0.197708576918, -0.114466652274, -0.128689259291, -0.179946497083, -0.171635285020, -0.194619327784, -0.255121409893, -0.279915034771, -0.244463324547, -0.331075191498, -0.255403548479, -0.067071408033, -0.148696154356, -0.247213855386, -0.010543121956, -0.214041054249, -0.136619076133, -0.031185809523, -0.145286396146, -0.090147145092, -0.144492313266, -0.418984442949, -0.060739327222, -0.215422764421, -0.285586774349, -0.118448190391, -0.050943870097, -0.100063636899, -0.140009775758, -0.129412204027, -0.235150769353, -0.181375011802, -0.278048217297, -0.259460896254, -0.319301187992, -0.388583540916, -0.485000699759, -0.410673439503, -0.342027723789, -0.236121475697, -0.281942188740, -0.465340226889, -0.531884014606, -0.756901800632, -0.414965748787, -0.157611861825, -0.047363694757, 0.010311897844, -0.304777622223, -0.479225516319, 0.031747370958, -0.336791276932, -0.258724242449, -0.112488821149, -0.151571020484, -0.220723137259, -0.203948542476, -0.102773405612, -0.217384636402, -0.269612252712, -0.287408113480, -0.297771543264, -0.450005859137, -0.572707474232, -0.563424170017, -0.452984094620, -0.210382178426, -0.192362099886, -0.371796250343, -0.329724222422, -0.571040451527, -0.965535819530, -0.684298455715, -0.269059062004, -0.018670715392, -0.085859350860, -0.232693597674, -0.445808261633, -0.139849931002, -0.186499729753, -0.196785196662, -0.048365145922, -0.002884283662, -0.160482808948, -0.104208260775, -0.125016123056, -0.158277437091, -0.044558431953, -0.194965049624, -0.465432375669, -0.491526186466, -0.485769271851, -0.438871949911, -0.319772124290, -0.320567131042, -0.206947237253, -0.310500383377, -0.175990253687, -0.211408555508, -0.917703032494, -0.752675592899, -0.140036612749, -0.008950560354, -0.096301414073, -0.179868862033, -0.437263458967, -0.220404148102, -0.090675026178, -0.052841935307, 0.099045254290, -0.002448272426, 0.115177407861, 0.003180949716, -0.095056876540, -0.045802246779, 0.077604904771, -0.303317725658, -0.543680429459, -0.258310049772, -0.370500504971, -0.266729712486, -0.195954561234, -0.135112985969, 0.034902449697, -0.009820180945, 0.144978821278, -0.079241238534, -0.461115956306, -0.553675651550, -0.112732313573, -0.014054751955, -0.042572516948, -0.160334393382, -0.408135592937, -0.154156088829, -0.086572989821, 0.052961137146, 0.114895902574, 0.130527526140, 0.139799699187, -0.000310586183, 0.170295059681, 0.174699112773, -0.018247039989, -0.261983156204, -0.291884630919, -0.184652596712, -0.093171715736, -0.235485091805, -0.261947184801, -0.152148783207, 0.110242128372, 0.285933077335, 0.506956815720, 0.296119749546, -0.315077692270, -0.591890215874, -0.217486083508, -0.112099364400, -0.110697351396, -0.111569590867, -0.379656165838, -0.166065186262, 0.098783433437, 0.260296255350, 0.041652753949, 0.073324479163, 0.037854384631, 0.165766358376, 0.096988461912, 0.133466303349, -0.056303676218, -0.193490639329, -0.061997212470, -0.027518274263, -0.122636161745, -0.189082205296, -0.076744936407, -0.080134905875, 0.074664227664, 0.298288434744, 0.505070984364, 0.299872428179, -0.225623413920, -0.716381132603, -0.293041020632, -0.108849197626, -0.095595218241, 0.037769161165, -0.339989244938, -0.623144209385, -0.013057364151, 0.174605548382, 0.017604159191, 0.045680489391, 0.214511573315, 0.166990771890, 0.247244179249, 0.126699358225, -0.131312206388, -0.147504150867, 0.064224869013, -0.060089431703, -0.241377159953, -0.195220276713, -0.021362693980, 0.040739443153, 0.143300428987, 0.273905575275, 0.271236389875, 0.229138731956, -0.055496271700, -0.450637817383, -0.165447145700, -0.064103960991, -0.035607807338, -0.165172338486, -0.519569158554, -0.795203208923, -0.050850879401, 0.145423755050, 0.087365187705, 0.213591977954, 0.114514641464, 0.301234662533, 0.373848676682, 0.093304812908, 0.030296226963, 0.155986115336, 0.024502251297, 0.014213014394, -0.136301368475, -0.042358852923, 0.055958498269, 0.036943752319, 0.032684165984, -0.041874561459, 0.152620032430, 0.117851756513, -0.020040290430, -0.589413583279, -0.220021337271, 0.021944535896, -0.017964899540, -0.164181947708, -0.580680012703, -0.527473330498, 0.000099203113, 0.166085019708, 0.209039807320, 0.188225775957, 0.223772868514, 0.256912827492, 0.459740787745, 0.110536709428, -0.024968180805, 0.035402450711, -0.004076967482, -0.124683573842, -0.129475221038, 0.020057968795, 0.046666506678, 0.015353971161, 0.014770735987, 0.007583517581, -0.104708366096, -0.044205296785, -0.065480843186, -0.709378182888, -0.306309372187, -0.086727887392, -0.099072299898, -0.095747157931, -0.485878467560, -0.709597229958, -0.120362371206, -0.047724291682, 0.148561596870, 0.219066187739, 0.306530237198, 0.441860675812, 0.437421441078, 0.081434123218, 0.036094002426, 0.012096478604, -0.010282518342, -0.147317767143, -0.082871824503, 0.122734032571, 0.076280787587, -0.059607882053, -0.033507555723, -0.018911009654, -0.027483766899, -0.002403273247, -0.009006022476, -0.667669534683, -0.410852134228, -0.163731887937, -0.044569998980, -0.048972338438, -0.457301765680, -0.552159190178, -0.331573814154, -0.131598934531, 0.099458701909, 0.101667478681, 0.131903320551, 0.210969820619, 0.287991851568, 0.310672640800, 0.179309636354, 0.008463466540, -0.013662819751, 0.049445513636, 0.189996540546, 0.168639481068, -0.031553354114, -0.042130067945, -0.004841051530, -0.077189080417, 0.069978371263, -0.086476981640, 0.038820985705, -0.325748205185, -0.281485289335, 0.065769761801, -0.229437693954, -0.128870472312, -0.416001468897, -0.444529861212, -0.351592719555, -0.144017875195, -0.131050139666, -0.003752870951, 0.185542225838, 0.236983343959, 0.407404422760, 0.346855968237, 0.179414495826, 0.182972654700, 0.146036356688, 0.196445271373, 0.134686961770, 0.026259819046, 0.006756428163, 0.065164998174, 0.033959928900, -0.004006313160, 0.008888251148, -0.127682015300, -0.286064803600, -0.477846711874, -0.173077777028, -0.071966990829, -0.098643288016, -0.264118164778, -0.423727482557, -0.325696051121, -0.338178187609, -0.283700585365, -0.082009054720, -0.110051900148, 0.123966008425, 0.293423891068, 0.297432780266, 0.331887632608, 0.302910447121, 0.400690913200, 0.188054040074, 0.179255768657, 0.078729964793, 0.114106178284, 0.072097547352, 0.032976530492, -0.012629513629, -0.143421724439, -0.137823343277, -0.231970831752, -0.216815754771, -0.276411086321, -0.036057382822, 0.046878222376, 0.016373971477, -0.212194755673, -0.412220150232, -0.595632195473, -0.625057697296, -0.467106491327, -0.139822334051, 0.066431500018, 0.035258919001, 0.126764059067, 0.277366846800, 0.360078901052, 0.446999698877, 0.333340108395, 0.198372587562, 0.235174894333, 0.189838230610, 0.174560695887, 0.103858776391, -0.019082337618, -0.199867993593, -0.040871903300, -0.270771443844, -0.304689466953, -0.322398215532, -0.169014081359, -0.008658399805, -0.108611956239, -0.094609148800, -0.021948704496, -0.335001468658, -0.549582779408, -0.715030074120, -0.956353724003, -0.376725554466, -0.095067717135, -0.035141218454, 0.059471711516, -0.003495311597, 0.211948901415, 0.094919815660, 0.050885442644, 0.198387980461, 0.049378637224, 0.017294099554, -0.040703754872, -0.045052289963, -0.005086294375, -0.136115446687, -0.327899694443, -0.541508197784, -0.544650077820, -0.364302843809, -0.013901620172, -0.017341209576, -0.027434352785, 0.049794860184, -0.099561177194, -0.089660152793, -0.194922417402, -0.494239181280, -0.816969871521, -0.710919260979, -0.441806286573, -0.385451108217, -0.321783453226, -0.350806355476, -0.164801076055, -0.118932515383, -0.112528055906, 0.005195853300, -0.113683737814, -0.238108649850, -0.045580271631, -0.016705576330, -0.131713539362, -0.250451326370, -0.206110879779, -0.543005347252, -0.502528727055, -0.253484219313, -0.275098323822, -0.031280882657, 0.062620960176, 0.043189905584, 0.025428794324, -0.074392512441, -0.228522166610, -0.296588093042, -0.551215767860, -0.663072824478, -0.807072103024, -0.988629341125, -1.249821662903, -0.850315570831, -0.733018815517, -0.589967787266, -0.590658545494, -0.441123574972, -0.364304423332, -0.306468576193, -0.437047183514, -0.589423894882, -0.560726821423, -0.778258323669, -0.535251200199, -0.529514253139, -0.320543378592, -0.190732523799, -0.179553955793, -0.051368575543, 0.072378553450, -0.037405006588, -0.076415687799, -0.126941442490, -0.246146023273, -0.226838067174, -0.230456739664, -0.280417352915, -0.428494960070, -0.484865397215, -0.590459525585, -0.317096322775, -0.296725481749, -0.702832162380, -0.776801705360, -0.712293505669, -0.644374608994, -0.752857565880, -0.608837127686, -0.674355745316, -0.333711445332, -0.304237037897, -0.209192052484, -0.277085036039, -0.209846675396, -0.102519646287, -0.134788691998, -0.011072918773, 0.009826220572, -0.020962849259, -0.006906449795, 0.044164445251, 0.000651590468, 0.010040339082, -0.036156669259, -0.163068547845, -0.216151565313, -0.148818776011, -0.162676215172, -0.322977572680, -0.370553284883, -0.336520552635, -0.413251101971, -0.415078759193, -0.370505064726, -0.299356341362, -0.297023296356, -0.254746019840, -0.144800797105, -0.287976235151, -0.163130387664, -0.174502417445, -0.034456014633, -0.079425849020, 0.073458619416, 0.014914788306, 0.077572874725, 0.080474935472, 0.066271968186, 0.025934092700, 0.029532734305, 0.004822691903, -0.066192373633, -0.102703697979, -0.111067630351, -0.017464896664, -0.160651087761, 0.008456272073, -0.022273011506, -0.056393489242, -0.075645551085, -0.002296792809, 0.011335196905, -0.095660507679, -0.159146964550, -0.091998070478, -0.180640295148, -0.078320957720, -0.078969217837, -0.074740827084, 0.001241914928, -0.026724770665, 0.039010740817, 0.030071757734, 0.055949531496, -0.070651955903, 0.072563268244, 0.025905057788, 0.052538610995, 0.068383269012, 0.034620136023, -0.057001277804, -0.064928062260, -0.037583578378, -0.055072329938, -0.053400672972, 0.014785734005, 0.013607626781, 0.067235819995, 0.028530793265, -0.022165738046, -0.023370176554, -0.001498870552, -0.020253270864, 0.007394723594, -0.034998234361, -0.032365430146, 0.083405710757, 0.024194866419, -0.069625295699, -0.009597904980, 0.049659572542, -0.037829484791, -0.024444092065, 0.033236585557, 0.072524778545, -0.077391080558, -0.030794864520, 0.006489408668, -0.049084875733, -0.142457842827, -0.239884957671, -0.241477191448, -0.183554127812, -0.199663802981, -0.240248128772, -0.085618704557, -0.208153918386, -0.172269299626, -0.139826446772, -0.132041588426, -0.116607859731, -0.026355881244, -0.115266397595, -0.078245848417, -0.075059525669, 0.050519935787, -0.063177108765, 0.070752553642, 0.042499192059, -0.004991307855, -0.029356934130, 0.067111104727, -0.115695089102, -0.124414205551, 0.010609264486, -0.044346913695, -0.192286521196, -0.200248479843, -0.211279496551, -0.401257693768, -0.452547281981, -0.385878622532, -0.481432974339, -0.375819742680, -0.342509955168, -0.258682876825, -0.311209648848, -0.150619208813, -0.098178446293, -0.148032680154, -0.097741633654, -0.149325355887, -0.046566240489, -0.101101130247, -0.001656041364, 0.052853234112, 0.078734911978, 0.050788365304, -0.062063567340, -0.072161570191, -0.216481685638, -0.208446130157, -0.150108471513, -0.296670317650, -0.405414849520, -0.432259172201, -0.608344495296, -0.681483447552, -0.604566335678, -0.546205282211, -0.630075335503, -0.590696930885, -0.618383884430, -0.410395383835, -0.502119600773, -0.382820576429, -0.296391695738, -0.211136221886, -0.344278991222, -0.187648162246, -0.122510932386, -0.036855157465, 0.008845816366, -0.089284941554, 0.002358339727, 0.064356781542, 0.054396759719, 0.012253321707, 0.129111945629, -0.147898823023, -0.305774539709, -0.497490048409, -0.656351149082, -0.735645890236, -0.717683017254, -0.874143660069, -0.704721570015, -0.507204949856, -0.548334717751, -0.664793074131, -0.612582623959, -0.893180370331, -0.970782101154, -0.919553279877, -0.814619362354, -0.599551260471, -0.251630306244, -0.313198983669, -0.389627575874, -0.152136474848, -0.187050849199, -0.280624568462, -0.137244269252, 0.009057670832, 0.065988130867, -0.063422441483, -0.036716707051, -0.181644186378, 0.108190745115, 0.006529848557, 0.106303855777, 0.072620019317, 0.122383803129, -0.171592876315, -0.202856481075, -0.191476777196, -0.173194691539, -0.350038856268, -0.305225104094, -0.315835624933, -0.416001796722, -0.403296828270, -0.651270508766, -0.868292510509, -0.755043745041, -0.516794562340, -0.900541186333, -0.524256944656, -0.533366382122, -0.181148692966, -0.194457575679, 0.085772968829, -0.006779991090, 0.173334613442, 0.277421474457, 0.074286222458, 0.202692389488, 0.168098405004, 0.151243343949, 0.160670414567, 0.109272792935, 0.159047394991, 0.168336018920, 0.104271419346, -0.141083687544, -0.089459881186, -0.046691618860, -0.041131466627, -0.047221507877, -0.104993425310, -0.126932501793, -0.068248875439, -0.119091123343, -0.087775707245, -0.509801506996, -0.662692487240, -0.696479797363, -0.527694344521, -0.185736700892, 0.059416078031, 0.016243249178, 0.362282991409, 0.353497982025, 0.071629799902, 0.082850880921, 0.270509272814, 0.312766522169, 0.198477670550, 0.265353441238, 0.225780218840, 0.241490259767, 0.209167137742, 0.052900820971, -0.106654651463, 0.029649280012, 0.126035407186, 0.185113653541, 0.253286480904, 0.058724064380, 0.131980910897, 0.004608124029, 0.000259605760, -0.201030761003, -0.380874037743, -0.518714129925, -0.532990396023, -0.047192528844, -0.120858542621, 0.209649294615, 0.283464759588, 0.455483108759, 0.154557988048, 0.213645577431, 0.170754626393, 0.289345443249, 0.208035334945, 0.120606705546, 0.108471445739, 0.167277872562, 0.227249279618, 0.128227055073, 0.078062787652, 0.189207926393, 0.248816385865, 0.184264793992, 0.175614103675, 0.130269542336, 0.061134804040, 0.012689301744, 0.062293771654, -0.101196497679, -0.379375487566, -0.700155198574, -0.511010468006, -0.233329966664, 0.080224812031, 0.345951080322, 0.142918735743, 0.409835666418, 0.213425815105, 0.200085863471, 0.171776697040, 0.030052779242, 0.105974756181, -0.022179109976, -0.024487867951, 0.074378743768, 0.156955972314, 0.157063007355, 0.267452687025, 0.323818147182, 0.293390542269, 0.350022405386, 0.158017620444, 0.213638961315, 0.072681583464, 0.100482590497, 0.028571648523, -0.128765717149, -0.306422203779, -0.475821822882, -0.169355630875, 0.058871570975, 0.137312963605, 0.168849706650, 0.435100436211, 0.308350086212, 0.269717216492, 0.161942332983, 0.044095233083, -0.062755465508, -0.086496837437, 0.061878763139, 0.046536084265, -0.037737343460, -0.062226280570, 0.138655602932, 0.234114050865, 0.447312504053, 0.429747283459, 0.280320912600, 0.301158040762, 0.207100123167, 0.246082186699, 0.231478288770, 0.116197906435, -0.269229382277, -0.533073723316, -0.272366911173, -0.176061958075, 0.051595598459, 0.103012226522, 0.263865858316, 0.519657969475, 0.443393260241, 0.394098043442, 0.041863523424, 0.025441087782, 0.133339583874, -0.062033232301, -0.010858627968, 0.105057872832, 0.019636519253, -0.021486958489, -0.011150221340, 0.181006431580, 0.321058690548, 0.366896927357, 0.324938654900, 0.323612421751, 0.109276637435, 0.169629752636, 0.109671004117, 0.098279207945, -0.212742745876, -0.704134225845, -0.789189279079, -0.285387516022, 0.117531992495, 0.107594713569, 0.329842269421, 0.588293790817, 0.579867303371, 0.316590428352, 0.167895466089, -0.073336809874, 0.108266189694, 0.110796041787, -0.052037332207, -0.035516306758, -0.122519865632, -0.562713503838, -0.585693001747, -0.195395499468, 0.173448503017, 0.352989017963, 0.273226827383, 0.221835106611, -0.020143324509, -0.052098426968, 0.040234711021, 0.034688886255, -0.185994490981, -0.429810494184, 0.051515329629, 0.047771852463, 0.135628819466, -0.085572868586, 0.316685825586, 0.453842192888, 0.327789247036, 0.264712274075, 0.091674201190, 0.122476771474, -0.011108522303, -0.053666245192, -0.057026997209, -0.176248252392, -0.419630318880, -0.911405146122, -0.873968958855, -0.344901412725, 0.018506364897, 0.122601181269, 0.121864080429, 0.035313662142, -0.000697797572, 0.103130146861, 0.005479720887, -0.079866088927, -0.203068271279, -0.068204790354, 0.043094083667, -0.064041398466, -0.130447492003, -0.084286376834, 0.099072016776, 0.427915602922, 0.214139819145, 0.155813589692, 0.055814918131, -0.075521558523, -0.089309662580, -0.101137042046, -0.285443365574, -0.214517101645, -0.540306925774, -0.856094837189, -0.549235463142, -0.284474730492, -0.136116638780, -0.011601745151, 0.113670237362, 0.298181116581, 0.349328100681, 0.165061607957, 0.170064315200, 0.144679069519, 0.091646648943, -0.024799434468, -0.241218000650, -0.282643258572, -0.107598371804, 0.030921583995, -0.102726146579, 0.165603399277, 0.142284125090, 0.043142687529, 0.012493662536, -0.014201044105, -0.165715977550, -0.294868290424, -0.337233453989, -0.337895929813, -0.460246920586, -0.636510789394, -0.399282097816, -0.209200382233, -0.046557702124, -0.004680183716, 0.381022185087, 0.393804013729, 0.286145538092, 0.379886895418, 0.276563644409, 0.322574704885, 0.146621093154, -0.133500248194, -0.541597843170, -0.328079968691, -0.218845173717, 0.054163653404, -0.021572895348, -0.055149123073, -0.030219862238, 0.128000050783, -0.120514504611, 0.028812028468, 0.045155767351, -0.167103305459, -0.164977252483, -0.402281552553, -0.522026419640, -0.383378714323, -0.195782020688, -0.148053526878, -0.039316546172, 0.055322974920, 0.120343402028, 0.252826750278, 0.199666813016, 0.273270308971, 0.117939516902, 0.003989687655, -0.166731789708, -0.270625561476, -0.659293711185, -0.421235769987, -0.090955764055, 0.061079449952, -0.087133578956, -0.091079957783, -0.167136877775, 0.028433984146, -0.016168216243, -0.155257135630, -0.136390194297, -0.255640536547, -0.182832255960, -0.394667595625, -0.311084002256, -0.072159387171, -0.069598525763, 0.005962201394, 0.091443590820, -0.077976129949, 0.043475128710, 0.087239414454, 0.027924632654, 0.056798715144, -0.081209994853, -0.060438204557, -0.165140479803, -0.042127769440, -0.020142005756, 0.084461003542, -0.263548135757, 0.032012801617, 0.009363136254, 0.133614853024, -0.159674629569, -0.073994353414, -0.087672285736, -0.371699005365, -0.406181514263, -0.260140091181, -0.343005448580, -0.409143805504, -0.201418176293, -0.078779704869, 0.084743916988, -0.016328347847, -0.002758032642, -0.090405173600, -0.131110221148, -0.043438654393, -0.115916855633, -0.017529202625, -0.084915682673, -0.203677326441, -0.379438102245, -0.367654323578, -0.132510408759, 0.125941708684, -0.205948621035, 0.022891044617, 0.208081811666, 0.280677497387, -0.219393491745, -0.013535774313, -0.346913844347, -0.347884297371, -0.540884852409, -0.313722789288, -0.275144040585, -0.281833738089, -0.278664201498, -0.112565778196, -0.034656252712, 0.003743350506, -0.136788725853, -0.237376809120, -0.277339249849, -0.295647025108, -0.191919848323, -0.360502868891, -0.349076867104, -0.567749559879, -0.516686618328, -0.289566516876, -0.195922434330, -0.087848648429, -0.231930419803, 0.042824350297, 0.054049592465, -0.130321934819, -0.497756093740, -0.553273797035, -0.467234939337, -0.628960967064, -0.453586280346, -0.210598126054, -0.333607077599, -0.184584110975, -0.094772763550, -0.048661570996, 0.042555369437, 0.063716202974, -0.155751869082, -0.224120229483, -0.299194544554, -0.473745971918, -0.324255377054, -0.444473326206, -0.504814147949, -0.593548297882, -0.526099920273, -0.253707557917, -0.321624517441, -0.125777751207, 0.021162439138, -0.009246904403, -0.251200497150, -0.329244405031, -0.656304776669, -0.405208289623, -0.287310421467, -0.351069122553, -0.332712352276, -0.118220113218, -0.169945150614, -0.218113318086, -0.127494424582, -0.057284858078, -0.089582152665, -0.115048252046, -0.109186135232, -0.106368668377, -0.325968325138, -0.362341582775, -0.418673962355, -0.497845679522, -0.514193236828, -0.573445737362, -0.673474550247, -0.245688274503, -0.078980177641, -0.221123769879, 0.008955011144, -0.063495196402, -0.003979571629, -0.340881735086, -0.576448798180, -0.207922279835, -0.062360018492, -0.068555347621, 0.049895074219, -0.055225569755, -0.103398673236, -0.004625166301, -0.163632839918, -0.127368658781, -0.166003063321, -0.137324675918, 0.005464812741, -0.048596300185, -0.223457023501, -0.279609113932, -0.297164410353, -0.468483388424, -0.466035425663, -0.564249277115, -0.662952184677, -0.329054921865, -0.087299719453, -0.329325288534, 0.025160249323, 0.001559697092, -0.073941029608, -0.248609170318, -0.341776669025, 0.164508536458, 0.112597711384, 0.196411907673, 0.349419265985, -0.158265173435, -0.159189119935, -0.055859297514, -0.179581522942, -0.206510484219, -0.098795734346, -0.019241655245, -0.001829721965, -0.115061506629, -0.150009125471, -0.267766237259, -0.326683640480, -0.537635922432, -0.615180790424, -0.405110597610, -0.743039488792, -0.316189289093, -0.282852798700, -0.259260416031, -0.062626428902, -0.024269089103, -0.005745656788, -0.125956565142, 0.000749700295, 0.288514345884, 0.410289943218, 0.410661965609, 0.298795908689, 0.133548438549, 0.001827956992, -0.010268620215, 0.101069703698, -0.024695169181, 0.027149260044, 0.087174437940, 0.053183294833, -0.004947766196, -0.065949372947, -0.192860126495, -0.296571522951, -0.188227713108, -0.189502239227, -0.425627946854, -0.792431473732, -0.327638208866, -0.193219333887, -0.030554370955, -0.009530901909, -0.016764685512, -0.074378132820, -0.204085916281, 0.193486288190, 0.291301220655, 0.236445397139, 0.103157348931, 0.237652793527, 0.262215524912, 0.323850870132, 0.177881196141, 0.310703665018, 0.265653938055, 0.113701544702, 0.155807092786, 0.226065218449, 0.168909937143, 0.186798229814, 0.050895944238, 0.067197613418, -0.194945052266, -0.072435274720, -0.009384837933, -0.289639592171, -0.196472391486, -0.053049929440, -0.075810223818, -0.024801857769, -0.016734369099, 0.037025123835, 0.046970762312, -0.060380131006, -0.282150000334, -0.192637428641, -0.196878150105, 0.067607276142, 0.161851435900, 0.238399207592, 0.157761871815, 0.081828810275, 0.056556332856, 0.236944466829, 0.244751378894, 0.315983235836, 0.293963521719, 0.337097048759, 0.415570855141, 0.354093700647, -0.037177003920, 0.124807663262, 0.186140522361, -0.099898040295, -0.079745829105, 0.190785393119, 0.062326468527, -0.085697539151, 0.071546979249, -0.059469249099, -0.027833152562, -0.057696759701, 0.051949080080, 0.189422294497, 0.132528707385, 0.190880060196, 0.164902448654, 0.124263003469, 0.328514248133, 0.160541325808, 0.177148789167, 0.529205143452, 0.401818782091, 0.276984900236, 0.380073428154, 0.669992446899, 0.284511178732, 0.396063297987, 0.074001923203, 0.201494261622, 0.217200547457, 0.190925806761, -0.020479798317, 0.032620087266, 0.026916235685, -0.052794657648, 0.038891069591, 0.064894340932, -0.037410788238, 0.078268878162, 0.023925706744, -0.053783077747, -0.007665395737, 0.056766428053, -0.075378097594, 0.005316652358, 0.082432381809, -0.023218177259, -0.114805229008, -0.062130279839, -0.071878552437, -0.078720137477, 0.059984542429, 0.037692844868, -0.056096192449, -0.017779968679, -0.025706712157, 0.044820137322, -0.082747302949, 0.017114967108, 0.015000015497, -0.017124854028, 0.001762188971, 0.014844387770, 0.018789961934, -0.073862440884, -0.039546698332, 0.065099529922, 0.060591772199, 0.020618375391, -0.068927802145, -0.058457434177, -0.245098769665, -0.205001935363, -0.164956852794, -0.172082290053, -0.123792707920, -0.167539700866, -0.181775301695, -0.260848402977, -0.351233363152, -0.390410751104, -0.166912347078, -0.175042748451, -0.155178710818, -0.292811274529, -0.196437329054, -0.183450907469, 0.037656530738, -0.013348810375, -0.056667283177, 0.039007090032, -0.070747166872, 0.052035771310, -0.069270700216, -0.149331405759, -0.063560359180, -0.049057800323, -0.202469781041, -0.329696208239, -0.319507151842, -0.365646392107, -0.596001386642, -0.680291235447, -0.792090773582, -0.948947846889, -1.058574557304, -0.997399091721, -0.995389878750, -0.521596312523, -0.085397616029, -0.592633128166, -0.491268336773, -0.544105231762, -0.283442020416, -0.312730669975, -0.219178602099, -0.091534644365, 0.079851202667, 0.042099274695, -0.059619881213, -0.050257708877, -0.081635825336, -0.159479558468, -0.221970170736, -0.419787794352, -0.283940196037, -0.338206797838, -0.259876340628, -0.366393834352, -0.386880189180, -0.387062728405, -0.269238859415, -0.270767599344, -0.363884061575, -0.199186041951, -0.308636784554, -0.208290278912, -0.115515768528, -0.352548509836, -0.222246214747, -0.110396265984, -0.011055071838, 0.099700212479, -0.015893390402, -0.039905227721, -0.148018985987, -0.069696590304, 0.026763468981, -0.098451420665, 0.095483474433, -0.345845043659, -0.397516876459, -0.559800624847, -0.405225396156, -0.187394887209, -0.074335917830, 0.084824822843, -0.062144871801, 0.056128527969, 0.119421780109, 0.060183923692, 0.129898160696, 0.187086060643, 0.103455744684, 0.052439026535, -0.004490293562, -0.015447222628, -0.004004439805, -0.000498499197, -0.139599531889, -0.218657210469, 0.050201363862, 0.109674245119, 0.163821816444, 0.040949169546, 0.052539385855, -0.053620383143, -0.240814864635, -0.353362768888, -0.606384217739, -0.495240867138, -0.230028063059, -0.124955512583, -0.053773440421, -0.077218428254, -0.195359334350, 0.009637597017, 0.169178694487, 0.171797811985, 0.076689220965, 0.167942032218, 0.101155065000, 0.148620218039, 0.007177925203, 0.054553851485, 0.098346002400, 0.025063602254, -0.089929059148, -0.213855564594, -0.117402620614, 0.173017486930, 0.040820602328, -0.025227263570, 0.029167339206, -0.053714703768, -0.463224172592, -0.424936920404, -0.470593452454, -0.252701759338, -0.203414261341, -0.133250042796, 0.045679233968, -0.055748265237, -0.004207549151, -0.045042987913, 0.088057495654, 0.026219533756, 0.029246589169, 0.164750903845, 0.111965194345, 0.091906353831, 0.009745347314, 0.137855142355, 0.056653134525, 0.040724396706, -0.090614356101, -0.032582208514, -0.047087218612, 0.213921204209, -0.003474630648, -0.109180226922, 0.066036216915, -0.245195135474, -0.442785710096, -0.305925697088, -0.098596416414, -0.104988448322, -0.080549091101, -0.030110323802, -0.003295868868, 0.004728941713, -0.014519028366, -0.020862065256, 0.029239075258, -0.085896179080, -0.091181047261, 0.014504160732, 0.052509967238, -0.079577013850, 0.044860132039, 0.015633722767, 0.028262205422, 0.076700642705, 0.098767653108, 0.218500927091, 0.174384906888, -0.069725088775, 0.101668722928, -0.105127185583, -0.080368086696, -0.208637848496, -0.498968362808, -0.053850360215, -0.024094315246, 0.015854833648, 0.076051987708, 0.193594828248, 0.061308998615, 0.105144515634, 0.061542451382, -0.017721328884, 0.067889094353, 0.054875809699, -0.171092316508, -0.053475480527, 0.057887814939, -0.047002773732, 0.004118377808, 0.127145677805, 0.008955941536, 0.156826451421, 0.130232185125, 0.075675688684, 0.195149466395, 0.084932968020, 0.169100567698, 0.268893569708, -0.013483434916, -0.234185427427, -0.395713299513, -0.149662718177, -0.132186770439, -0.012261327356, 0.094930663705, 0.066971354187, 0.073908537626, 0.199454545975, 0.089239217341, 0.098246105015, 0.035852536559, 0.029039975256, -0.177171841264, -0.293718904257, -0.181052759290, -0.006728858687, -0.021474124864, 0.070004634559, 0.138427555561, 0.069443330169, 0.185571759939, 0.178371652961, -0.085156381130, 0.006372012198, 0.242773756385, -0.064088374376, -0.069569110870, -0.301995456219, -0.374191313982, -0.395909816027, 0.133139535785, 0.056532196701, 0.088700383902, 0.117819517851, 0.186744734645, 0.235009595752, 0.199710920453, 0.156453192234, 0.162734270096, -0.007720608730, -0.170377835631, -0.360264837742, -0.267845302820, -0.218351274729, 0.035443563014, 0.111713260412, 0.028852330521, 0.141517728567, 0.107520923018, 0.110034301877, -0.201634734869, -0.381275653839, -0.078118510544, 0.021221680567, -0.000039893843, -0.261407405138, -0.463882297277, -0.261210352182, 0.043578606099, 0.124341018498, 0.147876724601, 0.256710827351, 0.163738816977, 0.183009684086, 0.197693213820, 0.059376716614, 0.118230111897, 0.286897182465, 0.220681861043, -0.059716865420, -0.174714148045, -0.226125821471, -0.115073658526, -0.032441951334, 0.071460574865, 0.037917770445, 0.248829960823, 0.125631600618, 0.138321414590, -0.112150236964, 0.133524149656, -0.023171305656, 0.022249057889, -0.220012947917, -0.510374784470, -0.031237186864, -0.039846330881, 0.220960170031, 0.043411400169, 0.083714976907, 0.056888371706, 0.088764771819, -0.100346520543, -0.085371933877, 0.098193019629, 0.259388595819, 0.133148550987, 0.022248249501, 0.019544722512, -0.034921396524, -0.031670421362, 0.043903715909, 0.158135086298, 0.250468879938, 0.245645239949, 0.355107426643, 0.441281557083, 0.021196734160, 0.025371288881, -0.188695982099, -0.120336093009, -0.242503315210, -0.322815895081, -0.118814729154, -0.065050974488, -0.040055744350, -0.061064422131, -0.095781236887, -0.168751403689, -0.106302537024, -0.109285376966, 0.019458437338, 0.246187582612, 0.291793078184, 0.042673166841, 0.129375040531, 0.027262773365, -0.178505778313, -0.057629797608, -0.033299770206, 0.088853597641, -0.048542149365, 0.003961847164, 0.124264746904, 0.061985988170, -0.098994202912, -0.126673668623, -0.175139099360, -0.168820276856, -0.073310226202, -0.296150296926, -0.159521475434, -0.349800586700, -0.161070629954, -0.144496142864, -0.330747872591, -0.256945252419, -0.234628885984, -0.113438837230, 0.098514221609, 0.193488657475, 0.258576601744, 0.093840666115, 0.156449526548, -0.037506263703, -0.055748857558, -0.097917459905, -0.095200903714, -0.289817482233, -0.208368614316, -0.410418838263, -0.398370385170, -0.283849865198, 0.030027613044, -0.329996496439, -0.159032121301, -0.146807700396, -0.103945128620, -0.282665163279, -0.178304046392, -0.446021348238, -0.468734115362, -0.313014686108, -0.318007856607, -0.230166882277, -0.114796318114, -0.052586920559, 0.010294812731, 0.226880058646, 0.275544434786, 0.177895963192, 0.007357777562, -0.104840502143, -0.128244414926, -0.093239590526, -0.203832522035, -0.308156579733, -0.349410265684, -0.292183876038, -0.274899661541, -0.352155625820, -0.183038324118, -0.543898999691, -0.190559431911, -0.123893409967, -0.091011717916, -0.342118233442, -0.199631363153, -0.575558066368, -0.347133070230, -0.222609683871, -0.068189516664, 0.028133917600, 0.002636930905, 0.000581373228, 0.020648170263, 0.258491247892, 0.123490303755, 0.011569115333, 0.039297863841, 0.030396215618, -0.118668973446, -0.239376142621, -0.320267111063, -0.308747529984, -0.317440122366, -0.295356273651, -0.194765388966, -0.238787919283, -0.378696501255, -0.527300655842, -0.136590451002, 0.070326082408, -0.185519263148, -0.235875666142, -0.421205580235, -0.248304352164, -0.307065010071, -0.230248600245, 0.080209672451, 0.059399869293, 0.172470450401, 0.140398487449, 0.173061430454, 0.222139850259, 0.158574000001, -0.069502346218, -0.137445315719, -0.030947731808, -0.177976980805, -0.240615934134, -0.153219103813, -0.177238628268, -0.227290302515, -0.121425710618, -0.050032481551, -0.063813343644, -0.859210669994, -0.549544692039, -0.367080450058, -0.110245570540, -0.211976110935, -0.318261116743, -0.827395260334, -0.412538826466, -0.112351350486, -0.088857829571, -0.077183045447, 0.119913265109, 0.178012758493, 0.175466492772, 0.146120280027, 0.168057575822, -0.106487266719, -0.130169376731, -0.079553075135, -0.144025504589, -0.132327765226, -0.045145221055, -0.103452943265, 0.006613067351, -0.137276425958, -0.098115444183, 0.013047579676, -0.079283617437, -0.761473476887, -0.498045742512, -0.270386248827, -0.169065907598, -0.278756320477, -0.431968301535, -0.603964745998, -0.353343069553, 0.013601024635, -0.021421147510, -0.099888361990, 0.007861576043, 0.114496178925, 0.083968140185, -0.033191371709, -0.100207641721, -0.123522587121, -0.190127491951, -0.093148998916, -0.066447913647, -0.012921935879, -0.015370757319, 0.075172893703, -0.020288888365, 0.016695775092, 0.091904751956, 0.157840490341, -0.147767528892, -0.776977181435, -0.459491670132, -0.220671698451, -0.075179606676, -0.237636387348, -0.523745656013, -0.527546167374, -0.293637633324, -0.088951013982, 0.085975810885, 0.097009100020, -0.012274720706, -0.026750996709, -0.067761518061, -0.161099776626, -0.023829612881, -0.101585008204, -0.084185600281, -0.057707589120, -0.153044089675, -0.113916367292, -0.004922568798, -0.029101051390, 0.025041548535, 0.106578268111, 0.159453138709, 0.048715755343, -0.135785117745, -0.817888736725, -0.360902041197, -0.109225787222, -0.142912685871, -0.041322205216, -0.397818684578, -0.617250680923, -0.147079050541, -0.096878528595, 0.085725069046, 0.134193465114, 0.057336546481, -0.026984820142, -0.017478173599, -0.035366673023, -0.100006751716, -0.005356022157, 0.040324691683, -0.008821593598, -0.032054983079, -0.016839522868, -0.014458445832, 0.016403818503, 0.018118161708, -0.011448888108, 0.072209894657, -0.082392647862, -0.409002453089, -0.505940318108, -0.435193538666, -0.050642546266, -0.091728717089, -0.044711139053, -0.498104840517, -0.303226262331, -0.179384157062, -0.198348984122, 0.001584461541, 0.050063356757, -0.019170895219, -0.099696643651, -0.001491205068, -0.009178252891, 0.154888972640, 0.190551787615, 0.108902491629, 0.026649098843, -0.015469084494, 0.012319262139, -0.033752549440, -0.010404278524, -0.064354106784, -0.012567370199, -0.016968559474, 0.031877819449, -0.342103481293, -0.336235612631, -0.256216913462, -0.137212663889, -0.017813622952, -0.044052965939, -0.331049084663, -0.247208967805, -0.216036453843, -0.394692450762, -0.301418095827, -0.144786164165, 0.005499833263, 0.008364171721, -0.019164185971, 0.132324650884, 0.111534893513, 0.264651954174, 0.229100689292, 0.190514340997, 0.216220512986, 0.037204340100, 0.081181161106, 0.074455462396, 0.010831410065, 0.074710443616, -0.028138248250, 0.096795253456, -0.222914770246, -0.289742857218, -0.222931981087, 0.086830280721, -0.066663205624, -0.048619169742, -0.176422774792, -0.217908143997, -0.679570555687, -0.599633038044, -0.397831559181, -0.321766734123, 0.044720508158, -0.008346020244, 0.037893489003, 0.161860272288, 0.180411741138, 0.147179812193, 0.114628374577, 0.161093294621, 0.273218721151, -0.070237554610, 0.204267948866, 0.311032682657, 0.070454798639, -0.068985693157, -0.195501729846, -0.291309505701, -0.437582343817, -0.457034498453, -0.178506895900, 0.061473704875, -0.000431589782, -0.009138233960, -0.231812179089, -0.262429893017, -0.518556654453, -0.674085855484, -0.370119631290, -0.425216913223, -0.374804288149, -0.298819303513, -0.130107626319, -0.118988126516, -0.189208090305, -0.164781808853, -0.065533466637, 0.141731128097, 0.102637737989, 0.056796818972, 0.018013872206, -0.009073623456, -0.039702937007, -0.456385403872, -0.669002532959, -0.317897766829, -0.311950892210, -0.092948883772, -0.186428815126, 0.040708549321, 0.035726197064, -0.017881691456, -0.045597162098, -0.172158092260, -0.268110871315, -0.354646593332, -0.625945091248, -0.208269223571, -0.262053877115, -0.423614382744, -0.483963966370, -0.371582210064, -0.469020515680, -0.446941405535, -0.485847860575, -1.152530670166, -1.020165324211, -0.534200608730, -0.538774907589, -0.805097520351, -0.706991493702, -0.508049845695, -0.259923756123, -0.072571292520, -0.125567302108, 0.036248020828, -0.064209446311, 0.069753654301, -0.000035852194, 0.078860692680, 0.052699156106, -0.068257451057, 0.001357531408, -0.120234683156, -0.087642379105, -0.170410171151, -0.119612917304, -0.209129974246, -0.343846261501, -0.389126390219, -0.340349406004, -0.345798939466, -0.457972854376, -0.269572824240, -0.382371395826, -0.357631027699, -0.219915673137, -0.340426892042, -0.207173138857, -0.256852954626, -0.270891726017, -0.151872903109, -0.037592217326, 0.064912416041, -0.020430058241, -0.068611860275, -0.074590049684, -0.065636008978, 0.073796994984, 0.070659168065, 0.027265250683, -0.023965917528, -0.070074684918, -0.079258166254, 0.005534254014, 0.042556203902, 0.056576363742, 0.047688581049, -0.187661662698, -0.117522038519, -0.094450898468, 0.010779830627, -0.013759985566, 0.055710323155, 0.066652007401, -0.082806475461, 0.006020992994, -0.059642702341, -0.068726927042, -0.029829621315, -0.082654044032, 0.063593171537, -0.075986661017, -0.011529877782, 0.019398629665, 0.026704043150, -0.067816473544, -0.028558649123, 0.057286947966, 0.033996064216, -0.070373296738, -0.016899621114, -0.083149760962, -0.148395657539, -0.309769690037, -0.336669355631, -0.405062168837, -0.283345282078, -0.215017884970, -0.154906332493, -0.175359427929, -0.275127381086, -0.227782100439, -0.125754147768, -0.191359490156, -0.172425836325, -0.226931393147, -0.081410109997, 0.001323968172, 0.004423156381, -0.015046149492, -0.083795540035, -0.003152810037, 0.082607202232, -0.070251770318, -0.144703477621, -0.128200367093, 0.019444815814, -0.053161740303, -0.075673207641, -0.156185150146, -0.181701496243, -0.388801306486, -0.619072079659, -0.604413688183, -0.807764887810, -0.687412917614, -0.644451856613, -0.656495988369, -0.636878967285, -0.625063896179, -0.415350228548, -0.314811259508, -0.149803340435, -0.282959789038, -0.133229732513, -0.068426154554, -0.012937117368, 0.004360087216, -0.081781059504, 0.042537115514, -0.022011868656, 0.056336168200, -0.187127992511, -0.106545761228, -0.139249429107, -0.188444837928, -0.207282483578, -0.390017032623, -0.446921616793, -0.779510974884, -0.952747285366, -0.968240678310, -1.091413378716, -1.202674746513, -1.242785811424, -1.226669669151, -0.885334193707, -0.310292840004, -0.698157012463, -0.516902804375, -0.540057301521, -0.408903360367, -0.117171101272, -0.172841876745, -0.025820158422, 0.027788333595, 0.068732805550, 0.064742438495, 0.036900468171, -0.041727911681, -0.113747589290, -0.146342515945, -0.161888390779, -0.324048519135, -0.489200145006, -0.554583013058, -0.903493702412, -0.552029371262, -0.501443564892, -0.375196516514, -0.374092578888, -0.381359696388, -0.552796542645, -0.587137341499, -0.618583619595, -0.548205256462, -0.647979557514, -0.510684370995, -1.233961224556, -0.925249814987, -0.597316503525, -0.342567980289, -0.254010140896, -0.258509218693, -0.202754259109, 0.077912874520, -0.020506948233, -0.156665384769, -0.264382630587, -0.259252756834, -0.508540987968, -0.884934842587, -0.544142961502, -0.439868122339, -0.294307768345, -0.232983574271, 0.082833759487, 0.002982476028, 0.023380577564, -0.201113507152, -0.149753972888, -0.448125302792, -0.299194693565, -0.332911044359, -0.317861974239, -0.313415944576, -0.372952759266, -0.635022222996, -1.269529104233, -0.904834806919, -0.605016589165, -0.208709433675, -0.086833216250, -0.071314051747, -0.199819073081, -0.196895271540, -0.379257440567, -0.632522165775, -0.729630410671, -0.498160958290, -0.437092661858, -0.223476290703, -0.076114073396, -0.030541157350, 0.043665591627, 0.117732800543, 0.242670685053, 0.251789659262, 0.204534620047, 0.266293138266, 0.193109884858, 0.149929210544, 0.058455850929, 0.002358516678, -0.096548929811, -0.434193819761, -0.532681107521, -0.583991885185, -0.459218144417, -0.492669820786, -0.240429833531, 0.014483846724, -0.274704962969, -0.331418782473, -0.521296381950, -0.811467647552, -0.664268016815, -0.342835992575, -0.313146084547, -0.097225345671, -0.034963391721, -0.014988415875, 0.043424554169, 0.153593361378, 0.271189987659, 0.343996167183, 0.388115912676, 0.413255929947, 0.134151861072, 0.144229367375, 0.013972186483, -0.021065725014, -0.027665149420, -0.207227423787, -0.401555240154, -0.587321460247, -0.571312844753, -0.579039454460, -0.178379699588, -0.163458764553, -0.197861269116, -0.478027015924, -0.516768097878, -0.535685837269, -0.334846913815, -0.123818099499, -0.262244313955, -0.031467657536, -0.158775672317, -0.048889335245, -0.066338121891, -0.139030471444, 0.114514000714, 0.236755222082, 0.160414218903, 0.181086033583, 0.001804689877, -0.012066072784, -0.040369194001, -0.045622501522, 0.055110014975, -0.119748540223, -0.337398141623, -0.368563771248, -0.543654441833, -0.546541571617, -0.317416280508, -0.102139174938, -0.310136854649, -0.505319058895, -0.323879092932, -0.478122472763, -0.083810783923, -0.017143078148, -0.082019351423, -0.046883940697, -0.007662485819, -0.010115650482, 0.043513521552, -0.044036984444, 0.036563992500, 0.088780060410, 0.109263442457, -0.032983388752, -0.116456605494, -0.011546572670, -0.132463619113, -0.034487430006, -0.130908027291, -0.171328619123, -0.371192395687, -0.515719890594, -0.742225527763, -0.670622289181, -0.379667729139, -0.081376157701, -0.300541311502, -0.526117146015, -0.378769576550, -0.282837778330, 0.026509217918, 0.129609793425, 0.056242972612, 0.126631751657, 0.047054421157, 0.088951960206, 0.118632867932, 0.063079021871, -0.131790190935, -0.072584182024, -0.118285872042, -0.026371560991, -0.000980483834, 0.070724733174, 0.016431283206, -0.012937986292, -0.037918142974, -0.123378403485, -0.290447205305, -0.525901317596, -0.442776381969, -0.623868346214, -0.308166265488, -0.143396586180, -0.455414563417, -0.619388163090, -0.356773465872, -0.105652511120, 0.183702856302, 0.143975228071, 0.116695113480, 0.255023151636, 0.154459103942, 0.199175789952, 0.139987885952, 0.022396415472, -0.117780119181, -0.032203692943, 0.004891357385, 0.076493330300, 0.216541707516, 0.217838138342, 0.124712802470, 0.355118960142, 0.238007083535, 0.079515650868, -0.134502604604, -0.468266636133, -0.495153248310, -0.406858414412, -0.233611389995, -0.113686986268, -0.447349458933, -0.589167714119, -0.244016304612, 0.158255800605, 0.228495836258, 0.265520632267, 0.198378443718, 0.133473426104, 0.201838821173, 0.218701854348, 0.087280914187, -0.192525982857, -0.031256571412, 0.127729132771, 0.225105002522, 0.296022027731, 0.258743554354, 0.305972009897, 0.362681418657, 0.281494826078, 0.282854080200, 0.214664265513, 0.128441587090, -0.611036837101, -0.964904725552, -0.498203635216, -0.203984528780, -0.089840479195, -0.261533141136, -0.477635622025, -0.041847176850, 0.289115160704, 0.304915219545, 0.165113613009, 0.142734229565, 0.109665505588, 0.102654285729, 0.086390875280, -0.062645457685, -0.231414109468, 0.044066425413, 0.145623266697, 0.176871344447, 0.285004585981, 0.354763865471, 0.215024128556, 0.283697694540, 0.276953548193, 0.257574409246, 0.133386179805, -0.193763390183, -0.695381104946, -0.668447017670, -0.324561089277, -0.084705792367, -0.215513423085, -0.157806590199, -0.463498026133, 0.012711049989, 0.222743958235, 0.079285040498, 0.091163918376, 0.077534236014, 0.074280910194, -0.017520908266, -0.079862535000, -0.024920286611, -0.101244308054, 0.032627087086, -0.002474300098, 0.156841978431, 0.258396714926, 0.278917729855, 0.109032571316, 0.117450639606, 0.096107192338, 0.059710517526, -0.063007861376, -0.394789755344, -0.990174174309, -0.600044667721, -0.303782969713, -0.198068886995, -0.228339359164, -0.018857629970, -0.494540423155, -0.119150221348, 0.045783698559, 0.082516916096, -0.000427676423, 0.042975783348, 0.065189167857, -0.048440139741, 0.050357498229, -0.015797145665, -0.050267368555, -0.166867047548, -0.140029072762, 0.100641652942, 0.270995080471, 0.260147213936, 0.085985854268, 0.009212946519, 0.076823905110, -0.084412209690, -0.265303790569, -0.442158609629, -1.016738653183, -0.577705562115, -0.159199595451, -0.154907032847, -0.036842830479, -0.057201348245, -0.299732863903, -0.121778532863, 0.014239761047, 0.008969425224, -0.125106707215, 0.007084080484, 0.019941277802, -0.076253391802, 0.084685213864, 0.086624406278, -0.044945057482, -0.224483475089, -0.141799092293, 0.031590227038, 0.164780318737, 0.115386933088, 0.086259722710, -0.148774221539, -0.133548051119, -0.232297912240, -0.111795626581, -0.463999003172, -0.876747310162, -0.649661362171, -0.455895394087, -0.360277563334, -0.003749392927, -0.111993722618, -0.403391689062, -0.230089068413, -0.243764936924, -0.142475455999, -0.169723629951, 0.011645959690, -0.000237921835, 0.054856900126, 0.051804330200, 0.045217748731, -0.070582211018, -0.092587105930, -0.011395944282, 0.167793720961, 0.032702762634, 0.005928459112, -0.084445640445, -0.134268224239, -0.126594915986, -0.289294749498, -0.405495285988, -0.538540244102, -0.717963039875, -0.564803302288, -0.323585301638, -0.269167900085, -0.033571131527, -0.136036887765, -0.324022889137, -0.568902790546, -0.430635601282, -0.337047368288, -0.074397996068, -0.164505377412, -0.061006244272, -0.005618314724, 0.133778944612, 0.045774258673, -0.199938952923, -0.228623226285, 0.032435111701, 0.080534853041, -0.061961371452, -0.045668169856, -0.057909853756, -0.032917890698, -0.088483303785, -0.287284702063, -0.283072471619, -0.566323220730, -0.691516160965, -0.329534351826, -0.410122334957, -0.280909895897, 0.047851111740, -0.184941917658, -0.401022493839, -0.428644955158, -0.483652323484, -0.337692856789, -0.145603507757, -0.112706787884, -0.153360337019, -0.366377234459, -0.260106325150, -0.359032958746, -0.245468959212, -0.189216554165, -0.149716094136, -0.114008545876, -0.088811010122, -0.229386344552, -0.178324431181, -0.093685068190, -0.014766068198, -0.289009124041, -0.311149239540, -0.353082090616, -0.343807488680, -0.258465647697, -0.140912741423, -0.239340141416, -0.000426799059, -0.081980839372, -0.318782866001, -0.467833876610, -0.362462341785, -0.023900780827, -0.198968142271, -0.342557013035, -0.277131378651, -0.393051952124, -0.406751096249, -0.467581421137, -0.408655107021, -0.169885888696, -0.230254709721, -0.218090370297, -0.154459804296, -0.162601873279, -0.200131252408, -0.104718700051, -0.207536801696, -0.344297438860, -0.383519709110, -0.251130044460, 0.144887074828, 0.033024638891, -0.165827140212, 0.031560290605, 0.030229553580, -0.211408391595, -0.325138479471, -0.547171652317, -0.190493389964, -0.036003530025, -0.196103900671, -0.278098762035, -0.177713900805, -0.138405457139, -0.257357120514, -0.236464992166, -0.243721202016, -0.215535268188, -0.157882928848, -0.177361667156, -0.065821237862, -0.235464453697, -0.239080116153, -0.193387210369, -0.135115176439, -0.145360559225, -0.212741881609, -0.059445172548, 0.115818157792, -0.038570377976, -0.266936004162, 0.072010144591, -0.116343684494, -0.054929252714, -0.354781597853, -0.236521616578, -0.072884984314, -0.325186371803, -0.268620908260, -0.148922100663, -0.082996428013, -0.071637369692, -0.001334397006, -0.065047897398, -0.035709146410, -0.031365476549, -0.141336813569, -0.189475566149, -0.171382576227, -0.219682544470, -0.131235316396, -0.318107724190, -0.199116140604, -0.173919215798, -0.033157296479, 0.033778429031, 0.189352452755, -0.006489378866, -0.272428721189, 0.022742651403, -0.072481893003, 0.053548492491, -0.327049762011, -0.076366111636, -0.415842145681, -0.222983703017, -0.266731500626, -0.184603497386, 0.020497905090, -0.108970917761, -0.101126827300, -0.085777349770, -0.136258989573, -0.153647452593, -0.107340261340, -0.144847899675, -0.160526663065, -0.133334547281, -0.198402196169, -0.123661078513, 0.080824680626, 0.121530584991, 0.221322536469, 0.263102531433, 0.173320204020, -0.124939754605, -0.229814261198, 0.018083848059, 0.029599197209, 0.046620167792, -0.181799247861, -0.478190988302, -0.061456494033, 0.044100489467, 0.017379576340, 0.100438311696, 0.046796415001, -0.113470077515, 0.032210845500, -0.025221176445, -0.183023899794, -0.150889128447, -0.207755699754, -0.089834146202, -0.008134548552, 0.034086141735, 0.021833788604, 0.072421245277, 0.255090236664, 0.224722132087, 0.251387208700, 0.283721446991, -0.066907607019, -0.235758036375, -0.101161010563, -0.061748787761, 0.040865860879, 0.009049981833, 0.085557237267, -0.460622131824, -0.009697753005, 0.373908549547, 0.179775074124, 0.267437517643, 0.156792774796, 0.149359062314, 0.145119488239, 0.082562431693, 0.169901654124, 0.044947072864, 0.083106294274, 0.083793573081, 0.125349000096, 0.237872570753, 0.252348840237, 0.329598009586, 0.411931157112, 0.349326342344, 0.174850314856, 0.071116536856, -0.087560236454, -0.076880447567, -0.215867087245, 0.079806409776, 0.045411832631, -0.025131102651, 0.036794535816, 0.083941824734, 0.358983010054, 0.352168977261, 0.405679881573, 0.351759374142, 0.400570511818, 0.367840617895, 0.326204538345, 0.252408146858, 0.385869950056, 0.352103799582, 0.526352345943, 0.241596505046, 0.280934065580, 0.282511383295, 0.295800000429, 0.209592714906, 0.381417244673, 0.150928393006, -0.041036676615, 0.118283241987, 0.057746578008, -0.088648796082, -0.027295801789, -0.026688959450, -0.073232591152, 0.014062620699, -0.058618571609, -0.018161542714, -0.128470972180, -0.224453106523, 0.031406804919, 0.087497487664, 0.048616964370, 0.017548942938, -0.107921101153, 0.012326241471, -0.038669548929, -0.551784992218, -0.046644546092, -0.064952582121, -0.182198792696, -0.436139643192, -0.192236065865, -0.158786267042, 0.006150553003, -0.013329480775, -0.161309793591, -0.201773837209, -0.021697692573, -0.043291632086, -0.060949653387, 0.081067524850};
-TPrecision ip1_biases[] = {-0.357464134693, 0.479175776243, 0.074342429638, -0.285570561886, 0.098733559251, 0.903623878956, -0.104794636369, 0.476542890072, -1.049197673798, -0.185828864574};
+const TPrecision ip1_weights_trans[] = {0.018667995930, 0.000447072089, 0.031374752522, 0.070837847888, 0.063643805683, 0.079327724874, 0.059543319046, 0.055949531496, 0.038891069591, -0.074590049684, 0.059371449053, -0.070190668106, -0.071548394859, 0.048890821636, 0.071395300329, 0.012513220310, -0.016816124320, -0.070651955903, 0.064894340932, -0.065636008978, -0.025514069945, 0.034806296229, -0.031904246658, 0.044306732714, 0.084791935980, 0.003691360354, 0.081607215106, 0.072563268244, -0.037410788238, 0.073796994984, -0.030562266707, -0.052220311016, 0.067052297294, -0.073409751058, 0.040876246989, -0.080607041717, 0.045258201659, 0.025905057788, 0.078268878162, 0.070659168065, -0.071564994752, 0.048653207719, 0.075599111617, 0.035421513021, 0.031761981547, -0.032870985568, 0.023188024759, 0.052538610995, 0.023925706744, 0.027265250683, -0.084544830024, -0.011683411896, -0.073500633240, -0.035976976156, 0.006926797330, 0.017362035811, 0.082652546465, 0.068383269012, -0.053783077747, -0.023965917528, -0.079564385116, -0.051696766168, -0.003451921046, 0.054706089199, 0.009038545191, -0.026910409331, -0.085977748036, 0.034620136023, -0.007665395737, -0.070074684918, -0.076922439039, -0.083123266697, -0.011738210917, 0.085692860186, 0.076696075499, 0.014278575778, -0.033028542995, -0.057001277804, 0.056766428053, -0.079258166254, -0.085307031870, -0.002751268446, 0.073963753879, 0.046343944967, 0.052013330162, -0.033177163452, 0.071809716523, -0.064928062260, -0.075378097594, 0.005534254014, -0.041354667395, -0.031057067215, -0.009136199951, -0.039491690695, -0.047977134585, -0.022786900401, 0.057433940470, -0.037583578378, 0.005316652358, 0.042556203902, 0.065358318388, 0.073986046016, 0.005365237594, -0.036426510662, 0.012753471732, -0.045699898154, 0.008552759886, -0.055072329938, 0.082432381809, 0.056576363742, 0.079380176961, 0.059553898871, 0.060553811491, -0.030934974551, 0.084099911153, 0.016264498234, 0.009990572929, -0.053400672972, -0.023218177259, 0.047688581049, 0.016916435212, 0.025504052639, -0.170337080956, -0.167215555906, -0.130794361234, -0.087534822524, 0.081089869142, 0.014785734005, -0.114805229008, -0.187661662698, -0.164530888200, -0.014830965549, -0.011240878142, -0.080280736089, -0.164462089539, -0.180749952793, 0.071265667677, 0.013607626781, -0.062130279839, -0.117522038519, -0.026671778411, -0.010430654511, 0.089330121875, -0.142273500562, -0.105478882790, 0.066838540137, -0.073220625520, 0.067235819995, -0.071878552437, -0.094450898468, -0.074697598815, -0.057336237282, 0.111044235528, 0.002275194973, -0.015343267471, -0.052558466792, -0.036193363369, 0.028530793265, -0.078720137477, 0.010779830627, -0.009639270604, 0.018706440926, -0.041933968663, 0.038883067667, 0.055115811527, 0.081536121666, -0.033833481371, -0.022165738046, 0.059984542429, -0.013759985566, 0.008743122220, 0.085530556738, 0.066342718899, -0.016292832792, 0.031107656658, 0.002439931035, 0.027077913284, -0.023370176554, 0.037692844868, 0.055710323155, -0.034359596670, -0.073550291359, 0.021777942777, 0.002353236079, 0.027984797955, -0.020522035658, -0.068498820066, -0.001498870552, -0.056096192449, 0.066652007401, -0.042144518346, 0.050696484745, 0.050523720682, 0.028528556228, 0.053577043116, 0.005942441523, -0.061135604978, -0.020253270864, -0.017779968679, -0.082806475461, -0.084212996066, -0.058888044208, -0.055623546243, 0.011454746127, -0.025235332549, 0.021417669952, 0.039101593196, 0.007394723594, -0.025706712157, 0.006020992994, 0.007669046521, 0.016283169389, 0.006584294140, 0.041220299900, -0.070907771587, 0.009140990674, -0.071642532945, -0.034998234361, 0.044820137322, -0.059642702341, 0.002151705325, -0.068080142140, 0.040667198598, 0.056843124330, 0.044143311679, 0.071251787245, 0.016317345202, -0.032365430146, -0.082747302949, -0.068726927042, 0.009229861200, -0.080872267485, 0.006622672081, -0.047226831317, -0.084425449371, 0.007431097329, -0.018234081566, 0.083405710757, 0.017114967108, -0.029829621315, -0.040067136288, -0.050949651748, 0.078209914267, 0.028221301734, -0.064099416137, -0.021560244262, 0.049873478711, 0.024194866419, 0.015000015497, -0.082654044032, -0.044752325863, -0.039886720479, 0.055483736098, -0.085158199072, 0.080992199481, 0.029389224946, 0.051349647343, -0.069625295699, -0.017124854028, 0.063593171537, -0.005247391760, 0.011696554720, 0.070531807840, -0.073183245957, -0.002522811294, 0.080222271383, -0.016607336700, -0.009597904980, 0.001762188971, -0.075986661017, 0.030985772610, 0.073228694499, -0.064419642091, -0.038250129670, 0.024882249534, 0.067328922451, 0.079136364162, 0.049659572542, 0.014844387770, -0.011529877782, -0.016799032688, 0.045213736594, 0.049854777753, 0.050197891891, -0.030579511076, -0.020956590772, -0.043032169342, -0.037829484791, 0.018789961934, 0.019398629665, -0.042251337320, -0.058163583279, 0.026570364833, 0.036357581615, -0.047453235835, 0.003067336977, -0.078479275107, -0.024444092065, -0.073862440884, 0.026704043150, -0.038342710584, -0.085971757770, 0.033542782068, -0.009917557240, -0.057001128793, -0.066543430090, -0.003811068833, 0.033236585557, -0.039546698332, -0.067816473544, 0.013296872377, -0.049467526376, -0.073575705290, 0.022961907089, -0.036450721323, 0.032140560448, 0.036770641804, 0.072524778545, 0.065099529922, -0.028558649123, -0.028118366376, -0.002637157449, -0.115833356977, 0.076269924641, -0.067355968058, 0.013517237268, 0.057568963617, -0.077391080558, 0.060591772199, 0.057286947966, -0.023391956463, 0.071674652398, -0.150850176811, 0.052952688187, -0.086758866906, -0.050936531276, 0.141913995147, -0.030794864520, 0.020618375391, 0.033996064216, 0.000424430065, -0.083483137190, -0.228710666299, 0.013236791827, -0.245441898704, -0.035267632455, 0.336682677269, 0.006489408668, -0.068927802145, -0.070373296738, -0.107378616929, -0.061460550874, -0.158022776246, 0.005884860642, -0.240247964859, 0.049623802304, 0.291690140963, -0.049084875733, -0.058457434177, -0.016899621114, -0.045708462596, -0.090378150344, -0.140882238746, -0.221685752273, -0.254923045635, -0.108981952071, 0.350323259830, -0.142457842827, -0.245098769665, -0.083149760962, -0.041817843914, -0.137600198388, -0.109624706209, -0.153637006879, -0.422309815884, -0.224047645926, 0.363716244698, -0.239884957671, -0.205001935363, -0.148395657539, -0.170169711113, -0.196122586727, -0.312408596277, -0.200567424297, -0.293918341398, -0.175457477570, 0.356919407845, -0.241477191448, -0.164956852794, -0.309769690037, 0.094182953238, -0.058006573468, -0.233718693256, -0.243632420897, -0.445806533098, -0.219251126051, 0.304132193327, -0.183554127812, -0.172082290053, -0.336669355631, 0.113302543759, -0.101654291153, -0.416391521692, -0.256268888712, -0.611056566238, -0.178619489074, 0.447566509247, -0.199663802981, -0.123792707920, -0.405062168837, 0.075228326023, -0.049199648201, -0.365804165602, -0.217977687716, -0.468460768461, -0.271748572588, 0.275951176882, -0.240248128772, -0.167539700866, -0.283345282078, -0.302513331175, 0.187106922269, -0.060347709805, -0.181479543447, -0.220372974873, -0.283175498247, 0.016787121072, -0.085618704557, -0.181775301695, -0.215017884970, 0.080345526338, 0.166304528713, -0.003796007717, -0.197752028704, -0.352624356747, -0.249154269695, 0.119000285864, -0.208153918386, -0.260848402977, -0.154906332493, -0.021703897044, -0.311332941055, 0.353802144527, -0.431187480688, -0.455063253641, -0.372791409492, -0.039810400456, -0.172269299626, -0.351233363152, -0.175359427929, 0.056644670665, -0.325378805399, 0.067913837731, -0.264916360378, -0.456097424030, -0.394817322493, 0.317588388920, -0.139826446772, -0.390410751104, -0.275127381086, -0.189680531621, -0.040335111320, -0.322232156992, -0.162313699722, -0.432724833488, -0.282164454460, 0.377572804689, -0.132041588426, -0.166912347078, -0.227782100439, -0.225364074111, -0.094471491873, -0.335472553968, -0.015354009345, -0.213295936584, -0.292148530483, 0.301637470722, -0.116607859731, -0.175042748451, -0.125754147768, -0.241257488728, -0.100157067180, -0.253564119339, -0.127915948629, -0.260125219822, -0.313908576965, 0.259509980679, -0.026355881244, -0.155178710818, -0.191359490156, -0.262499243021, -0.051871035248, -0.325167834759, -0.312300741673, -0.210380792618, -0.290352702141, 0.164310455322, -0.115266397595, -0.292811274529, -0.172425836325, -0.081518888474, -0.003725465387, -0.181926950812, -0.122613608837, -0.150722250342, -0.085309311748, 0.143489718437, -0.078245848417, -0.196437329054, -0.226931393147, 0.015146377496, -0.079840265214, -0.109648935497, -0.084210328758, -0.129206016660, -0.006925380323, 0.154029160738, -0.075059525669, -0.183450907469, -0.081410109997, 0.079833902419, -0.074986986816, 0.019085921347, -0.019017986953, -0.026913642883, 0.075624831021, -0.020004540682, 0.050519935787, 0.037656530738, 0.001323968172, -0.011083677411, -0.078647255898, -0.041267205030, 0.065449722111, 0.036813728511, 0.007480293512, -0.020141683519, -0.063177108765, -0.013348810375, 0.004423156381, -0.063341043890, -0.067339107394, 0.061300076544, 0.026763133705, -0.024607557803, 0.061024658382, 0.055558197200, 0.070752553642, -0.056667283177, -0.015046149492, 0.079714991152, 0.033867716789, 0.050799451768, 0.029143609107, -0.059182222933, -0.058737307787, 0.021381564438, 0.042499192059, 0.039007090032, -0.083795540035, 0.031253777444, 0.034501194954, -0.030629977584, -0.029516499490, -0.011871702969, -0.025900579989, 0.062389783561, -0.004991307855, -0.070747166872, -0.003152810037, 0.032514303923, -0.064790800214, 0.032090984285, 0.011831745505, 0.082968287170, -0.055500023067, -0.080597035587, -0.029356934130, 0.052035771310, 0.082607202232, -0.002335875062, 0.073802918196, 0.064358144999, 0.071504265070, -0.107512116432, -0.089871555567, 0.054655771703, 0.067111104727, -0.069270700216, -0.070251770318, 0.035963911563, -0.080461107194, -0.220695614815, 0.048474118114, -0.143524855375, -0.127941355109, 0.024856740609, -0.115695089102, -0.149331405759, -0.144703477621, 0.052836950868, -0.054212484509, -0.168977290392, -0.080224432051, -0.256517827511, -0.133596569300, 0.144615978003, -0.124414205551, -0.063560359180, -0.128200367093, -0.164594590664, -0.045838549733, -0.153854921460, -0.133597090840, -0.093850083649, -0.159095525742, 0.317738622427, 0.010609264486, -0.049057800323, 0.019444815814, -0.266673028469, -0.140480428934, -0.120734810829, -0.168812379241, -0.307055026293, -0.191253542900, 0.396400362253, -0.044346913695, -0.202469781041, -0.053161740303, -0.209267616272, -0.243283212185, -0.140408173203, -0.320106238127, -0.399575352669, -0.212908223271, 0.406036376953, -0.192286521196, -0.329696208239, -0.075673207641, -0.340938597918, -0.315776973963, 0.011717699468, -0.372873365879, -0.469006627798, -0.330821543932, 0.434482127428, -0.200248479843, -0.319507151842, -0.156185150146, -0.397833734751, -0.325105994940, 0.117698445916, -0.449552357197, -0.641293048859, -0.413761526346, 0.277554720640, -0.211279496551, -0.365646392107, -0.181701496243, -0.739445567131, -0.464784801006, -0.020472301170, -0.240128636360, -0.705654442310, -0.355193823576, 0.469612866640, -0.401257693768, -0.596001386642, -0.388801306486, -0.216504946351, -0.358971834183, 0.027094421908, -0.003207281698, -0.984871745110, -0.307432562113, 0.493242442608, -0.452547281981, -0.680291235447, -0.619072079659, -0.200665026903, -0.040513843298, 0.069677978754, 0.010275404900, -0.885772466660, -0.567364811897, 0.437782883644, -0.385878622532, -0.792090773582, -0.604413688183, -0.452844172716, 0.144439995289, 0.067482024431, -0.204132735729, -0.536983370781, -0.834882736206, 0.217164710164, -0.481432974339, -0.948947846889, -0.807764887810, -0.721890926361, 0.207229271531, -0.022430261597, -0.232556596398, -0.480379790068, -0.913015007973, 0.286826908588, -0.375819742680, -1.058574557304, -0.687412917614, -0.813230812550, 0.286443173885, 0.077151313424, -0.226715952158, -0.544726014137, -0.333648830652, 0.162354990840, -0.342509955168, -0.997399091721, -0.644451856613, -0.512231171131, 0.264836847782, 0.095418259501, -0.268387377262, -0.493658691645, -0.072250694036, 0.241037830710, -0.258682876825, -0.995389878750, -0.656495988369, -0.836532056332, -0.028333459049, 0.080868497491, -0.193956509233, -0.485097169876, 0.065377764404, 0.195781320333, -0.311209648848, -0.521596312523, -0.636878967285, -0.708374857903, -0.094126485288, -0.107913941145, -0.181624755263, -0.813077032566, -0.078383088112, 0.303008943796, -0.150619208813, -0.085397616029, -0.625063896179, -0.651004374027, -0.067475065589, -0.205694228411, -0.266235023737, -0.624639570713, -0.053537890315, 0.305057138205, -0.098178446293, -0.592633128166, -0.415350228548, -0.600087881088, -0.106769062579, -0.196356326342, -0.351682513952, -0.511922895908, -0.213925540447, 0.312070459127, -0.148032680154, -0.491268336773, -0.314811259508, -0.398342669010, -0.305843353271, -0.191652521491, -0.347517669201, -0.291212141514, -0.204178959131, 0.450079679489, -0.097741633654, -0.544105231762, -0.149803340435, -0.276868790388, -0.203341931105, -0.348330825567, -0.369332641363, -0.217588320374, -0.218435645103, 0.351257503033, -0.149325355887, -0.283442020416, -0.282959789038, -0.238671943545, -0.102741546929, -0.027443425730, -0.126905828714, -0.362077683210, -0.260497212410, 0.394748926163, -0.046566240489, -0.312730669975, -0.133229732513, -0.051953751594, -0.055987168103, 0.134857848287, -0.023425161839, -0.317189633846, -0.328876793385, 0.044962689281, -0.101101130247, -0.219178602099, -0.068426154554, 0.001133495593, 0.017774077132, 0.122630149126, 0.064966857433, -0.027068784460, -0.141881346703, -0.153124123812, -0.001656041364, -0.091534644365, -0.012937117368, 0.046977855265, -0.022426046431, -0.016469888389, 0.066390730441, 0.039812631905, -0.060074497014, 0.044148467481, 0.052853234112, 0.079851202667, 0.004360087216, -0.033008377999, 0.072362042964, -0.034202083945, 0.081972546875, 0.074663601816, 0.028664864600, 0.080509655178, 0.078734911978, 0.042099274695, -0.081781059504, 0.082551576197, 0.032083876431, 0.014675095677, 0.005845904350, -0.021787248552, 0.069110579789, -0.011595368385, 0.050788365304, -0.059619881213, 0.042537115514, -0.062390074134, 0.024996988475, -0.061362754554, 0.078983761370, -0.049981664866, 0.067853681743, -0.040331844240, -0.062063567340, -0.050257708877, -0.022011868656, -0.019621456042, 0.132100269198, -0.088976368308, -0.085527621210, -0.049896996468, -0.135139837861, 0.007399049588, -0.072161570191, -0.081635825336, 0.056336168200, 0.071789517999, 0.137032002211, -0.220116719604, -0.243235781789, -0.190714821219, 0.014364574105, 0.106897681952, -0.216481685638, -0.159479558468, -0.187127992511, -0.116349153221, -0.205015257001, -0.252337396145, -0.115693509579, -0.324447274208, 0.092542856932, 0.026517536491, -0.208446130157, -0.221970170736, -0.106545761228, -0.124795764685, -0.308588117361, -0.052912387997, 0.105960845947, -0.380910754204, -0.220874756575, 0.128377556801, -0.150108471513, -0.419787794352, -0.139249429107, -0.327280789614, -0.317528724670, -0.039257783443, 0.155148774385, -0.405288130045, -0.386377573013, 0.190698444843, -0.296670317650, -0.283940196037, -0.188444837928, -0.213609278202, -0.370287746191, 0.035530358553, 0.171958625317, -0.324509203434, -0.396831631660, 0.290567576885, -0.405414849520, -0.338206797838, -0.207282483578, -0.074091061950, -0.511806190014, 0.132510334253, 0.152440845966, -0.465283274651, -0.318776011467, 0.293959259987, -0.432259172201, -0.259876340628, -0.390017032623, -0.180279403925, -0.293288737535, 0.307100117207, 0.032018508762, -0.691861152649, -0.263634443283, 0.245340287685, -0.608344495296, -0.366393834352, -0.446921616793, -0.164118707180, -0.414609670639, 0.260615795851, 0.094417370856, -0.662271261215, -0.172846481204, 0.246106624603, -0.681483447552, -0.386880189180, -0.779510974884, -0.120240315795, -0.548031687737, 0.329744756222, 0.333706766367, -0.715743064880, -0.259012669325, 0.258848309517, -0.604566335678, -0.387062728405, -0.952747285366, -0.050314575434, -0.238293722272, 0.329451292753, 0.320030987263, -0.917666792870, -0.114435799420, 0.175114408135, -0.546205282211, -0.269238859415, -0.968240678310, -0.045494765043, -0.145786002278, 0.318186610937, 0.247362270951, -1.022002816200, -0.075123421848, 0.118396610022, -0.630075335503, -0.270767599344, -1.091413378716, 0.001703208429, -0.150865778327, 0.168199092150, 0.243317350745, -0.714780628681, -0.094722114503, 0.198833033442, -0.590696930885, -0.363884061575, -1.202674746513, -0.080460079014, 0.007348457817, 0.125606164336, 0.258843690157, -0.644297897816, -0.005166788585, 0.177472561598, -0.618383884430, -0.199186041951, -1.242785811424, 0.000448171457, 0.036530002952, 0.163917675614, 0.141043826938, -0.564842760563, -0.046515040100, 0.019951751456, -0.410395383835, -0.308636784554, -1.226669669151, -0.082364387810, -0.184652522206, 0.012575652450, 0.173118248582, -0.417071223259, -0.010341132991, 0.078074723482, -0.502119600773, -0.208290278912, -0.885334193707, -0.237114027143, -0.333059042692, -0.162478223443, 0.198669597507, -0.393489867449, 0.218912184238, 0.187967315316, -0.382820576429, -0.115515768528, -0.310292840004, -0.337490439415, -0.305358350277, -0.207750141621, 0.126173868775, -0.199639186263, 0.176141664386, 0.232068389654, -0.296391695738, -0.352548509836, -0.698157012463, -0.286988675594, -0.350975483656, -0.312776774168, 0.165784239769, -0.097027964890, 0.160522088408, 0.112434305251, -0.211136221886, -0.222246214747, -0.516902804375, -0.402581214905, -0.383793681860, -0.208073675632, -0.236637219787, 0.009824882261, 0.248054727912, 0.224723517895, -0.344278991222, -0.110396265984, -0.540057301521, -0.466781437397, -0.513386189938, -0.351571172476, -0.497712254524, -0.033929549158, 0.125652566552, 0.214081600308, -0.187648162246, -0.011055071838, -0.408903360367, -0.194545850158, -0.462890416384, -0.580675661564, -0.403786003590, -0.017388740554, -0.100168108940, 0.337938576937, -0.122510932386, 0.099700212479, -0.117171101272, -0.203291267157, -0.409659802914, -0.140299066901, -0.260249733925, -0.214048787951, -0.129019901156, 0.197967544198, -0.036855157465, -0.015893390402, -0.172841876745, -0.019876778126, -0.271185457706, 0.014675681479, -0.073989197612, -0.186484619975, 0.140809312463, -0.142823413014, 0.008845816366, -0.039905227721, -0.025820158422, -0.216474503279, -0.134918913245, -0.064426496625, 0.041173007339, -0.145086362958, 0.073515251279, 0.033452916890, -0.089284941554, -0.148018985987, 0.027788333595, 0.013127937913, 0.006506673992, 0.022813364863, -0.020106159151, -0.047155886889, -0.015693008900, -0.031745385379, 0.002358339727, -0.069696590304, 0.068732805550, -0.062647797167, 0.043975465000, 0.084293060005, 0.030173480511, -0.076109252870, -0.005722790956, 0.016449637711, 0.064356781542, 0.026763468981, 0.064742438495, -0.028705658391, 0.046140044928, -0.160494968295, 0.055050600320, -0.028801277280, -0.069625347853, -0.000600037980, 0.054396759719, -0.098451420665, 0.036900468171, 0.003087054938, 0.047837194055, -0.153528556228, 0.030670098960, 0.027307944372, -0.157556310296, -0.210512906313, 0.012253321707, 0.095483474433, -0.041727911681, -0.071418680251, 0.071389578283, -0.261089831591, 0.279517740011, -0.191666796803, -0.121792756021, -0.024447962642, 0.129111945629, -0.345845043659, -0.113747589290, -0.206720724702, 0.133448526263, -0.213460803032, 0.334495812654, 0.109288685024, -0.525077104568, 0.166516393423, -0.147898823023, -0.397516876459, -0.146342515945, -0.197653904557, 0.005852313247, 0.010643961839, 0.357976883650, 0.090436659753, -0.500692248344, 0.018020562828, -0.305774539709, -0.559800624847, -0.161888390779, -0.209334418178, -0.072647422552, 0.161208227277, 0.325922429562, -0.243231728673, -0.225574508309, 0.003063522978, -0.497490048409, -0.405225396156, -0.324048519135, -0.082830116153, -0.177953511477, 0.135156258941, 0.264393150806, -0.184152320027, -0.215737029910, -0.068402498960, -0.656351149082, -0.187394887209, -0.489200145006, 0.045632060617, -0.077990546823, 0.069712549448, 0.228026449680, -0.286443501711, -0.400653302670, 0.073931559920, -0.735645890236, -0.074335917830, -0.554583013058, 0.058179374784, -0.072560139000, 0.290801435709, 0.237558946013, -0.289473205805, -0.186285823584, 0.036067482084, -0.717683017254, 0.084824822843, -0.903493702412, -0.113877385855, -0.116854950786, 0.147861123085, 0.234166041017, -0.562568366528, -0.163446843624, -0.036166980863, -0.874143660069, -0.062144871801, -0.552029371262, 0.038722138852, -0.277117431164, 0.202632501721, 0.216744512320, -0.422278165817, -0.086238570511, -0.217184290290, -0.704721570015, 0.056128527969, -0.501443564892, -0.156356617808, -0.084933459759, 0.240775406361, 0.311469346285, -0.393590360880, -0.036418203264, -0.222292214632, -0.507204949856, 0.119421780109, -0.375196516514, 0.030031187460, 0.058770809323, 0.094844788313, 0.214071705937, -0.239234551787, -0.205828502774, -0.058602206409, -0.548334717751, 0.060183923692, -0.374092578888, -0.044431701303, 0.097574695945, 0.230344042182, 0.170674636960, -0.287566393614, -0.118598014116, -0.117562092841, -0.664793074131, 0.129898160696, -0.381359696388, 0.065632224083, -0.047692481428, 0.078827328980, 0.170451298356, -0.394590973854, 0.100144632161, -0.181418061256, -0.612582623959, 0.187086060643, -0.552796542645, -0.043471284211, -0.011208874173, 0.058369062841, 0.214696511626, -0.232544258237, 0.084881186485, 0.025853674859, -0.893180370331, 0.103455744684, -0.587137341499, 0.038802780211, -0.075261801481, 0.097454696894, 0.027966801077, -0.114494584501, 0.148511111736, 0.143326282501, -0.970782101154, 0.052439026535, -0.618583619595, -0.009103761055, -0.093327991664, 0.019561115652, 0.139732390642, -0.207764849067, 0.170207798481, 0.045186124742, -0.919553279877, -0.004490293562, -0.548205256462, -0.067550688982, 0.092490486801, -0.093740507960, 0.023206189275, 0.144290566444, 0.021597076207, 0.106827259064, -0.814619362354, -0.015447222628, -0.647979557514, -0.147716760635, 0.083584994078, -0.159595683217, -0.124837271869, 0.184280604124, -0.091567955911, 0.178887844086, -0.599551260471, -0.004004439805, -0.510684370995, -0.197323322296, 0.020633729175, -0.259401649237, -0.217314630747, 0.193554922938, 0.150002479553, 0.186797156930, -0.251630306244, -0.000498499197, -1.233961224556, 0.010490179993, -0.049106430262, -0.434101939201, -0.224305868149, 0.338245630264, 0.076527588069, 0.235694006085, -0.313198983669, -0.139599531889, -0.925249814987, -0.164341002703, -0.069567643106, -0.640455484390, -0.757631838322, 0.249610722065, 0.180369630456, 0.349994838238, -0.389627575874, -0.218657210469, -0.597316503525, -0.365861147642, -0.386280566454, -0.472225457430, -0.625540912151, 0.276100546122, 0.356871873140, -0.077691584826, -0.152136474848, 0.050201363862, -0.342567980289, -0.367927402258, -0.521194517612, -0.003003361635, -0.315014749765, -0.115199431777, 0.246056064963, -0.127893164754, -0.187050849199, 0.109674245119, -0.254010140896, -0.172754257917, -0.228713586926, -0.111252829432, -0.154208347201, -0.130235433578, 0.032764911652, -0.066520646214, -0.280624568462, 0.163821816444, -0.258509218693, -0.042509976774, -0.074482113123, -0.199445039034, -0.102393656969, -0.188947007060, -0.242979779840, 0.211436897516, -0.137244269252, 0.040949169546, -0.202754259109, -0.026113431901, 0.015427872539, -0.021584115922, 0.069341368973, -0.027285851538, 0.020267158747, -0.017827391624, 0.009057670832, 0.052539385855, 0.077912874520, 0.086147703230, 0.049749784172, -0.030863326043, 0.058896042407, -0.045482300222, 0.005077071488, 0.033652275801, 0.065988130867, -0.053620383143, -0.020506948233, -0.225293293595, 0.107126213610, -0.052408035845, 0.024297470227, -0.267768889666, -0.259202003479, 0.170530453324, -0.063422441483, -0.240814864635, -0.156665384769, -0.153959229589, 0.129634246230, -0.139981567860, 0.172125160694, -0.084339246154, -0.290619403124, -0.287769734859, -0.036716707051, -0.353362768888, -0.264382630587, -0.424649536610, 0.216079890728, 0.032708521932, 0.240819260478, 0.208409816027, -0.608753085136, 0.085984699428, -0.181644186378, -0.606384217739, -0.259252756834, -0.366256028414, 0.164022222161, 0.022779423743, 0.342725664377, 0.072030089796, -0.408534705639, -0.143366202712, 0.108190745115, -0.495240867138, -0.508540987968, -0.146474376321, 0.042654372752, 0.048684425652, 0.306039124727, 0.038417402655, -0.252536475658, -0.086448632181, 0.006529848557, -0.230028063059, -0.884934842587, -0.089421935380, -0.081394746900, 0.083551347256, 0.231596693397, -0.056374859065, -0.140922322869, -0.198415070772, 0.106303855777, -0.124955512583, -0.544142961502, -0.040501039475, -0.255216270685, 0.132265642285, 0.174893051386, -0.106783866882, -0.107406139374, 0.075386486948, 0.072620019317, -0.053773440421, -0.439868122339, 0.012961494736, -0.369413554668, 0.097255647182, 0.112525716424, -0.083681337535, -0.098686940968, -0.105949021876, 0.122383803129, -0.077218428254, -0.294307768345, -0.021907815710, -0.239915251732, 0.090833604336, 0.133703306317, -0.137834683061, 0.045386191458, 0.012595466338, -0.171592876315, -0.195359334350, -0.232983574271, -0.050094217062, -0.313391655684, 0.129563987255, 0.129639253020, -0.130566373467, 0.009671425447, -0.316702067852, -0.202856481075, 0.009637597017, 0.082833759487, 0.022640373558, -0.213949650526, 0.167513921857, 0.039670173079, -0.165205657482, -0.007949257270, -0.189623042941, -0.191476777196, 0.169178694487, 0.002982476028, 0.037747479975, -0.015434996225, 0.176700219512, 0.153164774179, -0.235059678555, -0.099661231041, -0.255978941917, -0.173194691539, 0.171797811985, 0.023380577564, 0.182991400361, -0.041003838181, 0.210628956556, 0.044327974319, -0.068628877401, -0.041370533407, -0.080017998815, -0.350038856268, 0.076689220965, -0.201113507152, 0.023680130020, 0.004365267232, 0.112462840974, 0.119225658476, -0.068689353764, -0.103993639350, -0.038982007653, -0.305225104094, 0.167942032218, -0.149753972888, 0.121546834707, -0.119471497834, 0.274049490690, 0.179225459695, 0.026820667088, 0.013097251765, -0.146280020475, -0.315835624933, 0.101155065000, -0.448125302792, 0.088776879013, -0.271613717079, 0.138868644834, -0.034110095352, -0.019436515868, 0.112859591842, -0.028634747490, -0.416001796722, 0.148620218039, -0.299194693565, 0.195628494024, -0.093560151756, 0.089484497905, 0.080791391432, 0.049405246973, 0.110603712499, 0.146503478289, -0.403296828270, 0.007177925203, -0.332911044359, 0.021397527307, -0.067546404898, -0.029958931729, -0.060342337936, 0.052744761109, 0.069981940091, 0.165779843926, -0.651270508766, 0.054553851485, -0.317861974239, -0.023073006421, 0.052485693246, -0.011461798102, -0.128068029881, 0.041771911085, 0.142995223403, 0.145780578256, -0.868292510509, 0.098346002400, -0.313415944576, -0.033232145011, 0.180312037468, -0.086555689573, -0.182748600841, 0.000137919138, 0.110433906317, 0.107186280191, -0.755043745041, 0.025063602254, -0.372952759266, -0.011700041592, 0.174891948700, -0.061094909906, -0.236650124192, 0.225536882877, 0.163690283895, 0.178223818541, -0.516794562340, -0.089929059148, -0.635022222996, -0.183849096298, 0.063561134040, -0.315951794386, -0.364611566067, 0.356030017138, 0.202798545361, 0.250831097364, -0.900541186333, -0.213855564594, -1.269529104233, -0.441391766071, -0.068096563220, -0.512981832027, -0.549321055412, 0.136342063546, 0.218355849385, 0.124876283109, -0.524256944656, -0.117402620614, -0.904834806919, -0.575763940811, -0.689814448357, -0.275397956371, -0.718357741833, -0.132060155272, 0.470138400793, 0.011001351289, -0.533366382122, 0.173017486930, -0.605016589165, -0.467468351126, -0.353952735662, -0.136795476079, -0.171346768737, -0.228875309229, 0.395497441292, 0.115197375417, -0.181148692966, 0.040820602328, -0.208709433675, -0.115931980312, -0.056906685233, -0.118786230683, -0.072063185275, -0.216665372252, 0.035950269550, 0.160337030888, -0.194457575679, -0.025227263570, -0.086833216250, 0.008327946067, -0.004260256886, -0.066071487963, -0.034667972475, -0.026398405433, 0.047839306295, 0.036552153528, 0.085772968829, 0.029167339206, -0.071314051747, -0.101540587842, -0.059557177126, -0.137040123343, 0.036470372230, -0.098359510303, -0.061098914593, -0.007861150429, -0.006779991090, -0.053714703768, -0.199819073081, -0.170204207301, -0.217038288713, -0.128648981452, -0.047199215740, -0.333001554012, -0.003102601739, -0.056664351374, 0.173334613442, -0.463224172592, -0.196895271540, -0.296464562416, -0.023336542770, -0.117819644511, 0.285476535559, -0.238864153624, -0.453387290239, -0.456159293652, 0.277421474457, -0.424936920404, -0.379257440567, -0.430560171604, 0.063551023602, 0.092111602426, 0.229285404086, 0.116031795740, -0.439735949039, -0.138907656074, 0.074286222458, -0.470593452454, -0.632522165775, -0.077919706702, -0.079730793834, 0.154036000371, 0.190385073423, 0.097060881555, -0.194939598441, -0.242161542177, 0.202692389488, -0.252701759338, -0.729630410671, -0.009873051196, -0.081048488617, 0.035463292152, 0.214216068387, -0.055126730353, -0.109562695026, -0.197016894817, 0.168098405004, -0.203414261341, -0.498160958290, 0.002946550027, -0.314440906048, 0.128541305661, 0.120944209397, 0.025458887219, -0.119151480496, -0.040009554476, 0.151243343949, -0.133250042796, -0.437092661858, -0.066439419985, -0.348847359419, 0.026549547911, 0.055222876370, 0.006981987506, -0.056986093521, -0.089344628155, 0.160670414567, 0.045679233968, -0.223476290703, -0.224345952272, -0.373603403568, 0.151060044765, 0.158334359527, -0.009796452709, 0.035390045494, -0.124862752855, 0.109272792935, -0.055748265237, -0.076114073396, 0.021220099181, -0.185444042087, 0.037655536085, 0.264786928892, -0.184131652117, 0.015849968418, -0.177411690354, 0.159047394991, -0.004207549151, -0.030541157350, -0.058119717985, -0.140626981854, 0.037240084261, 0.046726159751, -0.272655427456, 0.004389245994, -0.275444239378, 0.168336018920, -0.045042987913, 0.043665591627, -0.057958886027, -0.176607668400, -0.003786769696, 0.082149691880, -0.289190560579, 0.001830980647, -0.062332440168, 0.104271419346, 0.088057495654, 0.117732800543, 0.195799320936, -0.175713688135, 0.089566804469, 0.129811823368, -0.412606477737, 0.001754454919, -0.211929425597, -0.141083687544, 0.026219533756, 0.242670685053, 0.150805890560, -0.230384722352, 0.028413260356, 0.172357574105, -0.426943957806, 0.069497786462, -0.205990359187, -0.089459881186, 0.029246589169, 0.251789659262, 0.068953126669, -0.214533075690, 0.076197773218, 0.144810602069, -0.404416322708, -0.020855650306, -0.032631997019, -0.046691618860, 0.164750903845, 0.204534620047, 0.139795586467, -0.331892967224, 0.121592916548, 0.089631766081, -0.426294535398, -0.091786995530, -0.204558551311, -0.041131466627, 0.111965194345, 0.266293138266, 0.169638514519, -0.243884846568, -0.027793431655, 0.089291751385, -0.239974468946, 0.000779326423, -0.049680259079, -0.047221507877, 0.091906353831, 0.193109884858, 0.219389677048, -0.078438602388, 0.033719167113, 0.090705320239, -0.290018290281, 0.129417568445, -0.114262796938, -0.104993425310, 0.009745347314, 0.149929210544, 0.113910220563, -0.034091774374, -0.038460042328, 0.016727374867, -0.101292803884, 0.137540474534, -0.080676823854, -0.126932501793, 0.137855142355, 0.058455850929, 0.087671227753, 0.010397348553, -0.091909125447, -0.070806391537, -0.093476183712, 0.171441912651, 0.006228373852, -0.068248875439, 0.056653134525, 0.002358516678, 0.229182466865, 0.071612387896, -0.026420144364, -0.073853231966, -0.075117945671, 0.045049868524, 0.060157772154, -0.119091123343, 0.040724396706, -0.096548929811, 0.137506633997, 0.022375470027, -0.129640892148, -0.155308604240, 0.101252533495, 0.101302720606, -0.038247469813, -0.087775707245, -0.090614356101, -0.434193819761, -0.089346081018, -0.023093737662, -0.584619939327, -0.363110780716, 0.303662210703, 0.164440929890, 0.053176943213, -0.509801506996, -0.032582208514, -0.532681107521, -0.510910689831, -0.180064231157, -0.625407040119, -0.315145760775, 0.077754296362, 0.487445265055, 0.091940879822, -0.662692487240, -0.047087218612, -0.583991885185, -0.900333404541, -0.920245707035, -0.500869870186, -0.865830361843, -0.208807900548, 0.449459105730, -0.028198571876, -0.696479797363, 0.213921204209, -0.459218144417, -0.558169722557, -0.389670848846, -0.383642047644, -0.375134825706, -0.048772554845, 0.286389559507, -0.130950585008, -0.527694344521, -0.003474630648, -0.492669820786, -0.212668254972, -0.107164129615, -0.174960598350, -0.043206352741, -0.355106681585, 0.179373666644, 0.118884958327, -0.185736700892, -0.109180226922, -0.240429833531, 0.016010763124, 0.062926962972, 0.069158963859, -0.028236402199, 0.030038997531, 0.004374114797, 0.072037354112, 0.059416078031, 0.066036216915, 0.014483846724, -0.270118445158, -0.155291661620, -0.183028906584, 0.310395121574, -0.120803914964, -0.275830000639, -0.028662713245, 0.016243249178, -0.245195135474, -0.274704962969, -0.201054930687, -0.125126481056, 0.077173538506, -0.202121794224, -0.291580706835, -0.093944884837, -0.217879682779, 0.362282991409, -0.442785710096, -0.331418782473, -0.145114287734, -0.222979292274, 0.102266125381, 0.097635403275, -0.117738649249, -0.643116831779, -0.387465953827, 0.353497982025, -0.305925697088, -0.521296381950, -0.566865861416, 0.014265587553, 0.319959312677, 0.246630355716, 0.104531623423, -0.751905202866, 0.010400626808, 0.071629799902, -0.098596416414, -0.811467647552, -0.062613949180, -0.328797370195, 0.075898066163, 0.271733134985, 0.120138265193, -0.287212699652, -0.152902081609, 0.082850880921, -0.104988448322, -0.664268016815, 0.024628994986, -0.400333404541, 0.130834370852, 0.121936127543, 0.047090012580, -0.065743386745, -0.327889144421, 0.270509272814, -0.080549091101, -0.342835992575, -0.131911888719, -0.256309151649, -0.014461672865, 0.102920316160, 0.022198030725, -0.009628116153, -0.026360383257, 0.312766522169, -0.030110323802, -0.313146084547, -0.183179676533, -0.399644702673, 0.101067736745, 0.103293024004, -0.061136465520, 0.176141560078, -0.129737868905, 0.198477670550, -0.003295868868, -0.097225345671, -0.070719800889, -0.293521195650, -0.003713351209, 0.069286070764, -0.040075637400, 0.021696284413, -0.148744001985, 0.265353441238, 0.004728941713, -0.034963391721, 0.038291778415, -0.208877697587, 0.014127023518, 0.007852321491, -0.175023630261, 0.118187651038, -0.197708576918, 0.225780218840, -0.014519028366, -0.014988415875, 0.092514492571, -0.147068604827, 0.108502790332, 0.095973536372, -0.258452534676, 0.165807664394, -0.114466652274, 0.241490259767, -0.020862065256, 0.043424554169, 0.012764912099, -0.066658861935, 0.043063901365, 0.147183150053, -0.345600187778, 0.090864628553, -0.128689259291, 0.209167137742, 0.029239075258, 0.153593361378, 0.027333591133, -0.206283792853, 0.054755471647, 0.058704908937, -0.389914810658, -0.124548584223, -0.179946497083, 0.052900820971, -0.085896179080, 0.271189987659, 0.051137335598, -0.197946190834, -0.011098722927, 0.118555627763, -0.474939256907, 0.039048567414, -0.171635285020, -0.106654651463, -0.091181047261, 0.343996167183, -0.011030101217, -0.329146832228, 0.023854205385, 0.158074304461, -0.436694651842, -0.138393521309, -0.194619327784, 0.029649280012, 0.014504160732, 0.388115912676, 0.115569874644, -0.285536408424, -0.006436596625, 0.094149544835, -0.384977579117, 0.057059321553, -0.255121409893, 0.126035407186, 0.052509967238, 0.413255929947, 0.229559838772, -0.147204309702, -0.199434950948, 0.051929611713, -0.334456682205, 0.097928613424, -0.279915034771, 0.185113653541, -0.079577013850, 0.134151861072, 0.174652338028, -0.209155514836, -0.068343877792, 0.057406056672, -0.202909082174, 0.024228483438, -0.244463324547, 0.253286480904, 0.044860132039, 0.144229367375, 0.191195920110, -0.050038360059, -0.022529970855, 0.051502082497, -0.147916957736, 0.063645049930, -0.331075191498, 0.058724064380, 0.015633722767, 0.013972186483, -0.017911572009, -0.063655957580, -0.068742543459, -0.021399861202, -0.160445481539, 0.027982961386, -0.255403548479, 0.131980910897, 0.028262205422, -0.021065725014, 0.097641110420, -0.046272352338, -0.040054351091, -0.094664908946, -0.079113475978, 0.127465382218, -0.067071408033, 0.004608124029, 0.076700642705, -0.027665149420, 0.116494111717, -0.088360100985, 0.074888892472, -0.234446033835, 0.085734970868, 0.192279860377, -0.148696154356, 0.000259605760, 0.098767653108, -0.207227423787, 0.161463454366, -0.105720616877, -0.492107927799, -0.266006886959, 0.166638419032, 0.279280334711, -0.247213855386, -0.201030761003, 0.218500927091, -0.401555240154, -0.188783392310, -0.599339962006, -0.645208299160, -0.674035072327, 0.046607788652, 0.512166082859, -0.010543121956, -0.380874037743, 0.174384906888, -0.587321460247, -0.852886378765, -0.784951329231, -0.337495505810, -0.965442299843, -0.080404207110, 0.578111290932, -0.214041054249, -0.518714129925, -0.069725088775, -0.571312844753, -0.693037807941, -0.433275192976, -0.447029262781, -0.428133040667, 0.054905191064, 0.233146026731, -0.136619076133, -0.532990396023, 0.101668722928, -0.579039454460, -0.104245871305, -0.147901996970, -0.298803538084, -0.106499254704, -0.403614819050, 0.109680972993, -0.031185809523, -0.047192528844, -0.105127185583, -0.178379699588, 0.095242753625, -0.100193627179, -0.058682132512, -0.067375928164, -0.052168305963, -0.040454100817, -0.145286396146, -0.120858542621, -0.080368086696, -0.163458764553, -0.293150424957, -0.122818693519, 0.084242321551, -0.120548620820, -0.179559871554, -0.189471051097, -0.090147145092, 0.209649294615, -0.208637848496, -0.197861269116, -0.052338995039, -0.086064517498, -0.056478947401, -0.104820519686, -0.098514012992, -0.292237430811, -0.144492313266, 0.283464759588, -0.498968362808, -0.478027015924, -0.021031308919, -0.251811951399, 0.012197962031, 0.086273506284, -0.173279538751, -0.789364814758, -0.418984442949, 0.455483108759, -0.053850360215, -0.516768097878, -0.475818336010, -0.008917411789, 0.230650469661, 0.224683806300, 0.040980681777, -0.794220387936, -0.060739327222, 0.154557988048, -0.024094315246, -0.535685837269, -0.090794235468, -0.282445371151, 0.135497659445, 0.149493426085, 0.076891131699, -0.354197800159, -0.215422764421, 0.213645577431, 0.015854833648, -0.334846913815, -0.022098219022, -0.384746521711, 0.040185965598, 0.128476291895, -0.008410026319, -0.117517016828, -0.285586774349, 0.170754626393, 0.076051987708, -0.123818099499, -0.136720240116, -0.276652991772, 0.055616524071, 0.045476168394, 0.022676993161, -0.117668196559, -0.118448190391, 0.289345443249, 0.193594828248, -0.262244313955, -0.051797579974, -0.359782636166, 0.079343497753, 0.000095936011, -0.153993815184, 0.102862648666, -0.050943870097, 0.208035334945, 0.061308998615, -0.031467657536, 0.042757634073, -0.428124636412, -0.011290499941, -0.012663577683, -0.036701388657, 0.006402185652, -0.100063636899, 0.120606705546, 0.105144515634, -0.158775672317, 0.001995565137, -0.267678141594, 0.157692179084, -0.036108590662, -0.133904635906, 0.071286097169, -0.140009775758, 0.108471445739, 0.061542451382, -0.048889335245, -0.012167795561, -0.220542892814, 0.118020378053, 0.035487316549, -0.151439204812, 0.097048148513, -0.129412204027, 0.167277872562, -0.017721328884, -0.066338121891, 0.111237578094, -0.062686637044, -0.051342945546, 0.058061968535, -0.206565737724, 0.071167252958, -0.235150769353, 0.227249279618, 0.067889094353, -0.139030471444, 0.076438426971, 0.022068427876, 0.001594973262, 0.053069896996, -0.299200326204, -0.109617531300, -0.181375011802, 0.128227055073, 0.054875809699, 0.114514000714, 0.140435412526, 0.009390391409, 0.011407839134, 0.072995565832, -0.437322676182, -0.115000814199, -0.278048217297, 0.078062787652, -0.171092316508, 0.236755222082, 0.213574513793, 0.061314139515, 0.068142123520, 0.188754871488, -0.474147439003, -0.234789296985, -0.259460896254, 0.189207926393, -0.053475480527, 0.160414218903, 0.317015945911, -0.033424597234, -0.026707334444, 0.139186769724, -0.304091066122, -0.070373207331, -0.319301187992, 0.248816385865, 0.057887814939, 0.181086033583, 0.230964705348, -0.083058208227, -0.040583092719, 0.086952984333, -0.192760288715, -0.118793122470, -0.388583540916, 0.184264793992, -0.047002773732, 0.001804689877, 0.141704306006, -0.077515959740, -0.091046661139, 0.103910364211, -0.122963003814, -0.067562080920, -0.485000699759, 0.175614103675, 0.004118377808, -0.012066072784, 0.166252806783, -0.036688387394, 0.072148136795, 0.134894251823, -0.110283516347, 0.126898556948, -0.410673439503, 0.130269542336, 0.127145677805, -0.040369194001, 0.111446008086, -0.224394500256, -0.021330853924, 0.090230889618, -0.041311997920, 0.196808427572, -0.342027723789, 0.061134804040, 0.008955941536, -0.045622501522, 0.027596183121, -0.175949871540, 0.018280528486, 0.012241986580, -0.074119120836, 0.230990886688, -0.236121475697, 0.012689301744, 0.156826451421, 0.055110014975, 0.110286936164, -0.205270081758, -0.075721785426, 0.047433353961, -0.028037967160, 0.081126570702, -0.281942188740, 0.062293771654, 0.130232185125, -0.119748540223, 0.214355453849, -0.434237122536, -0.097941853106, -0.376800924540, -0.037311311811, 0.396987676620, -0.465340226889, -0.101196497679, 0.075675688684, -0.337398141623, -0.029595730826, -0.772990107536, -0.923614621162, -0.970699667931, -0.148244082928, 0.707179486752, -0.531884014606, -0.379375487566, 0.195149466395, -0.368563771248, -0.963766574860, -0.778815209866, -1.002435922623, -1.154696822166, -0.134180232882, 0.669787526131, -0.756901800632, -0.700155198574, 0.084932968020, -0.543654441833, -0.817524552345, -0.460606217384, -0.481384634972, -0.413938105106, -0.223955616355, 0.345163851976, -0.414965748787, -0.511010468006, 0.169100567698, -0.546541571617, -0.294146001339, -0.167962998152, -0.242982521653, -0.118238106370, -0.210451066494, 0.035792950541, -0.157611861825, -0.233329966664, 0.268893569708, -0.317416280508, -0.021398317069, -0.125590056181, 0.044288754463, -0.028442561626, -0.150941684842, -0.131341055036, -0.047363694757, 0.080224812031, -0.013483434916, -0.102139174938, -0.186949044466, -0.063606895506, -0.342106521130, -0.172459453344, -0.221157029271, -0.144523561001, 0.010311897844, 0.345951080322, -0.234185427427, -0.310136854649, 0.176697909832, -0.210242420435, -0.148736029863, -0.066518977284, -0.072339065373, -0.314539104700, -0.304777622223, 0.142918735743, -0.395713299513, -0.505319058895, -0.053317170590, -0.228141978383, 0.101278305054, 0.201801151037, -0.479716539383, -0.669503331184, -0.479225516319, 0.409835666418, -0.149662718177, -0.323879092932, -0.226652488112, -0.106602944434, 0.135460197926, 0.380337983370, -0.344579309225, -0.593977153301, 0.031747370958, 0.213425815105, -0.132186770439, -0.478122472763, -0.054340589792, -0.454219967127, 0.208309531212, 0.028682067990, -0.091733984649, -0.286505252123, -0.336791276932, 0.200085863471, -0.012261327356, -0.083810783923, -0.167418792844, -0.300093948841, -0.016763076186, 0.076613560319, -0.178201198578, -0.166083484888, -0.258724242449, 0.171776697040, 0.094930663705, -0.017143078148, -0.148563459516, -0.178531110287, -0.045015983284, 0.065219283104, -0.139742851257, -0.018962778151, -0.112488821149, 0.030052779242, 0.066971354187, -0.082019351423, -0.096489675343, -0.175696194172, -0.075963005424, -0.058985475451, -0.092104397714, 0.083528712392, -0.151571020484, 0.105974756181, 0.073908537626, -0.046883940697, -0.025683980435, -0.298337817192, 0.106056518853, -0.038695164025, -0.088172584772, 0.113032229245, -0.220723137259, -0.022179109976, 0.199454545975, -0.007662485819, 0.039982832968, -0.190716400743, 0.091876365244, -0.205824270844, -0.098134145141, 0.129870682955, -0.203948542476, -0.024487867951, 0.089239217341, -0.010115650482, -0.081425391138, -0.093034431338, 0.016786083579, -0.360171467066, -0.132297769189, 0.215153649449, -0.102773405612, 0.074378743768, 0.098246105015, 0.043513521552, -0.021482584998, -0.097838193178, 0.023658543825, -0.275410830975, -0.074333943427, 0.159272402525, -0.217384636402, 0.156955972314, 0.035852536559, -0.044036984444, 0.066458038986, 0.056015603244, 0.069380089641, -0.035521175712, -0.223724514246, -0.037255264819, -0.269612252712, 0.157063007355, 0.029039975256, 0.036563992500, 0.084680795670, 0.216196596622, 0.109961688519, 0.172267213464, -0.509476900101, -0.157620191574, -0.287408113480, 0.267452687025, -0.177171841264, 0.088780060410, 0.010041452013, 0.304127365351, 0.155393332243, 0.305479198694, -0.431515932083, -0.298663437366, -0.297771543264, 0.323818147182, -0.293718904257, 0.109263442457, 0.154970020056, 0.206338658929, 0.115086615086, 0.186595082283, -0.058598194271, -0.353355467319, -0.450005859137, 0.293390542269, -0.181052759290, -0.032983388752, 0.284025996923, -0.016528358683, -0.012662408873, 0.113342307508, -0.152936741710, -0.211860924959, -0.572707474232, 0.350022405386, -0.006728858687, -0.116456605494, 0.332219690084, -0.062452267855, 0.071409568191, 0.091340817511, -0.045342307538, -0.130855485797, -0.563424170017, 0.158017620444, -0.021474124864, -0.011546572670, 0.197179600596, -0.189335837960, -0.033743098378, 0.113056883216, -0.056721199304, -0.144692167640, -0.452984094620, 0.213638961315, 0.070004634559, -0.132463619113, 0.179104700685, -0.254473775625, 0.003582319478, 0.246998116374, -0.008245340548, -0.050362333655, -0.210382178426, 0.072681583464, 0.138427555561, -0.034487430006, -0.024848155677, -0.316437661648, -0.112386174500, 0.184507071972, 0.007581822574, 0.208523258567, -0.192362099886, 0.100482590497, 0.069443330169, -0.130908027291, 0.108407996595, -0.387119263411, -0.054520428181, 0.182094916701, -0.116313144565, 0.185896098614, -0.371796250343, 0.028571648523, 0.185571759939, -0.171328619123, 0.301119118929, -0.653677523136, -0.163841292262, -0.193070784211, -0.127354234457, 0.524094343185, -0.329724222422, -0.128765717149, 0.178371652961, -0.371192395687, 0.073793791234, -0.594073593616, -0.882823348045, -1.556069731712, -0.485361635685, 0.877437829971, -0.571040451527, -0.306422203779, -0.085156381130, -0.515719890594, -0.817535996437, -0.878806829453, -0.860802173615, -0.589858651161, -0.423067748547, 0.896280944347, -0.965535819530, -0.475821822882, 0.006372012198, -0.742225527763, -0.882678806782, -0.287778407335, -0.258986622095, -0.353286832571, -0.453651666641, 0.403565943241, -0.684298455715, -0.169355630875, 0.242773756385, -0.670622289181, -0.302991002798, -0.170089215040, -0.305133044720, -0.283151745796, -0.260308951139, 0.259485065937, -0.269059062004, 0.058871570975, -0.064088374376, -0.379667729139, -0.131748840213, -0.120734371245, 0.000018124014, -0.098872639239, -0.137071311474, -0.144148498774, -0.018670715392, 0.137312963605, -0.069569110870, -0.081376157701, -0.154698729515, 0.005479841027, -0.225797966123, -0.220544904470, -0.225170791149, -0.312091410160, -0.085859350860, 0.168849706650, -0.301995456219, -0.300541311502, 0.020516065881, -0.201825946569, -0.114662565291, 0.061161428690, -0.352554976940, -0.310509622097, -0.232693597674, 0.435100436211, -0.374191313982, -0.526117146015, -0.070310667157, -0.243395000696, 0.116608537734, 0.305138975382, -0.478238165379, -0.536059975624, -0.445808261633, 0.308350086212, -0.395909816027, -0.378769576550, -0.199444070458, -0.257902562618, -0.071583390236, 0.113734208047, -0.203394293785, -0.227348983288, -0.139849931002, 0.269717216492, 0.133139535785, -0.282837778330, -0.036489009857, -0.552274405956, 0.119592078030, 0.051158621907, -0.276245981455, -0.105528324842, -0.186499729753, 0.161942332983, 0.056532196701, 0.026509217918, -0.071466997266, -0.485027104616, 0.052534282207, -0.038250196725, -0.205655544996, -0.093293465674, -0.196785196662, 0.044095233083, 0.088700383902, 0.129609793425, -0.097912423313, -0.220612809062, -0.171619385481, -0.150248706341, -0.128511562943, 0.056258551776, -0.048365145922, -0.062755465508, 0.117819517851, 0.056242972612, -0.022253165022, -0.213818565011, -0.086004890501, -0.220337867737, -0.061454694718, 0.241596266627, -0.002884283662, -0.086496837437, 0.186744734645, 0.126631751657, 0.017163045704, -0.228722706437, -0.111295200884, -0.439097285271, 0.070371232927, 0.248070493340, -0.160482808948, 0.061878763139, 0.235009595752, 0.047054421157, -0.122545577586, -0.135645702481, -0.164498701692, -0.375010699034, 0.021382415667, 0.226389393210, -0.104208260775, 0.046536084265, 0.199710920453, 0.088951960206, 0.038133148104, 0.013894460164, -0.071475483477, -0.495594531298, 0.061715438962, 0.237811312079, -0.125016123056, -0.037737343460, 0.156453192234, 0.118632867932, -0.023460067809, -0.073732472956, -0.206415936351, -0.355376631021, 0.116871245205, 0.295880436897, -0.158277437091, -0.062226280570, 0.162734270096, 0.063079021871, 0.025086455047, 0.186607524753, -0.250218838453, 0.002601902932, -0.249505177140, 0.210838437080, -0.044558431953, 0.138655602932, -0.007720608730, -0.131790190935, 0.006819765083, 0.500326633453, -0.217813581228, 0.075169622898, -0.675821185112, -0.030933693051, -0.194965049624, 0.234114050865, -0.170377835631, -0.072584182024, -0.179643779993, 0.626372992992, -0.158212080598, 0.150818511844, -0.270922690630, -0.174954891205, -0.465432375669, 0.447312504053, -0.360264837742, -0.118285872042, -0.107983514667, 0.282581388950, 0.024566577747, 0.180033490062, -0.043795868754, -0.244112759829, -0.491526186466, 0.429747283459, -0.267845302820, -0.026371560991, 0.107965268195, -0.022332873195, 0.055119358003, 0.096740037203, 0.081815235317, -0.416255623102, -0.485769271851, 0.280320912600, -0.218351274729, -0.000980483834, 0.188546329737, -0.225467562675, 0.029880670831, 0.217439115047, -0.006029657554, -0.326981216669, -0.438871949911, 0.301158040762, 0.035443563014, 0.070724733174, 0.076289005578, -0.202635571361, 0.011576637626, 0.104812912643, -0.055825904012, -0.236522793770, -0.319772124290, 0.207100123167, 0.111713260412, 0.016431283206, 0.147586211562, -0.283990174532, -0.001137561863, 0.228462815285, -0.118602678180, -0.205448240042, -0.320567131042, 0.246082186699, 0.028852330521, -0.012937986292, 0.066075213253, -0.315343350172, -0.115793280303, 0.126529082656, -0.098097749054, -0.026261009276, -0.206947237253, 0.231478288770, 0.141517728567, -0.037918142974, 0.148787140846, -0.498396277428, -0.122707724571, 0.117736794055, -0.104224592447, -0.009497615509, -0.310500383377, 0.116197906435, 0.107520923018, -0.123378403485, 0.232124164701, -0.667467057705, -0.240656405687, -0.071596540511, -0.487821757793, 0.355697453022, -0.175990253687, -0.269229382277, 0.110034301877, -0.290447205305, 0.128966152668, -1.033917546272, -0.605909407139, -1.072803616524, -0.543066382408, 0.982548236847, -0.211408555508, -0.533073723316, -0.201634734869, -0.525901317596, -0.628343760967, -0.444216459990, -0.386472016573, -0.367543101311, -0.610571086407, 1.190746068954, -0.917703032494, -0.272366911173, -0.381275653839, -0.442776381969, -0.704290986061, -0.224533051252, -0.192047178745, -0.550557971001, -0.446778267622, 0.776485860348, -0.752675592899, -0.176061958075, -0.078118510544, -0.623868346214, -0.050258073956, 0.140836134553, -0.294921845198, -0.043918527663, -0.276593357325, 0.155544579029, -0.140036612749, 0.051595598459, 0.021221680567, -0.308166265488, -0.090676769614, 0.035849831998, 0.056072127074, -0.093647122383, -0.142740920186, -0.085376486182, -0.008950560354, 0.103012226522, -0.000039893843, -0.143396586180, 0.058921404183, 0.125745207071, -0.195618480444, -0.150049388409, -0.355551511049, -0.156798720360, -0.096301414073, 0.263865858316, -0.261407405138, -0.455414563417, -0.133724942803, 0.056523889303, -0.239152982831, -0.022190535441, -0.442499846220, -0.244268402457, -0.179868862033, 0.519657969475, -0.463882297277, -0.619388163090, -0.136652544141, -0.170562043786, -0.148626670241, 0.405045807362, -0.242586269975, -0.586917459965, -0.437263458967, 0.443393260241, -0.261210352182, -0.356773465872, -0.237030044198, -0.192681849003, -0.110438793898, 0.104034185410, -0.191752359271, -0.064826488495, -0.220404148102, 0.394098043442, 0.043578606099, -0.105652511120, -0.219854533672, -0.268410801888, -0.026857398450, -0.224508300424, -0.104489728808, -0.069771587849, -0.090675026178, 0.041863523424, 0.124341018498, 0.183702856302, -0.046229016036, -0.498798191547, -0.127350464463, -0.292427062988, -0.043582227081, 0.098435752094, -0.052841935307, 0.025441087782, 0.147876724601, 0.143975228071, -0.019364701584, -0.357541143894, -0.378348469734, -0.412577688694, 0.070447474718, 0.163137763739, 0.099045254290, 0.133339583874, 0.256710827351, 0.116695113480, -0.079254612327, -0.227336704731, -0.413149863482, -0.525687932968, 0.147307604551, 0.130811095238, -0.002448272426, -0.062033232301, 0.163738816977, 0.255023151636, -0.132166653872, -0.245982721448, -0.440790891647, -0.419141799212, 0.235335171223, 0.107159331441, 0.115177407861, -0.010858627968, 0.183009684086, 0.154459103942, -0.067433141172, -0.151594370604, -0.550308465958, -0.359798014164, 0.218696355820, 0.161303430796, 0.003180949716, 0.105057872832, 0.197693213820, 0.199175789952, 0.021030526608, -0.143112540245, -0.630528330803, -0.258861362934, 0.226781278849, 0.151585519314, -0.095056876540, 0.019636519253, 0.059376716614, 0.139987885952, -0.101070888340, -0.114517152309, -0.569203197956, -0.185734227300, 0.281061887741, 0.266512572765, -0.045802246779, -0.021486958489, 0.118230111897, 0.022396415472, -0.110355652869, 0.232534155250, -0.707378387451, 0.083072692156, -0.424584329128, 0.313912898302, 0.077604904771, -0.011150221340, 0.286897182465, -0.117780119181, -0.445858806372, 0.534618258476, -0.593817234039, 0.152871772647, -0.715321898460, 0.016440115869, -0.303317725658, 0.181006431580, 0.220681861043, -0.032203692943, -0.530313134193, 0.510767519474, -0.365768343210, 0.126778468490, 0.046688422561, -0.192747458816, -0.543680429459, 0.321058690548, -0.059716865420, 0.004891357385, -0.417805910110, 0.210961550474, -0.241358891129, 0.075110517442, 0.231729477644, -0.175896197557, -0.258310049772, 0.366896927357, -0.174714148045, 0.076493330300, -0.094792976975, -0.020177764818, -0.185874715447, 0.078515209258, 0.057367358357, -0.265248030424, -0.370500504971, 0.324938654900, -0.226125821471, 0.216541707516, -0.057716373354, -0.043030358851, -0.066376343369, 0.057740561664, -0.007901136763, -0.257446706295, -0.266729712486, 0.323612421751, -0.115073658526, 0.217838138342, 0.117877796292, -0.150662407279, 0.013850861229, 0.135699734092, -0.109043389559, -0.412910640240, -0.195954561234, 0.109276637435, -0.032441951334, 0.124712802470, 0.116035461426, -0.175125077367, -0.016479954123, 0.089708857238, -0.186962127686, -0.567567527294, -0.135112985969, 0.169629752636, 0.071460574865, 0.355118960142, 0.232104122639, -0.174898147583, -0.004444922321, -0.117022439837, -0.108056999743, -0.586479365826, 0.034902449697, 0.109671004117, 0.037917770445, 0.238007083535, 0.253197938204, -0.335057914257, -0.057233873755, -0.156410872936, -0.212620586157, -0.551319301128, -0.009820180945, 0.098279207945, 0.248829960823, 0.079515650868, 0.243584826589, -0.336624950171, -0.253889828920, -0.308899551630, -0.475553363562, -0.102493643761, 0.144978821278, -0.212742745876, 0.125631600618, -0.134502604604, 0.195844933391, -0.711083173752, -0.216403082013, -0.815395355225, -0.734640836716, 0.458543658257, -0.079241238534, -0.704134225845, 0.138321414590, -0.468266636133, -0.333906352520, -0.176931932569, 0.126124650240, -0.136003345251, -0.568384110928, 0.979477345943, -0.461115956306, -0.789189279079, -0.112150236964, -0.495153248310, -0.554842770100, -0.186380878091, -0.079158701003, -0.292117059231, -0.368856102228, 0.618989765644, -0.553675651550, -0.285387516022, 0.133524149656, -0.406858414412, -0.109910480678, 0.055020265281, -0.234262034297, -0.072115622461, -0.181661158800, 0.001325488905, -0.112732313573, 0.117531992495, -0.023171305656, -0.233611389995, -0.065621532500, 0.000316853228, 0.034487668425, -0.115050472319, 0.063358254731, -0.032844029367, -0.014054751955, 0.107594713569, 0.022249057889, -0.113686986268, 0.047976732254, -0.117296725512, -0.169566124678, -0.278331458569, -0.304124385118, -0.188559800386, -0.042572516948, 0.329842269421, -0.220012947917, -0.447349458933, 0.006560755894, -0.218428626657, -0.179669082165, -0.386511206627, -0.439686447382, -0.269189476967, -0.160334393382, 0.588293790817, -0.510374784470, -0.589167714119, -0.165340781212, -0.096961960196, -0.327801436186, 0.100723981857, -0.240804523230, -0.324745446444, -0.408135592937, 0.579867303371, -0.031237186864, -0.244016304612, -0.173763513565, -0.065509565175, -0.254767268896, -0.134075835347, -0.373343646526, -0.027718368918, -0.154156088829, 0.316590428352, -0.039846330881, 0.158255800605, -0.075140088797, -0.241902396083, -0.414117425680, -0.294341385365, -0.096517316997, 0.007110192906, -0.086572989821, 0.167895466089, 0.220960170031, 0.228495836258, 0.035316813737, -0.107823923230, -0.783948838711, -0.356806367636, 0.051171679050, 0.187365591526, 0.052961137146, -0.073336809874, 0.043411400169, 0.265520632267, 0.023092482239, -0.033757131547, -0.761655211449, -0.391575455666, 0.191518157721, 0.047592747957, 0.114895902574, 0.108266189694, 0.083714976907, 0.198378443718, -0.042770434171, -0.126535668969, -0.633843779564, -0.317862242460, 0.170716136694, -0.011288163252, 0.130527526140, 0.110796041787, 0.056888371706, 0.133473426104, -0.106871023774, -0.214902713895, -0.612532436848, -0.100364252925, 0.271244198084, 0.043031997979, 0.139799699187, -0.052037332207, 0.088764771819, 0.201838821173, -0.039544101804, -0.308943390846, -0.496625393629, -0.069095313549, 0.352406352758, 0.101709812880, -0.000310586183, -0.035516306758, -0.100346520543, 0.218701854348, -0.015754247084, -0.457294464111, -0.537144422531, -0.070073753595, 0.435727804899, 0.266673952341, 0.170295059681, -0.122519865632, -0.085371933877, 0.087280914187, -0.041595257819, -0.163497954607, -0.590078592300, 0.057980407029, 0.520963490009, 0.271018505096, 0.174699112773, -0.562713503838, 0.098193019629, -0.192525982857, -0.145103618503, 0.301222085953, -0.482865184546, 0.049371495843, -0.183624595404, 0.240759193897, -0.018247039989, -0.585693001747, 0.259388595819, -0.031256571412, -0.557223081589, 0.592491507530, -0.462590366602, 0.193888977170, -0.361175715923, -0.063234068453, -0.261983156204, -0.195395499468, 0.133148550987, 0.127729132771, -0.758094787598, 0.556329488754, -0.335434764624, 0.091541670263, 0.066959746182, -0.149394348264, -0.291884630919, 0.173448503017, 0.022248249501, 0.225105002522, -0.708629667759, 0.069799467921, -0.350833982229, 0.008202302270, 0.302931278944, -0.334865570068, -0.184652596712, 0.352989017963, 0.019544722512, 0.296022027731, -0.155357837677, -0.055839933455, -0.307933688164, 0.118039250374, 0.140279665589, -0.273721456528, -0.093171715736, 0.273226827383, -0.034921396524, 0.258743554354, -0.118684135377, -0.070371747017, -0.152057006955, 0.125954225659, 0.003152494319, -0.287464797497, -0.235485091805, 0.221835106611, -0.031670421362, 0.305972009897, -0.057205669582, -0.225300505757, -0.032206520438, -0.077634163201, 0.026841783896, -0.259437948465, -0.261947184801, -0.020143324509, 0.043903715909, 0.362681418657, 0.022221595049, -0.228155001998, -0.083803296089, -0.141678586602, 0.094957537949, -0.435050040483, -0.152148783207, -0.052098426968, 0.158135086298, 0.281494826078, 0.148530542850, -0.129531696439, -0.112553119659, -0.394329696894, 0.114576354623, -0.692321836948, 0.110242128372, 0.040234711021, 0.250468879938, 0.282854080200, 0.263750255108, -0.114698156714, -0.148974865675, -0.528424620628, 0.066113226116, -1.025760889053, 0.285933077335, 0.034688886255, 0.245645239949, 0.214664265513, 0.249866217375, -0.149626314640, -0.306296139956, -0.523479163647, -0.326649606228, -1.035341024399, 0.506956815720, -0.185994490981, 0.355107426643, 0.128441587090, 0.422553092241, -0.616686224937, 0.110387086868, -0.590573072433, -0.224763140082, -0.897044718266, 0.296119749546, -0.429810494184, 0.441281557083, -0.611036837101, -0.106827661395, -0.277889996767, 0.333459377289, 0.095052778721, -0.215563073754, -0.048319637775, -0.315077692270, 0.051515329629, 0.021196734160, -0.964904725552, -0.422495752573, -0.236739665270, 0.393797725439, -0.203518480062, -0.307707935572, 0.374728351831, -0.591890215874, 0.047771852463, 0.025371288881, -0.498203635216, -0.283374786377, 0.016852403060, 0.264504253864, -0.145061120391, -0.269056826830, -0.230663672090, -0.217486083508, 0.135628819466, -0.188695982099, -0.203984528780, -0.035166986287, 0.054430428892, -0.089521914721, -0.165290743113, -0.024683548138, -0.020048759878, -0.112099364400, -0.085572868586, -0.120336093009, -0.089840479195, 0.026234962046, -0.174059659243, -0.126425072551, -0.219063237309, -0.172330543399, -0.188170194626, -0.110697351396, 0.316685825586, -0.242503315210, -0.261533141136, -0.067796126008, -0.220680490136, -0.054593149573, -0.400546222925, -0.296770542860, -0.261033564806, -0.111569590867, 0.453842192888, -0.322815895081, -0.477635622025, -0.170378550887, 0.176999643445, -0.274485945702, 0.010946798138, -0.296800553799, -0.064966559410, -0.379656165838, 0.327789247036, -0.118814729154, -0.041847176850, -0.021535079926, 0.033508218825, -0.644074499607, -0.306662470102, -0.068622104824, 0.070384792984, -0.166065186262, 0.264712274075, -0.065050974488, 0.289115160704, -0.073617987335, -0.247844144702, -0.773852586746, -0.405037850142, 0.164080217481, 0.125990346074, 0.098783433437, 0.091674201190, -0.040055744350, 0.304915219545, 0.213093653321, -0.062960185111, -0.860307514668, -0.281134963036, 0.306228399277, 0.046954087913, 0.260296255350, 0.122476771474, -0.061064422131, 0.165113613009, 0.136528328061, -0.181272044778, -0.742730140686, -0.379611909389, 0.272458612919, 0.044479180127, 0.041652753949, -0.011108522303, -0.095781236887, 0.142734229565, 0.038585621864, -0.036677654833, -0.384490191936, -0.257335692644, 0.321543425322, -0.049693901092, 0.073324479163, -0.053666245192, -0.168751403689, 0.109665505588, 0.052254199982, -0.221344619989, -0.272707819939, -0.122207932174, 0.330400109291, -0.022878255695, 0.037854384631, -0.057026997209, -0.106302537024, 0.102654285729, 0.132708892226, -0.540179371834, -0.191064819694, -0.169467836618, 0.350374042988, 0.212818995118, 0.165766358376, -0.176248252392, -0.109285376966, 0.086390875280, 0.012831433676, -0.486423283815, -0.078457728028, -0.078460574150, 0.581744730473, 0.252272009850, 0.096988461912, -0.419630318880, 0.019458437338, -0.062645457685, 0.045594196767, -0.208856582642, -0.065409213305, 0.005426578224, 0.287895083427, 0.287366569042, 0.133466303349, -0.911405146122, 0.246187582612, -0.231414109468, -0.383009642363, 0.345164895058, -0.100576005876, 0.175824776292, -0.143074795604, 0.190801471472, -0.056303676218, -0.873968958855, 0.291793078184, 0.044066425413, -0.694553852081, 0.482983469963, -0.162172555923, 0.140437856317, -0.081063635647, -0.064795106649, -0.193490639329, -0.344901412725, 0.042673166841, 0.145623266697, -0.745211482048, 0.343226969242, -0.240606516600, -0.020994473249, 0.209515348077, -0.345799088478, -0.061997212470, 0.018506364897, 0.129375040531, 0.176871344447, -0.595762670040, 0.165179878473, -0.322579443455, -0.007840956561, 0.247861504555, -0.444367945194, -0.027518274263, 0.122601181269, 0.027262773365, 0.285004585981, -0.193393319845, 0.003653986845, -0.165943622589, -0.011445367709, 0.190497741103, -0.342076092958, -0.122636161745, 0.121864080429, -0.178505778313, 0.354763865471, -0.075709797442, -0.197931110859, -0.196599423885, 0.003962338902, 0.227586224675, -0.137217730284, -0.189082205296, 0.035313662142, -0.057629797608, 0.215024128556, -0.047818720341, -0.314982235432, -0.076449476182, -0.094923682511, 0.127563014627, -0.113646283746, -0.076744936407, -0.000697797572, -0.033299770206, 0.283697694540, -0.230364874005, -0.273075789213, -0.115272223949, -0.311555683613, 0.175956442952, -0.103117763996, -0.080134905875, 0.103130146861, 0.088853597641, 0.276953548193, 0.004434859380, -0.164754152298, -0.099067263305, -0.475471764803, 0.189327418804, -0.249820277095, 0.074664227664, 0.005479720887, -0.048542149365, 0.257574409246, 0.132449299097, -0.293709725142, -0.182335212827, -0.637745916843, 0.214841410518, -0.477178961039, 0.298288434744, -0.079866088927, 0.003961847164, 0.133386179805, 0.272929757833, -0.547594249249, -0.238191798329, -0.319235146046, -0.131689652801, -0.643987596035, 0.505070984364, -0.203068271279, 0.124264746904, -0.193763390183, 0.397446423769, -0.657980084419, 0.282960265875, -0.336561083794, -0.269597709179, -0.885180354118, 0.299872428179, -0.068204790354, 0.061985988170, -0.695381104946, 0.039146773517, -0.395678997040, 0.559526860714, -0.134229630232, -0.104786403477, -0.350507646799, -0.225623413920, 0.043094083667, -0.098994202912, -0.668447017670, -0.305672317743, -0.216313302517, 0.712669789791, -0.261419236660, -0.266164600849, 0.056571375579, -0.716381132603, -0.064041398466, -0.126673668623, -0.324561089277, -0.217921897769, -0.133849784732, 0.232046872377, -0.255789816380, -0.137434914708, -0.183985143900, -0.293041020632, -0.130447492003, -0.175139099360, -0.084705792367, -0.056037541479, -0.109529219568, -0.139487043023, -0.037921298295, -0.191204532981, 0.184832304716, -0.108849197626, -0.084286376834, -0.168820276856, -0.215513423085, -0.006164305843, -0.033007480204, -0.204624563456, 0.031850550324, -0.098347961903, -0.158643722534, -0.095595218241, 0.099072016776, -0.073310226202, -0.157806590199, -0.052162498236, 0.120114609599, -0.213052079082, -0.097527600825, -0.372908502817, -0.216766923666, 0.037769161165, 0.427915602922, -0.296150296926, -0.463498026133, -0.278746843338, 0.178852498531, -0.169829800725, 0.016389541328, -0.117665983737, -0.027292456478, -0.339989244938, 0.214139819145, -0.159521475434, 0.012711049989, -0.057348448783, 0.194027930498, -0.389733970165, -0.168373018503, 0.283559799194, 0.105795040727, -0.623144209385, 0.155813589692, -0.349800586700, 0.222743958235, 0.213486626744, -0.172157019377, -0.615070223808, -0.313398510218, 0.238187938929, -0.112766630948, -0.013057364151, 0.055814918131, -0.161070629954, 0.079285040498, 0.102737233043, -0.328195631504, -0.340729892254, -0.412554025650, 0.234653547406, -0.101313605905, 0.174605548382, -0.075521558523, -0.144496142864, 0.091163918376, 0.242612868547, -0.257996857166, -0.217417389154, -0.370259135962, 0.252121955156, -0.079051032662, 0.017604159191, -0.089309662580, -0.330747872591, 0.077534236014, 0.174574151635, -0.033395230770, -0.127518206835, -0.141685903072, 0.247917383909, -0.020648805425, 0.045680489391, -0.101137042046, -0.256945252419, 0.074280910194, 0.145822405815, -0.250618249178, -0.139711573720, -0.173870697618, 0.213596105576, 0.127273216844, 0.214511573315, -0.285443365574, -0.234628885984, -0.017520908266, 0.039945818484, -0.546773970127, -0.111468590796, -0.135880559683, 0.300913900137, 0.234776571393, 0.166990771890, -0.214517101645, -0.113438837230, -0.079862535000, 0.125607147813, -0.550729155540, 0.066959619522, -0.178312852979, 0.351514816284, 0.059650093317, 0.247244179249, -0.540306925774, 0.098514221609, -0.024920286611, 0.060793239623, -0.088057674468, -0.061852995306, 0.067907556891, 0.172183066607, 0.139877319336, 0.126699358225, -0.856094837189, 0.193488657475, -0.101244308054, -0.369612216949, 0.342680722475, 0.154947847128, 0.078705847263, -0.129679813981, -0.027010217309, -0.131312206388, -0.549235463142, 0.258576601744, 0.032627087086, -0.714058637619, 0.543846130371, -0.062923111022, 0.058550555259, -0.040600318462, -0.134504467249, -0.147504150867, -0.284474730492, 0.093840666115, -0.002474300098, -0.785742402077, 0.431119829416, -0.108641050756, -0.007577968296, 0.056060478091, -0.217816010118, 0.064224869013, -0.136116638780, 0.156449526548, 0.156841978431, -0.584518313408, 0.021036183462, -0.110220506787, -0.015430011787, 0.331422328949, -0.244120299816, -0.060089431703, -0.011601745151, -0.037506263703, 0.258396714926, -0.234511941671, -0.186053812504, -0.190001577139, 0.017904845998, 0.435429722071, -0.277629166842, -0.241377159953, 0.113670237362, -0.055748857558, 0.278917729855, -0.062557443976, -0.390714675188, -0.136427298188, 0.045256502926, 0.182480201125, -0.132995411754, -0.195220276713, 0.298181116581, -0.097917459905, 0.109032571316, -0.164467439055, -0.460220962763, -0.151102200150, -0.114504046738, 0.212603554130, -0.165514752269, -0.021362693980, 0.349328100681, -0.095200903714, 0.117450639606, 0.015838494524, -0.384158581495, -0.064363881946, -0.195978239179, 0.228912800550, -0.085929974914, 0.040739443153, 0.165061607957, -0.289817482233, 0.096107192338, 0.060387354344, -0.225781008601, -0.164246305823, -0.164700672030, 0.058445490897, -0.100663237274, 0.143300428987, 0.170064315200, -0.208368614316, 0.059710517526, 0.078489050269, -0.183783918619, -0.166843906045, -0.216033026576, 0.002349418355, -0.120892323554, 0.273905575275, 0.144679069519, -0.410418838263, -0.063007861376, 0.241587042809, -0.284798473120, -0.008575768210, -0.248929142952, -0.213319838047, -0.243103668094, 0.271236389875, 0.091646648943, -0.398370385170, -0.394789755344, 0.280492544174, -0.168908551335, 0.205698698759, -0.149082049727, -0.221555814147, -0.245632365346, 0.229138731956, -0.024799434468, -0.283849865198, -0.990174174309, 0.077902160585, -0.159441754222, 0.522000193596, -0.325810372829, -0.250684350729, -0.429064720869, -0.055496271700, -0.241218000650, 0.030027613044, -0.600044667721, -0.487221270800, -0.049215864390, 0.683893084526, -0.263860523701, -0.482591807842, -0.502962648869, -0.450637817383, -0.282643258572, -0.329996496439, -0.303782969713, -0.232325285673, -0.109458483756, 0.290355026722, -0.177152812481, -0.237085536122, -0.153386592865, -0.165447145700, -0.107598371804, -0.159032121301, -0.198068886995, -0.069581992924, 0.055845521390, -0.090143300593, -0.182489976287, -0.066369585693, 0.029866572469, -0.064103960991, 0.030921583995, -0.146807700396, -0.228339359164, 0.020051408559, -0.029893880710, -0.045733485371, 0.069250583649, 0.086918585002, -0.067293867469, -0.035607807338, -0.102726146579, -0.103945128620, -0.018857629970, -0.274330914021, 0.176957666874, -0.209024727345, 0.307300120592, 0.172899812460, -0.399535804987, -0.165172338486, 0.165603399277, -0.282665163279, -0.494540423155, -0.462542623281, 0.176838055253, 0.081819497049, -0.017578851432, 0.068699821830, -0.170353382826, -0.519569158554, 0.142284125090, -0.178304046392, -0.119150221348, 0.071542225778, 0.066660739481, 0.081538870931, -0.005094696768, 0.192762792110, -0.105942577124, -0.795203208923, 0.043142687529, -0.446021348238, 0.045783698559, 0.239969804883, -0.471503227949, 0.090484187007, -0.135230794549, 0.174232602119, -0.272577375174, -0.050850879401, 0.012493662536, -0.468734115362, 0.082516916096, 0.102564394474, -0.539074301720, 0.096435241401, -0.213052749634, 0.225415974855, -0.241710290313, 0.145423755050, -0.014201044105, -0.313014686108, -0.000427676423, 0.261666625738, -0.129332646728, 0.028173726052, -0.329294234514, 0.219752803445, -0.221659421921, 0.087365187705, -0.165715977550, -0.318007856607, 0.042975783348, 0.219372838736, 0.001879553311, 0.008553157561, -0.264839053154, 0.371921390295, -0.027311163023, 0.213591977954, -0.294868290424, -0.230166882277, 0.065189167857, 0.189126521349, -0.270512551069, 0.022506944835, -0.217159375548, 0.244749501348, 0.032793972641, 0.114514641464, -0.337233453989, -0.114796318114, -0.048440139741, 0.255873262882, -0.508212745190, -0.051779843867, -0.191204115748, 0.117019340396, 0.094075337052, 0.301234662533, -0.337895929813, -0.052586920559, 0.050357498229, 0.117554530501, -0.192708522081, 0.046633847058, -0.041708204895, 0.249373197556, 0.070951208472, 0.373848676682, -0.460246920586, 0.010294812731, -0.015797145665, -0.169808372855, 0.051968902349, 0.016505181789, 0.077071391046, 0.104049354792, 0.104691810906, 0.093304812908, -0.636510789394, 0.226880058646, -0.050267368555, -0.588623940945, 0.427315711975, 0.200073406100, 0.108885653317, -0.101053006947, -0.065639115870, 0.030296226963, -0.399282097816, 0.275544434786, -0.166867047548, -0.805862843990, 0.464725226164, 0.058530718088, 0.090292073786, 0.020322406664, -0.302952915430, 0.155986115336, -0.209200382233, 0.177895963192, -0.140029072762, -0.730445981026, 0.186655759811, -0.032519046217, -0.055879451334, 0.295286446810, -0.296426624060, 0.024502251297, -0.046557702124, 0.007357777562, 0.100641652942, -0.410598188639, -0.007772982586, -0.099064834416, -0.087841965258, 0.427162617445, -0.222795456648, 0.014213014394, -0.004680183716, -0.104840502143, 0.270995080471, -0.240515768528, -0.371152907610, -0.079595640302, -0.131958305836, 0.293875366449, -0.268138587475, -0.136301368475, 0.381022185087, -0.128244414926, 0.260147213936, 0.023905713111, -0.536510348320, -0.100893467665, -0.044200167060, 0.204684540629, 0.074841476977, -0.042358852923, 0.393804013729, -0.093239590526, 0.085985854268, -0.055603347719, -0.683649361134, 0.000733195979, 0.115016780794, 0.201930388808, -0.117494769394, 0.055958498269, 0.286145538092, -0.203832522035, 0.009212946519, 0.104129001498, -0.594346463680, -0.194860562682, 0.106344468892, 0.015141543932, -0.085306361318, 0.036943752319, 0.379886895418, -0.308156579733, 0.076823905110, -0.006790249143, -0.271988540888, -0.129480019212, 0.094416216016, 0.024538515136, -0.096430905163, 0.032684165984, 0.276563644409, -0.349410265684, -0.084412209690, 0.114568799734, -0.503960311413, -0.174266204238, 0.144945010543, 0.002403597580, -0.035496857017, -0.041874561459, 0.322574704885, -0.292183876038, -0.265303790569, 0.253328174353, -0.574435174465, -0.144777566195, 0.227168112993, -0.117410235107, 0.067580088973, 0.152620032430, 0.146621093154, -0.274899661541, -0.442158609629, 0.303219199181, -0.444962859154, 0.278796017170, 0.057263750583, -0.568608462811, 0.047047693282, 0.117851756513, -0.133500248194, -0.352155625820, -1.016738653183, -0.080634877086, -0.303567618132, 0.549501895905, -0.805520176888, -0.442126929760, -0.450546801090, -0.020040290430, -0.541597843170, -0.183038324118, -0.577705562115, -0.374869823456, -0.296515345573, 0.600349128246, -0.053833514452, -0.076494529843, -0.488602101803, -0.589413583279, -0.328079968691, -0.543898999691, -0.159199595451, -0.195283010602, -0.221026554704, 0.363602519035, -0.123810648918, -0.155243590474, -0.224560052156, -0.220021337271, -0.218845173717, -0.190559431911, -0.154907032847, -0.137779235840, -0.083453141153, 0.062321722507, -0.146996498108, -0.171875715256, -0.098780967295, 0.021944535896, 0.054163653404, -0.123893409967, -0.036842830479, -0.128168627620, 0.004563826602, -0.136247128248, 0.234579548240, 0.008832298219, -0.204417422414, -0.017964899540, -0.021572895348, -0.091011717916, -0.057201348245, -0.211549356580, 0.200007230043, -0.042127430439, 0.257489681244, -0.244692295790, -0.392452955246, -0.164181947708, -0.055149123073, -0.342118233442, -0.299732863903, -0.259587913752, -0.172732472420, 0.251233667135, 0.088560223579, -0.208124071360, -0.094185300171, -0.580680012703, -0.030219862238, -0.199631363153, -0.121778532863, -0.040000244975, -0.109663933516, 0.210807442665, 0.113123431802, -0.265081703663, -0.225881084800, -0.527473330498, 0.128000050783, -0.575558066368, 0.014239761047, 0.151048719883, -0.424484729767, 0.283301085234, 0.105463981628, -0.060514643788, -0.196296140552, 0.000099203113, -0.120514504611, -0.347133070230, 0.008969425224, 0.121199943125, -0.483740270138, 0.213180840015, -0.219441071153, 0.026186572388, -0.172160461545, 0.166085019708, 0.028812028468, -0.222609683871, -0.125106707215, 0.151843860745, -0.312801033258, -0.066357672215, -0.243253201246, 0.261691927910, -0.409491986036, 0.209039807320, 0.045155767351, -0.068189516664, 0.007084080484, 0.239698246121, -0.247864037752, -0.087753519416, -0.372607707977, 0.258567154408, -0.427510350943, 0.188225775957, -0.167103305459, 0.028133917600, 0.019941277802, 0.181861549616, -0.158220008016, 0.099204003811, -0.295346856117, 0.130457654595, -0.239852488041, 0.223772868514, -0.164977252483, 0.002636930905, -0.076253391802, 0.212594702840, -0.114606536925, 0.060964711010, -0.214269638062, 0.049632627517, -0.110686741769, 0.256912827492, -0.402281552553, 0.000581373228, 0.084685213864, 0.142013579607, -0.213051185012, 0.148993954062, -0.065137133002, 0.020880457014, -0.129263684154, 0.459740787745, -0.522026419640, 0.020648170263, 0.086624406278, -0.316632002592, -0.071881815791, 0.259717673063, -0.036995600909, -0.052896056324, -0.134425371885, 0.110536709428, -0.383378714323, 0.258491247892, -0.044945057482, -0.722629725933, 0.324015200138, 0.177432820201, 0.102159291506, -0.011458977126, -0.192586243153, -0.024968180805, -0.195782020688, 0.123490303755, -0.224483475089, -0.692569017410, 0.449610292912, 0.035430505872, -0.072151936591, 0.211183160543, -0.300029247999, 0.035402450711, -0.148053526878, 0.011569115333, -0.141799092293, -0.486313909292, 0.081328570843, 0.024039136246, -0.154999434948, 0.379788488150, -0.214033797383, -0.004076967482, -0.039316546172, 0.039297863841, 0.031590227038, -0.204117029905, -0.216531962156, 0.104050904512, -0.194628745317, 0.424097508192, -0.265753984451, -0.124683573842, 0.055322974920, 0.030396215618, 0.164780318737, -0.094007998705, -0.588499426842, 0.037718068808, -0.057668253779, 0.197195842862, -0.053833708167, -0.129475221038, 0.120343402028, -0.118668973446, 0.115386933088, 0.015923671424, -0.548769474030, 0.016667727381, 0.144833236933, 0.172098711133, -0.024831295013, 0.020057968795, 0.252826750278, -0.239376142621, 0.086259722710, -0.011873381212, -0.536029100418, -0.034378439188, 0.170990124345, 0.089777052402, 0.076984584332, 0.046666506678, 0.199666813016, -0.320267111063, -0.148774221539, 0.124900363386, -0.396452635527, -0.106981351972, 0.161430418491, 0.099733777344, 0.073625095189, 0.015353971161, 0.273270308971, -0.308747529984, -0.133548051119, 0.104463435709, -0.204145252705, 0.128267928958, 0.081767350435, 0.041770860553, -0.037671077996, 0.014770735987, 0.117939516902, -0.317440122366, -0.232297912240, 0.053069252521, -0.404261231422, 0.081945307553, 0.196724370122, 0.025941452011, 0.050137411803, 0.007583517581, 0.003989687655, -0.295356273651, -0.111795626581, 0.136430457234, -0.440986841917, 0.040526576340, 0.219908520579, -0.242875993252, 0.028298880905, -0.104708366096, -0.166731789708, -0.194765388966, -0.463999003172, -0.059069167823, -0.241219982505, 0.375938385725, 0.337183982134, -0.420226275921, 0.021380208433, -0.044205296785, -0.270625561476, -0.238787919283, -0.876747310162, -0.301384687424, -0.461429595947, 0.735862374306, -0.651588380337, -0.449604004622, -0.413181424141, -0.065480843186, -0.659293711185, -0.378696501255, -0.649661362171, -0.483887434006, -0.195183217525, 0.662962377071, -0.493723899126, -0.328221976757, -0.517527043819, -0.709378182888, -0.421235769987, -0.527300655842, -0.455895394087, -0.072156727314, -0.302688449621, 0.270344972610, -0.326434463263, -0.277577519417, -0.187352672219, -0.306309372187, -0.090955764055, -0.136590451002, -0.360277563334, 0.055924378335, 0.026107005775, 0.025954902172, -0.054934464395, 0.063622452319, -0.085679322481, -0.086727887392, 0.061079449952, 0.070326082408, -0.003749392927, -0.135686352849, 0.048462796956, -0.230440691113, 0.156182661653, -0.022368960083, -0.165111079812, -0.099072299898, -0.087133578956, -0.185519263148, -0.111993722618, -0.383503764868, 0.079538971186, 0.006654180121, 0.173167943954, -0.052728559822, -0.437882632017, -0.095747157931, -0.091079957783, -0.235875666142, -0.403391689062, -0.362524539232, -0.218245938420, 0.267778366804, 0.402775108814, -0.489281505346, 0.040727969259, -0.485878467560, -0.167136877775, -0.421205580235, -0.230089068413, 0.085027411580, -0.161002203822, 0.245207712054, 0.340087532997, -0.297740668058, 0.027292221785, -0.709597229958, 0.028433984146, -0.248304352164, -0.243764936924, 0.120821610093, -0.599486172199, 0.209877356887, 0.021908856928, -0.217365950346, 0.093540273607, -0.120362371206, -0.016168216243, -0.307065010071, -0.142475455999, 0.105712264776, -0.632687687874, 0.205958187580, -0.055801011622, -0.039027847350, 0.238576516509, -0.047724291682, -0.155257135630, -0.230248600245, -0.169723629951, 0.177879109979, -0.537160456181, 0.132090136409, -0.126679331064, 0.096898853779, -0.243688076735, 0.148561596870, -0.136390194297, 0.080209672451, 0.011645959690, 0.146168202162, -0.128941208124, -0.052953336388, -0.312440633774, 0.216192424297, -0.365742504597, 0.219066187739, -0.255640536547, 0.059399869293, -0.000237921835, 0.259879976511, -0.177827104926, 0.155272379518, -0.438750386238, 0.099934674799, -0.308276385069, 0.306530237198, -0.182832255960, 0.172470450401, 0.054856900126, 0.313664466143, -0.104486748576, 0.162812933326, -0.485769867897, -0.099755600095, -0.399202793837, 0.441860675812, -0.394667595625, 0.140398487449, 0.051804330200, 0.102868415415, -0.205000028014, 0.230469286442, -0.433712184429, -0.038799207658, -0.343390583992, 0.437421441078, -0.311084002256, 0.173061430454, 0.045217748731, -0.240281865001, 0.063100770116, 0.303714424372, -0.258043825626, -0.008357638493, -0.404256671667, 0.081434123218, -0.072159387171, 0.222139850259, -0.070582211018, -0.681342780590, 0.267052382231, 0.225690558553, -0.305735707283, 0.220573037863, -0.393651694059, 0.036094002426, -0.069598525763, 0.158574000001, -0.092587105930, -0.632921576500, 0.385377854109, 0.023694010451, -0.394017159939, 0.393236249685, -0.343299269676, 0.012096478604, 0.005962201394, -0.069502346218, -0.011395944282, -0.393683165312, -0.078719541430, 0.008102076128, -0.235459417105, 0.357665717602, -0.087056718767, -0.010282518342, 0.091443590820, -0.137445315719, 0.167793720961, -0.126036554575, -0.351739257574, -0.029163345695, -0.060205291957, 0.262878388166, -0.038016866893, -0.147317767143, -0.077976129949, -0.030947731808, 0.032702762634, -0.027266807854, -0.587299406528, -0.040311567485, 0.145597845316, 0.155416622758, 0.073913849890, -0.082871824503, 0.043475128710, -0.177976980805, 0.005928459112, -0.013136858121, -0.471214205027, 0.035969238728, 0.076001033187, 0.075636096299, 0.052337575704, 0.122734032571, 0.087239414454, -0.240615934134, -0.084445640445, -0.050065837801, -0.198910474777, 0.014395121485, 0.239932537079, -0.026598267257, -0.020666230470, 0.076280787587, 0.027924632654, -0.153219103813, -0.134268224239, 0.054816182703, -0.141385972500, -0.079950198531, 0.039902623743, -0.025072671473, 0.079966016114, -0.059607882053, 0.056798715144, -0.177238628268, -0.126594915986, 0.001240204787, -0.208873838186, 0.102911338210, 0.141524687409, 0.021402793005, -0.043917953968, -0.033507555723, -0.081209994853, -0.227290302515, -0.289294749498, 0.107309013605, -0.007361719850, 0.094510927796, 0.266083091497, -0.143224477768, 0.063125520945, -0.018911009654, -0.060438204557, -0.121425710618, -0.405495285988, 0.092624597251, -0.244768232107, 0.115244410932, 0.233759775758, -0.231189042330, 0.064559765160, -0.027483766899, -0.165140479803, -0.050032481551, -0.538540244102, -0.002774922410, -0.141053840518, 0.308186501265, -0.154948085546, -0.314932256937, 0.068440273404, -0.002403273247, -0.042127769440, -0.063813343644, -0.717963039875, -0.165528923273, -0.358716577291, 0.718379378319, -0.631035387516, -0.632568895817, -0.552955210209, -0.009006022476, -0.020142005756, -0.859210669994, -0.564803302288, -0.379351466894, -0.093624912202, 0.527758896351, -0.472771227360, -0.249601349235, -0.653842210770, -0.667669534683, 0.084461003542, -0.549544692039, -0.323585301638, 0.026813510805, -0.199256837368, 0.326608210802, -0.255464285612, -0.223724901676, -0.334083378315, -0.410852134228, -0.263548135757, -0.367080450058, -0.269167900085, -0.113798692822, -0.024695273489, -0.099486738443, -0.254026830196, -0.265779137611, -0.144061848521, -0.163731887937, 0.032012801617, -0.110245570540, -0.033571131527, -0.187196537852, 0.205696687102, -0.182777985930, 0.171045139432, 0.048270504922, -0.220381185412, -0.044569998980, 0.009363136254, -0.211976110935, -0.136036887765, -0.308108240366, -0.144479840994, -0.160164952278, 0.230867058039, -0.048605278134, -0.313053607941, -0.048972338438, 0.133614853024, -0.318261116743, -0.324022889137, -0.405616611242, -0.259614259005, 0.021481370553, 0.504408121109, -0.369988739491, 0.046937637031, -0.457301765680, -0.159674629569, -0.827395260334, -0.568902790546, -0.130672022700, -0.675233602524, 0.299033254385, 0.218177363276, -0.270006775856, 0.242269754410, -0.552159190178, -0.073994353414, -0.412538826466, -0.430635601282, -0.035630647093, -0.818703651428, 0.267573714256, 0.185689613223, -0.140540495515, 0.231158867478, -0.331573814154, -0.087672285736, -0.112351350486, -0.337047368288, 0.090743735433, -0.760148227215, 0.195312798023, 0.102033033967, -0.152585282922, 0.414344429970, -0.131598934531, -0.371699005365, -0.088857829571, -0.074397996068, 0.076810352504, -0.392392516136, 0.214020773768, -0.168801426888, -0.077885329723, 0.120974086225, 0.099458701909, -0.406181514263, -0.077183045447, -0.164505377412, 0.117406599224, -0.075730562210, 0.111513219774, -0.150908797979, 0.043844919652, -0.049898728728, 0.101667478681, -0.260140091181, 0.119913265109, -0.061006244272, 0.209384903312, -0.073845058680, 0.123354047537, -0.293673336506, -0.064593844116, -0.228302240372, 0.131903320551, -0.343005448580, 0.178012758493, -0.005618314724, 0.260302662849, -0.138818800449, 0.181231871247, -0.479877740145, -0.156482994556, -0.206947371364, 0.210969820619, -0.409143805504, 0.175466492772, 0.133778944612, 0.041021391749, -0.215741723776, 0.116013698280, -0.497275739908, -0.101597383618, -0.208230897784, 0.287991851568, -0.201418176293, 0.146120280027, 0.045774258673, -0.246088892221, 0.038352310658, 0.233410045505, -0.464940726757, 0.026847036555, -0.202791646123, 0.310672640800, -0.078779704869, 0.168057575822, -0.199938952923, -0.547465741634, 0.252253115177, 0.191706329584, -0.325623154640, 0.198045387864, -0.191393896937, 0.179309636354, 0.084743916988, -0.106487266719, -0.228623226285, -0.445699870586, 0.177594378591, 0.072444453835, -0.268564790487, 0.160142242908, 0.034942600876, 0.008463466540, -0.016328347847, -0.130169376731, 0.032435111701, -0.209972575307, -0.069460555911, 0.048882819712, 0.042413812131, 0.238102674484, -0.056205239147, -0.013662819751, -0.002758032642, -0.079553075135, 0.080534853041, -0.089064322412, -0.394308209419, 0.069493807852, 0.183304622769, 0.115330316126, 0.051167245954, 0.049445513636, -0.090405173600, -0.144025504589, -0.061961371452, -0.035717010498, -0.233198896050, 0.183916285634, 0.187764182687, -0.047655116767, 0.107032716274, 0.189996540546, -0.131110221148, -0.132327765226, -0.045668169856, 0.035158056766, -0.066165208817, 0.097751632333, 0.174902990460, -0.060569029301, 0.072018899024, 0.168639481068, -0.043438654393, -0.045145221055, -0.057909853756, -0.015806555748, -0.143616333604, 0.027428152040, 0.120864719152, -0.153653979301, 0.014388291165, -0.031553354114, -0.115916855633, -0.103452943265, -0.032917890698, -0.126977100968, 0.105912037194, 0.046101026237, 0.080331049860, -0.039896585047, 0.006913201418, -0.042130067945, -0.017529202625, 0.006613067351, -0.088483303785, 0.015322599560, -0.074858285487, 0.041069123894, 0.246295854449, -0.026127424091, 0.111847609282, -0.004841051530, -0.084915682673, -0.137276425958, -0.287284702063, 0.094990782440, -0.184659734368, 0.119099378586, 0.215170189738, -0.368064373732, 0.026381125674, -0.077189080417, -0.203677326441, -0.098115444183, -0.283072471619, -0.005326363724, -0.126005843282, 0.325752615929, 0.075251884758, -0.227643117309, 0.046655185521, 0.069978371263, -0.379438102245, 0.013047579676, -0.566323220730, -0.142453432083, -0.129313170910, 0.511539459229, -0.343092858791, -0.363176137209, 0.199785262346, -0.086476981640, -0.367654323578, -0.079283617437, -0.691516160965, -0.262898415327, -0.064431570470, 0.766943871975, -0.834124982357, -0.555408060551, -0.440770119429, 0.038820985705, -0.132510408759, -0.761473476887, -0.329534351826, -0.169704228640, 0.054429292679, 0.306647062302, -0.455700457096, -0.168477892876, -0.296360701323, -0.325748205185, 0.125941708684, -0.498045742512, -0.410122334957, -0.238750845194, 0.184421151876, 0.288912862539, -0.237902671099, -0.076704896986, -0.330723404884, -0.281485289335, -0.205948621035, -0.270386248827, -0.280909895897, 0.003106378717, 0.182080462575, -0.074674732983, -0.053526513278, -0.084865078330, -0.051372658461, 0.065769761801, 0.022891044617, -0.169065907598, 0.047851111740, 0.026545999572, 0.088401228189, -0.236644864082, -0.092323310673, -0.192389354110, -0.174302905798, -0.229437693954, 0.208081811666, -0.278756320477, -0.184941917658, -0.124385379255, -0.088040359318, -0.177637577057, -0.072471722960, -0.116640456021, 0.088706322014, -0.128870472312, 0.280677497387, -0.431968301535, -0.401022493839, -0.400733441114, -0.234110459685, -0.079398646951, 0.479440242052, -0.113047599792, 0.029313096777, -0.416001468897, -0.219393491745, -0.603964745998, -0.428644955158, -0.168871209025, -0.677887678146, 0.077665597200, 0.271348685026, -0.244397535920, 0.135279849172, -0.444529861212, -0.013535774313, -0.353343069553, -0.483652323484, -0.010562012903, -0.786907494068, 0.109283074737, 0.237131476402, -0.093139439821, 0.175670042634, -0.351592719555, -0.346913844347, 0.013601024635, -0.337692856789, 0.101947359741, -0.435129165649, 0.081887699664, 0.164502561092, -0.131878837943, 0.230368077755, -0.144017875195, -0.347884297371, -0.021421147510, -0.145603507757, 0.066838398576, -0.155856013298, 0.245893716812, 0.015741238371, -0.284478873014, 0.169479817152, -0.131050139666, -0.540884852409, -0.099888361990, -0.112706787884, 0.108878813684, -0.061655879021, 0.115735143423, -0.042761918157, -0.300199806690, 0.158718362451, -0.003752870951, -0.313722789288, 0.007861576043, -0.153360337019, 0.106448478997, -0.003586582839, 0.188312530518, -0.132305726409, -0.433266192675, 0.034423500299, 0.185542225838, -0.275144040585, 0.114496178925, -0.366377234459, 0.284180343151, -0.064874626696, 0.142868980765, -0.131270423532, -0.405941188335, 0.004517938942, 0.236983343959, -0.281833738089, 0.083968140185, -0.260106325150, 0.278515815735, -0.004696262535, 0.239503577352, -0.271635204554, -0.325862348080, 0.016358617693, 0.407404422760, -0.278664201498, -0.033191371709, -0.359032958746, 0.042362630367, -0.060907293111, 0.169884800911, -0.345052361488, -0.216153725982, -0.015297953971, 0.346855968237, -0.112565778196, -0.100207641721, -0.245468959212, -0.232594728470, 0.053268823773, 0.158896312118, -0.239143744111, -0.156018406153, -0.009648730978, 0.179414495826, -0.034656252712, -0.123522587121, -0.189216554165, -0.189077287912, 0.042449161410, 0.090303100646, -0.116453990340, 0.101046845317, -0.024130778387, 0.182972654700, 0.003743350506, -0.190127491951, -0.149716094136, -0.080783583224, -0.112185314298, 0.114165857434, 0.051488220692, 0.103318855166, 0.076744832098, 0.146036356688, -0.136788725853, -0.093148998916, -0.114008545876, -0.143737941980, -0.083118729293, 0.099548436701, 0.147810205817, 0.018700519577, -0.013539383188, 0.196445271373, -0.237376809120, -0.066447913647, -0.088811010122, 0.036800254136, -0.001417065505, 0.176029503345, 0.223896309733, -0.120536118746, -0.018919881433, 0.134686961770, -0.277339249849, -0.012921935879, -0.229386344552, -0.111806601286, 0.087892629206, 0.015278608538, 0.166690886021, -0.158234283328, 0.034875690937, 0.026259819046, -0.295647025108, -0.015370757319, -0.178324431181, -0.142627447844, 0.128162652254, -0.035820074379, 0.181393712759, -0.151755735278, 0.020358121023, 0.006756428163, -0.191919848323, 0.075172893703, -0.093685068190, 0.018003767356, 0.112333431840, 0.051088422537, 0.095394574106, -0.210807114840, 0.076583981514, 0.065164998174, -0.360502868891, -0.020288888365, -0.014766068198, -0.012358058244, 0.018922094256, 0.184289515018, 0.139408379793, -0.181686580181, 0.085223250091, 0.033959928900, -0.349076867104, 0.016695775092, -0.289009124041, 0.065208196640, -0.076989606023, 0.257362067699, 0.107194550335, -0.536555886269, 0.007795356214, -0.004006313160, -0.567749559879, 0.091904751956, -0.311149239540, -0.049322556704, -0.034486867487, 0.173178374767, -0.048783995211, -0.492044746876, 0.137476697564, 0.008888251148, -0.516686618328, 0.157840490341, -0.353082090616, -0.121921896935, 0.115259252489, 0.223901540041, -0.161259114742, -0.410278081894, 0.202602788806, -0.127682015300, -0.289566516876, -0.147767528892, -0.343807488680, -0.421182602644, 0.147696703672, 0.565819263458, -0.907765984535, -0.556584596634, -0.140962168574, -0.286064803600, -0.195922434330, -0.776977181435, -0.258465647697, -0.284949153662, 0.048793166876, 0.398405075073, -0.445899426937, -0.089022487402, -0.318080335855, -0.477846711874, -0.087848648429, -0.459491670132, -0.140912741423, -0.091829709709, 0.270977079868, 0.195418238640, -0.221664130688, -0.032776091248, -0.110671490431, -0.173077777028, -0.231930419803, -0.220671698451, -0.239340141416, -0.016714572906, -0.067616827786, -0.025257073343, -0.046006593853, 0.007387489080, -0.060368925333, -0.071966990829, 0.042824350297, -0.075179606676, -0.000426799059, 0.104439303279, -0.133700847626, -0.075254447758, -0.003196011763, -0.105257548392, -0.308347135782, -0.098643288016, 0.054049592465, -0.237636387348, -0.081980839372, -0.060053952038, -0.123289525509, 0.022411687300, -0.131989151239, -0.059043664485, 0.025034468621, -0.264118164778, -0.130321934819, -0.523745656013, -0.318782866001, -0.210885569453, -0.203282162547, -0.092343978584, 0.390412151814, -0.072284840047, 0.115909777582, -0.423727482557, -0.497756093740, -0.527546167374, -0.467833876610, -0.098286814988, -0.348702400923, 0.200778454542, 0.176809728146, -0.199596360326, 0.049926266074, -0.325696051121, -0.553273797035, -0.293637633324, -0.362462341785, 0.041871640831, -0.490629881620, 0.096660874784, 0.157966181636, -0.405484825373, 0.138709083200, -0.338178187609, -0.467234939337, -0.088951013982, -0.023900780827, -0.050253998488, -0.090460337698, 0.084927029908, 0.175701469183, -0.301942616701, 0.091604247689, -0.283700585365, -0.628960967064, 0.085975810885, -0.198968142271, -0.024121187627, -0.083226628602, 0.289856106043, 0.088897250593, -0.449861854315, -0.020323172212, -0.082009054720, -0.453586280346, 0.097009100020, -0.342557013035, 0.103334546089, -0.036828424782, 0.204689189792, 0.080436721444, -0.462319254875, 0.200517207384, -0.110051900148, -0.210598126054, -0.012274720706, -0.277131378651, 0.044538132846, 0.124502055347, 0.125449866056, 0.101705826819, -0.402346372604, 0.177527308464, 0.123966008425, -0.333607077599, -0.026750996709, -0.393051952124, 0.322929263115, 0.051342561841, 0.137476295233, -0.126730695367, -0.437708377838, 0.009572417475, 0.293423891068, -0.184584110975, -0.067761518061, -0.406751096249, 0.262831866741, 0.006703981198, 0.244652152061, -0.141258627176, -0.311157405376, 0.166294068098, 0.297432780266, -0.094772763550, -0.161099776626, -0.467581421137, 0.197580620646, 0.070417381823, 0.067903652787, -0.256588101387, -0.230841994286, 0.012715417892, 0.331887632608, -0.048661570996, -0.023829612881, -0.408655107021, 0.089109137654, -0.089160867035, 0.080562509596, -0.105259567499, -0.221102774143, 0.046740476042, 0.302910447121, 0.042555369437, -0.101585008204, -0.169885888696, 0.031534057111, 0.011064142920, 0.061383698136, -0.000431261054, -0.074783913791, -0.043628163636, 0.400690913200, 0.063716202974, -0.084185600281, -0.230254709721, -0.052935287356, -0.029484216124, -0.010865794495, 0.095415703952, 0.014079054818, -0.012294036336, 0.188054040074, -0.155751869082, -0.057707589120, -0.218090370297, -0.096738718450, 0.170966282487, 0.075831301510, 0.057711318135, 0.027005912736, 0.057882949710, 0.179255768657, -0.224120229483, -0.153044089675, -0.154459804296, -0.031279511750, 0.176468312740, -0.058538325131, 0.137897238135, -0.064450293779, 0.140068471432, 0.078729964793, -0.299194544554, -0.113916367292, -0.162601873279, -0.148012816906, 0.300414621830, 0.129522994161, 0.257726997137, -0.100448302925, 0.063425920904, 0.114106178284, -0.473745971918, -0.004922568798, -0.200131252408, -0.112102195621, 0.189018994570, 0.216442450881, 0.085019640625, -0.187302216887, 0.081299319863, 0.072097547352, -0.324255377054, -0.029101051390, -0.104718700051, -0.114567682147, 0.127051740885, 0.099047839642, 0.226573511958, -0.220846921206, -0.010150404647, 0.032976530492, -0.444473326206, 0.025041548535, -0.207536801696, -0.046512231231, 0.002035655547, 0.178059488535, 0.011905045249, -0.089936502278, 0.004627351183, -0.012629513629, -0.504814147949, 0.106578268111, -0.344297438860, -0.008987994865, -0.123641192913, 0.189815238118, -0.000790606951, -0.271545916796, 0.270467221737, -0.143421724439, -0.593548297882, 0.159453138709, -0.383519709110, -0.128964766860, -0.169408932328, 0.139795526862, -0.019895389676, -0.475185930729, 0.089222133160, -0.137823343277, -0.526099920273, 0.048715755343, -0.251130044460, -0.116742901504, 0.070065341890, 0.247511550784, -0.265046745539, -0.442711681128, -0.023219002411, -0.231970831752, -0.253707557917, -0.135785117745, 0.144887074828, -0.401119202375, 0.050135180354, 0.449108541012, -0.898239910603, -0.394894182682, -0.052673697472, -0.216815754771, -0.321624517441, -0.817888736725, 0.033024638891, -0.249381020665, -0.041199643165, 0.131255045533, -0.142469257116, -0.219565033913, -0.229809656739, -0.276411086321, -0.125777751207, -0.360902041197, -0.165827140212, -0.012107966468, 0.106548033655, -0.087826013565, -0.046529542655, -0.136152833700, 0.138292595744, -0.036057382822, 0.021162439138, -0.109225787222, 0.031560290605, -0.009589383379, 0.048624906689, -0.071662627161, -0.162710905075, 0.031103145331, 0.015948027372, 0.046878222376, -0.009246904403, -0.142912685871, 0.030229553580, -0.147566601634, 0.016723996028, -0.031136337668, 0.107475571334, 0.002598490566, -0.246407762170, 0.016373971477, -0.251200497150, -0.041322205216, -0.211408391595, -0.191235944629, -0.192339822650, 0.066616393626, 0.071321092546, -0.084173478186, -0.258401274681, -0.212194755673, -0.329244405031, -0.397818684578, -0.325138479471, -0.176327273250, 0.001624465338, 0.106001488864, 0.323617875576, -0.307610869408, 0.031832981855, -0.412220150232, -0.656304776669, -0.617250680923, -0.547171652317, -0.093796819448, 0.140283524990, 0.045455195010, 0.136116743088, -0.355737566948, 0.096045382321, -0.595632195473, -0.405208289623, -0.147079050541, -0.190493389964, -0.006402982399, 0.253878206015, -0.017840456218, 0.101580001414, -0.224200591445, 0.046452905983, -0.625057697296, -0.287310421467, -0.096878528595, -0.036003530025, 0.054551705718, 0.213266879320, 0.108936190605, 0.116095557809, -0.603401243687, 0.076175250113, -0.467106491327, -0.351069122553, 0.085725069046, -0.196103900671, 0.018783843145, 0.076505951583, 0.066779695451, 0.156420245767, -0.536915183067, 0.094780169427, -0.139822334051, -0.332712352276, 0.134193465114, -0.278098762035, -0.014278124087, 0.084794439375, 0.073706671596, 0.083378858864, -0.270931005478, 0.126305520535, 0.066431500018, -0.118220113218, 0.057336546481, -0.177713900805, 0.044697955251, 0.006382486783, 0.266952484846, 0.011865938082, -0.231728658080, 0.033140189946, 0.035258919001, -0.169945150614, -0.026984820142, -0.138405457139, 0.100126236677, 0.103437758982, 0.103440120816, -0.053576987237, -0.182912558317, 0.077903352678, 0.126764059067, -0.218113318086, -0.017478173599, -0.257357120514, 0.293033689260, -0.013655425049, 0.138456061482, -0.122186928988, -0.126765847206, 0.097376056015, 0.277366846800, -0.127494424582, -0.035366673023, -0.236464992166, 0.268618673086, -0.206424087286, 0.061000335962, -0.128271624446, -0.264237523079, 0.048013925552, 0.360078901052, -0.057284858078, -0.100006751716, -0.243721202016, 0.026981484145, -0.211453199387, 0.011399385519, -0.034939594567, -0.252608567476, 0.088421136141, 0.446999698877, -0.089582152665, -0.005356022157, -0.215535268188, 0.035647563636, -0.045532625169, -0.062420360744, -0.052569597960, -0.108757458627, 0.083818435669, 0.333340108395, -0.115048252046, 0.040324691683, -0.157882928848, -0.045293908566, 0.011269079521, -0.060204684734, 0.052394367754, -0.108746543527, 0.084165744483, 0.198372587562, -0.109186135232, -0.008821593598, -0.177361667156, -0.042753022164, 0.086501620710, 0.056773878634, 0.100028179586, -0.092323832214, 0.079922482371, 0.235174894333, -0.106368668377, -0.032054983079, -0.065821237862, -0.146783083677, 0.124133259058, 0.164492934942, 0.061046019197, -0.020803250372, 0.014315753244, 0.189838230610, -0.325968325138, -0.016839522868, -0.235464453697, -0.173071846366, 0.169741123915, 0.212947592139, 0.147169575095, -0.025588091463, 0.060015041381, 0.174560695887, -0.362341582775, -0.014458445832, -0.239080116153, -0.167842328548, 0.160789474845, 0.315607815981, 0.132768645883, -0.120402224362, -0.013482386246, 0.103858776391, -0.418673962355, 0.016403818503, -0.193387210369, -0.177483618259, 0.207075908780, 0.117669224739, 0.060379501432, -0.043542828411, 0.151697561145, -0.019082337618, -0.497845679522, 0.018118161708, -0.135115176439, 0.055071972311, 0.090082436800, 0.042273249477, -0.145908191800, -0.082791365683, 0.224635913968, -0.199867993593, -0.514193236828, -0.011448888108, -0.145360559225, -0.094320394099, -0.296540141106, 0.192517280579, -0.100970029831, -0.163287088275, 0.147070690989, -0.040871903300, -0.573445737362, 0.072209894657, -0.212741881609, -0.186035245657, -0.268262803555, 0.367821961641, -0.233315125108, -0.135888755322, 0.168944314122, -0.270771443844, -0.673474550247, -0.082392647862, -0.059445172548, -0.203857764602, 0.110765881836, 0.245647326112, -0.513998568058, -0.164773702621, 0.123632356524, -0.304689466953, -0.245688274503, -0.409002453089, 0.115818157792, -0.340345680714, 0.141047522426, 0.269810527563, -0.624801754951, -0.315448850393, 0.062175743282, -0.322398215532, -0.078980177641, -0.505940318108, -0.038570377976, 0.174064055085, -0.123512513936, 0.143971800804, -0.112093031406, -0.164102002978, -0.015727274120, -0.169014081359, -0.221123769879, -0.435193538666, -0.266936004162, 0.027386726812, 0.034780669957, -0.006514090113, -0.070658892393, -0.072326749563, -0.050596568733, -0.008658399805, 0.008955011144, -0.050642546266, 0.072010144591, 0.013248530217, 0.180537045002, -0.174436748028, -0.052645854652, 0.016799192876, -0.102868907154, -0.108611956239, -0.063495196402, -0.091728717089, -0.116343684494, 0.012087499723, 0.092069759965, -0.133526101708, -0.011881994084, 0.047283381224, -0.137044951320, -0.094609148800, -0.003979571629, -0.044711139053, -0.054929252714, -0.184004560113, -0.121670864522, 0.015388466418, 0.189508005977, -0.001600021962, -0.514087855816, -0.021948704496, -0.340881735086, -0.498104840517, -0.354781597853, -0.255376607180, 0.021782863885, 0.201344132423, 0.339265316725, -0.397506445646, -0.063505217433, -0.335001468658, -0.576448798180, -0.303226262331, -0.236521616578, -0.449124544859, 0.161872670054, 0.171735823154, 0.214688256383, -0.463716775179, 0.256619393826, -0.549582779408, -0.207922279835, -0.179384157062, -0.072884984314, -0.092637985945, 0.498674422503, 0.011852595955, -0.009777890518, -0.575159788132, -0.047014869750, -0.715030074120, -0.062360018492, -0.198348984122, -0.325186371803, -0.007730823476, 0.217170655727, 0.154348850250, 0.065446779132, -0.408763587475, -0.183419957757, -0.956353724003, -0.068555347621, 0.001584461541, -0.268620908260, -0.003443258815, 0.108762390912, 0.238247245550, 0.028078719974, -0.289064496756, -0.062638908625, -0.376725554466, 0.049895074219, 0.050063356757, -0.148922100663, 0.024624623358, 0.078041367233, 0.173531636596, 0.041088368744, -0.211258009076, -0.006601167377, -0.095067717135, -0.055225569755, -0.019170895219, -0.082996428013, 0.128648191690, 0.000831713958, 0.177908271551, -0.035419944674, -0.261341601610, 0.064718693495, -0.035141218454, -0.103398673236, -0.099696643651, -0.071637369692, 0.101023413241, -0.049379318953, 0.162083208561, -0.006213862449, -0.138423725963, 0.016022615135, 0.059471711516, -0.004625166301, -0.001491205068, -0.001334397006, 0.164536356926, -0.288121163845, 0.142404243350, 0.091089099646, -0.192014768720, 0.026188023388, -0.003495311597, -0.163632839918, -0.009178252891, -0.065047897398, 0.101137168705, -0.362663656473, -0.032616339624, -0.036456175148, -0.156803965569, 0.213471964002, 0.211948901415, -0.127368658781, 0.154888972640, -0.035709146410, 0.201649382710, -0.300596565008, 0.004888983909, -0.082126393914, -0.208499655128, 0.125449776649, 0.094919815660, -0.166003063321, 0.190551787615, -0.031365476549, 0.175479009748, -0.151908054948, -0.064959675074, -0.073106095195, -0.164136230946, 0.112133376300, 0.050885442644, -0.137324675918, 0.108902491629, -0.141336813569, 0.120365552604, 0.060911841691, -0.052055489272, 0.030241696164, -0.058059964329, 0.040559835732, 0.198387980461, 0.005464812741, 0.026649098843, -0.189475566149, 0.062828697264, 0.103572905064, -0.043401148170, 0.148328244686, -0.057327814400, 0.169437155128, 0.049378637224, -0.048596300185, -0.015469084494, -0.171382576227, -0.048382379115, 0.142654836178, 0.014573941007, 0.054761450738, -0.021301563829, 0.081414267421, 0.017294099554, -0.223457023501, 0.012319262139, -0.219682544470, -0.205318912864, 0.254178911448, 0.180117025971, 0.122580088675, -0.014812430367, 0.053104251623, -0.040703754872, -0.279609113932, -0.033752549440, -0.131235316396, -0.033223439008, 0.170835673809, 0.165418624878, 0.138199090958, 0.073787659407, 0.113442815840, -0.045052289963, -0.297164410353, -0.010404278524, -0.318107724190, -0.100522197783, 0.166539520025, 0.202832877636, 0.027758792043, 0.109099440277, 0.021151872352, -0.005086294375, -0.468483388424, -0.064354106784, -0.199116140604, -0.163772568107, -0.009236478247, 0.140406012535, -0.085584342480, 0.116040565073, 0.080219030380, -0.136115446687, -0.466035425663, -0.012567370199, -0.173919215798, -0.006487559993, -0.322860926390, 0.263773500919, -0.107721455395, 0.027157811448, 0.107696332037, -0.327899694443, -0.564249277115, -0.016968559474, -0.033157296479, -0.070498980582, -0.233461737633, 0.111750967801, -0.223252594471, -0.108837135136, 0.125793948770, -0.541508197784, -0.662952184677, 0.031877819449, 0.033778429031, -0.162034526467, 0.049594338983, 0.205421790481, -0.509851932526, -0.085589811206, 0.188929706812, -0.544650077820, -0.329054921865, -0.342103481293, 0.189352452755, -0.305718600750, -0.011046605185, 0.150291457772, -0.244743570685, -0.284345805645, -0.057948123664, -0.364302843809, -0.087299719453, -0.336235612631, -0.006489378866, 0.067549191415, 0.222660958767, -0.110904455185, 0.064271762967, 0.087119802833, 0.080527991056, -0.013901620172, -0.329325288534, -0.256216913462, -0.272428721189, 0.140237659216, 0.065556608140, 0.017336256802, -0.071897588670, 0.001828674227, -0.116039656103, -0.017341209576, 0.025160249323, -0.137212663889, 0.022742651403, -0.008367180824, -0.052351817489, -0.032620020211, 0.052667386830, 0.038772456348, 0.063025064766, -0.027434352785, 0.001559697092, -0.017813622952, -0.072481893003, 0.062537290156, 0.075301013887, -0.012394443154, -0.039048105478, -0.083711169660, 0.029919691384, 0.049794860184, -0.073941029608, -0.044052965939, 0.053548492491, -0.030973246321, -0.008518832736, -0.059642750770, 0.266625523567, 0.018762504682, -0.028139630333, -0.099561177194, -0.248609170318, -0.331049084663, -0.327049762011, -0.352153837681, -0.193178057671, -0.168777853251, 0.497678518295, -0.192874729633, 0.088996477425, -0.089660152793, -0.341776669025, -0.247208967805, -0.076366111636, -0.492591798306, -0.090370185673, -0.114431396127, 0.326794028282, -0.457163512707, 0.182919204235, -0.194922417402, 0.164508536458, -0.216036453843, -0.415842145681, -0.215151309967, 0.257632732391, -0.038221344352, 0.204536974430, -0.498757898808, 0.156870827079, -0.494239181280, 0.112597711384, -0.394692450762, -0.222983703017, -0.104839563370, 0.299678444862, 0.021480491385, 0.223783493042, -0.141404852271, -0.144472807646, -0.816969871521, 0.196411907673, -0.301418095827, -0.266731500626, 0.064986377954, 0.029545463622, -0.001909951447, 0.196485012770, -0.161448210478, -0.081462867558, -0.710919260979, 0.349419265985, -0.144786164165, -0.184603497386, 0.023088665679, -0.077541321516, 0.113922730088, -0.010404991917, -0.024773949757, 0.052172772586, -0.441806286573, -0.158265173435, 0.005499833263, 0.020497905090, 0.150783792138, -0.007079944480, 0.033276509494, 0.136331200600, -0.037284616381, 0.012500268407, -0.385451108217, -0.159189119935, 0.008364171721, -0.108970917761, 0.201928123832, -0.150441691279, 0.012493004091, 0.141137242317, -0.064459219575, 0.160517185926, -0.321783453226, -0.055859297514, -0.019164185971, -0.101126827300, 0.235738992691, -0.208422034979, 0.089945405722, 0.168217778206, -0.086596794426, 0.151387304068, -0.350806355476, -0.179581522942, 0.132324650884, -0.085777349770, 0.269229054451, -0.094741508365, -0.055363830179, -0.083789288998, -0.182642832398, 0.098421402276, -0.164801076055, -0.206510484219, 0.111534893513, -0.136258989573, 0.291533619165, -0.201162755489, -0.022153008729, 0.066032543778, -0.144284203649, 0.008850594051, -0.118932515383, -0.098795734346, 0.264651954174, -0.153647452593, 0.101026326418, -0.076813757420, -0.045472901314, 0.057620123029, -0.092293784022, 0.134192332625, -0.112528055906, -0.019241655245, 0.229100689292, -0.107340261340, 0.078162990510, -0.043221738189, -0.146189197898, -0.056455299258, -0.042528923601, 0.091102987528, 0.005195853300, -0.001829721965, 0.190514340997, -0.144847899675, 0.060207508504, 0.156913712621, -0.029271442443, -0.067793451250, 0.024174017832, 0.087390340865, -0.113683737814, -0.115061506629, 0.216220512986, -0.160526663065, -0.013591377996, 0.322415411472, -0.005231271032, 0.075519010425, 0.048089127988, 0.019838303328, -0.238108649850, -0.150009125471, 0.037204340100, -0.133334547281, -0.153080672026, 0.040684517473, 0.182049423456, 0.179410129786, 0.189566582441, -0.137600883842, -0.045580271631, -0.267766237259, 0.081181161106, -0.198402196169, -0.361515223980, 0.064442925155, 0.203260719776, 0.003444098402, 0.081833720207, -0.026520824060, -0.016705576330, -0.326683640480, 0.074455462396, -0.123661078513, -0.366683721542, -0.042667850852, 0.216302722692, -0.069838806987, 0.136012405157, 0.027026284486, -0.131713539362, -0.537635922432, 0.010831410065, 0.080824680626, -0.263191580772, -0.181057319045, 0.237771481276, -0.142907157540, 0.119891099632, -0.051445845515, -0.250451326370, -0.615180790424, 0.074710443616, 0.121530584991, -0.209901615977, -0.314035207033, 0.212740540504, -0.307669818401, -0.183173283935, 0.068004786968, -0.206110879779, -0.405110597610, -0.028138248250, 0.221322536469, -0.291352421045, -0.409953117371, 0.238232299685, -0.347240507603, -0.203474789858, 0.163772717118, -0.543005347252, -0.743039488792, 0.096795253456, 0.263102531433, -0.333325475454, -0.285447090864, 0.188568145037, -0.261756986380, -0.178957432508, 0.013300548308, -0.502528727055, -0.316189289093, -0.222914770246, 0.173320204020, -0.213920176029, -0.057672947645, 0.066713333130, -0.148132756352, -0.142846912146, -0.026374889538, -0.253484219313, -0.282852798700, -0.289742857218, -0.124939754605, -0.154133021832, 0.144126445055, -0.201443016529, 0.036317825317, 0.176346868277, 0.127633646131, -0.275098323822, -0.259260416031, -0.222931981087, -0.229814261198, -0.010477721691, 0.085271544755, -0.024807680398, 0.052572019398, -0.067511349916, -0.001853942871, -0.031280882657, -0.062626428902, 0.086830280721, 0.018083848059, -0.023412667215, 0.006045550108, 0.039077393711, 0.050538472831, -0.077192828059, -0.063235118985, 0.062620960176, -0.024269089103, -0.066663205624, 0.029599197209, 0.075653918087, -0.080193690956, -0.032893016934, 0.074641652405, -0.011482335627, -0.066666081548, 0.043189905584, -0.005745656788, -0.048619169742, 0.046620167792, -0.113185830414, 0.015298640355, -0.157863035798, 0.069429554045, -0.025595929474, -0.171471580863, 0.025428794324, -0.125956565142, -0.176422774792, -0.181799247861, -0.086932189763, -0.280517309904, -0.409321248531, 0.372076183558, -0.180964708328, 0.130076572299, -0.074392512441, 0.000749700295, -0.217908143997, -0.478190988302, -0.276848763227, -0.433960676193, -0.450990200043, 0.369349807501, -0.454426705837, 0.042358856648, -0.228522166610, 0.288514345884, -0.679570555687, -0.061456494033, -0.218701511621, -0.070133358240, -0.543397843838, 0.261562973261, -0.126484140754, 0.052723057568, -0.296588093042, 0.410289943218, -0.599633038044, 0.044100489467, -0.312433093786, -0.030890872702, -0.457123756409, 0.370326191187, 0.002047348768, -0.052674435079, -0.551215767860, 0.410661965609, -0.397831559181, 0.017379576340, -0.302769213915, -0.227172404528, -0.305208504200, 0.376632809639, -0.121014222503, -0.068099908531, -0.663072824478, 0.298795908689, -0.321766734123, 0.100438311696, -0.192095994949, -0.223027393222, -0.229231506586, 0.205198705196, -0.093668833375, 0.011278133839, -0.807072103024, 0.133548438549, 0.044720508158, 0.046796415001, -0.053290497512, -0.228620603681, -0.186928093433, 0.144276887178, -0.022954208776, 0.171530008316, -0.988629341125, 0.001827956992, -0.008346020244, -0.113470077515, -0.038658559322, -0.304155170918, -0.153798878193, 0.269480228424, -0.053912106901, 0.145878329873, -1.249821662903, -0.010268620215, 0.037893489003, 0.032210845500, -0.031071657315, -0.280081629753, -0.189788162708, 0.202696278691, 0.026794727892, 0.173716634512, -0.850315570831, 0.101069703698, 0.161860272288, -0.025221176445, 0.188463628292, -0.227244615555, 0.065690487623, 0.251320689917, -0.137492731214, 0.136409521103, -0.733018815517, -0.024695169181, 0.180411741138, -0.183023899794, 0.143224254251, -0.393424481153, -0.102128408849, 0.189049124718, -0.120541267097, 0.250273734331, -0.589967787266, 0.027149260044, 0.147179812193, -0.150889128447, 0.022883636877, -0.329098135233, 0.057425979525, 0.197528555989, -0.118344992399, 0.224173069000, -0.590658545494, 0.087174437940, 0.114628374577, -0.207755699754, -0.018083637580, -0.259828120470, -0.075699597597, 0.076612763107, -0.139006391168, 0.146048679948, -0.441123574972, 0.053183294833, 0.161093294621, -0.089834146202, -0.164029404521, -0.516901016235, -0.063024252653, 0.114724539220, 0.010714632459, 0.120649568737, -0.364304423332, -0.004947766196, 0.273218721151, -0.008134548552, -0.112371064723, -0.045509707183, 0.082343630493, 0.050297975540, -0.118334963918, 0.082299798727, -0.306468576193, -0.065949372947, -0.070237554610, 0.034086141735, -0.395696610212, 0.023091962561, 0.105646051466, -0.129451543093, -0.033393703401, 0.076126463711, -0.437047183514, -0.192860126495, 0.204267948866, 0.021833788604, -0.463958263397, -0.020019693300, 0.021491652355, -0.175052732229, 0.077909499407, 0.033406145871, -0.589423894882, -0.296571522951, 0.311032682657, 0.072421245277, -0.537666261196, -0.148796260357, -0.027324995026, -0.163268700242, 0.020957987756, -0.027220336720, -0.560726821423, -0.188227713108, 0.070454798639, 0.255090236664, -0.578941941261, -0.077517583966, 0.061458088458, -0.135079577565, 0.013217261061, -0.071079656482, -0.778258323669, -0.189502239227, -0.068985693157, 0.224722132087, -0.427384376526, -0.317059874535, 0.025218131021, -0.133230283856, -0.025397367775, 0.196000427008, -0.535251200199, -0.425627946854, -0.195501729846, 0.251387208700, -0.569055140018, -0.378144532442, -0.015346908011, -0.116129837930, -0.071117006242, 0.083476200700, -0.529514253139, -0.792431473732, -0.291309505701, 0.283721446991, -0.469232380390, -0.112682409585, 0.487061768770, -0.234422251582, -0.379464209080, 0.084876321256, -0.320543378592, -0.327638208866, -0.437582343817, -0.066907607019, -0.210314512253, 0.023498225957, 0.368769913912, -0.260704725981, 0.033656280488, -0.356011480093, -0.190732523799, -0.193219333887, -0.457034498453, -0.235758036375, -0.002304145368, 0.201581522822, 0.166310787201, -0.086925752461, -0.143357664347, -0.144141227007, -0.179553955793, -0.030554370955, -0.178506895900, -0.101161010563, -0.019749060273, -0.015086583793, 0.031984016299, 0.082114912570, 0.035181425512, -0.078749909997, -0.051368575543, -0.009530901909, 0.061473704875, -0.061748787761, 0.045821167529, -0.071920171380, -0.053185977042, 0.044461645186, 0.061733447015, -0.036072768271, 0.072378553450, -0.016764685512, -0.000431589782, 0.040865860879, 0.040385372937, 0.001105166972, 0.023744314909, 0.045982174575, 0.002517111599, -0.030417770147, -0.037405006588, -0.074378132820, -0.009138233960, 0.009049981833, -0.002750915242, -0.018747746944, -0.014574675821, 0.155703231692, -0.045757073909, -0.027452144772, -0.076415687799, -0.204085916281, -0.231812179089, 0.085557237267, -0.148944452405, -0.251939594746, -0.208328545094, -0.137795075774, -0.076651602983, 0.083368688822, -0.126941442490, 0.193486288190, -0.262429893017, -0.460622131824, -0.293934851885, -0.429543584585, -0.547800123692, -0.056570902467, -0.069825001061, 0.137874245644, -0.246146023273, 0.291301220655, -0.518556654453, -0.009697753005, -0.578276216984, -0.656879603863, -0.778808891773, 0.185235798359, -0.208988234401, -0.173565968871, -0.226838067174, 0.236445397139, -0.674085855484, 0.373908549547, -0.587685644627, -0.666303277016, -0.361664742231, 0.271575868130, -0.226153299212, -0.074965640903, -0.230456739664, 0.103157348931, -0.370119631290, 0.179775074124, -0.533481657505, -0.608503758907, -0.495480686426, 0.363387316465, -0.477278560400, -0.124878071249, -0.280417352915, 0.237652793527, -0.425216913223, 0.267437517643, -0.635196030140, -0.446259796619, -0.859684646130, 0.522244155407, -0.456370621920, -0.151376754045, -0.428494960070, 0.262215524912, -0.374804288149, 0.156792774796, -0.684954881668, -0.517319858074, -0.869813263416, 0.544429838657, -0.394468098879, 0.111887373030, -0.484865397215, 0.323850870132, -0.298819303513, 0.149359062314, -0.822732865810, -0.947901606560, -0.687186479568, 0.445621997118, -0.247729659081, 0.061102543026, -0.590459525585, 0.177881196141, -0.130107626319, 0.145119488239, -0.637488842010, -1.089581251144, -0.722549080849, 0.407336384058, -0.333844691515, 0.044965613633, -0.317096322775, 0.310703665018, -0.118988126516, 0.082562431693, -0.827667415142, -0.593971610069, -0.443810045719, 0.472278982401, -0.441005617380, 0.198016881943, -0.296725481749, 0.265653938055, -0.189208090305, 0.169901654124, -0.740915954113, -0.645703554153, -0.293813347816, 0.333900600672, -0.388695806265, 0.189154654741, -0.702832162380, 0.113701544702, -0.164781808853, 0.044947072864, -0.850029826164, -0.564863622189, -0.205448776484, 0.193804785609, -0.277525186539, 0.039781704545, -0.776801705360, 0.155807092786, -0.065533466637, 0.083106294274, -0.827506780624, -0.652874350548, -0.089084200561, 0.085586912930, -0.277708768845, 0.225486949086, -0.712293505669, 0.226065218449, 0.141731128097, 0.083793573081, -0.863364517689, -0.998765707016, -0.167713090777, 0.116258017719, -0.411320358515, 0.196662843227, -0.644374608994, 0.168909937143, 0.102637737989, 0.125349000096, -0.693364799023, -0.913719475269, -0.272775143385, 0.015523590147, -0.454991430044, 0.264619916677, -0.752857565880, 0.186798229814, 0.056796818972, 0.237872570753, -0.752830684185, -0.841969907284, -0.272552430630, 0.019919425249, -0.346906751394, 0.153644666076, -0.608837127686, 0.050895944238, 0.018013872206, 0.252348840237, -0.779650986195, -0.634594857693, -0.394436597824, 0.162615284324, -0.440820604563, 0.063299924135, -0.674355745316, 0.067197613418, -0.009073623456, 0.329598009586, -0.574612200260, -0.526536047459, -0.284733951092, -0.139690056443, -0.422623604536, 0.043862953782, -0.333711445332, -0.194945052266, -0.039702937007, 0.411931157112, -0.518496453762, -0.201591402292, -0.290983408689, -0.218401849270, -0.409380763769, 0.170190006495, -0.304237037897, -0.072435274720, -0.456385403872, 0.349326342344, -0.474145025015, -0.205876842141, -0.461029231548, -0.069645084441, -0.268042474985, 0.235766425729, -0.209192052484, -0.009384837933, -0.669002532959, 0.174850314856, -0.435582041740, -0.170047581196, -0.393769055605, -0.325740367174, 0.021679909900, 0.380694478750, -0.277085036039, -0.289639592171, -0.317897766829, 0.071116536856, -0.293335229158, -0.149933144450, -0.169407263398, -0.210523739457, -0.344437628984, 0.250286579132, -0.209846675396, -0.196472391486, -0.311950892210, -0.087560236454, 0.056615341455, -0.005239645950, 0.077924698591, -0.066359385848, -0.135390371084, -0.092447333038, -0.102519646287, -0.053049929440, -0.092948883772, -0.076880447567, 0.000532352424, -0.073150135577, 0.063344433904, -0.059879899025, -0.210440516472, -0.087219819427, -0.134788691998, -0.075810223818, -0.186428815126, -0.215867087245, 0.041824541986, 0.064612425864, 0.032202839851, -0.083927832544, -0.047506768256, -0.081375546753, -0.011072918773, -0.024801857769, 0.040708549321, 0.079806409776, 0.037907265127, -0.011639885604, 0.072247304022, -0.003645077348, -0.000222116709, -0.071748085320, 0.009826220572, -0.016734369099, 0.035726197064, 0.045411832631, 0.001095801592, -0.085264876485, -0.008406311274, 0.055880151689, 0.025875084102, -0.057003036141, -0.020962849259, 0.037025123835, -0.017881691456, -0.025131102651, -0.033722475171, -0.062986806035, 0.060128606856, -0.012681327760, -0.047270040959, -0.048223871738, -0.006906449795, 0.046970762312, -0.045597162098, 0.036794535816, -0.044724259526, -0.149917557836, -0.058052878827, -0.159107431769, -0.057035811245, 0.011318905279, 0.044164445251, -0.060380131006, -0.172158092260, 0.083941824734, -0.155690297484, -0.218460753560, -0.218529790640, -0.169351324439, -0.003354124259, -0.208926990628, 0.000651590468, -0.282150000334, -0.268110871315, 0.358983010054, -0.178334176540, -0.404287695885, -0.300295710564, 0.025891376659, -0.042396165431, -0.405363231897, 0.010040339082, -0.192637428641, -0.354646593332, 0.352168977261, -0.364394009113, -0.428459018469, -0.319625526667, -0.014980412088, -0.217432454228, -0.650173425674, -0.036156669259, -0.196878150105, -0.625945091248, 0.405679881573, -0.430303007364, -0.413296669722, -0.430987685919, -0.063331052661, -0.596761226654, -0.457699537277, -0.163068547845, 0.067607276142, -0.208269223571, 0.351759374142, -0.618655323982, -0.585604131222, -0.566882848740, -0.053931344301, -0.764828741550, -0.462739944458, -0.216151565313, 0.161851435900, -0.262053877115, 0.400570511818, -0.741170048714, -0.731902718544, -0.409373134375, -0.241210281849, -0.825811743736, -0.258894383907, -0.148818776011, 0.238399207592, -0.423614382744, 0.367840617895, -0.774325370789, -0.521265983582, -0.548839390278, -0.077731229365, -0.714763224125, -0.208528190851, -0.162676215172, 0.157761871815, -0.483963966370, 0.326204538345, -0.714354813099, -0.570674479008, -0.434025824070, -0.163966700435, -0.951405763626, 0.108749762177, -0.322977572680, 0.081828810275, -0.371582210064, 0.252408146858, -0.609513461590, -0.785076200962, -0.637166619301, -0.159341037273, -0.928427398205, 0.047221776098, -0.370553284883, 0.056556332856, -0.469020515680, 0.385869950056, -0.606997370720, -0.758756995201, -0.681023478508, -0.171442329884, -1.035563588142, -0.165428936481, -0.336520552635, 0.236944466829, -0.446941405535, 0.352103799582, -0.573058664799, -0.589697897434, -0.766016006470, -0.180955618620, -1.258314251900, -0.220287010074, -0.413251101971, 0.244751378894, -0.485847860575, 0.526352345943, -0.589863479137, -0.294687479734, -0.615407049656, -0.147035688162, -0.907779514790, 0.036188878119, -0.415078759193, 0.315983235836, -1.152530670166, 0.241596505046, -0.605344116688, -0.476532548666, -0.583729326725, -0.007407695055, -1.051024794579, -0.016293620691, -0.370505064726, 0.293963521719, -1.020165324211, 0.280934065580, -0.563989341259, -0.751718938351, -0.443977326155, -0.084844917059, -1.010654926300, -0.157109215856, -0.299356341362, 0.337097048759, -0.534200608730, 0.282511383295, -0.563216924667, -0.357472240925, -0.722080886364, 0.020623957738, -0.927344143391, -0.227413251996, -0.297023296356, 0.415570855141, -0.538774907589, 0.295800000429, -0.357842117548, -0.454968303442, -0.624520301819, -0.024823363870, -0.818143010139, -0.168314263225, -0.254746019840, 0.354093700647, -0.805097520351, 0.209592714906, -0.291852027178, -0.327378898859, -0.512934565544, 0.028459571302, -0.852409243584, -0.001500784769, -0.144800797105, -0.037177003920, -0.706991493702, 0.381417244673, -0.473926842213, -0.155909821391, -0.535982847214, -0.069082878530, -0.481884062290, -0.055990129709, -0.287976235151, 0.124807663262, -0.508049845695, 0.150928393006, -0.209144815803, -0.221342623234, -0.237291380763, -0.145039826632, -0.548404991627, -0.022232705727, -0.163130387664, 0.186140522361, -0.259923756123, -0.041036676615, -0.277165055275, -0.112152457237, -0.210771128535, -0.282242834568, -0.088133335114, -0.066094204783, -0.174502417445, -0.099898040295, -0.072571292520, 0.118283241987, -0.028845990077, 0.031543977559, 0.054140273482, 0.052165269852, 0.005914272275, -0.161840319633, -0.034456014633, -0.079745829105, -0.125567302108, 0.057746578008, 0.072192400694, 0.065384082496, 0.056864250451, 0.028587857261, -0.067551858723, 0.007062202785, -0.079425849020, 0.190785393119, 0.036248020828, -0.088648796082, -0.043689023703, -0.032081343234, 0.068012334406, -0.035497676581, -0.035487812012, 0.043860547245, 0.073458619416, 0.062326468527, -0.064209446311, -0.027295801789, -0.011376567185, 0.015847399831, 0.010944813490, -0.067880868912, 0.068584434688, 0.063302524388, 0.014914788306, -0.085697539151, 0.069753654301, -0.026688959450, -0.077066563070, 0.005297258496, -0.076144136488, 0.048101402819, 0.030357040465, -0.009886115789, 0.077572874725, 0.071546979249, -0.000035852194, -0.073232591152, -0.065027624369, 0.038736037910, 0.068998865783, -0.054430317134, 0.075141437352, 0.046150095761, 0.080474935472, -0.059469249099, 0.078860692680, 0.014062620699, -0.029889766127, 0.053823612630, 0.014969736338, 0.010365664959, -0.043045040220, 0.079666726291, 0.066271968186, -0.027833152562, 0.052699156106, -0.058618571609, 0.069450728595, -0.053446456790, -0.072230100632, -0.075213909149, -0.046625167131, 0.063070870936, 0.025934092700, -0.057696759701, -0.068257451057, -0.018161542714, -0.110858149827, -0.016050156206, -0.025285854936, -0.011430462822, -0.092550098896, 0.013279896230, 0.029532734305, 0.051949080080, 0.001357531408, -0.128470972180, -0.069498598576, -0.001594838104, 0.027720075101, -0.117540799081, -0.070161074400, -0.000969156390, 0.004822691903, 0.189422294497, -0.120234683156, -0.224453106523, -0.070255488157, 0.037782527506, -0.079744040966, -0.162066668272, -0.184218868613, -0.176923751831, -0.066192373633, 0.132528707385, -0.087642379105, 0.031406804919, -0.073892436922, 0.038761880249, -0.036071542650, -0.150174662471, -0.227156281471, -0.243683874607, -0.102703697979, 0.190880060196, -0.170410171151, 0.087497487664, -0.137570947409, -0.009479341097, -0.012828222476, -0.239744096994, -0.136141628027, -0.319938898087, -0.111067630351, 0.164902448654, -0.119612917304, 0.048616964370, -0.056065034121, -0.005903806537, -0.097527422011, -0.342992931604, -0.232559606433, -0.368423312902, -0.017464896664, 0.124263003469, -0.209129974246, 0.017548942938, -0.229509890079, -0.190039038658, -0.273394137621, -0.527727603912, -0.420769065619, 0.102550595999, -0.160651087761, 0.328514248133, -0.343846261501, -0.107921101153, -0.187544941902, -0.156988233328, -0.253394454718, -0.614517271519, -0.348132073879, 0.044758472592, 0.008456272073, 0.160541325808, -0.389126390219, 0.012326241471, -0.154172033072, -0.164097651839, -0.148325830698, -0.448354333639, -0.461731821299, 0.106356553733, -0.022273011506, 0.177148789167, -0.340349406004, -0.038669548929, -0.230900928378, -0.119497500360, -0.210145562887, -0.500953614712, -0.590358018875, -0.065350085497, -0.056393489242, 0.529205143452, -0.345798939466, -0.551784992218, -0.245944082737, -0.297583311796, -0.118713490665, -0.506235897541, -0.584590971470, -0.394227623940, -0.075645551085, 0.401818782091, -0.457972854376, -0.046644546092, -0.201863169670, -0.085229590535, -0.056879315525, -0.604348480701, -0.295453339815, -0.466210842133, -0.002296792809, 0.276984900236, -0.269572824240, -0.064952582121, -0.092373959720, -0.062715545297, -0.181275591254, -0.576023817062, -0.469818472862, -0.624112069607, 0.011335196905, 0.380073428154, -0.382371395826, -0.182198792696, -0.119595870376, -0.068888977170, -0.090158648789, -0.505747795105, -0.451122820377, -0.574382722378, -0.095660507679, 0.669992446899, -0.357631027699, -0.436139643192, -0.104425586760, -0.219787493348, -0.177901327610, -0.371053427458, -0.344158530235, -0.239610731602, -0.159146964550, 0.284511178732, -0.219915673137, -0.192236065865, -0.043351393193, -0.272470951080, -0.253308951855, -0.369777262211, -0.382923126221, -0.270023882389, -0.091998070478, 0.396063297987, -0.340426892042, -0.158786267042, -0.215970739722, -0.093322567642, -0.202705755830, -0.342590153217, -0.359064310789, -0.341323196888, -0.180640295148, 0.074001923203, -0.207173138857, 0.006150553003, -0.291401356459, -0.074621096253, -0.347784996033, -0.291711419821, -0.144662111998, -0.365901798010, -0.078320957720, 0.201494261622, -0.256852954626, -0.013329480775, -0.162816569209, -0.052636269480, -0.223934918642, -0.139999151230, -0.248725578189, -0.136024266481, -0.078969217837, 0.217200547457, -0.270891726017, -0.161309793591, -0.100580923259, -0.081448666751, -0.181113511324, -0.040137041360, -0.177554652095, -0.149063408375, -0.074740827084, 0.190925806761, -0.151872903109, -0.201773837209, 0.001566894352, -0.011638268828, 0.080628283322, -0.006211437285, 0.041948743165, 0.051242671907, 0.001241914928, -0.020479798317, -0.037592217326, -0.021697692573, 0.018939852715, -0.059753105044, -0.044871479273, -0.008095286787, -0.005812600255, -0.033761229366, -0.026724770665, 0.032620087266, 0.064912416041, -0.043291632086, -0.025469426066, -0.065664872527, 0.003631360829, 0.008400633931, 0.032933622599, 0.083199821413, 0.039010740817, 0.026916235685, -0.020430058241, -0.060949653387, 0.013279482722, -0.015894152224, 0.002216100693, -0.056085124612, 0.074654795229, 0.032411150634, 0.030071757734, -0.052794657648, -0.068611860275, 0.081067524850};
+const TPrecision ip1_biases[] = {-0.357464134693, 0.479175776243, 0.074342429638, -0.285570561886, 0.098733559251, 0.903623878956, -0.104794636369, 0.476542890072, -1.049197673798, -0.185828864574};
+const TQuant ip1_weights_int8[] = {2, 5, -2, -2, -6, -7, -6, -6, -7, -3, 5, 6, 1, -13, -2, -6, -1, 1, -3, -3, -7, 1, 0, 1, -3, -4, 0, 3, -1, -3, -3, 1, -2, -2, 0, -9, -4, -3, -14, 8, 9, 6, -25, 7, -2, 5, -15, -18, -20, -21, -7, 1, 7, -1, -5, 7, 3, 3, 0, 3, 4, -13, -22, -17, -28, -32, -60, -18, -16, -37, -59, -66, -42, -68, -58, -53, -49, -33, -23, -19, -4, 0, 4, -3, 7, -5, -2, 6, -9, -10, -27, -17, -6, -15, -13, -10, -4, -4, 0, -7, 0, -7, -19, -28, -23, -33, -38, -16, -17, -2, -18, 1, -5, -2, 0, -6, -17, -16, -17, -7, 4, 5, -9, 3, -13, 2, -4, 5, -4, 3, -1, -6, -12, -16, 1, -13, -30, -30, -14, -3, -2, 7, -18, -13, -35, -30, -12, -7, -3, 1, -2, -4, 2, 3, 15, 2, 10, 7, 16, 2, -2, -3, -1, -15, -36, -47, -38, -9, 1, -8, -14, -24, -35, -6, -1, 0, -5, -18, 2, -5, -5, 16, 12, 6, 11, 14, 18, 9, 7, 19, 11, -7, -42, -73, -46, -17, 1, -22, -16, -12, -46, -5, 2, -11, -15, -6, 3, 8, 1, 2, 4, -1, 9, 19, 14, 16, -1, 8, 10, 13, -15, -70, -57, -9, 8, -24, -4, -2, -39, -7, -2, -11, -4, 3, 0, -1, 9, 6, 11, 17, 26, 19, 12, 14, 9, 2, 9, 17, -2, -79, -67, -24, -2, -15, 14, -4, -18, -4, -14, -12, -8, -2, 3, -7, -2, 5, 7, 1, 13, 23, 27, 16, 15, -2, 9, 25, 6, -67, -72, -25, -11, -13, 2, -6, -16, -3, -6, -8, -2, 1, -10, 3, -2, 2, 1, -15, -9, 9, 15, 6, 12, 5, 12, 19, 11, -51, -57, -4, -7, 5, -11, -11, -19, -18, -4, -2, -6, -11, -6, 2, -8, -9, -36, -43, -34, -8, -5, 10, 9, 19, 21, 20, 16, -27, -45, -9, -5, 4, 1, -13, -14, -6, 3, 2, -3, -9, -3, -1, -3, -12, -45, -62, -58, -13, -10, -5, 2, 12, 22, 20, 34, -9, -34, -23, -3, 2, -6, -14, -2, -6, 17, 11, 3, 4, 11, 1, 4, -31, -57, -61, -49, -16, -6, -4, -19, 0, 11, 22, 32, 3, -25, -18, -5, -1, -4, -23, -5, 17, 8, 20, 14, 12, 3, 10, 5, -30, -58, -64, -48, -19, -5, -13, 1, 5, 6, 20, 23, 6, -40, -19, -6, 2, -22, -38, 6, 20, 8, 21, 18, 15, 21, 10, -14, -48, -66, -60, -34, -20, 2, -5, 8, -1, 9, 21, 25, -7, -31, -16, -11, -10, -17, -21, -3, 12, 10, 12, 20, 15, 17, 12, -26, -59, -57, -40, -17, -8, 1, -1, 10, 9, 4, 11, -5, -25, -39, -6, 5, -11, -31, -30, 7, 10, 9, 15, 12, 21, 26, 8, -20, -56, -52, -32, -10, -2, -1, -4, 4, 0, 9, 8, 0, -14, -31, 2, -9, -15, -25, -33, -11, -3, 7, 6, 10, 17, 21, 3, -20, -45, -36, -17, -7, -3, 3, -1, -10, 1, 8, 0, -12, -21, -14, -19, 0, 2, -10, -33, -14, -1, 8, 5, 9, 9, 23, 23, 3, -19, -15, -7, -12, 3, -9, -12, 1, -1, 5, -4, -10, -34, -23, -7, -1, 9, -5, -17, -8, 3, -4, -2, 8, 4, 26, 21, 16, 7, 3, -4, -8, -3, -12, -9, -9, -4, -1, -11, -10, -33, -20, -1, -1, -12, -16, -14, -8, -1, 4, 2, -1, 4, 8, 24, 22, 2, 3, -4, -3, -12, -14, -14, -14, 4, -8, -15, -17, -28, 14, 2, 1, 1, -15, -21, -37, -8, -1, 0, 2, 10, 8, 13, 8, 16, 14, 10, 5, -4, -17, -3, -8, -13, -1, -6, -13, -25, 6, 11, -1, 5, -3, -29, -40, -18, -9, 5, 2, 12, 16, 19, 22, 24, 8, 6, 5, -1, -12, -30, -30, -21, -17, -24, -27, -17, -13, -1, -2, 6, -9, -7, -23, -18, -25, -25, -16, -4, -3, -3, 15, 12, 2, -1, -13, -9, -32, -38, -44, -47, -35, -46, -38, -17, 0, -2, 4, 3, 0, -12, -24, -47, -48, -44, -52, -56, -67, -52, -68, -60, -69, -68, -70, -57, -61, -64, -47, -42, -39, -36, -24, 5, 0, 3, 3, 0, -3, -4, -13, -15, -30, -35, -50, -60, -63, -58, -50, -50, -47, -48, -49, -46, -46, -29, -24, -39, -17, -23, -2, 6, -4, -1, -6, -5, -2, 6, -9, -6, -6, -6, -11, -5, -19, -15, -13, -19, -20, -16, -8, -10, -9, -4, -18, -24, -13, -8, 0, 2, -2, 1, 0, -6, 3, -4, 4, -1, -4, -7, 0, -3, 6, 5, 2, -1, -1, -5, 2, 7, -6, 4, -5, 1, -6, -7, -4, -3, 1, 6, 4, -5, -7, -4, 0, 6, -7, -5, -7, -11, -16, -5, -8, -4, 15, 14, -25, -27, -3, -8, -8, -4, 0, -7, -6, -6, -5, 3, 3, -5, 6, -7, -4, -4, -11, -20, -26, -27, -38, -29, -3, 12, 17, 23, 22, -2, -8, -6, -9, -25, -17, -8, -5, 1, -2, 6, 3, 2, 11, 11, -17, -25, -26, -30, -42, -24, -34, -45, -19, -12, -12, 1, 3, -15, -27, -25, -29, -31, -42, -38, -33, -22, -11, 1, 4, 4, 4, 6, 11, 0, -6, -15, -6, -6, -10, -23, -7, 5, 8, -4, -1, -6, -8, 8, 7, 2, -4, -6, -32, -43, -19, -6, 1, 4, 9, 11, 18, 13, 3, -7, -21, -30, -20, -26, -17, -1, -3, 0, -10, -22, -8, -6, 4, 15, 14, 5, -6, -56, -29, -5, 0, -5, -18, -2, 5, -7, -7, -26, -28, -30, -15, -11, -14, -14, -19, -18, -27, -20, -6, -3, 1, 6, 2, -2, -15, -75, -32, -9, 5, -13, -10, -18, 1, -27, -33, -21, -33, -24, -17, -12, -5, -17, -16, -27, -23, -12, -17, -4, -5, -4, -7, -9, -49, -64, -35, -12, -8, -10, -7, -21, -1, -23, -31, -23, -29, -35, -22, -18, -5, 2, 1, 5, -3, -7, -6, -3, -18, -14, -17, -35, -63, -64, -38, -14, -10, -5, -17, -19, -9, -37, -24, -15, -14, -24, -16, -8, -8, 5, 18, 25, 17, -1, -5, -15, -21, -26, -32, -53, -48, -72, -23, -14, -10, 0, -16, -20, -21, -45, -40, -18, -17, -19, -11, 1, -6, 15, 41, 51, 23, -2, -18, -17, -23, -26, -41, -54, -84, -36, -18, 11, 3, 10, 5, -14, -16, -22, -41, -29, -19, -20, -12, -12, -9, 19, 44, 42, 17, -2, -4, -12, -14, -14, -27, -27, -58, -14, -15, 4, 0, -10, -18, -8, -5, -20, -9, -3, -10, -18, -25, -37, -13, 25, 48, 45, 6, -5, -6, -18, -19, -11, -9, -12, -50, -23, -19, 1, 4, -14, -18, 14, 3, -20, -5, -15, -3, -18, -44, -40, -17, 28, 39, 28, 13, 0, -16, -26, -22, -13, -24, -45, -54, -32, -18, -11, -9, -3, 10, 15, 16, -14, -27, -21, -3, -20, -45, -45, -7, 28, 44, 35, 2, -15, -32, -38, -31, -18, -15, -23, -14, -13, -4, -9, 5, -2, 14, 14, 5, -38, -44, -11, 0, -22, -41, -16, 4, 35, 38, 15, -1, -30, -44, -56, -49, -22, -41, -47, -36, -25, -24, -18, -7, 0, 16, -14, -9, -35, -39, -26, -20, -13, -9, -17, -6, 26, 37, 7, -18, -48, -45, -44, -32, -17, -33, -36, -20, -38, -16, -25, 2, 4, 6, -18, -13, -49, -52, -44, -11, -15, -9, -17, 5, 22, 31, -6, -29, -48, -38, -16, -12, -17, -1, -20, -12, -29, -8, -16, -2, 17, -12, -21, -55, -67, -62, -32, -6, -6, -11, -18, 3, 21, 14, -6, -32, -19, -5, -12, 9, -6, -15, -10, -11, -5, 4, 15, 15, 7, -7, -19, -55, -64, -36, -13, -5, 0, -5, 0, -5, 4, 3, -9, -7, 0, 7, 10, 9, 2, -6, -3, 9, 12, 4, 22, -6, -11, -10, -17, -28, -40, -7, -7, -3, 10, 4, 1, 6, -7, 1, -2, 14, 14, 25, 15, 10, 0, -10, -14, 6, 4, -3, 9, 4, 1, -16, 0, 11, 21, 17, 6, 7, 1, 8, -1, -17, -17, -4, 1, 7, 10, 14, 13, 17, 7, -24, -22, 9, 12, -10, 3, 15, 8, -10, 2, 13, 41, 18, 9, 6, 0, -4, -24, -30, -25, -12, 5, 8, 12, 21, 14, 14, -1, -26, -19, 4, -1, 18, 5, -4, 6, -1, -16, -7, 21, 24, 2, -6, -1, -12, -17, -8, -16, -6, -4, 13, 26, 3, 5, -3, -15, -26, -33, -23, -5, 12, 7, 0, -7, 1, -23, -35, -6, -3, -19, -18, -19, -25, -23, -19, -32, -27, -21, -42, -4, 2, -2, -12, -6, -26, -31, -9, 2, 16, -1, -6, 0, -2, -21, -35, -54, -54, -50, -36, -42, -77, -89, -48, -53, -46, -53, -82, -75, -69, -52, -43, -16, -17, -14, -12, 0, -6, 5, -1, -7, -5, -12, -18, -33, -35, -34, -48, -60, -43, -47, -64, -62, -48, -24, -39, -61, -29, -37, -27, -13, -18, -9, 3, 5, -3, 1, 0, 3, 4, -4, -1, 0, 3, 3, -1, 0, -16, -13, -13, -10, -24, -7, -5, -6, -18, -22, -8, -6, -4, -7, -1, -5, -5, -1, 3, -6, -3, 5, 6, -6, 0, -1, 6, -1, 0, 5, -14, -1, 7, 9, -3, 5, 2, 4, -5, 1, 3, 1, 6, 5, 6, -5, 4, 2, 3, -6, -9, -12, -19, -13, -11, -9, -25, -19, -34, -30, -5, 0, 29, 6, -26, -27, -21, -27, -15, -9, 2, -3, 5, 4, -2, 3, 5, -18, -14, -13, -10, -11, 1, 10, -2, 2, 6, 6, -2, 6, 8, 7, -9, -17, -16, -16, -28, -2, 11, 10, -1, -3, 1, -5, -7, -18, -21, -4, -3, 3, 11, 25, 21, 27, 27, 26, 14, 10, 13, 1, -13, -17, -26, -17, -29, -47, -11, 1, -5, 2, 7, -13, -13, -21, -17, 1, 13, 11, 6, 24, 12, 17, 20, 8, 19, 6, 5, 8, 2, -8, -13, -21, -35, -52, -39, 0, -9, -16, -2, -3, -4, -11, 3, 2, 4, 7, 11, 8, 7, 11, 14, 14, 17, 9, 22, 11, 7, -2, -1, -7, -5, -26, -42, -22, -11, -10, -5, -11, -10, -10, 8, 13, 3, 10, 2, 12, 3, 3, 0, 7, 2, 6, 10, -2, 3, -3, -8, -2, -11, -48, -51, -41, -31, -14, 6, -15, 6, 8, 26, 6, 11, -1, 8, 0, 1, 9, 4, 4, -1, 2, -1, -16, -6, -2, -6, -3, 6, -40, -53, -28, -36, -24, -5, 7, -5, 1, 19, 11, 3, 5, 6, -1, 13, 10, -4, 0, 1, 6, -2, -3, -7, 6, -2, 1, -6, -8, -75, -82, -39, -20, 4, -28, -12, 8, 11, 17, -1, -4, -6, 9, 7, 1, 2, 6, 9, 13, 9, -1, 6, -3, 0, -9, -4, -13, -72, -70, -21, -25, 0, -18, -9, 10, -6, 10, 4, -14, -7, -9, -13, -6, -17, -20, -18, -13, 2, 4, 2, 1, 0, -9, -10, -20, -49, -32, -16, -24, 5, -16, -20, -12, -9, -2, -10, -31, -34, -36, -45, -51, -46, -58, -48, -30, -20, -15, -5, 1, -1, 0, -5, -21, -18, 10, -6, -19, 3, -14, -15, -27, -21, -34, -64, -62, -52, -50, -41, -44, -48, -39, -38, -27, -29, -25, -12, -3, -7, -9, -12, -25, 9, 27, 32, 22, -7, -10, -4, -22, -53, -63, -70, -61, -31, -22, -16, -6, -5, -8, -13, -20, -26, -14, -16, -6, -9, -8, -15, -19, 23, 46, 58, 19, -11, -17, -17, -14, -32, -50, -28, -18, -10, -11, -9, 5, -5, 13, -5, -9, -9, -16, -11, -12, -5, -13, -14, -1, 17, 43, 56, 24, -7, -4, -17, 7, 7, 7, 8, 2, 1, 2, -4, 4, 1, 16, 5, -3, -8, -6, -8, 0, -16, -11, -14, -12, 23, 45, 49, 30, 5, -11, -3, 21, 17, 23, 17, -5, -7, 8, 5, 12, 21, 14, 3, 2, 8, 3, 1, -3, -9, 10, 7, 3, 31, 60, 54, 22, 2, -19, 1, 22, 20, 17, 17, 11, -4, 13, 13, 19, 25, 18, 2, 1, -2, -3, 3, 1, -7, 8, 8, 9, 25, 59, 43, 27, -8, -15, -13, 2, 24, 22, 16, 17, 9, 10, 15, 9, 19, 16, 6, 4, 6, 15, 8, 2, 4, 3, 10, 27, 42, 63, 25, 24, -6, -19, -14, -6, 6, 9, 7, 20, 9, 15, 12, 20, 14, 13, 7, 9, 8, 14, 1, -3, 4, 15, 21, 14, 18, 46, 33, 16, -2, -6, 2, -8, 16, 8, 7, 24, 17, 10, 11, 20, 6, 7, 5, -1, 6, -5, 11, 18, 8, 15, 15, 11, 20, 37, 11, -7, -6, -3, 5, 9, 4, -1, 9, 5, 6, 22, 8, 11, 5, 1, -5, -5, 5, 13, 17, 26, 10, 3, 16, 30, 20, 22, 12, -1, -14, -11, 1, 16, 14, 1, 13, 19, 14, 15, 13, 12, -3, 0, -5, -4, -4, 1, 15, 14, 17, 11, 22, 9, 17, 12, -9, 1, -3, -1, -5, -14, -9, -3, 2, 0, 9, 3, 1, 7, -5, -2, -4, -12, -2, 0, 15, 17, 18, 19, 17, 19, 15, 5, -16, -2, 3, -3, -13, -33, -37, -44, -37, -25, -19, -15, -13, -15, 5, -8, 5, -6, -5, 7, 9, 2, -2, 5, 2, -1, 40, 30, 14, 3, -4, 2, -1, -17, -45, -64, -30, -40, -70, -71, -56, -59, -36, -24, -17, -7, -14, -22, -22, -32, -23, -24, -38, -32, -14, 6, 5, 3, 6, -1, 5, -5, -18, -25, -26, -35, -46, -33, -45, -35, -52, -56, -63, -50, -48, -36, -59, -51, -42, -44, -19, -17, 4, 5, 6, 1, -6, 6, 1, -6, -2, 2, -7, -3, -1, -8, -22, -21, -12, -17, -10, -5, -15, -7, -15, -21, -17, -28, -18, -15, 7, -4, 0, 0, 6, 4, 4, -6, 3, -3, 4, 7, 4, -3, -3, -3, -14, -7, -12, 0, 3, -1, 0, 2, 1, 3, 5, -4, 2, -7, -6, -3, 4, 3, -1, 2, 6, 4, 1, 0, -18, -13, -16, -20, -21, -18, -15, -16, -35, -22, -13, -1, -10, -25, -10, -7, -2, 5, 2, 2, -2, 1, 6, 4, -7, -11, -14, -26, -30, -37, -20, 0, 1, -17, -19, -19, -22, -16, -15, -22, -29, -28, -30, -10, -2, 5, 5, 7, 0, 6, -7, -20, -9, 9, 13, 14, 12, 3, 8, 27, 26, 20, 20, 21, 12, 14, 16, 10, 14, -19, -41, -33, -21, -6, 3, -2, 2, 4, 3, 23, 27, 29, 27, 22, 19, 19, 19, 18, 25, 17, 14, 14, 18, 2, 11, 2, -10, -18, -18, -62, -51, -26, -13, -8, 6, 5, 2, 14, 20, 28, 25, 19, 14, 9, 11, 11, 3, 13, 4, 10, 15, -3, 7, -5, -10, -15, -19, -30, -45, -59, -14, -6, -3, 3, -4, 23, 19, 16, 17, 10, 5, 13, 22, 4, 7, 11, 14, 12, 7, 7, 7, 1, -6, -6, -13, -30, -26, -71, -31, -4, -2, 25, -16, 8, 20, 22, 10, 8, 8, 6, 1, 8, 12, 5, 10, 13, 8, 4, 5, 4, -2, -8, -19, -22, -55, -79, -35, -9, -5, -10, -9, 7, 18, 12, 10, 4, 0, -1, -3, 3, 5, 4, 6, 15, 11, 7, 8, 11, 7, 1, 4, -31, -79, -94, -34, -10, -2, -14, -5, 16, 31, 2, 6, 5, -5, -3, -17, -29, -22, -3, 14, 25, 15, 9, 7, 9, 20, 15, 15, -16, -127, -48, -29, -23, -8, -18, 5, 25, 9, 4, -3, -12, -18, -36, -31, -40, -29, 0, 6, 12, 15, 8, 18, 9, 19, 10, 10, -6, -88, -30, -45, -4, -8, -12, -2, 33, 8, -18, -24, -34, -43, -34, -29, -21, -15, 7, 12, 10, 6, 6, 5, 11, 7, -10, -13, -25, -67, -11, -24, -6, -9, -23, -32, 8, -11, -24, -29, -32, -26, -8, -6, -6, 5, 4, 16, 7, 1, 10, 10, -6, -12, -32, -43, -43, -48, 8, -17, -12, -13, -18, -33, 1, -25, -33, -23, -31, -21, -10, -14, -6, 0, 14, 11, -2, -1, -1, 0, -8, -25, -39, -52, -26, -27, -11, -21, -21, -3, 3, -8, 1, -14, -26, -34, -30, -12, -14, -11, -15, 6, 6, 5, -1, -1, 1, 4, -9, -16, -13, -18, -20, -12, -27, -22, -14, -15, 6, 25, -1, 0, -11, -17, -27, -22, -18, -16, -3, 6, 9, 7, -5, -7, -11, -4, 9, 9, 8, 12, 19, 5, -66, -4, -10, -12, 19, 21, 7, 9, 9, -18, -20, -30, -24, -17, -5, -3, 8, -6, -13, -16, -5, 12, 14, 13, 7, 16, 18, 28, -53, -40, -27, -4, 13, 14, 33, 28, 2, -5, -10, -26, -36, -40, -35, -21, -25, -32, -19, -5, 12, 6, 20, 3, 12, 22, 19, -13, -52, -39, -21, -21, 14, 19, 41, 18, 15, 8, -14, -12, -24, -39, -41, -38, -27, -22, 3, 15, 15, 14, 10, 7, 20, 18, 6, -28, -68, -37, -19, -4, -8, -6, 39, 22, 19, 13, 1, -3, -11, -11, -22, -28, -20, -10, 4, 12, 18, 14, 15, 8, 11, 9, -4, -13, -74, -36, -18, -4, 0, -11, 32, 14, 13, 14, 7, 7, 8, -10, -12, -21, -9, 0, 8, 5, 11, 21, 7, 18, 1, 0, -2, -22, -73, -12, -4, -13, 9, 6, 26, 11, 8, 9, 13, 7, 1, -4, -10, -10, -3, -4, 4, 8, 5, 12, 11, 5, -12, -8, -19, -42, -51, -9, -6, -4, -1, 15, 28, 18, -1, 5, 2, 3, -3, -1, 7, -3, -7, -6, 2, 12, 4, 10, 11, 2, -7, -9, -18, -42, -20, 5, -6, 4, -3, 22, 41, 27, 17, 18, 16, -1, 11, 12, 14, -7, 5, 5, -5, -6, 6, 15, 0, -6, -12, -25, -28, -21, -12, 3, 4, 4, 6, 6, 30, 30, 21, 30, 31, 17, 12, 22, 17, 21, 15, 16, 6, 9, 4, -11, -14, -13, -11, -11, -9, -19, -21, -7, 7, 4, 4, 13, -11, -5, 15, 22, 30, 43, 44, 36, 33, 39, 27, 16, 7, 9, 1, 2, 13, -11, -18, -6, -27, -17, -5, -5, -7, 0, 5, -1, -13, -14, 2, -1, -5, -4, -20, -6, -13, -13, -14, -15, -12, -1, -7, 2, -2, 2, -6, -12, -23, 4, 2, -3, -6, 4, -4, 1, -6, -1, -10, -13, -12, -20, -28, -43, -50, -37, -41, -41, -49, -47, -41, -30, -30, -28, -24, -11, -3, -1, -1, 1, -5, 5, 6, 7, 3, 3, 1, 1, 6, 4, -4, 1, 7, -11, -13, -9, -1, 4, 3, 2, 4, -2, -6, 4, -7, -5, 7, 0, 2, -2, -4, -5, -3, -5, -7, -20, -20, -21, -34, -24, -36, -50, -38, -18, -29, -37, -37, -35, -17, -21, -17, -12, -11, -2, 3, -2, -5, -1, 7, -9, -12, -21, -8, -25, -33, -38, -52, -58, -80, -72, -44, -39, -44, -40, -40, -66, -51, -42, -24, -18, -30, -26, -2, 3, 6, -2, -4, -4, -16, -26, -31, -33, -26, -38, -56, -54, -58, -75, -83, -58, -53, -46, -34, -32, -16, -8, 1, -3, -1, -17, -15, -12, -4, -6, -2, 2, -16, 9, 7, -20, -15, -23, -24, -46, -34, -32, -20, -23, -32, -19, -9, -17, 12, 15, 16, 28, 20, 23, -9, -11, -15, -2, -4, -22, -7, 17, 6, 3, -5, -9, -7, -11, -11, -13, -19, -6, -6, 2, -2, 4, 4, 3, 0, 18, 29, 11, -11, -19, -18, -2, -8, -27, -19, 9, 8, -4, 2, 1, -1, -15, -22, -24, -34, -35, -33, -35, -20, -24, -8, -8, -6, 8, 25, 6, -17, -4, -29, 2, -10, -24, -10, 9, 10, 4, 2, -5, -3, -14, -21, -28, -32, -39, -36, -31, -27, -17, -12, -13, -6, 7, 14, 4, -7, 4, -33, -4, -15, -8, -14, 3, 6, -1, 2, -13, -3, -11, -12, -17, -24, -36, -39, -25, -16, -10, -9, -3, -6, -2, -3, -12, -11, -18, -17, -12, -18, -6, -39, -28, -7, -15, -11, -8, -7, -8, -11, -6, -18, -42, -35, -5, -12, -4, -5, -1, 1, -9, -10, -40, -35, -37, -21, -11, -18, -29, -39, -17, -23, -17, -10, -5, 6, 2, 5, 10, -20, -55, -22, -4, 7, 0, -5, -10, -8, -9, -40, -44, -50, -36, -23, -12, -29, -36, -20, -16, -9, -4, 6, 12, 19, 18, 19, 23, -35, -58, 4, 19, 5, -1, -9, -15, -9, -17, -39, -60, -46, -30, -15, 5, -25, -36, -20, -30, -8, 4, 16, 14, 22, 29, 36, 43, -15, -29, 5, 25, 11, 0, 2, 8, 9, 5, -27, -18, -18, -25, -22, -2, -14, -24, -24, -6, 13, 25, 22, 26, 27, 29, 47, 23, -12, -7, 17, 20, 16, 19, 10, 14, 15, 18, -11, -22, -9, -22, -11, -16, -8, -30, -10, 23, 19, 19, 21, 20, 17, 25, 29, 14, -11, -3, 5, 27, 36, 15, 17, 19, 5, 0, -17, -18, -20, -39, -19, -5, 7, 14, 6, 16, 14, 18, 18, 30, 20, 10, 20, 8, -8, 2, 24, 35, 24, 17, 16, 1, 2, 0, -10, -46, -36, -6, -13, -14, 1, -20, -17, -22, -5, 2, 21, 21, 11, 4, 2, -4, -1, 17, 31, 35, 16, 14, 7, 8, 3, 2, -20, -34, -37, -27, -23, 5, -2, -4, -40, -24, -18, -3, 8, 18, 8, -8, -3, -1, 18, 32, 29, 21, 13, 6, -2, -2, 2, -12, -19, -26, -52, -20, -18, -22, 4, -4, -30, -22, -11, -12, -6, 4, -5, -13, -8, 2, 16, 13, 19, 9, -4, -5, -13, -3, -2, -30, -19, -30, -45, -14, -6, -7, -16, -10, -9, -20, -8, -11, -23, -25, -35, -33, -27, -18, -13, 8, 8, 2, -10, -13, -12, -17, -15, -44, -40, -33, -45, -7, -3, 1, -9, -5, -6, -16, -33, -25, -37, -38, -33, -36, -25, -19, -18, -6, 1, 2, -5, -8, -15, -18, -7, -22, -39, -36, -32, -18, -11, 3, 0, -7, -25, -29, -18, -49, -44, -22, -19, -15, -10, -22, -21, -9, -9, -8, -2, -2, -10, -4, -7, -13, -11, -13, -26, -13, -6, 1, 4, 0, -32, -38, -47, -33, -24, -17, -21, -11, -16, -13, -17, -13, -5, -5, -2, -1, 6, 9, 9, 2, -9, -7, -23, 7, 0, 3, -7, 2, -16, -37, -41, -12, -13, -2, -3, -5, -7, -15, -12, -8, -3, 2, 4, 15, 7, 11, 10, -15, -17, -15, -12, 14, -6, -6, -1, -2, -15, -37, -10, 0, -10, -8, -2, -4, 2, -11, -10, -10, -11, 1, -10, -3, 6, 2, 1, -2, -6, -31, 3, -12, 3, 5, 0, -4, -6, -6, -17, -18, -39, -37, -32, -20, -27, -36, -32, -23, -23, -34, -37, -28, -36, -34, -33, -22, 2, -28, -11, -17, -4, 0, 2, -4, -5, 0, -3, -18, -49, -62, -67, -58, -78, -76, -85, -103, -74, -86, -82, -76, -67, -70, -39, -45, -7, 0, -6, -3, 6, 2, 6, -4, -4, -8, -6, -15, -19, -11, -19, -34, -28, -38, -48, -48, -24, -38, -37, -28, -31, -29, -12, -20, -14, 3, 0, 3, 6, 6, 1, 0, -7, -3, 1, -2, 1, -3, -2, -4, 1, -7, -15, 5, -4, 7, 0, -2, 0, 2, 1, 6, 1, -2, 2, 7, 5, -2, 0, -5, 3, 1, -4, -3, 4, -9, -18, -14, -18, -15, -22, -23, -20, -30, -32, -23, -24, -26, -24, -7, -1, 6, 1, 5, -5, -2, -5, -7, -10, -11, -13, -16, -17, -27, -34, -29, -25, -46, -68, -75, -27, -6, 5, -6, -4, -17, -17, -18, -21, -27, -12, -5, 2, 6, 6, -11, 1, 8, -18, -32, -32, -26, -22, -14, -21, -9, -6, -8, 0, -4, -1, 18, 14, 13, 20, 10, -8, -11, 11, 6, -1, 0, -6, -13, -10, -43, -41, -18, -18, -33, -15, -13, -7, -3, -17, -10, 8, 7, 12, 14, 2, -7, 12, 6, 15, 29, 20, 3, -20, 2, 0, -21, -24, -50, -33, -21, -12, -9, -8, 4, 1, -1, -8, -3, -8, 1, 9, 9, 6, 12, 9, 13, 17, 18, 38, 32, 3, 4, -5, 0, -37, -36, -16, -9, -10, -5, 3, 1, 0, 0, 0, 6, -2, -7, 0, 11, 11, 14, 4, 8, 13, 40, 37, 23, 15, 0, -23, -8, -52, -61, -23, -5, -1, 14, 2, 10, 14, 7, -10, 3, -11, 5, 8, 2, 5, 2, 10, 16, 23, 42, 47, 19, 9, -3, -15, -24, -64, -65, -29, -10, -10, 8, 1, 6, 8, 6, -9, -9, -19, -6, -10, -6, 10, 16, 19, 7, 32, 58, 55, 28, 3, -11, -12, -26, -55, -48, -23, -14, -2, 7, 9, 11, 18, 13, -3, -13, -24, -29, -17, -11, -12, -4, 17, 15, 43, 72, 73, 33, 21, -12, -25, -25, -44, -19, -9, -8, 5, 20, 20, 18, 19, 24, 17, -3, -14, -20, -34, -27, -19, -17, -2, -1, 29, 80, 97, 63, 13, -7, -13, -20, -48, -5, -6, 8, 13, 11, 9, 13, 12, 22, 26, 1, -16, -14, -22, -21, -34, -46, -48, -45, -8, 37, 80, 51, 0, -3, -15, -22, -27, -2, 1, 15, 4, -1, 4, 8, 22, 22, 20, -5, -12, -27, -22, -23, -21, -36, -57, -84, -85, -73, -4, 31, -19, -2, -15, -21, -5, 6, 10, 4, 4, -4, -2, 17, 21, 23, 16, -5, -28, -36, -28, -11, -9, -8, -20, -39, -53, -72, -29, 5, -15, 15, -13, -18, -2, 9, -9, -8, -6, -2, 10, 19, 5, 11, -2, -11, -18, -20, -23, -11, -14, -7, -8, -10, -20, -20, -35, -41, -13, 2, -5, -33, -14, -9, -22, -20, -18, -2, 3, 8, 6, 9, -5, -25, -24, -18, -22, 6, -10, -7, -8, -3, 6, 4, -37, -40, -18, -8, -17, -32, -8, -18, -16, -14, -33, -35, -20, -9, -11, -11, -16, -24, -17, -22, -4, -2, 6, 6, -3, 4, 2, 2, -34, -42, -15, -7, -13, -36, 3, 2, 8, 19, -20, -30, -25, -33, -28, -33, -32, -28, -7, -3, 6, 4, -2, 7, -4, 5, 5, 6, -45, -53, -27, -12, -18, -26, 4, 20, 19, 34, 10, -4, -19, -17, -17, -17, -16, 3, -5, 4, 9, 6, 1, 1, 9, 2, 4, 16, -36, -24, -27, -4, -14, 7, 2, 11, 14, 19, 14, 13, 3, 0, 1, -1, -1, -2, 6, -1, -2, 3, 2, 6, 7, 1, 11, 17, -12, -26, -9, -5, -25, 2, 9, 4, 11, 7, -2, 16, 14, 1, 14, 1, 4, -4, -1, 5, 11, 5, 7, -1, 0, 22, 7, -2, -4, -19, 11, 1, -20, -21, 3, 8, 4, 6, 8, 10, 3, 6, 8, 4, 7, 7, 7, 7, 1, 5, -1, 12, 18, 12, 14, 10, 5, -1, -4, -8, -11, -42, -5, 21, -4, -15, -5, -1, 5, 1, 2, 17, 10, 9, 3, 14, 7, 4, 9, 2, 7, 9, 10, 15, -5, 7, -9, 5, 2, -2, 7, 15, 13, -12, -7, 4, 1, 13, 12, 8, 1, 11, 7, 7, 2, -11, -2, 2, -4, 6, 13, 1, -2, 10, 0, -5, -5, -14, 11, 3, 4, -4, -6, 1, 14, 12, 14, 11, 20, 18, 12, 10, 7, 6, 3, -2, -6, 16, 7, 7, -29, -12, -6, -3, -2, -2, 7, 11, -14, -6, -10, -12, 9, 5, 4, 16, 15, 3, 18, 16, 22, 13, 5, 4, 14, 19, 31, 20, -8, -7, -7, -6, -5, -4, 1, -17, -33, -53, -37, -38, -21, -17, 9, 4, -14, -18, 3, -1, -13, -19, -14, 0, -5, -2, -5, -13, 1, 4, 5, -1, 4, 7, 5, 1, 0, -14, -20, -26, -30, 8, 4, 9, -5, -32, -38, -51, -47, -20, -22, -28, -30, -11, -12, 4, -3, 7, 3, 5, -1, 7, 4, 2, 7, -7, -3, 6, 5, 1, 1, 7, 6, -6, -3, -3, 2, -6, -5, 3, -6, 1, -1, 4, 4, -1, 6, -4, -6, 0, 3, 5, 12, 27, 24, 29, 30, 29, 25, 37, 23, 1, 10, -3, 26, 31, 25, 21, 13, 12, 13, -2, -2, 5, 2, 5, -7, 4, 2, 12, 26, 32, 33, 35, 23, 38, 40, 36, 18, 23, 13, 20, 16, 25, 25, 25, 37, 29, 32, 4, -12, 4, 7, -1, -3, 1, 9, 2, 10, 16, 24, 24, 20, 20, 21, 14, 10, 16, 14, 2, 6, 15, 19, 9, 18, 17, 28, 16, -12, 3, -3, 1, 0, -17, -2, 14, 1, 0, -6, 6, 3, -3, -18, -18, -5, -10, -15, 2, 12, 4, 9, 15, 15, 19, 29, -6, -10, -5, 17, -1, 3, 14, -23, 7, -12, -7, -16, 6, -9, 1, -26, -15, -21, -7, -3, -12, -2, 12, 14, 12, 9, 15, 20, 10, 1, 9, 13, 3, -1, -5, -37, -11, -20, -16, -3, -7, -10, -14, -22, -5, -17, -17, -3, -17, -4, -9, -7, 1, 5, -3, 4, 8, -2, -11, 10, 6, -2, -18, -32, 1, -12, -27, -2, -11, -12, -16, -9, -11, -15, -14, -16, -21, -23, -20, -27, -21, -5, -12, -20, -1, -17, -11, -3, -12, -7, -12, -34, -5, -18, -23, -10, -4, -8, -11, -11, -19, -15, -23, -21, -26, -32, -40, -34, -28, -19, -23, -38, -43, -62, -34, -13, -4, 1, -25, -39, 3, -27, -21, -9, -12, -18, -17, -8, -18, -22, -23, -24, -37, -47, -46, -37, -17, -16, -30, -27, -47, -79, -56, -22, -2, -7, -19, -36, -11, -15, -16, -4, 0, -13, -9, -10, -13, -4, -16, -38, -40, -40, -36, -26, -26, -17, -25, -14, -17, -75, -61, -11, -1, -8, -15, -36, -18, -7, -4, 8, 0, 9, 0, -8, -4, 6, -25, -44, -21, -30, -22, -16, -11, 3, -1, 12, -6, -38, -45, -9, -1, -3, -13, -33, -13, -7, 4, 9, 11, 11, 0, 14, 14, -1, -21, -24, -15, -8, -19, -21, -12, 9, 23, 41, 24, -26, -48, -18, -9, -9, -9, -31, -14, 8, 21, 3, 6, 3, 14, 8, 11, -5, -16, -5, -2, -10, -15, -6, -7, 6, 24, 41, 24, -18, -58, -24, -9, -8, 3, -28, -51, -1, 14, 1, 4, 18, 14, 20, 10, -11, -12, 5, -5, -20, -16, -2, 3, 12, 22, 22, 19, -5, -37, -14, -5, -3, -13, -42, -65, -4, 12, 7, 17, 9, 25, 31, 8, 2, 13, 2, 1, -11, -3, 5, 3, 3, -3, 12, 10, -2, -48, -18, 2, -1, -13, -47, -43, 0, 14, 17, 15, 18, 21, 38, 9, -2, 3, 0, -10, -11, 2, 4, 1, 1, 1, -9, -4, -5, -58, -25, -7, -8, -8, -40, -58, -10, -4, 12, 18, 25, 36, 36, 7, 3, 1, -1, -12, -7, 10, 6, -5, -3, -2, -2, 0, -1, -54, -34, -13, -4, -4, -37, -45, -27, -11, 8, 8, 11, 17, 24, 25, 15, 1, -1, 4, 16, 14, -3, -3, 0, -6, 6, -7, 3, -27, -23, 5, -19, -11, -34, -36, -29, -12, -11, 0, 15, 19, 33, 28, 15, 15, 12, 16, 11, 2, 1, 5, 3, 0, 1, -10, -23, -39, -14, -6, -8, -22, -35, -27, -28, -23, -7, -9, 10, 24, 24, 27, 25, 33, 15, 15, 6, 9, 6, 3, -1, -12, -11, -19, -18, -23, -3, 4, 1, -17, -34, -49, -51, -38, -11, 5, 3, 10, 23, 29, 36, 27, 16, 19, 15, 14, 8, -2, -16, -3, -22, -25, -26, -14, -1, -9, -8, -2, -27, -45, -58, -78, -31, -8, -3, 5, 0, 17, 8, 4, 16, 4, 1, -3, -4, 0, -11, -27, -44, -44, -30, -1, -1, -2, 4, -8, -7, -16, -40, -67, -58, -36, -31, -26, -29, -13, -10, -9, 0, -9, -19, -4, -1, -11, -20, -17, -44, -41, -21, -22, -3, 5, 4, 2, -6, -19, -24, -45, -54, -66, -81, -102, -69, -60, -48, -48, -36, -30, -25, -36, -48, -46, -64, -44, -43, -26, -16, -15, -4, 6, -3, -6, -10, -20, -19, -19, -23, -35, -40, -48, -26, -24, -57, -63, -58, -53, -61, -50, -55, -27, -25, -17, -23, -17, -8, -11, -1, 1, -2, -1, 4, 0, 1, -3, -13, -18, -12, -13, -26, -30, -27, -34, -34, -30, -24, -24, -21, -12, -24, -13, -14, -3, -6, 6, 1, 6, 7, 5, 2, 2, 0, -5, -8, -9, -1, -13, 1, -2, -5, -6, 0, 1, -8, -13, -8, -15, -6, -6, -6, 0, -2, 3, 2, 5, -6, 6, 2, 4, 6, 3, -5, -5, -3, -4, -4, 1, 1, 5, 2, -2, -2, 0, -2, 1, -3, -3, 7, 2, -6, -1, 4, -3, -2, 3, 6, -6, -3, 1, -4, -12, -20, -20, -15, -16, -20, -7, -17, -14, -11, -11, -10, -2, -9, -6, -6, 4, -5, 6, 3, 0, -2, 5, -9, -10, 1, -4, -16, -16, -17, -33, -37, -31, -39, -31, -28, -21, -25, -12, -8, -12, -8, -12, -4, -8, 0, 4, 6, 4, -5, -6, -18, -17, -12, -24, -33, -35, -50, -56, -49, -45, -51, -48, -50, -33, -41, -31, -24, -17, -28, -15, -10, -3, 1, -7, 0, 5, 4, 1, 11, -12, -25, -41, -54, -60, -59, -71, -58, -41, -45, -54, -50, -73, -79, -75, -66, -49, -21, -26, -32, -12, -15, -23, -11, 1, 5, -5, -3, -15, 9, 1, 9, 6, 10, -14, -17, -16, -14, -29, -25, -26, -34, -33, -53, -71, -62, -42, -73, -43, -44, -15, -16, 7, -1, 14, 23, 6, 17, 14, 12, 13, 9, 13, 14, 9, -12, -7, -4, -3, -4, -9, -10, -6, -10, -7, -42, -54, -57, -43, -15, 5, 1, 30, 29, 6, 7, 22, 26, 16, 22, 18, 20, 17, 4, -9, 2, 10, 15, 21, 5, 11, 0, 0, -16, -31, -42, -44, -4, -10, 17, 23, 37, 13, 17, 14, 24, 17, 10, 9, 14, 19, 10, 6, 15, 20, 15, 14, 11, 5, 1, 5, -8, -31, -57, -42, -19, 7, 28, 12, 33, 17, 16, 14, 2, 9, -2, -2, 6, 13, 13, 22, 26, 24, 29, 13, 17, 6, 8, 2, -11, -25, -39, -14, 5, 11, 14, 36, 25, 22, 13, 4, -5, -7, 5, 4, -3, -5, 11, 19, 37, 35, 23, 25, 17, 20, 19, 9, -22, -44, -22, -14, 4, 8, 22, 42, 36, 32, 3, 2, 11, -5, -1, 9, 2, -2, -1, 15, 26, 30, 27, 26, 9, 14, 9, 8, -17, -57, -64, -23, 10, 9, 27, 48, 47, 26, 14, -6, 9, 9, -4, -3, -10, -46, -48, -16, 14, 29, 22, 18, -2, -4, 3, 3, -15, -35, 4, 4, 11, -7, 26, 37, 27, 22, 7, 10, -1, -4, -5, -14, -34, -74, -71, -28, 2, 10, 10, 3, 0, 8, 0, -7, -17, -6, 4, -5, -11, -7, 8, 35, 17, 13, 5, -6, -7, -8, -23, -18, -44, -70, -45, -23, -11, -1, 9, 24, 29, 13, 14, 12, 7, -2, -20, -23, -9, 3, -8, 14, 12, 4, 1, -1, -14, -24, -28, -28, -38, -52, -33, -17, -4, 0, 31, 32, 23, 31, 23, 26, 12, -11, -44, -27, -18, 4, -2, -5, -2, 10, -10, 2, 4, -14, -13, -33, -43, -31, -16, -12, -3, 5, 10, 21, 16, 22, 10, 0, -14, -22, -54, -34, -7, 5, -7, -7, -14, 2, -1, -13, -11, -21, -15, -32, -25, -6, -6, 0, 7, -6, 4, 7, 2, 5, -7, -5, -13, -3, -2, 7, -22, 3, 1, 11, -13, -6, -7, -30, -33, -21, -28, -33, -16, -6, 7, -1, 0, -7, -11, -4, -9, -1, -7, -17, -31, -30, -11, 10, -17, 2, 17, 23, -18, -1, -28, -28, -44, -26, -22, -23, -23, -9, -3, 0, -11, -19, -23, -24, -16, -29, -28, -46, -42, -24, -16, -7, -19, 3, 4, -11, -41, -45, -38, -51, -37, -17, -27, -15, -8, -4, 3, 5, -13, -18, -24, -39, -26, -36, -41, -48, -43, -21, -26, -10, 2, -1, -21, -27, -54, -33, -23, -29, -27, -10, -14, -18, -10, -5, -7, -9, -9, -9, -27, -30, -34, -41, -42, -47, -55, -20, -6, -18, 1, -5, 0, -28, -47, -17, -5, -6, 4, -5, -8, 0, -13, -10, -14, -11, 0, -4, -18, -23, -24, -38, -38, -46, -54, -27, -7, -27, 2, 0, -6, -20, -28, 13, 9, 16, 29, -13, -13, -5, -15, -17, -8, -2, 0, -9, -12, -22, -27, -44, -50, -33, -61, -26, -23, -21, -5, -2, 0, -10, 0, 24, 33, 34, 24, 11, 0, -1, 8, -2, 2, 7, 4, 0, -5, -16, -24, -15, -15, -35, -65, -27, -16, -2, -1, -1, -6, -17, 16, 24, 19, 8, 19, 21, 26, 15, 25, 22, 9, 13, 18, 14, 15, 4, 5, -16, -6, -1, -24, -16, -4, -6, -2, -1, 3, 4, -5, -23, -16, -16, 6, 13, 19, 13, 7, 5, 19, 20, 26, 24, 28, 34, 29, -3, 10, 15, -8, -7, 16, 5, -7, 6, -5, -2, -5, 4, 15, 11, 16, 13, 10, 27, 13, 14, 43, 33, 23, 31, 55, 23, 32, 6, 16, 18, 16, -2, 3, 2, -4, 3, 5, -3, 6, 2, -4, -1, 5, -6, 0, 7, -2, -9, -5, -6, -6, 5, 3, -5, -1, -2, 4, -7, 1, 1, -1, 0, 1, 2, -6, -3, 5, 5, 2, -6, -5, -20, -17, -13, -14, -10, -14, -15, -21, -29, -32, -14, -14, -13, -24, -16, -15, 3, -1, -5, 3, -6, 4, -6, -12, -5, -4, -17, -27, -26, -30, -49, -56, -65, -77, -86, -81, -81, -43, -7, -48, -40, -44, -23, -26, -18, -7, 7, 3, -5, -4, -7, -13, -18, -34, -23, -28, -21, -30, -32, -32, -22, -22, -30, -16, -25, -17, -9, -29, -18, -9, -1, 8, -1, -3, -12, -6, 2, -8, 8, -28, -32, -46, -33, -15, -6, 7, -5, 5, 10, 5, 11, 15, 8, 4, 0, -1, 0, 0, -11, -18, 4, 9, 13, 3, 4, -4, -20, -29, -49, -40, -19, -10, -4, -6, -16, 1, 14, 14, 6, 14, 8, 12, 1, 4, 8, 2, -7, -17, -10, 14, 3, -2, 2, -4, -38, -35, -38, -21, -17, -11, 4, -5, 0, -4, 7, 2, 2, 13, 9, 8, 1, 11, 5, 3, -7, -3, -4, 17, 0, -9, 5, -20, -36, -25, -8, -9, -7, -2, 0, 0, -1, -2, 2, -7, -7, 1, 4, -6, 4, 1, 2, 6, 8, 18, 14, -6, 8, -9, -7, -17, -41, -4, -2, 1, 6, 16, 5, 9, 5, -1, 6, 4, -14, -4, 5, -4, 0, 10, 1, 13, 11, 6, 16, 7, 14, 22, -1, -19, -32, -12, -11, -1, 8, 5, 6, 16, 7, 8, 3, 2, -14, -24, -15, -1, -2, 6, 11, 6, 15, 15, -7, 1, 20, -5, -6, -25, -31, -32, 11, 5, 7, 10, 15, 19, 16, 13, 13, -1, -14, -29, -22, -18, 3, 9, 2, 12, 9, 9, -16, -31, -6, 2, 0, -21, -38, -21, 4, 10, 12, 21, 13, 15, 16, 5, 10, 23, 18, -5, -14, -18, -9, -3, 6, 3, 20, 10, 11, -9, 11, -2, 2, -18, -42, -3, -3, 18, 4, 7, 5, 7, -8, -7, 8, 21, 11, 2, 2, -3, -3, 4, 13, 20, 20, 29, 36, 2, 2, -15, -10, -20, -26, -10, -5, -3, -5, -8, -14, -9, -9, 2, 20, 24, 3, 11, 2, -15, -5, -3, 7, -4, 0, 10, 5, -8, -10, -14, -14, -6, -24, -13, -29, -13, -12, -27, -21, -19, -9, 8, 16, 21, 8, 13, -3, -5, -8, -8, -24, -17, -33, -33, -23, 2, -27, -13, -12, -8, -23, -15, -36, -38, -26, -26, -19, -9, -4, 1, 19, 22, 15, 1, -9, -10, -8, -17, -25, -29, -24, -22, -29, -15, -44, -16, -10, -7, -28, -16, -47, -28, -18, -6, 2, 0, 0, 2, 21, 10, 1, 3, 2, -10, -20, -26, -25, -26, -24, -16, -19, -31, -43, -11, 6, -15, -19, -34, -20, -25, -19, 7, 5, 14, 11, 14, 18, 13, -6, -11, -3, -15, -20, -13, -14, -19, -10, -4, -5, -70, -45, -30, -9, -17, -26, -68, -34, -9, -7, -6, 10, 15, 14, 12, 14, -9, -11, -6, -12, -11, -4, -8, 1, -11, -8, 1, -6, -62, -41, -22, -14, -23, -35, -49, -29, 1, -2, -8, 1, 9, 7, -3, -8, -10, -16, -8, -5, -1, -1, 6, -2, 1, 8, 13, -12, -63, -38, -18, -6, -19, -43, -43, -24, -7, 7, 8, -1, -2, -6, -13, -2, -8, -7, -5, -12, -9, 0, -2, 2, 9, 13, 4, -11, -67, -29, -9, -12, -3, -32, -50, -12, -8, 7, 11, 5, -2, -1, -3, -8, 0, 3, -1, -3, -1, -1, 1, 1, -1, 6, -7, -33, -41, -36, -4, -7, -4, -41, -25, -15, -16, 0, 4, -2, -8, 0, -1, 13, 16, 9, 2, -1, 1, -3, -1, -5, -1, -1, 3, -28, -27, -21, -11, -1, -4, -27, -20, -18, -32, -25, -12, 0, 1, -2, 11, 9, 22, 19, 16, 18, 3, 7, 6, 1, 6, -2, 8, -18, -24, -18, 7, -5, -4, -14, -18, -55, -49, -32, -26, 4, -1, 3, 13, 15, 12, 9, 13, 22, -6, 17, 25, 6, -6, -16, -24, -36, -37, -15, 5, 0, -1, -19, -21, -42, -55, -30, -35, -31, -24, -11, -10, -15, -13, -5, 12, 8, 5, 1, -1, -3, -37, -55, -26, -25, -8, -15, 3, 3, -1, -4, -14, -22, -29, -51, -17, -21, -35, -39, -30, -38, -36, -40, -94, -83, -44, -44, -66, -58, -41, -21, -6, -10, 3, -5, 6, 0, 6, 4, -6, 0, -10, -7, -14, -10, -17, -28, -32, -28, -28, -37, -22, -31, -29, -18, -28, -17, -21, -22, -12, -3, 5, -2, -6, -6, -5, 6, 6, 2, -2, -6, -6, 0, 3, 5, 4, -15, -10, -8, 1, -1, 5, 5, -7, 0, -5, -6, -2, -7, 5, -6, -1, 2, 2, -6, -2, 5, 3, -6, -1, -7, -12, -25, -27, -33, -23, -18, -13, -14, -22, -19, -10, -16, -14, -19, -7, 0, 0, -1, -7, 0, 7, -6, -12, -10, 2, -4, -6, -13, -15, -32, -51, -49, -66, -56, -53, -54, -52, -51, -34, -26, -12, -23, -11, -6, -1, 0, -7, 3, -2, 5, -15, -9, -11, -15, -17, -32, -36, -64, -78, -79, -89, -98, -101, -100, -72, -25, -57, -42, -44, -33, -10, -14, -2, 2, 6, 5, 3, -3, -9, -12, -13, -26, -40, -45, -74, -45, -41, -31, -31, -31, -45, -48, -50, -45, -53, -42, -101, -76, -49, -28, -21, -21, -17, 6, -2, -13, -22, -21, -42, -72, -44, -36, -24, -19, 7, 0, 2, -16, -12, -37, -24, -27, -26, -26, -30, -52, -104, -74, -49, -17, -7, -6, -16, -16, -31, -52, -60, -41, -36, -18, -6, -2, 4, 10, 20, 21, 17, 22, 16, 12, 5, 0, -8, -35, -43, -48, -37, -40, -20, 1, -22, -27, -43, -66, -54, -28, -26, -8, -3, -1, 4, 13, 22, 28, 32, 34, 11, 12, 1, -2, -2, -17, -33, -48, -47, -47, -15, -13, -16, -39, -42, -44, -27, -10, -21, -3, -13, -4, -5, -11, 9, 19, 13, 15, 0, -1, -3, -4, 4, -10, -28, -30, -44, -45, -26, -8, -25, -41, -26, -39, -7, -1, -7, -4, -1, -1, 4, -4, 3, 7, 9, -3, -10, -1, -11, -3, -11, -14, -30, -42, -61, -55, -31, -7, -25, -43, -31, -23, 2, 11, 5, 10, 4, 7, 10, 5, -11, -6, -10, -2, 0, 6, 1, -1, -3, -10, -24, -43, -36, -51, -25, -12, -37, -51, -29, -9, 15, 12, 10, 21, 13, 16, 11, 2, -10, -3, 0, 6, 18, 18, 10, 29, 19, 6, -11, -38, -40, -33, -19, -9, -37, -48, -20, 13, 19, 22, 16, 11, 16, 18, 7, -16, -3, 10, 18, 24, 21, 25, 30, 23, 23, 18, 10, -50, -79, -41, -17, -7, -21, -39, -3, 24, 25, 13, 12, 9, 8, 7, -5, -19, 4, 12, 14, 23, 29, 18, 23, 23, 21, 11, -16, -57, -55, -26, -7, -18, -13, -38, 1, 18, 6, 7, 6, 6, -1, -7, -2, -8, 3, 0, 13, 21, 23, 9, 10, 8, 5, -5, -32, -81, -49, -25, -16, -19, -2, -40, -10, 4, 7, 0, 4, 5, -4, 4, -1, -4, -14, -11, 8, 22, 21, 7, 1, 6, -7, -22, -36, -83, -47, -13, -13, -3, -5, -24, -10, 1, 1, -10, 1, 2, -6, 7, 7, -4, -18, -12, 3, 13, 9, 7, -12, -11, -19, -9, -38, -72, -53, -37, -29, 0, -9, -33, -19, -20, -12, -14, 1, 0, 4, 4, 4, -6, -8, -1, 14, 3, 0, -7, -11, -10, -24, -33, -44, -59, -46, -26, -22, -3, -11, -26, -46, -35, -28, -6, -13, -5, 0, 11, 4, -16, -19, 3, 7, -5, -4, -5, -3, -7, -23, -23, -46, -56, -27, -33, -23, 4, -15, -33, -35, -39, -28, -12, -9, -13, -30, -21, -29, -20, -15, -12, -9, -7, -19, -15, -8, -1, -24, -25, -29, -28, -21, -12, -20, 0, -7, -26, -38, -30, -2, -16, -28, -23, -32, -33, -38, -33, -14, -19, -18, -13, -13, -16, -9, -17, -28, -31, -20, 12, 3, -14, 3, 2, -17, -27, -45, -16, -3, -16, -23, -15, -11, -21, -19, -20, -18, -13, -14, -5, -19, -20, -16, -11, -12, -17, -5, 9, -3, -22, 6, -9, -4, -29, -19, -6, -27, -22, -12, -7, -6, 0, -5, -3, -3, -12, -15, -14, -18, -11, -26, -16, -14, -3, 3, 15, -1, -22, 2, -6, 4, -27, -6, -34, -18, -22, -15, 2, -9, -8, -7, -11, -13, -9, -12, -13, -11, -16, -10, 7, 10, 18, 21, 14, -10, -19, 1, 2, 4, -15, -39, -5, 4, 1, 8, 4, -9, 3, -2, -15, -12, -17, -7, -1, 3, 2, 6, 21, 18, 21, 23, -5, -19, -8, -5, 3, 1, 7, -38, -1, 31, 15, 22, 13, 12, 12, 7, 14, 4, 7, 7, 10, 19, 21, 27, 34, 29, 14, 6, -7, -6, -18, 7, 4, -2, 3, 7, 29, 29, 33, 29, 33, 30, 27, 21, 31, 29, 43, 20, 23, 23, 24, 17, 31, 12, -3, 10, 5, -7, -2, -2, -6, 1, -5, -1, -10, -18, 3, 7, 4, 1, -9, 1, -3, -45, -4, -5, -15, -36, -16, -13, 1, -1, -13, -16, -2, -4, -5, 7};
+const TsInt ip1_biases_int32[] = {-894480, -1094411, -363381, -430391, -1137017, -369290, -712453, -626882, -873164, -1099931};
+const TQuantParams ip1_quant = {1798611560, -10, -88};
+const TuShort softmax1_exp_table[] = {32768, 30898, 29136, 27473, 25906, 24428, 23034, 21720, 20481, 19312, 18210, 17171, 16192, 15268, 14397, 13575, 12801, 12071, 11382, 10733, 10120, 9543, 8998, 8485, 8001, 7544, 7114, 6708, 6325, 5964, 5624, 5303, 5001, 4715, 4446, 4193, 3953, 3728, 3515, 3315, 3126, 2947, 2779, 2621, 2471, 2330, 2197, 2072, 1954, 1842, 1737, 1638, 1544, 1456, 1373, 1295, 1221, 1151, 1086, 1024, 965, 910, 858, 809, 763, 720, 679, 640, 603, 569, 536, 506, 477, 450, 424, 400, 377, 356, 335, 316, 298, 281, 265, 250, 236, 222, 210, 198, 186, 176, 166, 156, 147, 139, 131, 124, 116, 110, 104, 98, 92, 87, 82, 77, 73, 69, 65, 61, 58, 54, 51, 48, 45, 43, 40, 38, 36, 34, 32, 30, 28, 27, 25, 24, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8, 7, 7, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 #endif
@@ -44,8 +44,18 @@ struct shapes layer_shapes ={
 
 void dnn_compute(TPrecision* input_img, TPrecision* ip1_out)
 {
-  TPrecision ip1_weights_trans[7840];
-  transpose(ip1_weights,ip1_weights_trans,layer_shapes.ip1_shape);
+  /* the weights are stored transposed (see generateRenesasWeights.py) */
   innerproduct(input_img,ip1_weights_trans,ip1_biases,ip1_out,layer_shapes.ip1_shape);
-  softmax(ip1_out,layer_shapes.softmax1_shape);
+#if !DNN_ARGMAX_ONLY
+  softmax_fast(ip1_out,layer_shapes.softmax1_shape);
+#endif
+}
+
+/* int8 network (DNN_INT8), the input is the image shifted to int8 (pixel - 128) */
+void dnn_compute_int8(const TQuant* input_img, TQuant* ip1_out)
+{
+  innerproduct_int8(input_img,ip1_weights_int8,ip1_biases_int32,ip1_out,layer_shapes.ip1_shape,&ip1_quant);
+#if !DNN_ARGMAX_ONLY
+  softmax_int8(ip1_out,layer_shapes.softmax1_shape,softmax1_exp_table);
+#endif
 }
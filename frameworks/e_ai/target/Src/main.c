@@ -63,12 +63,18 @@ int main(void)
 {
   /* USER CODE BEGIN 1 */
   uint8_t c_cmd;
-  float ip1_out[10];
   uint16_t i;
   /* buffers for the MNIST image */
   uint8_t inputPicture[IMAGE_SIZE];
+#if DNN_INT8
+  TQuant ip1_out[10];
+  TQuant q7_digitToClassify[IMAGE_SIZE];
+  TQuant max_val;
+#else
+  float ip1_out[10];
   float f32_digitToClassify[IMAGE_SIZE];
-  float max_val = -1;
+  float max_val;
+#endif
 
   /* USER CODE END 1 */
 
@@ -119,9 +125,18 @@ int main(void)
           if (HAL_UART_Receive(&huart4, inputPicture, IMAGE_SIZE, 1000) == HAL_OK)
           {
             
-            /* reset max val */
-            max_val = -1;
+#if DNN_INT8
+            /* shift input into int8, the network has the pixel scale (zero point -128) */
+            for (i = 0; i < IMAGE_SIZE; i++) {
+              q7_digitToClassify[i] = (TQuant)(inputPicture[i] - 128);
+            }
 
+            /* start time measurement */
+            HAL_GPIO_WritePin(GPIOB, ai_timing_Pin, GPIO_PIN_SET);
+
+            /* run nn */
+            dnn_compute_int8(q7_digitToClassify, ip1_out);
+#else
             /* scale input into float */
             for (i = 0; i < IMAGE_SIZE; i++) {
               f32_digitToClassify[i] = (float)inputPicture[i] / 255;
@@ -132,9 +147,12 @@ int main(void)
 
             /* run nn */
             dnn_compute(f32_digitToClassify, ip1_out);
+#endif
 
-            /* find max */
-            for(i = 0; i < 10; i++) 
+            /* find max, of the probabilities or of the logits (DNN_ARGMAX_ONLY) */
+            max_val = ip1_out[0];
+            c_cmd = 0;
+            for(i = 1; i < 10; i++) 
             {
                 if(max_val < ip1_out[i]) 
                 {
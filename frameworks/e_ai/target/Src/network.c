@@ -27,6 +27,8 @@
 ***********************************************************************************************************************/
 
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
 #include "Typedef.h"
 /*
 transpose :
@@ -50,11 +52,113 @@ void transpose( TPrecision *dData,TPrecision *dOut,TsInt* iShapes){
 	}
 }
 
+/*
+innerproduct tiles :
+	- The weights are read row by row (one input element, all outputs), in the order
+	  they are stored, which suits the caches of the host and the flash prefetch of the MCU
+	- A tile of up to IP_ROWS input rows and IP_COLS outputs is accumulated in registers,
+	  so a batch (N > 1) reads the weights once for IP_ROWS inputs
+	- Each output is summed over the inputs in order, the results are the same as the
+	  plain triple loop
+	- On hosts with SSE or AVX the columns are computed by vectors, the Cortex-M4 FPU has
+	  no float SIMD and runs the unrolled scalar tile
+*/
+#define IP_ROWS		4
+#define IP_COLS		8
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+static inline void innerproduct_tile(const TPrecision *data,const TPrecision *weight_trans, const TPrecision *biases,
+		TPrecision *out, TsInt D, TsInt F, TsInt rows, TsInt cols)
+{
+	TPrecision acc[IP_ROWS][IP_COLS] = {{0}};
+	const TPrecision *w = weight_trans;
+	TsInt iRow, iColumn, iInneritr;
+
+	for(iInneritr=0; iInneritr<D; iInneritr++)
+	{
+		for(iRow=0; iRow<rows; iRow++)
+		{
+			TPrecision x = data[(iRow*D)+iInneritr];
+			for(iColumn=0; iColumn<cols; iColumn++)
+			{
+				acc[iRow][iColumn] += x * w[iColumn];
+			}
+		}
+		w += F;
+	}
+	for(iRow=0; iRow<rows; iRow++)
+	{
+		for(iColumn=0; iColumn<cols; iColumn++)
+		{
+			out[(iRow*F)+iColumn] = acc[iRow][iColumn] + biases[iColumn];
+		}
+	}
+}
+
+/* IP_COLS columns of up to IP_ROWS rows, by one AVX or two SSE vectors per row */
+static inline void innerproduct_tile_full(const TPrecision *data,const TPrecision *weight_trans, const TPrecision *biases,
+		TPrecision *out, TsInt D, TsInt F, TsInt rows)
+{
+#if defined(__AVX__)
+	const TPrecision *w = weight_trans;
+	TsInt iRow, iInneritr;
+	__m256 acc[IP_ROWS];
+
+	for(iRow=0; iRow<IP_ROWS; iRow++)
+		acc[iRow] = _mm256_setzero_ps();
+	for(iInneritr=0; iInneritr<D; iInneritr++)
+	{
+		__m256 wv = _mm256_loadu_ps(w);
+		for(iRow=0; iRow<rows; iRow++)
+		{
+			acc[iRow] = _mm256_add_ps(acc[iRow], _mm256_mul_ps(_mm256_set1_ps(data[(iRow*D)+iInneritr]), wv));
+		}
+		w += F;
+	}
+	for(iRow=0; iRow<rows; iRow++)
+	{
+		_mm256_storeu_ps(&out[iRow*F], _mm256_add_ps(acc[iRow], _mm256_loadu_ps(biases)));
+	}
+#elif defined(__SSE__)
+	const TPrecision *w = weight_trans;
+	TsInt iRow, iInneritr;
+	__m128 acc_lo[IP_ROWS], acc_hi[IP_ROWS];
+
+	for(iRow=0; iRow<IP_ROWS; iRow++)
+		acc_lo[iRow] = acc_hi[iRow] = _mm_setzero_ps();
+	for(iInneritr=0; iInneritr<D; iInneritr++)
+	{
+		__m128 w_lo = _mm_loadu_ps(w);
+		__m128 w_hi = _mm_loadu_ps(w + 4);
+		for(iRow=0; iRow<rows; iRow++)
+		{
+			__m128 x = _mm_set1_ps(data[(iRow*D)+iInneritr]);
+			acc_lo[iRow] = _mm_add_ps(acc_lo[iRow], _mm_mul_ps(x, w_lo));
+			acc_hi[iRow] = _mm_add_ps(acc_hi[iRow], _mm_mul_ps(x, w_hi));
+		}
+		w += F;
+	}
+	for(iRow=0; iRow<rows; iRow++)
+	{
+		_mm_storeu_ps(&out[iRow*F], _mm_add_ps(acc_lo[iRow], _mm_loadu_ps(biases)));
+		_mm_storeu_ps(&out[iRow*F + 4], _mm_add_ps(acc_hi[iRow], _mm_loadu_ps(biases + 4)));
+	}
+#else
+	innerproduct_tile(data, weight_trans, biases, out, D, F, rows, IP_COLS);
+#endif
+}
+
 /*
 innerproduct :
 	- Fully connected layer
 	- Performs dot product of data and weights and add them up with biases
 	  (Matrix Multiplication of data and weights and addition of biases)
+	- Runs by tiles of IP_ROWS rows and IP_COLS columns (see innerproduct tiles)
 Parameters :
 	data		- Array of input data
 	weight_trans	- Array of weights (transposed)
@@ -62,26 +166,35 @@ Parameters :
 	out		- Placeholder for the output
 	shapes		- Dimensions of data and weights (N, D, F, D)
 */
-void innerproduct(TPrecision *data,TPrecision *weight_trans, TPrecision *biases,TPrecision *out,TsInt *shapes){
-        TsInt iRow, iColumn;
-		TsInt iInneritr;
-        TsInt N = shapes[0];
-        TsInt D = shapes[1];
-        TsInt F = shapes[2];
-        TPrecision dSum = 0;
-        
-        for(iRow=0; iRow<N; iRow++)
-        {
-          for(iColumn=0; iColumn<F; iColumn++)
-          {
-        	  dSum = 0;
-        	  for(iInneritr=0; iInneritr<D;iInneritr++)
-        	  {
-            	dSum += data[(iRow*D)+iInneritr] * weight_trans[(iInneritr*F)+iColumn];
-        	  }
-            out[(iRow*F)+iColumn] = dSum + biases[iColumn];
-          }
-        }
+void innerproduct(const TPrecision *data,const TPrecision *weight_trans, const TPrecision *biases,TPrecision *out,TsInt *shapes){
+	TsInt iRow, iColumn;
+	TsInt N = shapes[0];
+	TsInt D = shapes[1];
+	TsInt F = shapes[2];
+	TsInt rows, col;
+
+	for(iRow=0; iRow<N; iRow+=rows)
+	{
+		rows = (N - iRow < IP_ROWS) ? N - iRow : IP_ROWS;
+		if(F < IP_COLS)
+		{
+			innerproduct_tile(&data[iRow*D], weight_trans, biases, &out[iRow*F], D, F, rows, F);
+			continue;
+		}
+		for(iColumn=0; iColumn<F; iColumn+=IP_COLS)
+		{
+			/* the last tile overlaps the one before it when F is not a multiple of IP_COLS,
+			   the overlapping outputs are computed again to the same values */
+			col = (iColumn > F - IP_COLS) ? F - IP_COLS : iColumn;
+			/* constant sizes keep the accumulators in registers */
+			if(rows == 1)
+				innerproduct_tile_full(&data[iRow*D], &weight_trans[col], &biases[col], &out[(iRow*F)+col], D, F, 1);
+			else if(rows == IP_ROWS)
+				innerproduct_tile_full(&data[iRow*D], &weight_trans[col], &biases[col], &out[(iRow*F)+col], D, F, IP_ROWS);
+			else
+				innerproduct_tile_full(&data[iRow*D], &weight_trans[col], &biases[col], &out[(iRow*F)+col], D, F, rows);
+		}
+	}
 }
 
 
@@ -120,5 +233,199 @@ void softmax( TPrecision *dData, TsInt iShapes )
     }
 }
 
+/*
+fast_exp :
+	- exp(x) for x <= 0 without libm, as 2^n * exp(r) with x = n * ln(2) + r: n goes to
+	  the exponent bits and exp(r) (|r| <= ln(2) / 2) is a polynomial of degree 6
+	- The relative error is below 3e-7 (about 2 ulp)
+	- Underflows to 0 below -87, where 2^n has no normal float
+*/
+static inline TPrecision fast_exp(TPrecision x)
+{
+	union { TPrecision f; TsInt i; } scale;
+	TPrecision r, p;
+	TsInt n;
+
+	if(x < -87.0f)
+		return 0;
+	/* x <= 0 and the conversion rounds towards zero, so n is the nearest integer */
+	n = (TsInt)(x * 1.44269504f - 0.5f);
+	/* r = x - n * ln(2) with ln(2) in two parts, the first one is exact in n * ln(2) */
+	r = (x - (TPrecision)n * 0.693145752f) - (TPrecision)n * 1.42860677e-6f;
+	p = 1.0f + r * (1.0f + r * (0.5f + r * (0.166666667f + r * (0.0416666667f + r * (0.00833333333f + r * 0.00138888889f)))));
+	scale.i = (n + 127) << 23;
+	return p * scale.f;
+}
+
+/*
+softmax_fast :
+	- softmax() with fast_exp() instead of exp() of libm, which works on doubles and
+	  runs without the FPU on the Cortex-M4
+	- The exponentials are computed once and the sum is inverted once
+Parameters :
+	dData	- Array of input data
+	iShapes	- Size of the input array
+*/
+void softmax_fast( TPrecision *dData, TsInt iShapes )
+{
+    TPrecision dMax, dSum = 0;
+    TsInt iRow;
+
+    dMax = dData[0];
+    for (iRow = 1; iRow < iShapes; iRow++)
+    {
+        if (dData[iRow] > dMax)
+        {
+        	dMax = dData[iRow];
+        }
+    }
+    for (iRow = 0; iRow < iShapes; iRow++)
+    {
+    	dData[iRow] = fast_exp(dData[iRow] - dMax);
+        dSum = dSum + dData[iRow];
+    }
+    dSum = 1 / dSum;
+    for (iRow = 0; iRow < iShapes; iRow++)
+    {
+    	dData[iRow] = dData[iRow] * dSum;
+    }
+}
+
+/*
+int8 network (DNN_INT8) :
+	- The data, weights and outputs are int8 with a scale and zero point per layer,
+	  the biases are int32 with the scale of the products (see generateRenesasWeights.py)
+	- The weights are stored per output (F x D), so an output is a dot product of two
+	  contiguous int8 vectors, by SMLAD on the Cortex-M4 and by pmaddwd on hosts
+*/
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
+static TsInt dot_int8(const TQuant *a, const TQuant *b, TsInt size)
+{
+	TsInt sum = 0;
+	TsInt i = 0;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+	/* the even and the odd bytes of 4 are sign extended to two halfwords each */
+	for(; i <= size - 4; i += 4)
+	{
+		uint32_t va, vb;
+		memcpy(&va, &a[i], 4);
+		memcpy(&vb, &b[i], 4);
+		sum = __SMLAD(__SXTB16(va), __SXTB16(vb), sum);
+		sum = __SMLAD(__SXTB16(__ROR(va, 8)), __SXTB16(__ROR(vb, 8)), sum);
+	}
+#elif defined(__AVX2__)
+	__m256i acc = _mm256_setzero_si256();
+	__m128i acc128;
+	for(; i <= size - 16; i += 16)
+	{
+		__m256i va = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&a[i]));
+		__m256i vb = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&b[i]));
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+	}
+	acc128 = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	acc128 = _mm_add_epi32(acc128, _mm_shuffle_epi32(acc128, _MM_SHUFFLE(1, 0, 3, 2)));
+	acc128 = _mm_add_epi32(acc128, _mm_shuffle_epi32(acc128, _MM_SHUFFLE(2, 3, 0, 1)));
+	sum = _mm_cvtsi128_si32(acc128);
+#elif defined(__SSE2__)
+	/* the bytes are sign extended by unpacking them to the high byte and shifting back */
+	__m128i acc = _mm_setzero_si128();
+	for(; i <= size - 16; i += 16)
+	{
+		__m128i va = _mm_loadu_si128((const __m128i *)&a[i]);
+		__m128i vb = _mm_loadu_si128((const __m128i *)&b[i]);
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(va, va), 8),
+			_mm_srai_epi16(_mm_unpacklo_epi8(vb, vb), 8)));
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(va, va), 8),
+			_mm_srai_epi16(_mm_unpackhi_epi8(vb, vb), 8)));
+	}
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+	sum = _mm_cvtsi128_si32(acc);
+#endif
+	for(; i < size; i++)
+	{
+		sum += a[i] * b[i];
+	}
+	return sum;
+}
 
+/* rounds acc * multiplier * 2^(shift - 31) to the nearest and saturates it to int8 */
+static TQuant requantize(TsInt acc, const TQuantParams *quant)
+{
+	TsInt right_shift = 31 - quant->shift;
+	long long prod = (long long)acc * quant->multiplier;
+	TsInt out = (TsInt)((prod + (1LL << (right_shift - 1))) >> right_shift) + quant->zero_point;
+
+	if(out > 127)
+		out = 127;
+	if(out < -128)
+		out = -128;
+	return (TQuant)out;
+}
+
+/*
+innerproduct_int8 :
+	- Fully connected layer of the int8 network
+	- The zero point of the input is folded into the biases, an output is
+	  bias + dot(data, weights) requantized to int8
+Parameters :
+	data		- Array of int8 input data
+	weights		- Array of int8 weights (F x D, not transposed)
+	biases 		- Array of int32 biases
+	out		- Placeholder for the int8 output
+	shapes		- Dimensions of data and weights (N, D, F, D)
+	quant		- Requantization of the output
+*/
+void innerproduct_int8(const TQuant *data,const TQuant *weights, const TsInt *biases,TQuant *out,TsInt *shapes,const TQuantParams *quant){
+	TsInt iRow, iColumn;
+	TsInt N = shapes[0];
+	TsInt D = shapes[1];
+	TsInt F = shapes[2];
+
+	for(iRow=0; iRow<N; iRow++)
+	{
+		for(iColumn=0; iColumn<F; iColumn++)
+		{
+			out[(iRow*F)+iColumn] = requantize(biases[iColumn] + dot_int8(&data[iRow*D], &weights[iColumn*D], D), quant);
+		}
+	}
+}
+
+/*
+softmax_int8 :
+	- Activation function of the int8 network
+	- The output has a scale of 1/256 and a zero point of -128
+Parameters :
+	dData		- Array of int8 input data
+	iShapes		- Size of the input array
+	exp_table	- exp(-i * input scale) in Q15 for i = 0..255 (see generateRenesasWeights.py)
+*/
+void softmax_int8( TQuant *dData, TsInt iShapes, const TuShort *exp_table )
+{
+    TsInt iRow, dMax, dSum = 0, dOut;
+
+    dMax = dData[0];
+    for (iRow = 1; iRow < iShapes; iRow++)
+    {
+        if (dData[iRow] > dMax)
+        {
+        	dMax = dData[iRow];
+        }
+    }
+    for (iRow = 0; iRow < iShapes; iRow++)
+    {
+        dSum = dSum + exp_table[dMax - dData[iRow]];
+    }
+    for (iRow = 0; iRow < iShapes; iRow++)
+    {
+    	dOut = ((exp_table[dMax - dData[iRow]] << 8) + dSum / 2) / dSum - 128;
+    	dData[iRow] = (TQuant)(dOut > 127 ? 127 : dOut);
+    }
+}
@@ -29,6 +29,11 @@ from sklearn import metrics
 from fully_connected_opt_weight_generation import *
 import time
 import warnings
+import os
+import re
+import shutil
+import subprocess
+import tempfile
 
 
 """ 
@@ -444,7 +449,98 @@ def layers_output_ranges(model, x_test, kld=True, calibrate_size=1000):
     print("shift list", shift_list)
     return shift_list
 
-def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
+def static_buf_size(model):
+    # an estimation of the memory the model takes with NNOM_USING_STATIC_MEMORY:
+    # the structures of every layer, the weights padded for CMSIS-NN, the largest layer with its
+    # input, output and computational buffer, and one more output for a branch alive at the same time.
+    def size(shape):
+        sz = 1
+        for d in shape[1:]:
+            sz = sz*int(d)
+        return sz
+    structs = 256
+    weights = 0
+    largest = 0
+    outputs = [0]
+    for layer in model.layers:
+        inputs = layer.input if type(layer.input) is list else [layer.input]
+        io = size(layer.output.shape) + sum([size(inp.shape) for inp in inputs])
+        comp = 0
+        if(type(layer).__name__ in ('Conv1D', 'Conv2D', 'DepthwiseConv2D')):
+            ch_in = int(layer.input.shape[-1])
+            ch_out = int(layer.output.shape[-1])
+            pad_in = (ch_in + 3)//4*4
+            pad_out = (ch_out + 1)//2*2
+            if(type(layer).__name__ == 'DepthwiseConv2D'):
+                taps = layer.get_weights()[0].size // ch_out
+            else:
+                taps = layer.get_weights()[0].size // (ch_in * ch_out)
+                # odd channels are padded with their input, output and weights
+                if(ch_in != pad_in or ch_out != pad_out):
+                    comp += size(layer.input.shape)//ch_in*pad_in + size(layer.output.shape)//ch_out*pad_out
+                    weights += pad_out*taps*pad_in + pad_out
+            # bufferA, and the band of rows of a fused pooling
+            comp += 4*pad_in*taps + size(layer.output.shape)
+        structs += 256
+        largest = max(largest, io + comp)
+        outputs.append(size(layer.output.shape))
+    return structs + weights + largest + max(outputs)
+
+def export_static_model(name, symbols):
+    # compile the model of the header on the host and add its tables to the header (see nnom_export.h).
+    # with NNOM_USING_STATIC_MODEL, nnom_model_create() returns them and nothing is compiled on the target.
+    # symbols are the C names of the weights, bias and buffers which the model points to.
+    target = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'target')
+    tmp = tempfile.mkdtemp()
+    src = os.path.join(tmp, 'export.c')
+    out = os.path.join(tmp, 'model.h')
+    with open(src, 'w') as fp:
+        fp.write('#include "nnom.h"\n#include "nnom_export.h"\n\n')
+        # the model is compiled as on the target, with a static memory large enough for any host
+        fp.write('#undef NNOM_USING_STATIC_MODEL\n')
+        fp.write('#define NNOM_STATIC_BUF_SIZE (16 << 20)\n')
+        fp.write('#include "%s"\n\n'%(os.path.abspath(name).replace('\\', '/')))
+        fp.write('static const nnom_export_symbol_t symbols[] = {\n')
+        for sym in symbols:
+            fp.write('\t{%s, "%s"},\n'%(sym, sym))
+        fp.write('};\n\n')
+        fp.write('int main(int argc, char *argv[])\n{\n')
+        fp.write('\tnnom_model_t *model = nnom_model_create();\n')
+        fp.write('\tFILE *fp = fopen(argv[1], "w");\n')
+        fp.write('\tnnom_status_t result;\n\n')
+        fp.write('\tif (fp == NULL)\n\t\treturn 1;\n')
+        # the memory the model takes to compile, the first line
+        fp.write('\tfprintf(fp, "%lu\\n", (unsigned long)nnom_mem_stat());\n')
+        fp.write('\tresult = model_export(model, fp, symbols, sizeof(symbols) / sizeof(symbols[0]));\n')
+        fp.write('\tfclose(fp);\n')
+        fp.write('\treturn result != NN_SUCCESS;\n}\n')
+    subprocess.check_call(['make', '-s', '-C', target, '-f', 'Makefile.host', 'export',
+                           'EXPORT_SRC=' + src, 'EXPORT_OUT=' + out])
+    with open(out) as fp:
+        memory = int(fp.readline())
+        tables = fp.read()
+    shutil.rmtree(tmp)
+
+    # the model compiled on the target stays in the #else, its static memory is the one measured.
+    # structures are smaller on 32 bit targets than on a 64 bit host.
+    with open(name) as fp:
+        text = fp.read()
+    start = text.index('#ifdef NNOM_USING_STATIC_MEMORY\n', text.index('/* nnom model */'))
+    dynamic = re.sub(r'#define NNOM_STATIC_BUF_SIZE \(\d+\).*\n',
+        '#define NNOM_STATIC_BUF_SIZE (%d) /* measured on the host, the size used is in the compiling log */\n'%(memory),
+        text[start:])
+    with open(name, 'w') as fp:
+        fp.write(text[:start])
+        fp.write('#ifdef NNOM_USING_STATIC_MODEL\n')
+        fp.write(tables)
+        fp.write('static nnom_model_t* nnom_model_create(void)\n{\n')
+        fp.write('\treturn &nnom_model;\n')
+        fp.write('}\n')
+        fp.write('#else\n')
+        fp.write(dynamic)
+        fp.write('#endif\n')
+
+def generate_model(model, x_test, name='weights.h', format='hwc', kld=True, static_model=True):
     shift_list = layers_output_ranges(model, x_test, kld)
     generate_weights(model, name=name, format=format, shift_list=shift_list)
     if(type(model.layers[0]) != InputLayer):
@@ -494,6 +590,7 @@ def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
         fp.write('\n/* weights for each layer */\n')
         LI = {}
         ID = 0
+        symbols = []
         def is_skipable_layer(layer):
             # FIXME: add more that could be skiped
             if('lambda' in layer.name or
@@ -520,9 +617,11 @@ def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
                 if("kernel" in var_name):
                     fp.write('static const int8_t %s_weights[] = %s;\n'%(layer.name, var_name.upper()))
                     fp.write('static const nnom_weight_t %s_w = { (const void*)%s_weights, %s_OUTPUT_RSHIFT};\n'%(layer.name,layer.name, layer.name.upper()))
+                    symbols.append('&%s_w'%(layer.name))
                 elif("bias" in var_name):
                     fp.write('static const int8_t %s_bias[] = %s;\n'%(layer.name, var_name.upper()))
                     fp.write('static const nnom_bias_t %s_b = { (const void*)%s_bias, %s_BIAS_LSHIFT};\n'%(layer.name,layer.name, layer.name.upper()))
+                    symbols.append('&%s_b'%(layer.name))
         fp.write('\n/* nnom model */\n')
         # FIXME: now only support one input and one output
         sz = 1
@@ -533,14 +632,24 @@ def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
         for d in model.output.shape[1:]:
             sz = sz*d
         fp.write('static int8_t nnom_output_data[%d];\n'%(sz))
+        symbols += ['nnom_input_data', 'nnom_output_data']
+        # with static memory, the model needs no heap
+        fp.write('#ifdef NNOM_USING_STATIC_MEMORY\n')
+        fp.write('#ifndef NNOM_STATIC_BUF_SIZE\n')
+        fp.write('#define NNOM_STATIC_BUF_SIZE (%d) /* estimated, the size used is in the compiling log */\n'%(static_buf_size(model)))
+        fp.write('#endif\n')
+        fp.write('static uint8_t nnom_static_buf[NNOM_STATIC_BUF_SIZE];\n')
+        fp.write('#endif\n')
         fp.write('static nnom_model_t* nnom_model_create(void)\n{\n')
         fp.write('\tstatic nnom_model_t model;\n')
         if(ID>32):
-            fp.write('\tnnom_layer_t ** layer = malloc(sizeof(nnom_layer_t *)*%d);\n'%(ID+1))
-            fp.write('\tif(NULL == layer) return NULL;\n')
+            fp.write('\tstatic nnom_layer_t* layer[%d];\n'%(ID+1))
         else:
             fp.write('\tnnom_layer_t* layer[%d];\n'%(ID+1))
-        fp.write('\n\tnew_model(&model);\n\n')
+        fp.write('\n#ifdef NNOM_USING_STATIC_MEMORY\n')
+        fp.write('\tnnom_set_static_buf(nnom_static_buf, sizeof(nnom_static_buf));\n')
+        fp.write('#endif\n')
+        fp.write('\tnew_model(&model);\n\n')
         for layer in L:
             if(is_skipable_layer(layer)):
                 continue
@@ -568,7 +677,7 @@ def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
                 cfg = layer.get_config()
                 if('depthwise' in layer.name):
                     fp.write('\tlayer[{0}] = model.hook(DW_Conv2D({1}, kernel(1,{2}), stride(1,{3}), PADDING_{4}, &{5}_w, &{5}_b), layer[{6}]);\n'.format(
-                        id, 1, cfg['kernel_size'][0], cfg['strides'][0], cfg['padding'].upper(),
+                        id, cfg['depth_multiplier'], cfg['kernel_size'][0], cfg['strides'][0], cfg['padding'].upper(),
                         layer.name, LI[inp][0]))
                 else:
                     fp.write('\tlayer[{0}] = model.hook(Conv2D({1}, kernel(1,{2}), stride(1,{3}), PADDING_{4}, &{5}_w, &{5}_b), layer[{6}]);\n'.format(
@@ -579,7 +688,7 @@ def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
                 cfg = layer.get_config()
                 if ('depthwise' in layer.name):
                     fp.write('\tlayer[{0}] = model.hook(DW_Conv2D({1}, kernel{2}, stride{3}, PADDING_{4}, &{5}_w, &{5}_b), layer[{6}]);\n'.format(
-                        id, 1, cfg['kernel_size'], cfg['strides'], cfg['padding'].upper(),
+                        id, cfg['depth_multiplier'], cfg['kernel_size'], cfg['strides'], cfg['padding'].upper(),
                         layer.name, LI[inp][0]))
                 else:
                     fp.write('\tlayer[{0}] = model.hook(Conv2D({1}, kernel{2}, stride{3}, PADDING_{4}, &{5}_w, &{5}_b), layer[{6}]);\n'.format(
@@ -737,9 +846,9 @@ def generate_model(model, x_test, name='weights.h', format='hwc', kld=True):
         else:
             raise Exception('unsupported output shape of the last layer', layer.name, layer)
         fp.write('\tmodel_compile(&model, layer[0], layer[%s]);\n'%(id+1))
-        if(ID>32):
-            fp.write('\tfree(layer);\n')
         fp.write('\treturn &model;\n}\n')
+    if(static_model):
+        export_static_model(name, symbols)
     with open('.shift_list','w') as fp:
         fp.write(str(shift_list))
 
@@ -66,6 +66,7 @@ typedef enum
 	NNOM_ADD,
 	NNOM_SUB,
 	NNOM_MULT,
+	NNOM_QCONVERT,
 	NNOM_TYPE_MAX
 
 } nnom_layer_type_t;
@@ -98,6 +99,7 @@ typedef enum
 			"Add",          \
 			"Sub",          \
 			"Mult",         \
+			"QConvert",     \
 	}
 extern const char default_layer_names[][12];
 
@@ -184,12 +186,18 @@ typedef struct _nnom_mem_block_t
 	size_t size;
 	uint8_t owners; // how many layers own this block
 	uint8_t state;  // empty? filled? for static nn, currently only used in compiling
+	uint32_t first; // lifetime, from the layer (#) which creates the block
+	uint32_t last;  // to the last layer which uses it
+	size_t offset;  // offset in the network buffer, planned after compiling
+	struct _nnom_mem_block_t *next;
 } nnom_mem_block_t;
 
 typedef struct _nnom_stat_t
 {
 	size_t macc; //num. of operation
-	uint32_t time;
+	uint32_t time;   // us of the last run
+	uint32_t cycles; // cycles of the last run (see nnom_cycles_get())
+	size_t bytes;    // bytes of data moved in one run, inputs, output and weights
 } nnom_layer_stat_t;
 
 typedef struct _nnom_layer_hook_t
@@ -198,6 +206,27 @@ typedef struct _nnom_layer_hook_t
 	nnom_layer_hook_t *next; // next hook include secondary hooked layer
 } nnom_layer_hook_t;
 
+// The place of an io's data inside its memory block.
+// A layer whose only consumer is a concat layer writes its output directly into its slice
+// of the concat output block. The slice starts at offset and, if it is not contiguous,
+// its pixels and rows are pixel_pitch and row_pitch bytes apart. Both pitches are 0 for packed data.
+typedef struct _nnom_io_view_t
+{
+	uint32_t offset;
+	uint32_t row_pitch;
+	uint16_t pixel_pitch;
+} nnom_io_view_t;
+
+// Streaming (see model_run_stream()), for 1D data: a row of columns (time steps).
+// since the last run, the data moved left by shift columns, and its first head and last tail columns are new.
+// the columns in between are the ones of the last run.
+typedef struct _nnom_io_stream_t
+{
+	uint16_t shift;
+	uint16_t head;
+	uint16_t tail;
+} nnom_io_stream_t;
+
 typedef struct _nnom_layer_io_t
 {
 	nnom_layer_hook_t hook;		  // for example: (layer->out)--hook--(layer->in)
@@ -207,6 +236,9 @@ typedef struct _nnom_layer_io_t
 	nnom_shape_t shape;			  // shape of the buf
 	uint8_t type;
 	nnom_qformat_t qfmt;          // the q format of the memory
+	uint8_t elem_size;            // bytes of an element, 1 for q7 and 2 for q15 (see Q15()). 0 is the one of the input, set by the compiler
+	nnom_io_view_t view;          // where the data is in the memory block, set by the compiler
+	nnom_io_stream_t stream;      // which columns are new, in streaming
 } nnom_layer_io_t;
 
 // layers base
@@ -215,6 +247,7 @@ typedef struct _nnom_layer_t
 	nnom_status_t (*run)(nnom_layer_t *layer);				// run method. required
 	nnom_status_t (*comp_out_shape)(nnom_layer_t *layer);	// compute output buffer shape. can be left null, will call default_output_shape()
 	nnom_status_t (*free)(nnom_layer_t *layer);				// a callback to free private resources (comp buf not included) can be left null
+	nnom_status_t (*stream_run)(nnom_layer_t *layer);		// run on the new columns only (see model_run_stream()). can be left null to run the whole layer
 	nnom_buf_t *comp;		   								// computational buf
 	nnom_activation_t *actail; 								// I have an activation, I have a taill, wooo haaaa, acti-tail!!!
 
@@ -259,11 +292,17 @@ typedef struct _nnom_model
 	// callback
 	nnom_status_t (*layer_callback)(nnom_model_t *m, nnom_layer_t *layer);				// layer callback will be called after each layer(after actail). 
 
-	// block memory for layers
-	nnom_mem_block_t blocks[NNOM_BLOCK_NUM];
+	// block memory for layers, one block for each buffer lifetime.
+	// all blocks are placed in one network buffer
+	nnom_mem_block_t *blocks;
+	void *buf;
 
 	size_t total_ops;
 
+	bool is_stream;        // compiled for streaming, the layer outputs are kept between runs
+	bool is_stream_filled; // the layer outputs are the ones of the last complete run
+	bool is_static;        // compiled on the host into static tables (see nnom_export.h), nothing to compile or free
+
 	bool is_inited; //	is this structure initialized
 	bool is_alloc;  //	is this structure allocated by nnom (not by user)
 } nnom_model_t;
@@ -280,9 +319,25 @@ size_t nnom_alignto(size_t value, uint32_t alignment);
 size_t nnom_io_length(nnom_layer_io_t *io);
 size_t nnom_hook_length(nnom_layer_hook_t *hook);
 
+// data of an io, which is not always at the start of its memory block (see nnom_io_view_t)
+void *nnom_io_data(nnom_layer_io_t *io);
+// distance between two pixels and between two rows of the io data, in bytes
+uint16_t nnom_io_pixel_pitch(nnom_layer_io_t *io);
+uint32_t nnom_io_row_pitch(nnom_layer_io_t *io);
+// bytes of the io data, without the gaps of a strided view
+size_t nnom_io_bytes(nnom_layer_io_t *io);
+// whether the io data has gaps, which means only some layers can write it.
+bool nnom_io_is_strided(nnom_layer_io_t *io);
+// mark all the columns of the io data new (see nnom_io_stream_t)
+void nnom_io_stream_new(nnom_layer_io_t *io);
+
 // memory (malloc + memeset 0)
 void *nnom_mem(size_t size);
-	
+
+// static memory (see NNOM_USING_STATIC_MEMORY), the buffer must be set before creating the model.
+void nnom_set_static_buf(void *buf, size_t size);
+void *nnom_static_malloc(size_t size);
+
 // get how much memory has been taken
 size_t nnom_mem_stat(void);
 
@@ -295,6 +350,13 @@ nnom_status_t sequencial_compile(nnom_model_t *m);
 nnom_status_t model_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *output);
 // run a prediction
 nnom_status_t model_run(nnom_model_t *m);
+
+// streaming, for models on a sliding window of 1D data.
+// compile keeping every layer output between runs
+nnom_status_t model_stream_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *output);
+// run after the input window moved left by shift columns (time steps) and shift new columns were put at its end.
+// 1D layers which support streaming only compute their new output columns, the other layers run as usual.
+nnom_status_t model_run_stream(nnom_model_t *m, uint16_t shift);
 // delete model. 
 void model_delete(nnom_model_t *m);
 
@@ -25,6 +25,11 @@ nnom_activation_t *act_relu(void);
 nnom_activation_t *act_sigmoid(int32_t dec_bit);
 nnom_activation_t *act_tanh(int32_t dec_bit);
 
+// run methods of the activations, the static tables of compiled models point to them (see nnom_export.h)
+nnom_status_t relu_run(nnom_layer_t *layer, nnom_activation_t *act);
+nnom_status_t tanh_run(nnom_layer_t *layer, nnom_activation_t *act);
+nnom_status_t sigmoid_run(nnom_layer_t *layer, nnom_activation_t *act);
+
 // direct API
 nnom_status_t act_direct_run(nnom_layer_t *layer, nnom_activation_t *act, void *data, size_t size, nnom_qformat_t fmt);
 
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2018-2019
+ * Jianjia Ma, Wearable Bio-Robotics Group (WBR)
+ * majianjia@live.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __NNOM_EXPORT_H__
+#define __NNOM_EXPORT_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "nnom.h"
+
+// Export of a compiled model as C, on the host only (Makefile.host, it is not in the firmware).
+//
+// The model is compiled on the host, then model_export() writes all its structures as static variables
+// with constant initializers: the layers and their IOs, hooks, computational bufs and activations,
+// the memory blocks placed in the network buffer, and the shortcut list, which is the order of execution.
+// nnom_model is the compiled model, it is not compiled again and nothing of it is allocated at runtime.
+// (see NNOM_USING_STATIC_MODEL)
+//
+// The host must use the NNoM configuration of the target (nnom_port.h), the compiling depends on it.
+// Layers with user functions or states (Lambda, RNN) can not be exported.
+
+// the weights, bias and user buffers are pointed to by their C names
+typedef struct _nnom_export_symbol_t
+{
+	const void *p;
+	const char *name; // e.g. "&conv2d_1_w", "nnom_input_data"
+} nnom_export_symbol_t;
+
+nnom_status_t model_export(nnom_model_t *m, FILE *fp, const nnom_export_symbol_t *symbols, uint32_t num);
+
+#endif
@@ -40,8 +40,28 @@ typedef struct _nnom_conv2d_layer_t
 	uint32_t filter_mult; 							// filter size (for conv) or multilplier (for depthwise)
 	const nnom_weight_t *weights;
 	const nnom_bias_t *bias;
+
+	// the fast CMSIS-NN convolutions need ch_in in multiple of 4 and ch_out in multiple of 2.
+	// for other channels, the weights and bias are padded with zeros to pad_ch_in and pad_ch_out on compiling,
+	// (see conv2d_out_shape()). NULL if not padded.
+	q7_t *pad_weights;
+	q7_t *pad_bias;
+	uint16_t pad_ch_in;
+	uint16_t pad_ch_out;
+
+	// a max pooling or an add layer fused into this conv on compiling (see model_fuse_layers()), NULL if none.
+	// the fused layer keeps its parameters, its input shape is the conv output shape.
+	// its actail is the conv's own activation, which runs before the pooling or adding.
+	nnom_layer_t *fused;
 } nnom_conv2d_layer_t;
 
+// square image, kernel, stride and padding, for the CMSIS-NN functions which take only one dimension
+static inline bool conv2d_is_square(nnom_conv2d_layer_t *cl)
+{
+	return cl->super.in->shape.h == cl->super.in->shape.w && cl->kernel.h == cl->kernel.w &&
+		   cl->stride.h == cl->stride.w && cl->pad.h == cl->pad.w;
+}
+
 typedef struct _nnom_dense_layer_t
 {
 	nnom_layer_t super;
@@ -197,6 +217,11 @@ nnom_layer_t *Mult(int32_t oshift);      // output shift
 // utils
 nnom_layer_t *Flatten(void);
 nnom_layer_t *Concat(int8_t axis);
+nnom_layer_t *QConvert(uint8_t elem_size); // q7 <-> q15, inserted by the compiler between layers of different precisions
+
+// q15 precision for a Conv2D or a Dense layer, its weights and bias must be q15, e.g. Q15(Dense(10, &w, &b)).
+// the q15 data of the layer has 8 more fractional bits than the q7 data of the others.
+nnom_layer_t *Q15(nnom_layer_t *layer);
 
 // -- NN Constructers --
 // conv2d
@@ -20,20 +20,61 @@
 #include <stdio.h>
 
 // memory interfaces
+// with NNOM_USING_STATIC_MEMORY, the models take all their memory from the buffer given to nnom_set_static_buf(),
+// the heap is not used and nothing is freed.
+//#define NNOM_USING_STATIC_MEMORY
+#ifdef NNOM_USING_STATIC_MEMORY
+#define nnom_malloc(n)   	nnom_static_malloc(n)
+#define nnom_free(p)		((void)(p))
+#else
 #define nnom_malloc(n)   	malloc(n) 
 #define nnom_free(p)		free(p)
+#endif
 #define nnom_memset(p,v,s)	memset(p,v,s)
 
+// the models generated with their compiled tables (see nnom_export.h) use them, they are not compiled on the target
+// and take no memory but the one of their tables and their network buffer.
+#define NNOM_USING_STATIC_MODEL
+
 // runtime & debuges
+// nnom_cycles_get() is a free running 32bit counter which times the layers, NNOM_CYCLES_PER_US converts it to us.
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+// Cortex-M3/M4/M7, the DWT cycle counter of the core
+#include "stm32f4xx.h"
+#define nnom_timer_init()	do { CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; } while (0)
+#define nnom_cycles_get()	(DWT->CYCCNT)
+#define NNOM_CYCLES_PER_US	(SystemCoreClock / 1000000)
+#define nnom_us_get()		(HAL_GetTick() * 1000)
+#define nnom_ms_get()		HAL_GetTick()
+#elif defined(__linux__)
+// Linux host, the monotonic clock. A cycle is 1ns (a nominal 1GHz cpu).
+#include <time.h>
+static inline uint32_t nnom_clock_get(uint32_t ns_per_tick)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint32_t)((uint64_t)t.tv_sec * (1000000000 / ns_per_tick) + t.tv_nsec / ns_per_tick);
+}
+#define nnom_timer_init()
+#define nnom_cycles_get()	nnom_clock_get(1)
+#define NNOM_CYCLES_PER_US	(1000)
+#define nnom_us_get()		nnom_clock_get(1000)
+#define nnom_ms_get()		nnom_clock_get(1000000)
+#else
+// no timer
+#define nnom_timer_init()
+#define nnom_cycles_get()	0
+#define NNOM_CYCLES_PER_US	(1)
 #define nnom_us_get()		0
 #define nnom_ms_get()		0
+#endif
 #define NNOM_LOG(...)			printf(__VA_ARGS__)
 
 // NNoM configuration
-#define NNOM_BLOCK_NUM  	(8)		// maximum number of memory block  
 #define DENSE_WEIGHT_OPT 	(1)		// if used fully connected layer optimized weights. 
 
 #define NNOM_USING_CMSIS_NN       // uncomment if use CMSIS-NN for optimation 
+#define NNOM_CONV_CHANNEL_PADDING // with CMSIS-NN, pad odd channels of conv layers to use the fast functions. costs RAM for padded weights.
 
 #endif
 
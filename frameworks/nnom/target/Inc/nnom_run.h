@@ -41,5 +41,13 @@ nnom_status_t concat_run(nnom_layer_t *layer);
 nnom_status_t add_run(nnom_layer_t *layer);
 nnom_status_t sub_run(nnom_layer_t *layer);
 nnom_status_t mult_run(nnom_layer_t *layer);
+nnom_status_t qconvert_run(nnom_layer_t *layer);
+
+// streaming (see model_run_stream())
+nnom_status_t input_stream_run(nnom_layer_t *layer);
+nnom_status_t conv2d_stream_run(nnom_layer_t *layer);
+nnom_status_t rnn_stream_run(nnom_layer_t *layer);
+nnom_status_t activation_stream_run(nnom_layer_t *layer);
+nnom_status_t pool_stream_run(nnom_layer_t *layer);
 
 #endif
@@ -75,6 +75,20 @@ void prediction_summary(nnom_predic_t *pre);
 // return NN_ARGUMENT_ERROR if parameter error
 nnom_status_t nnom_predic(nnom_model_t *m, uint32_t *label, float *prob);
 
+// print the stats of the last run, time, cycles, MACs, MACs/cycle and data moved of each layer
 void model_stat(nnom_model_t *m);
 
+// print the same stats as CSV, one line per layer:
+// layer,type,time_us,cycles,macc,bytes
+void model_stat_csv(nnom_model_t *m);
+
+// write the stats to buf in binary, all values are little-endian uint32.
+// header: magic, version, number of layers, cycles per us
+// each layer: type, time (us), cycles, macc, bytes
+// return the size written, 0 if buf is smaller than NNOM_STAT_DUMP_SIZE(number of layers)
+#define NNOM_STAT_DUMP_MAGIC		(0x54534e4e) // "NNST"
+#define NNOM_STAT_DUMP_VERSION		(1)
+#define NNOM_STAT_DUMP_SIZE(layers)	(4 * 4 + (layers) * 5 * 4)
+size_t model_stat_dump(nnom_model_t *m, void *buf, size_t size);
+
 #endif
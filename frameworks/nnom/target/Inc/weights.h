@@ -59,11 +59,427 @@ static const nnom_bias_t dense_1_b = { (const void*)dense_1_bias, DENSE_1_BIAS_L
 /* nnom model */
 static int8_t nnom_input_data[784];
 static int8_t nnom_output_data[10];
+#ifdef NNOM_USING_STATIC_MODEL
+/* compiled model, 6 layers, network buffer 18828 bytes */
+static uint32_t nnom_buf[4707];
+static nnom_io_layer_t nnom_layer_0;
+static nnom_conv2d_layer_t nnom_layer_1;
+static nnom_dense_layer_t nnom_layer_2;
+static nnom_layer_t nnom_layer_3;
+static nnom_io_layer_t nnom_layer_4;
+static nnom_maxpool_layer_t nnom_layer_5;
+static nnom_layer_io_t nnom_io_0;
+static nnom_layer_io_t nnom_io_1;
+static nnom_layer_io_t nnom_io_2;
+static nnom_layer_io_t nnom_io_3;
+static nnom_layer_io_t nnom_io_4;
+static nnom_layer_io_t nnom_io_5;
+static nnom_layer_io_t nnom_io_6;
+static nnom_layer_io_t nnom_io_7;
+static nnom_layer_io_t nnom_io_8;
+static nnom_layer_io_t nnom_io_9;
+static nnom_layer_io_t nnom_io_10;
+static nnom_layer_io_t nnom_io_11;
+static nnom_mem_block_t nnom_blk_0;
+static nnom_mem_block_t nnom_blk_1;
+static nnom_mem_block_t nnom_blk_2;
+static nnom_mem_block_t nnom_blk_3;
+static nnom_mem_block_t nnom_blk_4;
+static nnom_mem_block_t nnom_blk_5;
+static nnom_buf_t nnom_comp_0;
+static nnom_buf_t nnom_comp_1;
+static nnom_buf_t nnom_comp_2;
+static nnom_activation_t nnom_act_0;
+static nnom_io_layer_t nnom_layer_0 = {
+	.super = {
+		.run = input_run,
+		.stream_run = input_stream_run,
+		.comp = NULL,
+		.actail = NULL,
+		.type = NNOM_INPUT,
+		.in = &nnom_io_0,
+		.out = &nnom_io_1,
+		.stat = {.macc = 0, .bytes = 1568},
+		.shortcut = &nnom_layer_1.super,
+	},
+	.shape = {28, 28, 1},
+	.buf = nnom_input_data,
+};
+static nnom_conv2d_layer_t nnom_layer_1 = {
+	.super = {
+		.run = conv2d_run,
+		.stream_run = conv2d_stream_run,
+		.comp = &nnom_comp_0,
+		.actail = NULL,
+		.type = NNOM_CONV_2D,
+		.in = &nnom_io_2,
+		.out = &nnom_io_3,
+		.stat = {.macc = 225792, .bytes = 7376},
+		.shortcut = &nnom_layer_2.super,
+	},
+	.kernel = {3, 3, 1},
+	.stride = {1, 1, 1},
+	.output_shift = 8,
+	.bias_shift = 5,
+	.pad = {1, 1, 0},
+	.padding_type = PADDING_SAME,
+	.filter_mult = 32,
+	.weights = &conv2d_1_w,
+	.bias = &conv2d_1_b,
+	.pad_weights = NULL,
+	.pad_bias = NULL,
+	.pad_ch_in = 0,
+	.pad_ch_out = 0,
+	.fused = &nnom_layer_5.super,
+};
+static nnom_dense_layer_t nnom_layer_2 = {
+	.super = {
+		.run = dense_run,
+		.comp = &nnom_comp_2,
+		.actail = NULL,
+		.type = NNOM_DENSE,
+		.in = &nnom_io_6,
+		.out = &nnom_io_7,
+		.stat = {.macc = 62720, .bytes = 69012},
+		.shortcut = &nnom_layer_3,
+	},
+	.output_unit = 10,
+	.weights = &dense_1_w,
+	.bias = &dense_1_b,
+	.output_shift = 11,
+	.bias_shift = 2,
+};
+static nnom_layer_t nnom_layer_3 = {
+	.run = softmax_run,
+	.comp = NULL,
+	.actail = NULL,
+	.type = NNOM_SOFTMAX,
+	.in = &nnom_io_8,
+	.out = &nnom_io_9,
+	.stat = {.macc = 0, .bytes = 20},
+	.shortcut = &nnom_layer_4.super,
+};
+static nnom_io_layer_t nnom_layer_4 = {
+	.super = {
+		.run = output_run,
+		.comp = NULL,
+		.actail = NULL,
+		.type = NNOM_OUTPUT,
+		.in = &nnom_io_10,
+		.out = &nnom_io_11,
+		.stat = {.macc = 0, .bytes = 20},
+		.shortcut = NULL,
+	},
+	.shape = {10, 1, 1},
+	.buf = nnom_output_data,
+};
+static nnom_maxpool_layer_t nnom_layer_5 = {
+	.super = {
+		.run = maxpool_run,
+		.stream_run = pool_stream_run,
+		.comp = &nnom_comp_1,
+		.actail = &nnom_act_0,
+		.type = NNOM_MAXPOOL,
+		.in = &nnom_io_4,
+		.out = &nnom_io_5,
+		.stat = {.macc = 0, .bytes = 0},
+		.shortcut = NULL,
+	},
+	.kernel = {2, 2, 1},
+	.stride = {2, 2, 1},
+	.pad = {0, 0, 0},
+	.padding_type = PADDING_VALID,
+};
+static nnom_layer_io_t nnom_io_0 = {
+	.hook = {
+		.io = NULL,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_0,
+	.owner = &nnom_layer_0.super,
+	.shape = {28, 28, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_1 = {
+	.hook = {
+		.io = &nnom_io_2,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_0,
+	.owner = &nnom_layer_0.super,
+	.shape = {28, 28, 1},
+	.type = LAYER_BUF_NULL,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_2 = {
+	.hook = {
+		.io = &nnom_io_1,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_0,
+	.owner = &nnom_layer_1.super,
+	.shape = {28, 28, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_3 = {
+	.hook = {
+		.io = &nnom_io_6,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_2,
+	.owner = &nnom_layer_1.super,
+	.shape = {14, 14, 32},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_4 = {
+	.hook = {
+		.io = &nnom_io_3,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = NULL,
+	.owner = &nnom_layer_5.super,
+	.shape = {28, 28, 32},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_5 = {
+	.hook = {
+		.io = NULL,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = NULL,
+	.owner = &nnom_layer_5.super,
+	.shape = {14, 14, 32},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_6 = {
+	.hook = {
+		.io = &nnom_io_3,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_2,
+	.owner = &nnom_layer_2.super,
+	.shape = {6272, 1, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_7 = {
+	.hook = {
+		.io = &nnom_io_8,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_4,
+	.owner = &nnom_layer_2.super,
+	.shape = {10, 1, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_8 = {
+	.hook = {
+		.io = &nnom_io_7,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_4,
+	.owner = &nnom_layer_3,
+	.shape = {10, 1, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_9 = {
+	.hook = {
+		.io = &nnom_io_10,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_5,
+	.owner = &nnom_layer_3,
+	.shape = {10, 1, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_10 = {
+	.hook = {
+		.io = &nnom_io_9,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_5,
+	.owner = &nnom_layer_4.super,
+	.shape = {10, 1, 1},
+	.type = LAYER_BUF_TEMP,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_layer_io_t nnom_io_11 = {
+	.hook = {
+		.io = NULL,
+		.next = NULL,
+	},
+	.aux = NULL,
+	.mem = &nnom_blk_5,
+	.owner = &nnom_layer_4.super,
+	.shape = {10, 1, 1},
+	.type = LAYER_BUF_NULL,
+	.qfmt = {0, 0},
+	.elem_size = 1,
+	.view = {0, 0, 0},
+	.stream = {0, 0, 0},
+};
+static nnom_mem_block_t nnom_blk_0 = {
+	.blk = (uint8_t *)nnom_buf + 1828,
+	.size = 784,
+	.owners = 0,
+	.state = NNOM_BUF_EMPTY,
+	.first = 1,
+	.last = 2,
+	.offset = 1828,
+	.next = &nnom_blk_1,
+};
+static nnom_mem_block_t nnom_blk_1 = {
+	.blk = (uint8_t *)nnom_buf + 0,
+	.size = 1828,
+	.owners = 0,
+	.state = NNOM_BUF_EMPTY,
+	.first = 2,
+	.last = 2,
+	.offset = 0,
+	.next = &nnom_blk_2,
+};
+static nnom_mem_block_t nnom_blk_2 = {
+	.blk = (uint8_t *)nnom_buf + 12544,
+	.size = 6272,
+	.owners = 0,
+	.state = NNOM_BUF_EMPTY,
+	.first = 2,
+	.last = 3,
+	.offset = 12544,
+	.next = &nnom_blk_3,
+};
+static nnom_mem_block_t nnom_blk_3 = {
+	.blk = (uint8_t *)nnom_buf + 0,
+	.size = 12544,
+	.owners = 0,
+	.state = NNOM_BUF_EMPTY,
+	.first = 3,
+	.last = 3,
+	.offset = 0,
+	.next = &nnom_blk_4,
+};
+static nnom_mem_block_t nnom_blk_4 = {
+	.blk = (uint8_t *)nnom_buf + 18816,
+	.size = 12,
+	.owners = 0,
+	.state = NNOM_BUF_EMPTY,
+	.first = 3,
+	.last = 4,
+	.offset = 18816,
+	.next = &nnom_blk_5,
+};
+static nnom_mem_block_t nnom_blk_5 = {
+	.blk = (uint8_t *)nnom_buf + 0,
+	.size = 12,
+	.owners = 1,
+	.state = NNOM_BUF_FILLED,
+	.first = 4,
+	.last = 4294967295,
+	.offset = 0,
+	.next = NULL,
+};
+static nnom_buf_t nnom_comp_0 = {
+	.mem = &nnom_blk_1,
+	.shape = {1828, 1, 1},
+	.type = LAYER_BUF_TEMP,
+};
+static nnom_buf_t nnom_comp_1 = {
+	.mem = NULL,
+	.shape = {0, 0, 0},
+	.type = LAYER_BUF_TEMP,
+};
+static nnom_buf_t nnom_comp_2 = {
+	.mem = &nnom_blk_3,
+	.shape = {12544, 1, 1},
+	.type = LAYER_BUF_TEMP,
+};
+static nnom_activation_t nnom_act_0 = {
+	.run = relu_run,
+	.data = NULL,
+	.size = 0,
+	.type = ACT_RELU,
+	.fmt = {0, 0},
+};
+static nnom_model_t nnom_model = {
+	.head = &nnom_layer_0.super,
+	.tail = &nnom_layer_4.super,
+	.blocks = &nnom_blk_0,
+	.buf = nnom_buf,
+	.total_ops = 288512,
+	.is_stream = false,
+	.is_static = true,
+};
+static nnom_model_t* nnom_model_create(void)
+{
+	return &nnom_model;
+}
+#else
+#ifdef NNOM_USING_STATIC_MEMORY
+#ifndef NNOM_STATIC_BUF_SIZE
+#define NNOM_STATIC_BUF_SIZE (20852) /* measured on the host, the size used is in the compiling log */
+#endif
+static uint8_t nnom_static_buf[NNOM_STATIC_BUF_SIZE];
+#endif
 static nnom_model_t* nnom_model_create(void)
 {
 	static nnom_model_t model;
 	nnom_layer_t* layer[7];
 
+#ifdef NNOM_USING_STATIC_MEMORY
+	nnom_set_static_buf(nnom_static_buf, sizeof(nnom_static_buf));
+#endif
 	new_model(&model);
 
 	layer[0] = Input(shape(28, 28, 1), nnom_input_data);
@@ -76,3 +492,4 @@ static nnom_model_t* nnom_model_create(void)
 	model_compile(&model, layer[0], layer[6]);
 	return &model;
 }
+#endif
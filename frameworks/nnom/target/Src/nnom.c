@@ -39,6 +39,29 @@ size_t nnom_mem_stat(void)
 	return nnom_memory_taken;
 }
 
+// the static memory, which is taken from the start to the end and never given back.
+static uint8_t *nnom_static_buf = NULL;
+static size_t nnom_static_buf_size = 0;
+static size_t nnom_static_buf_curr = 0;
+
+void nnom_set_static_buf(void *buf, size_t size)
+{
+	nnom_static_buf = buf;
+	nnom_static_buf_size = size;
+	nnom_static_buf_curr = 0;
+}
+
+void *nnom_static_malloc(size_t size)
+{
+	// aligned to the pointer size, the buffer itself might not be aligned.
+	size_t curr = nnom_alignto((size_t)nnom_static_buf + nnom_static_buf_curr, sizeof(void *) > 4 ? sizeof(void *) : 4)
+		- (size_t)nnom_static_buf;
+	if (nnom_static_buf == NULL || curr + size > nnom_static_buf_size)
+		return NULL;
+	nnom_static_buf_curr = curr + size;
+	return nnom_static_buf + curr;
+}
+
 // get the size of an module model
 static size_t io_mem_size(nnom_layer_io_t *io)
 {
@@ -47,7 +70,7 @@ static size_t io_mem_size(nnom_layer_io_t *io)
 	{
 		while (io)
 		{
-			size += shape_size(&io->shape);
+			size += nnom_io_bytes(io);
 			io = io->aux;
 		}
 	}
@@ -170,8 +193,9 @@ static nnom_layer_io_t *allocate_io(nnom_layer_io_t *io)
 		io->aux = nnom_mem(sizeof(nnom_layer_io_t));
 		if (io->aux == NULL)
 			return NULL;
-		// the owner for new io is inherited
+		// the owner and the precision for new io are inherited
 		io->aux->owner = io->owner;
+		io->aux->elem_size = io->elem_size;
 		return io->aux;
 	}
 }
@@ -341,7 +365,7 @@ void model_delete(nnom_model_t *m)
 {
 	nnom_layer_t *layer;
 	nnom_layer_t *next;
-	if (m == NULL)
+	if (m == NULL || m->is_static)
 		return;
 
 	// uses shortcut list to iterate the model,
@@ -357,8 +381,14 @@ void model_delete(nnom_model_t *m)
 		layer = next;
 	}
 
-	// free the memory blocks for the network's buffer
-	nnom_free(m->blocks->blk);
+	// free the network's buffer and its memory blocks
+	nnom_free(m->buf);
+	while (m->blocks)
+	{
+		nnom_mem_block_t *next_block = m->blocks->next;
+		nnom_free(m->blocks);
+		m->blocks = next_block;
+	}
 
 	// free model instance itself
 	if (m->is_alloc)
@@ -370,46 +400,57 @@ void model_delete(nnom_model_t *m)
 	return;
 }
 
-// find an available memory block.
-static nnom_mem_block_t *allocate_block(nnom_mem_block_t *list)
+// create a new memory block, which lives from the current layer (time) until it is released by its last owner.
+// blocks are not reused while compiling, they get their place in the network buffer from mem_plan().
+static nnom_mem_block_t *allocate_block(nnom_mem_block_t **list, uint32_t time)
 {
-	nnom_mem_block_t *free = NULL;
-	uint32_t idx;
-
-	for (idx = 0; idx < NNOM_BLOCK_NUM; idx++)
-	{
-		if (list[idx].owners == 0)
-			break;
-	}
-	free = &list[idx];
-	return free;
+	nnom_mem_block_t *block = nnom_mem(sizeof(nnom_mem_block_t));
+	if (block == NULL)
+		return NULL;
+	block->first = time;
+	block->last = time;
+	// add to the end of the list
+	while (*list != NULL)
+		list = &(*list)->next;
+	*list = block;
+	return block;
 }
 
-static void release_block(nnom_mem_block_t *block)
+static void release_block(nnom_mem_block_t *block, uint32_t time)
 {
 	if (block->owners > 0)
 		block->owners -= 1;
 	if (block->owners == 0)
 		block->state = NNOM_BUF_EMPTY;
+	// the block lives at least until this layer has run
+	if (time > block->last)
+		block->last = time;
 }
 
-static void release_input_mem(nnom_layer_t *layer)
+// the block lives as long as the model, its data is kept between runs.
+static void block_keep(nnom_mem_block_t *block)
+{
+	block->first = 0;
+	block->last = (uint32_t)-1;
+}
+
+static void release_input_mem(nnom_layer_t *layer, uint32_t time)
 {
 	nnom_layer_io_t *in;
 	// release all input of buf
 	in = layer->in;
 	while (in != NULL)
 	{
-		release_block(in->mem);
+		release_block(in->mem, time);
 		in = in->aux;
 	}
 }
-static void release_comp_mem(nnom_layer_t *layer)
+static void release_comp_mem(nnom_layer_t *layer, uint32_t time)
 {
 	// release computational buf if exist
 	if (layer->comp != NULL)
 	{
-		release_block(layer->comp->mem);
+		release_block(layer->comp->mem, time);
 	}
 }
 
@@ -442,6 +483,42 @@ size_t nnom_hook_length(nnom_layer_hook_t *hook)
 	return num;
 }
 
+void *nnom_io_data(nnom_layer_io_t *io)
+{
+	return (uint8_t *)io->mem->blk + io->view.offset;
+}
+
+uint16_t nnom_io_pixel_pitch(nnom_layer_io_t *io)
+{
+	if (io->view.pixel_pitch != 0)
+		return io->view.pixel_pitch;
+	return io->shape.c;
+}
+
+uint32_t nnom_io_row_pitch(nnom_layer_io_t *io)
+{
+	if (io->view.row_pitch != 0)
+		return io->view.row_pitch;
+	return io->shape.w * nnom_io_pixel_pitch(io);
+}
+
+size_t nnom_io_bytes(nnom_layer_io_t *io)
+{
+	return shape_size(&io->shape) * io->elem_size;
+}
+
+bool nnom_io_is_strided(nnom_layer_io_t *io)
+{
+	return io->view.pixel_pitch != 0 || io->view.row_pitch != 0;
+}
+
+void nnom_io_stream_new(nnom_layer_io_t *io)
+{
+	io->stream.shift = 0;
+	io->stream.head = io->shape.w;
+	io->stream.tail = 0;
+}
+
 // The shortcut version of find_last() method. 
 // must be used after compiling. 
 static nnom_layer_t *layer_shortcut_find_last(nnom_layer_t *start)
@@ -517,22 +594,65 @@ static void print_layer_info(nnom_layer_t *layer, uint32_t layer_count)
 	NNOM_LOG("(%6d,%6d,%6d)", in_size, out_size, compsize);
 }
 
-static void print_memory_block_info(nnom_mem_block_t *block_pool)
+static void print_memory_block_info(nnom_mem_block_t *block_list)
 {
-	// show the memory blocks's lifetime (number of owners)
-	NNOM_LOG("   ");
-	for (int i = 0; i < NNOM_BLOCK_NUM; i++)
+	// show the lifetime (number of owners) of the blocks in use
+	NNOM_LOG("    ");
+	for (nnom_mem_block_t *block = block_list; block != NULL; block = block->next)
 	{
-		if (i % 4 == 0)
-			NNOM_LOG(" ");
-		if (block_pool[i].owners)
-			NNOM_LOG("%d ", block_pool[i].owners);
-		else
-			NNOM_LOG("- ");
+		if (block->owners)
+			NNOM_LOG("%d ", block->owners);
 	}
 	NNOM_LOG("\n");
 }
 
+// whether the layer can write its output through a strided view (see nnom_io_view_t).
+// Only the local implementations take output pitches, CMSIS-NN writes packed outputs.
+static bool layer_writes_strided(nnom_layer_t *layer)
+{
+#ifdef NNOM_USING_CMSIS_NN
+	return false;
+#else
+	// neither do the q15 ones
+	if (layer->out->elem_size != sizeof(q7_t))
+		return false;
+	// fused convs write their output packed (see conv2d_fused_run())
+	if (layer->type == NNOM_CONV_2D || layer->type == NNOM_DW_CONV_2D)
+		return ((nnom_conv2d_layer_t *)layer)->fused == NULL;
+	return layer->type == NNOM_MAXPOOL || layer->type == NNOM_AVGPOOL;
+#endif
+}
+
+// A layer whose output is only used by a concat layer can write it straight into its slice of the
+// concat output block. That saves the copy in concat_run() and the memory block of the output.
+// return the concat layer, or NULL if the output needs a block of its own.
+static nnom_layer_t *find_concat_consumer(nnom_layer_t *layer)
+{
+	nnom_layer_t *concat;
+	nnom_concat_layer_t *cl;
+	uint32_t blocks;
+
+	if (layer->out->aux != NULL || layer->out->hook.next != NULL || layer->out->hook.io == NULL)
+		return NULL;
+	concat = layer->out->hook.io->owner;
+	if (concat->type != NNOM_CONCAT)
+		return NULL;
+	// single buf layers pass their input through, and concat layers would need nested views.
+	if (layer->in->type == LAYER_BUF_NULL || layer->out->type == LAYER_BUF_NULL || layer->type == NNOM_CONCAT)
+		return NULL;
+
+	// the slice is contiguous if all axes before the concat axis are 1.
+	cl = (nnom_concat_layer_t *)concat;
+	blocks = 1;
+	if (cl->axis >= 1)
+		blocks *= layer->out->shape.h;
+	if (cl->axis >= 2)
+		blocks *= layer->out->shape.w;
+	if (blocks > 1 && !layer_writes_strided(layer))
+		return NULL;
+	return concat;
+}
+
 // This is a nested called functions.
 // to analyse the topology of the model, calculate the output_shape of each layer and create shortcut lists.
 // Nest will happend when a layer have multiple output module or mutiple output hooks.
@@ -540,7 +660,7 @@ static void print_memory_block_info(nnom_mem_block_t *block_pool)
 // 	1) if the layer has multiple input but not all of them are filled by last layers. returns NN_MORE_TODO
 //	2) if all the output hooked are nested called. return NN_SUCCESS
 //	3) if the layer is output layer. return NN_SUCCESS
-nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool, uint32_t *layer_count)
+nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t **block_list, uint32_t *layer_count)
 {
 	size_t mem_size = 0;
 	nnom_layer_t *layer = start;
@@ -552,6 +672,7 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 	nnom_mem_block_t *out_blk;
 	
 	uint32_t local_layer_count = 1;
+	uint32_t time;
 	
 	if(layer_count == NULL)
 		layer_count = &local_layer_count;
@@ -563,6 +684,8 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 	{
 		// check input
 		in = layer->in;
+		// the number of the layer is the time in the lifetime of memory blocks
+		time = *layer_count;
 
 		// check if this layer is the input layer
 		// the first layer has no input hooked, and the io is not initialized
@@ -571,9 +694,11 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 			// if the input is not initalized
 			if (in->mem == NULL)
 			{
-				in_blk = allocate_block(block_pool);
+				in_blk = allocate_block(block_list, time);
+				if (in_blk == NULL)
+					return NN_NO_MEMORY;
 				in_blk->owners += 1; // add 1
-				mem_size = nnom_alignto(shape_size(&in->shape), 4);
+				mem_size = nnom_alignto(nnom_io_bytes(in), 4);
 				in_blk->size = mem_size > in_blk->size ? mem_size : in_blk->size;
 				// set the blk to the layer IO
 				in->mem = in_blk;
@@ -615,6 +740,9 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 
 		// 1. calculate output shape while all inputs are filled
 		layer->comp_out_shape(layer);
+		// layers with weights count their data in comp_out_shape(), the others only move their I/O.
+		if (layer->stat.bytes == 0)
+			layer->stat.bytes = io_mem_size(layer->in) + io_mem_size(layer->out);
 
 		// 2. add to shortcut list. 
 		layer_shortcut_add(start, layer);
@@ -623,13 +751,18 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 		if (layer->comp != NULL)
 		//if (shape_size(&layer->comp->shape) > 0)
 		{
-			layer->comp->mem = allocate_block(block_pool);
+			layer->comp->mem = allocate_block(block_list, time);
+			if (layer->comp->mem == NULL)
+				return NN_NO_MEMORY;
 			layer->comp->mem->owners += 1; // add us to buffer users
 			layer->comp->mem->state = NNOM_BUF_FILLED;
 			// record maximum mem size in this block
 			mem_size = nnom_alignto(shape_size(&layer->comp->shape), 4);
 			layer->comp->mem->size =
 				mem_size > layer->comp->mem->size ? mem_size : layer->comp->mem->size;
+			// such as the RNN states
+			if (layer->comp->type == LAYER_BUF_RESERVED)
+				block_keep(layer->comp->mem);
 		}
 
 		// print current layer's info. 
@@ -652,32 +785,48 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 				layer->out->mem = layer->in->mem;
 				
 				// print memory before release
-				print_memory_block_info(block_pool);
+				print_memory_block_info(*block_list);
 				// computational buf
-				release_comp_mem(layer);
+				release_comp_mem(layer, time);
 			}
 			// not a single buf layer
 			else
 			{
-				// allocate mem block for the output
-				out_blk = allocate_block(block_pool);
+				nnom_layer_t *concat = find_concat_consumer(layer);
+				if (concat != NULL)
+				{
+					// write into the output block of the concat layer, which is allocated by the first of its
+					// inputs. The concat layer sizes it and places the inputs in it (concatenate_out_shape()).
+					if (concat->out->mem == NULL)
+						concat->out->mem = allocate_block(block_list, time);
+					out_blk = concat->out->mem;
+				}
+				// otherwise, allocate mem block for the output
+				else if (layer->out->mem != NULL)
+					// the inputs of a concat layer have allocated it already
+					out_blk = layer->out->mem;
+				else
+					out_blk = allocate_block(block_list, time);
 				if (out_blk == NULL)
 					return NN_NO_MEMORY;
 				// set the life time, only one hooked layer, so the life time is 1
-				out_blk->owners = 1;
+				out_blk->owners += 1;
 				out_blk->state = NNOM_BUF_FILLED; // marked filled
 				// record maximum mem size in this block
-				mem_size = nnom_alignto(shape_size(&layer->out->shape), 4);
-				out_blk->size = mem_size > out_blk->size ? mem_size : out_blk->size;
+				if (concat == NULL)
+				{
+					mem_size = nnom_alignto(nnom_io_bytes(layer->out), 4);
+					out_blk->size = mem_size > out_blk->size ? mem_size : out_blk->size;
+				}
 				// set the blk to the layer IO
 				layer->out->mem = out_blk;
 
 				// once we allocate for output, we can now release input and comput.
 				// print memory before release
-				print_memory_block_info(block_pool);
+				print_memory_block_info(*block_list);
 				// release input mem and comp mem
-				release_input_mem(layer);
-				release_comp_mem(layer);
+				release_input_mem(layer, time);
+				release_comp_mem(layer, time);
 			}
 		}
 		// Multiple output and/or mutiple hooks
@@ -693,10 +842,10 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 				layer->out->mem->state = NNOM_BUF_FILLED;
 				
 				// print memory before release
-				print_memory_block_info(block_pool);
+				print_memory_block_info(*block_list);
 				// release computational buff and input buffer 
-				release_input_mem(layer);
-				release_comp_mem(layer);
+				release_input_mem(layer, time);
+				release_comp_mem(layer, time);
 			}
 			// mutiple buf layer. (I/O use different memory blocks)
 			else
@@ -705,25 +854,26 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 				out = layer->out;
 				while (out != NULL && out->hook.io != NULL) // the output layer have no output IO
 				{
-					// assign new block
-					out->mem = allocate_block(block_pool);
+					// assign new block, unless the inputs of a concat layer have allocated it already
+					if (out->mem == NULL)
+						out->mem = allocate_block(block_list, time);
 					if (out->mem == NULL)
 						return NN_NO_MEMORY;
 					// record maximum mem size in this block
-					mem_size = nnom_alignto(shape_size(&out->shape), 4);
+					mem_size = nnom_alignto(nnom_io_bytes(out), 4);
 					out->mem->size = mem_size > out->mem->size ? mem_size : out->mem->size;
 					// keep the block untill the last hooked layer is called.
-					out->mem->owners = nnom_hook_length(&out->hook); // set lifetime of the buffer = the num of hooked layers
+					out->mem->owners += nnom_hook_length(&out->hook); // set lifetime of the buffer = the num of hooked layers
 					out->mem->state = NNOM_BUF_FILLED;
 
 					out = out->aux;
 				}
 				// once we allocate for output, we can now release input and comput (or reduce the lifetime).
 				// print memory before release
-				print_memory_block_info(block_pool);
+				print_memory_block_info(*block_list);
 				// release input mem and comp mem
-				release_input_mem(layer);
-				release_comp_mem(layer);
+				release_input_mem(layer, time);
+				release_comp_mem(layer, time);
 			}
 
 			// 5.12 nested call the hooked output layers (if there are > 1 hooked to the output of this layer)
@@ -743,7 +893,7 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 					result = layer_shortcut_add(layer, hook->io->owner);
 					if (result == NN_SUCCESS)
 						// nested call only when the layer hasnt been compiled
-						compile_layers(hook->io->owner, block_pool, layer_count);
+						compile_layers(hook->io->owner, block_list, layer_count);
 					// next hook
 					hook = hook->next;
 				}
@@ -773,36 +923,116 @@ nnom_status_t compile_layers(nnom_layer_t *start, nnom_mem_block_t *block_pool,
 	return NN_SUCCESS;
 }
 
+static bool lifetime_overlap(nnom_mem_block_t *a, nnom_mem_block_t *b)
+{
+	return a->first <= b->last && b->first <= a->last;
+}
+
+// place the blocks in the network buffer. blocks which are alive at the same time must not overlap.
+// greedy by size: from the largest to the smallest, each block goes to the lowest offset where it
+// doesn't overlap the blocks placed before.
+// return the size of the network buffer
+static size_t mem_plan(nnom_mem_block_t *list)
+{
+	const size_t unplaced = (size_t)-1;
+	nnom_mem_block_t *block;
+	nnom_mem_block_t *placed;
+	size_t total_mem = 0;
+	size_t offset;
+	bool moved;
+
+	for (block = list; block != NULL; block = block->next)
+	{
+		block->offset = unplaced;
+		// blocks still owned after compiling (the model's output) live until the end.
+		if (block->owners > 0)
+			block->last = (uint32_t)-1;
+	}
+
+	while (1)
+	{
+		// the largest of the remaining blocks
+		nnom_mem_block_t *largest = NULL;
+		for (block = list; block != NULL; block = block->next)
+			if (block->offset == unplaced && (largest == NULL || block->size > largest->size))
+				largest = block;
+		if (largest == NULL)
+			break;
+		block = largest;
+
+		// move up until it doesn't overlap any placed block
+		offset = 0;
+		do {
+			moved = false;
+			for (placed = list; placed != NULL && block->size > 0; placed = placed->next)
+			{
+				if (placed->offset == unplaced || placed->size == 0 || !lifetime_overlap(block, placed))
+					continue;
+				if (offset < placed->offset + placed->size && placed->offset < offset + block->size)
+				{
+					offset = placed->offset + placed->size;
+					moved = true;
+				}
+			}
+		} while (moved);
+
+		block->offset = offset;
+		if (offset + block->size > total_mem)
+			total_mem = offset + block->size;
+	}
+	return total_mem;
+}
+
+// the memory no plan can go below: the largest sum of the blocks alive at the same time.
+static size_t mem_lower_bound(nnom_mem_block_t *list)
+{
+	nnom_mem_block_t *block;
+	nnom_mem_block_t *alive;
+	size_t bound = 0;
+
+	// the sum only increases when a block is created, so check at the creation of each block.
+	for (block = list; block != NULL; block = block->next)
+	{
+		size_t sum = 0;
+		for (alive = list; alive != NULL; alive = alive->next)
+			if (alive->first <= block->first && block->first <= alive->last)
+				sum += alive->size;
+		if (sum > bound)
+			bound = sum;
+	}
+	return bound;
+}
+
 size_t mem_analysis_result(nnom_model_t *m)
 {
-	uint32_t index;
-	uint32_t total_mem = 0;
-	NNOM_LOG("Memory cost by each block:\n ");
+	uint32_t index = 0;
+	size_t total_mem;
+	nnom_mem_block_t *block;
+
+	total_mem = mem_plan(m->blocks);
+
+	NNOM_LOG("Memory cost by each block (size@offset):\n ");
 	// print size of memory blocks
-	for (index = 0; index < NNOM_BLOCK_NUM; index++)
+	for (block = m->blocks; block != NULL; block = block->next, index++)
 	{
-		total_mem += m->blocks[index].size;
-		NNOM_LOG("blk_%d:%d  ", index, m->blocks[index].size);
+		NNOM_LOG("blk_%d:%d@%d  ", (int)index, (int)block->size, (int)block->offset);
+		if (index % 8 == 7 && block->next != NULL)
+			NNOM_LOG("\n ");
 	}
 	// size of total memory cost by networks buffer
-	NNOM_LOG("\n Total memory cost by network buffers: %d bytes\n", total_mem);
+	NNOM_LOG("\n Total memory cost by network buffers: %d bytes (lower bound %d bytes)\n",
+		(int)total_mem, (int)mem_lower_bound(m->blocks));
 
 	return total_mem;
 }
 
-// allocate memory, and set them to each block according to the mem analysis results.
+// set each block to its place in the network buffer, according to the mem analysis results.
 nnom_status_t block_mem_set(nnom_model_t *m, void *buf)
 {
-	uint32_t index;
-	uint32_t mem_offset = 0;
+	nnom_mem_block_t *block;
 
-	for (index = 0; index < NNOM_BLOCK_NUM; index++)
-	{
-		if (m->blocks[index].size == 0)
-			break;
-		m->blocks[index].blk = (void *)((unsigned long)buf + mem_offset);
-		mem_offset += m->blocks[index].size;
-	}
+	for (block = m->blocks; block != NULL; block = block->next)
+		block->blk = (void *)((unsigned long)buf + block->offset);
 	return NN_SUCCESS;
 }
 
@@ -820,7 +1050,7 @@ nnom_status_t set_tailed_activation(nnom_model_t *m)
 	{
 		if (layer->actail != NULL)
 		{
-			layer->actail->data = layer->out->mem->blk;
+			layer->actail->data = nnom_io_data(layer->out);
 			layer->actail->size = shape_size(&layer->out->shape);
 			// if actail has its own shifting, then leave it as it is. otherwise set it to same as output
 			if(layer->actail->fmt.m == 0 && layer->actail->fmt.n == 0)
@@ -851,6 +1081,243 @@ static uint64_t model_set_ops(nnom_model_t *m)
 	return total_ops;
 }
 
+// the layer after a layer with a single output and a single hook, NULL otherwise.
+static nnom_layer_t *single_consumer(nnom_layer_t *layer)
+{
+	if (layer->out->aux != NULL || layer->out->hook.next != NULL || layer->out->hook.io == NULL)
+		return NULL;
+	return layer->out->hook.io->owner;
+}
+
+// hook the layers after "from" to the output of "to", "from" is left with no output hooked.
+static void layer_take_consumers(nnom_layer_t *to, nnom_layer_t *from)
+{
+	nnom_layer_hook_t *hook;
+
+	to->out->hook = from->out->hook;
+	from->out->hook.io = NULL;
+	from->out->hook.next = NULL;
+	for (hook = &to->out->hook; hook != NULL && hook->io != NULL; hook = hook->next)
+		hook->io->hook.io = to->out;
+}
+
+// an Activation layer after a layer which has its own output buffer becomes that layer's tailed activation.
+static bool fuse_activation(nnom_model_t *m, nnom_layer_t *layer)
+{
+	nnom_layer_t *prev;
+
+	if (layer->type != NNOM_ACTIVATION || layer->in->hook.io == NULL || layer->in->aux != NULL ||
+		layer->out->aux != NULL)
+		return false;
+	prev = layer->in->hook.io->owner;
+	if (single_consumer(prev) != layer || prev->actail != NULL ||
+		prev->in->type == LAYER_BUF_NULL || prev->out->type == LAYER_BUF_NULL)
+		return false;
+
+	// the Activation layer runs in the format of its input (see activation_run()).
+	prev->actail = ((nnom_activation_layer_t *)layer)->act;
+	prev->actail->fmt = layer->in->qfmt;
+	((nnom_activation_layer_t *)layer)->act = NULL;
+	layer_take_consumers(prev, layer);
+	if (m->tail == layer)
+		m->tail = prev;
+	return true;
+}
+
+// a max pooling, or an add of 2 inputs, after a conv becomes part of the conv (see conv2d_fused_run()).
+// the pooling windows must not overlap vertically, so no conv output row is computed twice.
+static bool fuse_conv(nnom_model_t *m, nnom_layer_t *layer)
+{
+	nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
+	nnom_layer_t *next;
+	nnom_layer_io_t *other, *aux;
+	nnom_layer_hook_t *hook;
+	nnom_activation_t *act;
+
+	if ((layer->type != NNOM_CONV_2D && layer->type != NNOM_DW_CONV_2D) || layer->in->aux != NULL || cl->fused != NULL ||
+		layer->out->elem_size != sizeof(q7_t))
+		return false;
+	next = single_consumer(layer);
+	if (next == NULL || next->out->aux != NULL)
+		return false;
+
+	if (next->type == NNOM_MAXPOOL)
+	{
+		nnom_maxpool_layer_t *pool = (nnom_maxpool_layer_t *)next;
+		if (next->in->aux != NULL || pool->stride.h < pool->kernel.h)
+			return false;
+	}
+	else if (next->type == NNOM_ADD)
+	{
+		if (next->in->aux == NULL || next->in->aux->aux != NULL)
+			return false;
+		// the other input is moved to an aux input of the conv
+		other = (next->in->hook.io == layer->out) ? next->in->aux : next->in;
+		if (other->hook.io == layer->out)
+			return false;
+		for (hook = &other->hook.io->hook; hook != NULL && hook->io != other; hook = hook->next)
+			;
+		aux = io_add_aux(layer->in);
+		if (hook == NULL || aux == NULL)
+			return false;
+		aux->type = other->type;
+		aux->hook.io = other->hook.io;
+		hook->io = aux;
+	}
+	else
+		return false;
+
+	layer_take_consumers(layer, next);
+	// the fused layer's activation is now the output activation, the conv's one runs before pooling or adding.
+	act = layer->actail;
+	layer->actail = next->actail;
+	next->actail = act;
+	cl->fused = next;
+	if (m->tail == next)
+		m->tail = layer;
+	return true;
+}
+
+// list all the layers through their shortcut pointers, breadth first.
+// the passes before compiling use it, compile_layers() builds the list again later.
+static void model_list_layers(nnom_model_t *m)
+{
+	nnom_layer_t *layer, *last;
+	nnom_layer_hook_t *hook;
+	nnom_layer_io_t *io;
+
+	last = m->head;
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+	{
+		for (io = layer->out; io != NULL; io = io->aux)
+		{
+			for (hook = &io->hook; hook != NULL && hook->io != NULL; hook = hook->next)
+			{
+				nnom_layer_t *next = hook->io->owner;
+				nnom_layer_t *l;
+				for (l = m->head; l != NULL && l != next; l = l->shortcut)
+					;
+				if (l == NULL)
+				{
+					last->shortcut = next;
+					last = next;
+				}
+			}
+		}
+	}
+}
+
+static void model_unlist_layers(nnom_model_t *m)
+{
+	nnom_layer_t *layer, *next;
+
+	for (layer = m->head; layer != NULL; layer = next)
+	{
+		next = layer->shortcut;
+		layer->shortcut = NULL;
+	}
+}
+
+// put a QConvert layer in front of the input, which has the other precision than the output hooked to it.
+static nnom_layer_t *insert_qconvert(nnom_layer_io_t *in)
+{
+	nnom_layer_io_t *from = in->hook.io;
+	nnom_layer_hook_t *hook;
+	nnom_layer_t *layer;
+
+	for (hook = &from->hook; hook != NULL && hook->io != in; hook = hook->next)
+		;
+	if (hook == NULL)
+		return NULL;
+	layer = QConvert(in->elem_size);
+	if (layer == NULL)
+		return NULL;
+	hook->io = layer->in;
+	layer->in->hook.io = from;
+	layer->out->hook.io = in;
+	in->hook.io = layer->out;
+	return layer;
+}
+
+// q7 and q15 layers (see Q15()).
+// the layers which run in both set their precision from their input, the others get a QConvert layer
+// in front of each input of the other precision.
+static nnom_status_t model_set_precision(nnom_model_t *m)
+{
+	nnom_layer_t *layer, *conv;
+	nnom_layer_io_t *in;
+	bool changed;
+
+	model_list_layers(m);
+
+	// the layers of both precisions take the one of their input, the list is not in order for merged branches.
+	do {
+		changed = false;
+		for (layer = m->head; layer != NULL; layer = layer->shortcut)
+		{
+			in = layer->in;
+			if (in->elem_size == 0 && in->hook.io != NULL && in->hook.io->elem_size != 0)
+			{
+				in->elem_size = in->hook.io->elem_size;
+				layer->out->elem_size = in->elem_size;
+				changed = true;
+			}
+		}
+	} while (changed);
+
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+	{
+		for (in = layer->in; in != NULL; in = in->aux)
+		{
+			if (in->elem_size == 0)
+				in->elem_size = layer->out->elem_size = sizeof(q7_t);
+			if (in->hook.io == NULL || in->hook.io->elem_size == in->elem_size)
+				continue;
+			conv = insert_qconvert(in);
+			if (conv == NULL)
+			{
+				model_unlist_layers(m);
+				return NN_NO_MEMORY;
+			}
+			NNOM_LOG("Inserted QConvert to q%d before %s\n", in->elem_size * 8 - 1, default_layer_names[layer->type]);
+		}
+	}
+
+	model_unlist_layers(m);
+	return NN_SUCCESS;
+}
+
+// fuse layers before compiling, which saves the memory and the copies of the intermediate outputs.
+static void model_fuse_layers(nnom_model_t *m)
+{
+	nnom_layer_t *layer, *prev;
+
+	model_list_layers(m);
+
+	// activations first, then the convs can take the layers after them.
+	prev = NULL;
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+	{
+		if (fuse_activation(m, layer))
+		{
+			NNOM_LOG("Fused Activation into %s\n", default_layer_names[layer->in->hook.io->owner->type]);
+			prev->shortcut = layer->shortcut;
+			layer_delete(layer);
+			layer = prev;
+		}
+		prev = layer;
+	}
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+	{
+		if (fuse_conv(m, layer))
+			NNOM_LOG("Fused %s into %s\n", default_layer_names[((nnom_conv2d_layer_t *)layer)->fused->type],
+				default_layer_names[layer->type]);
+	}
+
+	// remove the list, the fused layers are not in it anymore
+	model_unlist_layers(m);
+}
+
 // a compiler can be use for both sequencial / functional model.
 // the output layer is optional only when the model is single output model
 // in this case, if output = NULL, the compile can find it by its own. 
@@ -859,9 +1326,16 @@ nnom_status_t model_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *
 	size_t buf_size;
 	uint8_t *buf;
 	uint32_t layer_num = 1;
-	uint32_t time = nnom_ms_get();
+	uint32_t time;
 	
+	// the timer of the layer stats
+	nnom_timer_init();
+	time = nnom_ms_get();
+
 	NNOM_NULL_CHECK(m);
+	// compiled on the host, its tables are set already (see nnom_export.h)
+	if (m->is_static)
+		return NN_SUCCESS;
 	NNOM_NULL_CHECK(input);
 
 	m->head = input;
@@ -869,15 +1343,38 @@ nnom_status_t model_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *
 	if (output == NULL)
 		m->tail = find_last(input);
 
+	// q7 <-> q15 conversions between the layers of different precisions
+	if (model_set_precision(m) != NN_SUCCESS)
+		return NN_NO_MEMORY;
+
+	// fuse layers, the model tail might be fused into the layer before it.
+	// the fused layers don't stream, leave them for streaming.
+	if (!m->is_stream)
+	{
+		model_fuse_layers(m);
+		if (output != NULL)
+			output = m->tail;
+	}
+
 	NNOM_LOG("\nStart compiling model...\n");
 	NNOM_LOG("Layer(#)         Activation    output shape    ops(MAC)   mem(in, out, buf)      mem blk lifetime\n");
 	NNOM_LOG("-------------------------------------------------------------------------------------------------\n");
 
 	// compile layers, started from list head, nested run till the end of models
-	compile_layers(m->head, m->blocks, &layer_num);
+	compile_layers(m->head, &m->blocks, &layer_num);
 
 	NNOM_LOG("-------------------------------------------------------------------------------------------------\n");
 
+	// streaming, every layer output is kept for the next run.
+	if (m->is_stream)
+	{
+		block_keep(m->head->in->mem);
+		for (nnom_layer_t *layer = m->head; layer != NULL; layer = layer->shortcut)
+			for (nnom_layer_io_t *out = layer->out; out != NULL; out = out->aux)
+				if (out->mem != NULL)
+					block_keep(out->mem);
+	}
+
 	// if model's tail is not the last layer which built by user.
 	if (output != layer_shortcut_find_last(input))
 		NNOM_LOG("WARNING: model returned at #%d %s layer, but this layer is not the end of shortcut list \n",
@@ -890,12 +1387,20 @@ nnom_status_t model_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *
 	buf = nnom_mem(buf_size);
 	if (buf == NULL)
 	{
-		NNOM_LOG("ERROR: No enough memory for network buffer, required %d bytes\n", buf_size);
+		NNOM_LOG("ERROR: No enough memory for network buffer, required %d bytes\n", (int)buf_size);
+#ifdef NNOM_USING_STATIC_MEMORY
+		NNOM_LOG("Static memory is %d bytes, %d are used by the layers\n", (int)nnom_static_buf_size, (int)nnom_static_buf_curr);
+#endif
 		return NN_NO_MEMORY;
 	}
 
+	m->buf = buf;
+
 	// split the memory for every memory block
 	block_mem_set(m, buf);
+#ifdef NNOM_USING_STATIC_MEMORY
+	NNOM_LOG("Static memory used %d of %d bytes\n", (int)nnom_static_buf_curr, (int)nnom_static_buf_size);
+#endif
 
 	// finally set the output buff to tailed activation on each layer
 	set_tailed_activation(m);
@@ -910,6 +1415,14 @@ nnom_status_t model_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *
 	return NN_SUCCESS;
 }
 
+// compile for model_run_stream()
+nnom_status_t model_stream_compile(nnom_model_t *m, nnom_layer_t *input, nnom_layer_t *output)
+{
+	NNOM_NULL_CHECK(m);
+	m->is_stream = true;
+	return model_compile(m, input, output);
+}
+
 // This is a simplified API for compile models with sequencial model only
 // this does not require specified Input / Output layers
 nnom_status_t sequencial_compile(nnom_model_t *m)
@@ -920,6 +1433,28 @@ nnom_status_t sequencial_compile(nnom_model_t *m)
 	return model_compile(m, input, output);
 }
 
+// run the tailed activation on an output with gaps, one row or one pixel at a time.
+static nnom_status_t actail_strided_run(nnom_layer_t *layer)
+{
+	nnom_activation_t *act = layer->actail;
+	nnom_layer_io_t *out = layer->out;
+	uint8_t *row = nnom_io_data(out);
+	uint16_t pixel_pitch = nnom_io_pixel_pitch(out);
+	uint32_t row_pitch = nnom_io_row_pitch(out);
+
+	for (uint32_t y = 0; y < out->shape.h; y++)
+	{
+		// pixels are packed, only the rows have gaps
+		if (pixel_pitch == out->shape.c)
+			act_direct_run(layer, act, row, out->shape.w * out->shape.c, act->fmt);
+		else
+			for (uint32_t x = 0; x < out->shape.w; x++)
+				act_direct_run(layer, act, row + x * pixel_pitch, out->shape.c, act->fmt);
+		row += row_pitch;
+	}
+	return NN_SUCCESS;
+}
+
 // run that layer
 nnom_status_t layer_run(nnom_layer_t *layer)
 {
@@ -928,16 +1463,20 @@ nnom_status_t layer_run(nnom_layer_t *layer)
 	NNOM_NULL_CHECK(layer);
 
 	// start
-	start = nnom_us_get();
+	start = nnom_cycles_get();
 	// run main layer first
 	result = layer->run(layer);
 	// run tailed-activation if it is presented
 	if (layer->actail != NULL)
 	{
-		layer->actail->run(layer, layer->actail);
+		if (nnom_io_is_strided(layer->out))
+			actail_strided_run(layer);
+		else
+			layer->actail->run(layer, layer->actail);
 	}
 	// done
-	layer->stat.time = nnom_us_get() - start;
+	layer->stat.cycles = nnom_cycles_get() - start;
+	layer->stat.time = layer->stat.cycles / NNOM_CYCLES_PER_US;
 	return result;
 }
 
@@ -951,6 +1490,8 @@ nnom_status_t model_run_to(nnom_model_t *m, nnom_layer_t *end_layer)
 	NNOM_NULL_CHECK(m->head);
 
 	layer = m->head;
+	// the outputs are not the ones of a complete run anymore
+	m->is_stream_filled = false;
 	
 	// using shortcut run
 	while (layer)
@@ -985,7 +1526,107 @@ nnom_status_t model_run_to(nnom_model_t *m, nnom_layer_t *end_layer)
 // run all layers.
 nnom_status_t model_run(nnom_model_t *m)
 {
-	return model_run_to(m, NULL);
+	nnom_status_t result = model_run_to(m, NULL);
+	if (result == NN_SUCCESS)
+		m->is_stream_filled = true;
+	return result;
+}
+
+// run the layer on the new columns of its input.
+static nnom_status_t layer_stream_run(nnom_layer_t *layer)
+{
+	nnom_status_t result;
+	nnom_activation_t *act = layer->actail;
+	nnom_layer_io_t *out = layer->out;
+	uint32_t pixel = out->shape.c;
+	uint8_t *data = nnom_io_data(out);
+	uint32_t start;
+
+	if (layer->in->hook.io != NULL)
+		layer->in->stream = layer->in->hook.io->stream;
+	if (layer->stream_run == NULL || nnom_io_is_strided(out))
+	{
+		result = layer_run(layer);
+		nnom_io_stream_new(out);
+		return result;
+	}
+
+	start = nnom_cycles_get();
+	result = layer->stream_run(layer);
+	// the tailed activation on the new columns
+	if (act != NULL)
+	{
+		if (out->stream.head + out->stream.tail >= out->shape.w)
+			act_direct_run(layer, act, data, shape_size(&out->shape), act->fmt);
+		else
+		{
+			if (out->stream.head > 0)
+				act_direct_run(layer, act, data, out->stream.head * pixel, act->fmt);
+			if (out->stream.tail > 0)
+				act_direct_run(layer, act, data + (out->shape.w - out->stream.tail) * pixel,
+					out->stream.tail * pixel, act->fmt);
+		}
+	}
+	layer->stat.cycles = nnom_cycles_get() - start;
+	layer->stat.time = layer->stat.cycles / NNOM_CYCLES_PER_US;
+	return result;
+}
+
+// run the model after its input window moved by shift columns, the new columns are at the end of the input buffer.
+// after model_run() or model_run_stream(), the layers only compute their new output columns when they can.
+nnom_status_t model_run_stream(nnom_model_t *m, uint16_t shift)
+{
+	uint32_t layer_num = 1;
+	nnom_status_t result;
+	nnom_layer_t *layer;
+	nnom_layer_io_t *in;
+	NNOM_NULL_CHECK(m);
+	NNOM_NULL_CHECK(m->head);
+
+	if (!m->is_stream)
+		return NN_ARGUMENT_ERROR;
+
+	layer = m->head;
+	in = layer->in;
+	// the first run, or a shift by the whole window, computes everything.
+	if (m->is_stream_filled && shift < in->shape.w)
+	{
+		in->stream.shift = shift;
+		in->stream.head = 0;
+		in->stream.tail = shift;
+	}
+	else
+		nnom_io_stream_new(in);
+	m->is_stream_filled = false;
+
+	// using shortcut run
+	while (layer)
+	{
+		// run layer
+		result = layer_stream_run(layer);
+		if (result != NN_SUCCESS)
+		{
+			NNOM_LOG("Error: #%d %s layer return error code:%d\n", layer_num, default_layer_names[layer->type], result);
+			return result;
+		}
+		// run callback
+		if( m->layer_callback != NULL)
+		{
+			result = m->layer_callback(m, layer);
+			if (result != NN_SUCCESS)
+			{
+				NNOM_LOG("Error: Callback return error code %d at #%d %s layer\n", result, layer_num, default_layer_names[layer->type]);
+				return result;
+			}
+		}
+		if (layer->shortcut == NULL)
+			break;
+		layer = layer->shortcut;
+		layer_num++;
+	}
+
+	m->is_stream_filled = true;
+	return NN_SUCCESS;
 }
 
 // callback, called after each layer has finished the calculation. 
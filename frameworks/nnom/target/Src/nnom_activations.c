@@ -23,8 +23,23 @@
 #endif
 
 // porting
-static nnom_status_t relu_run(nnom_layer_t *layer, nnom_activation_t *act)
+// the activations run on the output of the layer, which is q7 or q15 (see Q15()).
+static bool act_is_q15(nnom_layer_t *layer)
 {
+	return layer != NULL && layer->out->elem_size == sizeof(q15_t);
+}
+
+nnom_status_t relu_run(nnom_layer_t *layer, nnom_activation_t *act)
+{
+	if (act_is_q15(layer))
+	{
+		#ifdef NNOM_USING_CMSIS_NN
+		arm_relu_q15(act->data, act->size);
+		#else
+		local_relu_q15(act->data, act->size);
+		#endif
+		return NN_SUCCESS;
+	}
 	#ifdef NNOM_USING_CMSIS_NN
 	arm_relu_q7(act->data, act->size);
 	#else
@@ -33,8 +48,14 @@ static nnom_status_t relu_run(nnom_layer_t *layer, nnom_activation_t *act)
 	return NN_SUCCESS;
 }
 
-static nnom_status_t tanh_run(nnom_layer_t *layer, nnom_activation_t *act)
+nnom_status_t tanh_run(nnom_layer_t *layer, nnom_activation_t *act)
 {
+	// arm q15 version saturates the negative inputs to the smallest table entry
+	if (act_is_q15(layer))
+	{
+		local_tanh_q15(act->data, act->size, act->fmt.m);
+		return NN_SUCCESS;
+	}
 	// arm version cannot handle int_bit > 3
 	#ifdef NNOM_USING_CMSIS_NN
 	if(act->fmt.m <= 3)
@@ -46,8 +67,13 @@ static nnom_status_t tanh_run(nnom_layer_t *layer, nnom_activation_t *act)
 	return NN_SUCCESS;
 }
 
-static nnom_status_t sigmoid_run(nnom_layer_t *layer, nnom_activation_t *act)
+nnom_status_t sigmoid_run(nnom_layer_t *layer, nnom_activation_t *act)
 {
+	if (act_is_q15(layer))
+	{
+		local_sigmoid_q15(act->data, act->size, act->fmt.m);
+		return NN_SUCCESS;
+	}
 	// arm version cannot handle int_bit > 3
 	#ifdef NNOM_USING_CMSIS_NN
 	if(act->fmt.m <= 3)
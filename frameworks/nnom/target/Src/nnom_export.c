@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2018-2019
+ * Jianjia Ma, Wearable Bio-Robotics Group (WBR)
+ * majianjia@live.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "nnom.h"
+#include "nnom_export.h"
+
+// the structures of a model, each kind is exported as nnom_<name>_<index>
+typedef enum
+{
+	EXPORT_LAYER = 0,
+	EXPORT_IO,
+	EXPORT_HOOK,
+	EXPORT_BLOCK,
+	EXPORT_COMP,
+	EXPORT_ACT,
+	EXPORT_PAD,
+	EXPORT_KIND_MAX
+} export_kind_t;
+
+static const char export_names[][8] = {"layer", "io", "hook", "blk", "comp", "act", "pad"};
+
+typedef struct _export_obj_t
+{
+	const void *p;
+	size_t size; // the padded weights, the pointers inside them are exported as offsets
+	export_kind_t kind;
+	uint32_t index;
+} export_obj_t;
+
+typedef struct _export_t
+{
+	nnom_model_t *m;
+	FILE *fp;
+	const nnom_export_symbol_t *symbols;
+	uint32_t num_symbols;
+	export_obj_t *objs;
+	uint32_t num;
+	uint32_t max;
+	uint32_t count[EXPORT_KIND_MAX];
+	size_t buf_size;
+	nnom_status_t result;
+} export_t;
+
+// the functions the layers and activations point to
+typedef struct _export_func_t
+{
+	void (*f)(void);
+	const char *name;
+} export_func_t;
+
+#define EXPORT_FUNC(f) {(void (*)(void))f, #f}
+static const export_func_t export_funcs[] = {
+	EXPORT_FUNC(input_run),
+	EXPORT_FUNC(output_run),
+	EXPORT_FUNC(flatten_run),
+	EXPORT_FUNC(dw_conv2d_run),
+	EXPORT_FUNC(conv2d_run),
+	EXPORT_FUNC(dense_run),
+	EXPORT_FUNC(activation_run),
+	EXPORT_FUNC(softmax_run),
+	EXPORT_FUNC(maxpool_run),
+	EXPORT_FUNC(avgpool_run),
+	EXPORT_FUNC(sumpool_run),
+	EXPORT_FUNC(upsample_run),
+	EXPORT_FUNC(concat_run),
+	EXPORT_FUNC(add_run),
+	EXPORT_FUNC(sub_run),
+	EXPORT_FUNC(mult_run),
+	EXPORT_FUNC(qconvert_run),
+	EXPORT_FUNC(input_stream_run),
+	EXPORT_FUNC(conv2d_stream_run),
+	EXPORT_FUNC(activation_stream_run),
+	EXPORT_FUNC(pool_stream_run),
+	EXPORT_FUNC(relu_run),
+	EXPORT_FUNC(tanh_run),
+	EXPORT_FUNC(sigmoid_run),
+};
+
+// in the order of nnom_layer_type_t
+static const char export_layer_types[][20] = {
+	"NNOM_INVALID", "NNOM_INPUT", "NNOM_OUTPUT", "NNOM_CONV_2D", "NNOM_DW_CONV_2D", "NNOM_BATCHNORM",
+	"NNOM_DENSE", "NNOM_RNN", "NNOM_ACTIVATION", "NNOM_RELU", "NNOM_SIGMOID", "NNOM_TANH", "NNOM_SOFTMAX",
+	"NNOM_MAXPOOL", "NNOM_GLOBAL_MAXPOOL", "NNOM_AVGPOOL", "NNOM_GLOBAL_AVGPOOL", "NNOM_SUMPOOL",
+	"NNOM_GLOBAL_SUMPOOL", "NNOM_UPSAMPLE", "NNOM_FLATTEN", "NNOM_LAMBDA", "NNOM_CONCAT", "NNOM_ADD",
+	"NNOM_SUB", "NNOM_MULT", "NNOM_QCONVERT",
+};
+static const char export_act_types[][12] = {"ACT_RELU", "ACT_TANH", "ACT_SIGMOID"};
+static const char export_padding_types[][16] = {"PADDING_VALID", "PADDING_SAME"};
+static const char export_buf_types[][20] = {"LAYER_BUF_NULL", "LAYER_BUF_TEMP", "LAYER_BUF_RESERVED"};
+static const char export_buf_states[][16] = {"NNOM_BUF_EMPTY", "NNOM_BUF_FILLED"};
+
+// the structure type of a layer, NULL if it can not be exported
+static const char *layer_struct(nnom_layer_type_t type)
+{
+	switch (type)
+	{
+	case NNOM_INPUT:
+	case NNOM_OUTPUT:
+		return "nnom_io_layer_t";
+	case NNOM_CONV_2D:
+	case NNOM_DW_CONV_2D:
+		return "nnom_conv2d_layer_t";
+	case NNOM_DENSE:
+		return "nnom_dense_layer_t";
+	case NNOM_ACTIVATION:
+	case NNOM_RELU:
+	case NNOM_SIGMOID:
+	case NNOM_TANH:
+		return "nnom_activation_layer_t";
+	case NNOM_MAXPOOL:
+	case NNOM_GLOBAL_MAXPOOL:
+	case NNOM_AVGPOOL:
+	case NNOM_GLOBAL_AVGPOOL:
+	case NNOM_SUMPOOL:
+	case NNOM_GLOBAL_SUMPOOL:
+		return "nnom_maxpool_layer_t";
+	case NNOM_UPSAMPLE:
+		return "nnom_upsample_layer_t";
+	case NNOM_CONCAT:
+		return "nnom_concat_layer_t";
+	case NNOM_ADD:
+	case NNOM_SUB:
+	case NNOM_MULT:
+		return "nnom_matrix_layer_t";
+	case NNOM_SOFTMAX:
+	case NNOM_FLATTEN:
+	case NNOM_QCONVERT:
+		return "nnom_layer_t";
+	default:
+		return NULL;
+	}
+}
+
+static bool layer_is_base(nnom_layer_t *layer)
+{
+	return strcmp(layer_struct(layer->type), "nnom_layer_t") == 0;
+}
+
+static export_obj_t *export_find(export_t *e, const void *p)
+{
+	for (uint32_t i = 0; i < e->num; i++)
+		if (e->objs[i].p == p)
+			return &e->objs[i];
+	return NULL;
+}
+
+// add a structure to the export, return false if it is NULL or added already
+static bool export_add(export_t *e, export_kind_t kind, const void *p, size_t size)
+{
+	export_obj_t *obj;
+
+	if (p == NULL || export_find(e, p) != NULL)
+		return false;
+	if (e->num == e->max)
+	{
+		obj = realloc(e->objs, (e->max + 64) * sizeof(export_obj_t));
+		if (obj == NULL)
+		{
+			e->result = NN_NO_MEMORY;
+			return false;
+		}
+		e->objs = obj;
+		e->max += 64;
+	}
+	obj = &e->objs[e->num++];
+	obj->p = p;
+	obj->size = size;
+	obj->kind = kind;
+	obj->index = e->count[kind]++;
+	return true;
+}
+
+static void export_add_io(export_t *e, nnom_layer_io_t *io)
+{
+	nnom_layer_hook_t *hook;
+
+	for (; io != NULL; io = io->aux)
+	{
+		export_add(e, EXPORT_IO, io, 0);
+		for (hook = io->hook.next; hook != NULL; hook = hook->next)
+			export_add(e, EXPORT_HOOK, hook, 0);
+	}
+}
+
+// add the structures of a layer, the layer is added already
+static void export_add_layer(export_t *e, nnom_layer_t *layer)
+{
+	if (layer_struct(layer->type) == NULL)
+	{
+		NNOM_LOG("ERROR: %s layer can not be exported\n", default_layer_names[layer->type]);
+		e->result = NN_ARGUMENT_ERROR;
+		return;
+	}
+	export_add_io(e, layer->in);
+	export_add_io(e, layer->out);
+	export_add(e, EXPORT_COMP, layer->comp, 0);
+	export_add(e, EXPORT_ACT, layer->actail, 0);
+
+	if (strcmp(layer_struct(layer->type), "nnom_activation_layer_t") == 0)
+		export_add(e, EXPORT_ACT, ((nnom_activation_layer_t *)layer)->act, 0);
+	if (layer->type == NNOM_CONV_2D || layer->type == NNOM_DW_CONV_2D)
+	{
+		nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
+		if (cl->pad_weights != NULL)
+			export_add(e, EXPORT_PAD, cl->pad_weights, (cl->pad_bias - cl->pad_weights) + cl->pad_ch_out);
+		// the fused layer is not in the shortcut list
+		if (export_add(e, EXPORT_LAYER, cl->fused, 0))
+			export_add_layer(e, cl->fused);
+	}
+}
+
+// the C expression of a pointer of the model
+static void export_ptr(export_t *e, const void *p)
+{
+	const uint8_t *data = p;
+	const uint8_t *buf = e->m->buf;
+	export_obj_t *obj;
+	uint32_t i;
+
+	if (p == NULL)
+	{
+		fprintf(e->fp, "NULL");
+		return;
+	}
+	obj = export_find(e, p);
+	if (obj != NULL && obj->kind != EXPORT_PAD)
+	{
+		fprintf(e->fp, "&nnom_%s_%u", export_names[obj->kind], (unsigned)obj->index);
+		if (obj->kind == EXPORT_LAYER && !layer_is_base((nnom_layer_t *)p))
+			fprintf(e->fp, ".super");
+		return;
+	}
+	// data in the network buffer, or in the padded weights
+	if (buf != NULL && data >= buf && data <= buf + e->buf_size)
+	{
+		fprintf(e->fp, "(uint8_t *)nnom_buf + %lu", (unsigned long)(data - buf));
+		return;
+	}
+	for (i = 0; i < e->num; i++)
+	{
+		const uint8_t *start = e->objs[i].p;
+		if (e->objs[i].kind == EXPORT_PAD && data >= start && data < start + e->objs[i].size)
+		{
+			fprintf(e->fp, "(q7_t *)nnom_pad_%u + %lu", (unsigned)e->objs[i].index, (unsigned long)(data - start));
+			return;
+		}
+	}
+	for (i = 0; i < e->num_symbols; i++)
+	{
+		if (e->symbols[i].p == p)
+		{
+			fprintf(e->fp, "%s", e->symbols[i].name);
+			return;
+		}
+	}
+	NNOM_LOG("ERROR: pointer %p is not in the model or in the symbols\n", p);
+	e->result = NN_ARGUMENT_ERROR;
+	fprintf(e->fp, "NULL");
+}
+
+static void put_ptr(export_t *e, const char *indent, const char *field, const void *p)
+{
+	fprintf(e->fp, "%s.%s = ", indent, field);
+	export_ptr(e, p);
+	fprintf(e->fp, ",\n");
+}
+
+static void put_func(export_t *e, const char *indent, const char *field, void (*f)(void))
+{
+	uint32_t i;
+
+	if (f == NULL)
+		return;
+	for (i = 0; i < sizeof(export_funcs) / sizeof(export_funcs[0]); i++)
+	{
+		if (export_funcs[i].f == f)
+		{
+			fprintf(e->fp, "%s.%s = %s,\n", indent, field, export_funcs[i].name);
+			return;
+		}
+	}
+	NNOM_LOG("ERROR: %s method is not a function of NNoM\n", field);
+	e->result = NN_ARGUMENT_ERROR;
+}
+
+static void put_shape(export_t *e, const char *indent, const char *field, nnom_shape_t s)
+{
+	fprintf(e->fp, "%s.%s = {%u, %u, %u},\n", indent, field, s.h, s.w, s.c);
+}
+
+static void export_block(export_t *e, nnom_mem_block_t *block, uint32_t index)
+{
+	fprintf(e->fp, "static nnom_mem_block_t nnom_blk_%u = {\n", (unsigned)index);
+	put_ptr(e, "\t", "blk", block->blk);
+	fprintf(e->fp, "\t.size = %lu,\n", (unsigned long)block->size);
+	fprintf(e->fp, "\t.owners = %u,\n", block->owners);
+	fprintf(e->fp, "\t.state = %s,\n", export_buf_states[block->state]);
+	fprintf(e->fp, "\t.first = %lu,\n", (unsigned long)block->first);
+	fprintf(e->fp, "\t.last = %lu,\n", (unsigned long)block->last);
+	fprintf(e->fp, "\t.offset = %lu,\n", (unsigned long)block->offset);
+	put_ptr(e, "\t", "next", block->next);
+	fprintf(e->fp, "};\n");
+}
+
+static void export_hook(export_t *e, nnom_layer_hook_t *hook, uint32_t index)
+{
+	fprintf(e->fp, "static nnom_layer_hook_t nnom_hook_%u = {\n", (unsigned)index);
+	put_ptr(e, "\t", "io", hook->io);
+	put_ptr(e, "\t", "next", hook->next);
+	fprintf(e->fp, "};\n");
+}
+
+static void export_io(export_t *e, nnom_layer_io_t *io, uint32_t index)
+{
+	fprintf(e->fp, "static nnom_layer_io_t nnom_io_%u = {\n", (unsigned)index);
+	fprintf(e->fp, "\t.hook = {\n");
+	put_ptr(e, "\t\t", "io", io->hook.io);
+	put_ptr(e, "\t\t", "next", io->hook.next);
+	fprintf(e->fp, "\t},\n");
+	put_ptr(e, "\t", "aux", io->aux);
+	put_ptr(e, "\t", "mem", io->mem);
+	put_ptr(e, "\t", "owner", io->owner);
+	put_shape(e, "\t", "shape", io->shape);
+	fprintf(e->fp, "\t.type = %s,\n", export_buf_types[io->type]);
+	fprintf(e->fp, "\t.qfmt = {%d, %d},\n", io->qfmt.m, io->qfmt.n);
+	fprintf(e->fp, "\t.elem_size = %u,\n", io->elem_size);
+	fprintf(e->fp, "\t.view = {%lu, %lu, %u},\n", (unsigned long)io->view.offset, (unsigned long)io->view.row_pitch,
+		io->view.pixel_pitch);
+	fprintf(e->fp, "\t.stream = {%u, %u, %u},\n", io->stream.shift, io->stream.head, io->stream.tail);
+	fprintf(e->fp, "};\n");
+}
+
+static void export_comp(export_t *e, nnom_buf_t *comp, uint32_t index)
+{
+	fprintf(e->fp, "static nnom_buf_t nnom_comp_%u = {\n", (unsigned)index);
+	put_ptr(e, "\t", "mem", comp->mem);
+	put_shape(e, "\t", "shape", comp->shape);
+	fprintf(e->fp, "\t.type = %s,\n", export_buf_types[comp->type]);
+	fprintf(e->fp, "};\n");
+}
+
+static void export_act(export_t *e, nnom_activation_t *act, uint32_t index)
+{
+	fprintf(e->fp, "static nnom_activation_t nnom_act_%u = {\n", (unsigned)index);
+	put_func(e, "\t", "run", (void (*)(void))act->run);
+	put_ptr(e, "\t", "data", act->data);
+	fprintf(e->fp, "\t.size = %lu,\n", (unsigned long)act->size);
+	fprintf(e->fp, "\t.type = %s,\n", export_act_types[act->type]);
+	fprintf(e->fp, "\t.fmt = {%d, %d},\n", act->fmt.m, act->fmt.n);
+	fprintf(e->fp, "};\n");
+}
+
+static void export_pad(export_t *e, const q7_t *data, size_t size, uint32_t index)
+{
+	fprintf(e->fp, "static const q7_t nnom_pad_%u[%lu] = {", (unsigned)index, (unsigned long)size);
+	for (size_t i = 0; i < size; i++)
+		fprintf(e->fp, "%s%d", i == 0 ? "" : (i % 32 == 0 ? ",\n\t" : ", "), data[i]);
+	fprintf(e->fp, "};\n");
+}
+
+// the compile methods (comp_out_shape) and free methods are left out, the tables are neither compiled nor freed.
+static void export_layer(export_t *e, nnom_layer_t *layer, uint32_t index)
+{
+	bool base = layer_is_base(layer);
+	const char *indent = base ? "\t" : "\t\t";
+
+	fprintf(e->fp, "static %s nnom_layer_%u = {\n", layer_struct(layer->type), (unsigned)index);
+	if (!base)
+		fprintf(e->fp, "\t.super = {\n");
+	put_func(e, indent, "run", (void (*)(void))layer->run);
+	put_func(e, indent, "stream_run", (void (*)(void))layer->stream_run);
+	put_ptr(e, indent, "comp", layer->comp);
+	put_ptr(e, indent, "actail", layer->actail);
+	fprintf(e->fp, "%s.type = %s,\n", indent, export_layer_types[layer->type]);
+	put_ptr(e, indent, "in", layer->in);
+	put_ptr(e, indent, "out", layer->out);
+	fprintf(e->fp, "%s.stat = {.macc = %lu, .bytes = %lu},\n", indent, (unsigned long)layer->stat.macc,
+		(unsigned long)layer->stat.bytes);
+	put_ptr(e, indent, "shortcut", layer->shortcut);
+	if (!base)
+		fprintf(e->fp, "\t},\n");
+
+	switch (layer->type)
+	{
+	case NNOM_INPUT:
+	case NNOM_OUTPUT:
+	{
+		nnom_io_layer_t *cl = (nnom_io_layer_t *)layer;
+		put_shape(e, "\t", "shape", cl->shape);
+		put_ptr(e, "\t", "buf", cl->buf);
+		break;
+	}
+	case NNOM_CONV_2D:
+	case NNOM_DW_CONV_2D:
+	{
+		nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
+		put_shape(e, "\t", "kernel", cl->kernel);
+		put_shape(e, "\t", "stride", cl->stride);
+		fprintf(e->fp, "\t.output_shift = %d,\n", cl->output_shift);
+		fprintf(e->fp, "\t.bias_shift = %d,\n", cl->bias_shift);
+		put_shape(e, "\t", "pad", cl->pad);
+		fprintf(e->fp, "\t.padding_type = %s,\n", export_padding_types[cl->padding_type]);
+		fprintf(e->fp, "\t.filter_mult = %lu,\n", (unsigned long)cl->filter_mult);
+		put_ptr(e, "\t", "weights", cl->weights);
+		put_ptr(e, "\t", "bias", cl->bias);
+		put_ptr(e, "\t", "pad_weights", cl->pad_weights);
+		put_ptr(e, "\t", "pad_bias", cl->pad_bias);
+		fprintf(e->fp, "\t.pad_ch_in = %u,\n", cl->pad_ch_in);
+		fprintf(e->fp, "\t.pad_ch_out = %u,\n", cl->pad_ch_out);
+		put_ptr(e, "\t", "fused", cl->fused);
+		break;
+	}
+	case NNOM_DENSE:
+	{
+		nnom_dense_layer_t *cl = (nnom_dense_layer_t *)layer;
+		fprintf(e->fp, "\t.output_unit = %lu,\n", (unsigned long)cl->output_unit);
+		put_ptr(e, "\t", "weights", cl->weights);
+		put_ptr(e, "\t", "bias", cl->bias);
+		fprintf(e->fp, "\t.output_shift = %d,\n", cl->output_shift);
+		fprintf(e->fp, "\t.bias_shift = %d,\n", cl->bias_shift);
+		break;
+	}
+	case NNOM_ACTIVATION:
+	case NNOM_RELU:
+	case NNOM_SIGMOID:
+	case NNOM_TANH:
+		put_ptr(e, "\t", "act", ((nnom_activation_layer_t *)layer)->act);
+		break;
+	case NNOM_MAXPOOL:
+	case NNOM_GLOBAL_MAXPOOL:
+	case NNOM_AVGPOOL:
+	case NNOM_GLOBAL_AVGPOOL:
+	case NNOM_SUMPOOL:
+	case NNOM_GLOBAL_SUMPOOL:
+	{
+		nnom_maxpool_layer_t *cl = (nnom_maxpool_layer_t *)layer;
+		put_shape(e, "\t", "kernel", cl->kernel);
+		put_shape(e, "\t", "stride", cl->stride);
+		put_shape(e, "\t", "pad", cl->pad);
+		fprintf(e->fp, "\t.padding_type = %s,\n", export_padding_types[cl->padding_type]);
+		break;
+	}
+	case NNOM_UPSAMPLE:
+		put_shape(e, "\t", "kernel", ((nnom_upsample_layer_t *)layer)->kernel);
+		break;
+	case NNOM_CONCAT:
+		fprintf(e->fp, "\t.axis = %d,\n", ((nnom_concat_layer_t *)layer)->axis);
+		break;
+	case NNOM_ADD:
+	case NNOM_SUB:
+	case NNOM_MULT:
+		fprintf(e->fp, "\t.oshift = %ld,\n", (long)((nnom_matrix_layer_t *)layer)->oshift);
+		break;
+	default:
+		break;
+	}
+	fprintf(e->fp, "};\n");
+}
+
+static void export_model(export_t *e)
+{
+	nnom_model_t *m = e->m;
+
+	fprintf(e->fp, "static nnom_model_t nnom_model = {\n");
+	put_ptr(e, "\t", "head", m->head);
+	put_ptr(e, "\t", "tail", m->tail);
+	put_ptr(e, "\t", "blocks", m->blocks);
+	fprintf(e->fp, "\t.buf = nnom_buf,\n");
+	fprintf(e->fp, "\t.total_ops = %lu,\n", (unsigned long)m->total_ops);
+	fprintf(e->fp, "\t.is_stream = %s,\n", m->is_stream ? "true" : "false");
+	fprintf(e->fp, "\t.is_static = true,\n");
+	fprintf(e->fp, "};\n");
+}
+
+// write the compiled model m as C.
+// the structures are declared first, they point to each other.
+nnom_status_t model_export(nnom_model_t *m, FILE *fp, const nnom_export_symbol_t *symbols, uint32_t num)
+{
+	export_t e;
+	nnom_mem_block_t *block;
+	nnom_layer_t *layer;
+	uint32_t i, k;
+
+	NNOM_NULL_CHECK(m);
+	NNOM_NULL_CHECK(m->head);
+	NNOM_NULL_CHECK(fp);
+
+	memset(&e, 0, sizeof(e));
+	e.m = m;
+	e.fp = fp;
+	e.symbols = symbols;
+	e.num_symbols = num;
+
+	// the layers are numbered in the order of execution
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+		export_add(&e, EXPORT_LAYER, layer, 0);
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+		export_add_layer(&e, layer);
+	for (block = m->blocks; block != NULL; block = block->next)
+	{
+		export_add(&e, EXPORT_BLOCK, block, 0);
+		if (block->offset + block->size > e.buf_size)
+			e.buf_size = block->offset + block->size;
+	}
+	if (e.result != NN_SUCCESS)
+	{
+		free(e.objs);
+		return e.result;
+	}
+
+	fprintf(fp, "/* compiled model, %u layers, network buffer %lu bytes */\n", (unsigned)e.count[EXPORT_LAYER],
+		(unsigned long)e.buf_size);
+	fprintf(fp, "static uint32_t nnom_buf[%lu];\n", (unsigned long)(e.buf_size > 0 ? (e.buf_size + 3) / 4 : 1));
+	for (i = 0; i < e.num; i++)
+		if (e.objs[i].kind == EXPORT_PAD)
+			export_pad(&e, e.objs[i].p, e.objs[i].size, e.objs[i].index);
+
+	for (k = 0; k < EXPORT_KIND_MAX; k++)
+	{
+		for (i = 0; i < e.num; i++)
+		{
+			export_obj_t *obj = &e.objs[i];
+			if (obj->kind != k)
+				continue;
+			switch (obj->kind)
+			{
+			case EXPORT_LAYER:
+				fprintf(fp, "static %s nnom_layer_%u;\n", layer_struct(((nnom_layer_t *)obj->p)->type), (unsigned)obj->index);
+				break;
+			case EXPORT_IO:
+				fprintf(fp, "static nnom_layer_io_t nnom_io_%u;\n", (unsigned)obj->index);
+				break;
+			case EXPORT_HOOK:
+				fprintf(fp, "static nnom_layer_hook_t nnom_hook_%u;\n", (unsigned)obj->index);
+				break;
+			case EXPORT_BLOCK:
+				fprintf(fp, "static nnom_mem_block_t nnom_blk_%u;\n", (unsigned)obj->index);
+				break;
+			case EXPORT_COMP:
+				fprintf(fp, "static nnom_buf_t nnom_comp_%u;\n", (unsigned)obj->index);
+				break;
+			case EXPORT_ACT:
+				fprintf(fp, "static nnom_activation_t nnom_act_%u;\n", (unsigned)obj->index);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	for (k = 0; k < EXPORT_KIND_MAX; k++)
+	{
+		for (i = 0; i < e.num; i++)
+		{
+			export_obj_t *obj = &e.objs[i];
+			if (obj->kind != k)
+				continue;
+			switch (obj->kind)
+			{
+			case EXPORT_LAYER:
+				export_layer(&e, (nnom_layer_t *)obj->p, obj->index);
+				break;
+			case EXPORT_IO:
+				export_io(&e, (nnom_layer_io_t *)obj->p, obj->index);
+				break;
+			case EXPORT_HOOK:
+				export_hook(&e, (nnom_layer_hook_t *)obj->p, obj->index);
+				break;
+			case EXPORT_BLOCK:
+				export_block(&e, (nnom_mem_block_t *)obj->p, obj->index);
+				break;
+			case EXPORT_COMP:
+				export_comp(&e, (nnom_buf_t *)obj->p, obj->index);
+				break;
+			case EXPORT_ACT:
+				export_act(&e, (nnom_activation_t *)obj->p, obj->index);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+	export_model(&e);
+
+	free(e.objs);
+	return e.result;
+}
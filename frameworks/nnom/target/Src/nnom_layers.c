@@ -56,6 +56,7 @@ nnom_qformat_t qformat(int8_t m, int8_t n)
 nnom_layer_io_t *io_init(void *owner_layer, nnom_layer_io_t *io)
 {
 	io->owner = (nnom_layer_t *)owner_layer;
+	io->elem_size = sizeof(q7_t);
 	return io;
 }
 
@@ -80,6 +81,27 @@ nnom_layer_io_t *io_add_aux(nnom_layer_io_t *targeted_io)
 // Conv2D
 // multiplier of (output/input channel),
 // shape of kernal, shape of strides, weight struct, bias struct
+// free the channel padded weights (see conv2d_out_shape()) and the fused layer
+static nnom_status_t conv2d_free(nnom_layer_t *layer)
+{
+	nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
+	nnom_layer_io_t *io, *next;
+
+	nnom_free(cl->pad_weights);
+	if (cl->fused != NULL)
+	{
+		// its hooks were moved on fusing, only its aux inputs are left.
+		for (io = cl->fused->in->aux; io != NULL; io = next)
+		{
+			next = io->aux;
+			nnom_free(io);
+		}
+		nnom_free(cl->fused->actail);
+		nnom_free(cl->fused);
+	}
+	return NN_SUCCESS;
+}
+
 nnom_layer_t *Conv2D(uint32_t filters, nnom_shape_t k, nnom_shape_t s, nnom_padding_t pad_type,
 					 const nnom_weight_t *w, const nnom_bias_t *b)
 {
@@ -110,7 +132,9 @@ nnom_layer_t *Conv2D(uint32_t filters, nnom_shape_t k, nnom_shape_t s, nnom_padd
 	layer->super.comp = comp;
 	// set run method & output shape
 	layer->super.run = conv2d_run;
+	layer->super.stream_run = conv2d_stream_run;
 	layer->super.comp_out_shape = conv2d_out_shape;
+	layer->super.free = conv2d_free;
 
 	// get the private parameters
 	layer->kernel = k;
@@ -276,6 +300,7 @@ nnom_layer_t *RNN(nnom_rnn_cell_t *cell, bool return_sequence)
 	layer->super.comp = comp;
 	// set run and outshape methods
 	layer->super.run = rnn_run;
+	layer->super.stream_run = rnn_stream_run;
 	layer->super.comp_out_shape = rnn_out_shape;
 
 	// rnn parameters.
@@ -311,6 +336,7 @@ nnom_layer_t *Activation(nnom_activation_t *act)
 	// set type in layer parent
 	layer->super.type = NNOM_ACTIVATION;
 	layer->super.run = activation_run;
+	layer->super.stream_run = activation_stream_run;
 	layer->super.comp_out_shape = default_out_shape;
 	// set buf state
 	in->type = LAYER_BUF_TEMP;
@@ -318,6 +344,9 @@ nnom_layer_t *Activation(nnom_activation_t *act)
 	// put in & out on the layer.
 	layer->super.in = io_init(layer, in);
 	layer->super.out = io_init(layer, out);
+	// q7 or q15, as its input
+	in->elem_size = 0;
+	out->elem_size = 0;
 
 	// set activation to layer
 	layer->act = act;
@@ -409,6 +438,7 @@ nnom_layer_t *MaxPool(nnom_shape_t k, nnom_shape_t s, nnom_padding_t pad_type)
 	// set type in layer parent
 	layer->super.type = NNOM_MAXPOOL;
 	layer->super.run = maxpool_run;
+	layer->super.stream_run = pool_stream_run; // avg pooling too, not the global ones
 	layer->super.comp_out_shape = maxpooling_out_shape;
 	// set buf state
 	in->type = LAYER_BUF_TEMP;
@@ -541,10 +571,60 @@ nnom_layer_t *Flatten(void)
 	// put in & out on the layer.
 	layer->in = io_init(layer, in);
 	layer->out = io_init(layer, out);
+	// q7 or q15, as its input
+	in->elem_size = 0;
+	out->elem_size = 0;
 
 	return layer;
 }
 
+nnom_layer_t *QConvert(uint8_t elem_size)
+{
+	nnom_layer_t *layer;
+	nnom_layer_io_t *in, *out;
+
+	// apply a block memory for all the sub handles.
+	size_t mem_size = sizeof(nnom_layer_t) + sizeof(nnom_layer_io_t) * 2;
+	layer = nnom_mem(mem_size);
+	if (layer == NULL)
+		return NULL;
+
+	// distribut the memory to sub handles.
+	in = (void *)((unsigned long)layer + sizeof(nnom_layer_t));
+	out = (void *)((unsigned long)in + sizeof(nnom_layer_io_t));
+
+	// set type in layer parent
+	layer->type = NNOM_QCONVERT;
+	layer->run = qconvert_run;
+	layer->comp_out_shape = default_out_shape;
+	// set buf state
+	in->type = LAYER_BUF_TEMP;
+	out->type = LAYER_BUF_TEMP;
+	// put in & out on the layer.
+	layer->in = io_init(layer, in);
+	layer->out = io_init(layer, out);
+	// the input is the other one
+	in->elem_size = elem_size == sizeof(q15_t) ? sizeof(q7_t) : sizeof(q15_t);
+	out->elem_size = elem_size;
+
+	return layer;
+}
+
+nnom_layer_t *Q15(nnom_layer_t *layer)
+{
+	if (layer == NULL)
+		return NULL;
+	// the layers which have q15 kernels
+	if (layer->type != NNOM_CONV_2D && layer->type != NNOM_DENSE)
+	{
+		NNOM_LOG("ERROR: no q15 version of %s layer, it stays q7\n", default_layer_names[layer->type]);
+		return layer;
+	}
+	layer->in->elem_size = sizeof(q15_t);
+	layer->out->elem_size = sizeof(q15_t);
+	return layer;
+}
+
 nnom_layer_t *Input(nnom_shape_t input_shape, void *p_buf)
 {
 	nnom_io_layer_t *layer;
@@ -563,6 +643,7 @@ nnom_layer_t *Input(nnom_shape_t input_shape, void *p_buf)
 	// set type in layer parent
 	layer->super.type = NNOM_INPUT;
 	layer->super.run = input_run;
+	layer->super.stream_run = input_stream_run;
 	layer->super.comp_out_shape = input_out_shape;
 	// set buf state
 	in->type = LAYER_BUF_TEMP;
@@ -587,6 +668,7 @@ nnom_layer_t *Output(nnom_shape_t output_shape, void *p_buf)
 	{
 		layer->type = NNOM_OUTPUT;
 		layer->run = output_run;
+		layer->stream_run = NULL;
 		layer->comp_out_shape = output_out_shape;
 	}
 	return layer;
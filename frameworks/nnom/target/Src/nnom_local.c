@@ -18,6 +18,170 @@
 #include "nnom.h"
 #include "nnom_local.h"
 
+// The im2col/GEMM convolutions below use SIMD for their dot products when the compiler targets
+// SSE4.1, AVX2 or NEON (-msse4.1, -mavx2, -mfpu=neon or AArch64), plain C otherwise.
+// All paths widen to 16bit before multiplying and accumulate in 32bit, so they give the same results.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NNOM_LOCAL_SSE
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define NNOM_LOCAL_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NNOM_LOCAL_NEON
+#endif
+
+// number of channels the depthwise convolution accumulates at once
+#define NNOM_DW_GROUP (32)
+
+#ifdef NNOM_LOCAL_SSE
+static inline int32_t local_hsum_epi32(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+#endif
+
+// returns sum(a[i] * b[i])
+static inline int32_t local_dot_q7(const q7_t *a, const q7_t *b, uint32_t len)
+{
+    int32_t sum = 0;
+    uint32_t i = 0;
+#if defined(NNOM_LOCAL_SSE)
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 8 <= len; i += 8)
+    {
+        __m128i va = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(a + i)));
+        __m128i vb = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(b + i)));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(va, vb));
+    }
+    sum = local_hsum_epi32(acc);
+#elif defined(NNOM_LOCAL_NEON)
+    int32x4_t acc = vdupq_n_s32(0);
+    for (; i + 8 <= len; i += 8)
+        acc = vpadalq_s16(acc, vmull_s8(vld1_s8(a + i), vld1_s8(b + i)));
+    sum = vgetq_lane_s32(acc, 0) + vgetq_lane_s32(acc, 1) + vgetq_lane_s32(acc, 2) + vgetq_lane_s32(acc, 3);
+#endif
+    for (; i < len; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+// adds sum(a[i] * b0[i]) to *sum0 and sum(a[i] * b1[i]) to *sum1, a (the weights) is loaded once for both.
+static inline void local_dot_q7_2col(const q7_t *a, const q7_t *b0, const q7_t *b1, uint32_t len, int32_t *sum0, int32_t *sum1)
+{
+    int32_t s0 = 0, s1 = 0;
+    uint32_t i = 0;
+#if defined(NNOM_LOCAL_SSE)
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+#if defined(__AVX2__)
+    __m256i acc0_256 = _mm256_setzero_si256();
+    __m256i acc1_256 = _mm256_setzero_si256();
+    for (; i + 16 <= len; i += 16)
+    {
+        __m256i va = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a + i)));
+        __m256i vb0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b0 + i)));
+        __m256i vb1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b1 + i)));
+        acc0_256 = _mm256_add_epi32(acc0_256, _mm256_madd_epi16(va, vb0));
+        acc1_256 = _mm256_add_epi32(acc1_256, _mm256_madd_epi16(va, vb1));
+    }
+    acc0 = _mm_add_epi32(_mm256_castsi256_si128(acc0_256), _mm256_extracti128_si256(acc0_256, 1));
+    acc1 = _mm_add_epi32(_mm256_castsi256_si128(acc1_256), _mm256_extracti128_si256(acc1_256, 1));
+#endif
+    for (; i + 8 <= len; i += 8)
+    {
+        __m128i va = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(a + i)));
+        __m128i vb0 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(b0 + i)));
+        __m128i vb1 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(b1 + i)));
+        acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(va, vb0));
+        acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(va, vb1));
+    }
+    s0 = local_hsum_epi32(acc0);
+    s1 = local_hsum_epi32(acc1);
+#elif defined(NNOM_LOCAL_NEON)
+    int32x4_t acc0 = vdupq_n_s32(0);
+    int32x4_t acc1 = vdupq_n_s32(0);
+    for (; i + 8 <= len; i += 8)
+    {
+        int8x8_t va = vld1_s8(a + i);
+        acc0 = vpadalq_s16(acc0, vmull_s8(va, vld1_s8(b0 + i)));
+        acc1 = vpadalq_s16(acc1, vmull_s8(va, vld1_s8(b1 + i)));
+    }
+    s0 = vgetq_lane_s32(acc0, 0) + vgetq_lane_s32(acc0, 1) + vgetq_lane_s32(acc0, 2) + vgetq_lane_s32(acc0, 3);
+    s1 = vgetq_lane_s32(acc1, 0) + vgetq_lane_s32(acc1, 1) + vgetq_lane_s32(acc1, 2) + vgetq_lane_s32(acc1, 3);
+#endif
+    for (; i < len; i++)
+    {
+        s0 += a[i] * b0[i];
+        s1 += a[i] * b1[i];
+    }
+    *sum0 += s0;
+    *sum1 += s1;
+}
+
+// acc[i] += a[i] * b[i], for the channels of the depthwise convolution
+static inline void local_mac_q7(const q7_t *a, const q7_t *b, int32_t *acc, uint32_t len)
+{
+    uint32_t i = 0;
+#if defined(NNOM_LOCAL_SSE)
+    for (; i + 8 <= len; i += 8)
+    {
+        __m128i va = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(a + i)));
+        __m128i vb = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(b + i)));
+        __m128i prod = _mm_mullo_epi16(va, vb); // |a*b| <= 2^14, fits in 16bit
+        __m128i lo = _mm_cvtepi16_epi32(prod);
+        __m128i hi = _mm_cvtepi16_epi32(_mm_srli_si128(prod, 8));
+        _mm_storeu_si128((__m128i *)(acc + i), _mm_add_epi32(_mm_loadu_si128((__m128i *)(acc + i)), lo));
+        _mm_storeu_si128((__m128i *)(acc + i + 4), _mm_add_epi32(_mm_loadu_si128((__m128i *)(acc + i + 4)), hi));
+    }
+#elif defined(NNOM_LOCAL_NEON)
+    for (; i + 8 <= len; i += 8)
+    {
+        int16x8_t prod = vmull_s8(vld1_s8(a + i), vld1_s8(b + i));
+        vst1q_s32(acc + i, vaddw_s16(vld1q_s32(acc + i), vget_low_s16(prod)));
+        vst1q_s32(acc + i + 4, vaddw_s16(vld1q_s32(acc + i + 4), vget_high_s16(prod)));
+    }
+#endif
+    for (; i < len; i++)
+        acc[i] += a[i] * b[i];
+}
+
+// copy the receptive field which starts at (in_x - padding_x, in_y - padding_y) of the HWC image to col,
+// with zeros for the part outside of the image. Its layout (y, x, ch) is the one of a filter in the weights.
+static void local_im2col_q7_HWC(const q7_t *Im_in,
+                                const uint16_t dim_im_in_x, const uint16_t dim_im_in_y, const uint16_t ch_im_in,
+                                const uint16_t dim_kernel_x, const uint16_t dim_kernel_y,
+                                const uint16_t padding_x, const uint16_t padding_y,
+                                const int in_x, const int in_y, q7_t *col)
+{
+    const int base_x = in_x - padding_x;
+    const int ker_x_start = base_x < 0 ? -base_x : 0;
+    const int ker_x_end = base_x + dim_kernel_x > dim_im_in_x ? dim_im_in_x - base_x : dim_kernel_x;
+    int m;
+
+    for (m = 0; m < dim_kernel_y; m++)
+    {
+        const int in_row = in_y - padding_y + m;
+        if (in_row < 0 || in_row >= dim_im_in_y || ker_x_start >= ker_x_end)
+        {
+            memset(col, 0, dim_kernel_x * ch_im_in);
+        }
+        else
+        {
+            // left padding, the taps inside the image are contiguous in HWC, right padding
+            memset(col, 0, ker_x_start * ch_im_in);
+            memcpy(col + ker_x_start * ch_im_in,
+                   Im_in + (in_row * dim_im_in_x + base_x + ker_x_start) * ch_im_in,
+                   (ker_x_end - ker_x_start) * ch_im_in);
+            memset(col + ker_x_end * ch_im_in, 0, (dim_kernel_x - ker_x_end) * ch_im_in);
+        }
+        col += dim_kernel_x * ch_im_in;
+    }
+}
+
 // modified from CMSIS-NN test_ref
 void local_avepool_q7_HWC(const q7_t *Im_in,           // input image
                           const uint16_t dim_im_in_x,  // input image dimension x or W
@@ -31,6 +195,8 @@ void local_avepool_q7_HWC(const q7_t *Im_in,           // input image
                           const uint16_t stride_y,     // stride
                           const uint16_t dim_im_out_x, // output image dimension x or W
                           const uint16_t dim_im_out_y, // output image dimension y or H
+                          const uint16_t out_pixel_pitch, // distance of two output pixels, ch_im_in if packed
+                          const uint32_t out_row_pitch, // distance of two output rows, dim_im_out_x * ch_im_in if packed
                           q7_t *bufferA,               // a buffer for local storage, NULL by now
                           q7_t *Im_out)
 {
@@ -56,7 +222,7 @@ void local_avepool_q7_HWC(const q7_t *Im_in,           // input image
                         }
                     }
                 }
-                Im_out[i_ch_in + ch_im_in * (i_x + i_y * dim_im_out_x)] = sum / count;
+                Im_out[i_ch_in + i_x * out_pixel_pitch + i_y * out_row_pitch] = sum / count;
             }
         }
     }
@@ -75,6 +241,8 @@ void local_maxpool_q7_HWC(const q7_t *Im_in,           // input image
                           const uint16_t stride_y,     // stride
                           const uint16_t dim_im_out_x, // output image dimension x or W
                           const uint16_t dim_im_out_y, // output image dimension y or H
+                          const uint16_t out_pixel_pitch, // distance of two output pixels, ch_im_in if packed
+                          const uint32_t out_row_pitch, // distance of two output rows, dim_im_out_x * ch_im_in if packed
                           q7_t *bufferA,               // a buffer for local storage, NULL by now
                           q7_t *Im_out)
 {
@@ -101,7 +269,7 @@ void local_maxpool_q7_HWC(const q7_t *Im_in,           // input image
                         }
                     }
                 }
-                Im_out[i_ch_in + ch_im_in * (i_x + i_y * dim_im_out_x)] = max;
+                Im_out[i_ch_in + i_x * out_pixel_pitch + i_y * out_row_pitch] = max;
             }
         }
     }
@@ -236,45 +404,54 @@ void local_convolve_HWC_q7_nonsquare(const q7_t *Im_in,
                                      const uint16_t bias_shift, const uint16_t out_shift, q7_t *Im_out, // output image
                                      const uint16_t dim_im_out_x,                                       // output image dimension x
                                      const uint16_t dim_im_out_y,                                       // output image dimension y
+                                     const uint16_t out_pixel_pitch,                                    // distance of two output pixels, ch_im_out if packed
+                                     const uint32_t out_row_pitch,                                      // distance of two output rows, dim_im_out_x * ch_im_out if packed
                                      q15_t *bufferA,                                                    //buffer space for input
                                      q7_t *bufferB                                                      //buffer space for output
 )
 {
-    int i, j, k, l, m, n;
-    int conv_out;
-    int in_row, in_col;
+    // im2col + GEMM: the receptive fields of two output pixels are copied to two columns in bufferA,
+    // zero padded, then each filter (a row of the weights) is multiplied with both columns.
+    // bufferA has room for 2 q15 columns (CMSIS-NN), which are 4 q7 columns.
+    const uint32_t col_len = ch_im_in * dim_kernel_y * dim_kernel_x;
+    const uint32_t num_pixels = dim_im_out_x * dim_im_out_y;
+    q7_t *col0 = (q7_t *)bufferA;
+    q7_t *col1 = col0 + col_len;
+    uint32_t pixel;
+    int i;
 
-    for (i = 0; i < ch_im_out; i++)
+    for (pixel = 0; pixel < num_pixels; pixel += 2)
     {
-        for (j = 0; j < dim_im_out_y; j++)
+        const int x0 = pixel % dim_im_out_x, y0 = pixel / dim_im_out_x;
+        const int x1 = (pixel + 1) % dim_im_out_x, y1 = (pixel + 1) / dim_im_out_x;
+        const bool has_pair = pixel + 1 < num_pixels;
+        q7_t *out0 = Im_out + y0 * out_row_pitch + x0 * out_pixel_pitch;
+        q7_t *out1 = Im_out + y1 * out_row_pitch + x1 * out_pixel_pitch;
+
+        local_im2col_q7_HWC(Im_in, dim_im_in_x, dim_im_in_y, ch_im_in, dim_kernel_x, dim_kernel_y,
+                            padding_x, padding_y, stride_x * x0, stride_y * y0, col0);
+        if (has_pair)
+            local_im2col_q7_HWC(Im_in, dim_im_in_x, dim_im_in_y, ch_im_in, dim_kernel_x, dim_kernel_y,
+                                padding_x, padding_y, stride_x * x1, stride_y * y1, col1);
+
+        for (i = 0; i < ch_im_out; i++)
         {
-            for (k = 0; k < dim_im_out_x; k++)
-            {
+            const q7_t *w = wt + i * col_len;
 #ifndef NNOM_TRUNCATE
-                conv_out = ((q31_t)(bias[i]) << bias_shift) + (0x1 << (out_shift - 1));
+            q31_t sum0 = ((q31_t)(bias[i]) << bias_shift) + (0x1 << (out_shift - 1));
 #else
-                conv_out = bias[i] << bias_shift;
+            q31_t sum0 = (q31_t)(bias[i]) << bias_shift;
 #endif
-                for (m = 0; m < dim_kernel_y; m++)
-                {
-                    for (n = 0; n < dim_kernel_x; n++)
-                    {
-                        // if-for implementation
-                        in_row = stride_y * j + m - padding_y;
-                        in_col = stride_x * k + n - padding_x;
-                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in_y && in_col < dim_im_in_x)
-                        {
-                            for (l = 0; l < ch_im_in; l++)
-                            {
-                                conv_out += Im_in[(in_row * dim_im_in_x + in_col) * ch_im_in + l] *
-                                            wt[i * ch_im_in * dim_kernel_y * dim_kernel_x + (m * dim_kernel_x + n) * ch_im_in +
-                                               l];
-                            }
-                        }
-                    }
-                }
-                Im_out[i + (j * dim_im_out_x + k) * ch_im_out] = (q7_t)__NNOM_SSAT((conv_out >> out_shift), 8);
+            q31_t sum1 = sum0;
+
+            if (has_pair)
+            {
+                local_dot_q7_2col(w, col0, col1, col_len, &sum0, &sum1);
+                out1[i] = (q7_t)__NNOM_SSAT((sum1 >> out_shift), 8);
             }
+            else
+                sum0 += local_dot_q7(w, col0, col_len);
+            out0[i] = (q7_t)__NNOM_SSAT((sum0 >> out_shift), 8);
         }
     }
 }
@@ -297,39 +474,59 @@ void local_depthwise_separable_conv_HWC_q7_nonsquare(const q7_t *Im_in,
                                                      q7_t *Im_out,                // output image
                                                      const uint16_t dim_im_out_x, // output image dimension x
                                                      const uint16_t dim_im_out_y, // output image dimension y
+                                                     const uint16_t out_pixel_pitch, // distance of two output pixels, ch_im_out if packed
+                                                     const uint32_t out_row_pitch, // distance of two output rows, dim_im_out_x * ch_im_out if packed
                                                      q15_t *bufferA,              //buffer space for input
                                                      q7_t *bufferB                //buffer space for output
 )
 {
-    int i_out_y, i_out_x, i_ch_out;
-    int i_ker_y, i_ker_x;
+    // each output pixel sums the valid kernel taps channel by channel. The taps inside the image
+    // are found once per pixel, so the channel loop has no bounds checks.
+    // the channels are done in groups of NNOM_DW_GROUP, which accumulate in 32bit on the stack.
+    // with a channel multiplier, output channel (ch * mult + m) is input channel ch with the filter m,
+    // the weights are ordered as [mult][kernel_y][kernel_x][ch_im_in].
+    const int mult = ch_im_out / ch_im_in;
+    const int taps = dim_kernel_x * dim_kernel_y;
+    int32_t acc[NNOM_DW_GROUP];
+    int i_out_y, i_out_x, i_ch, i_ker_y, i_ker_x, m, c;
     for (i_out_y = 0; i_out_y < dim_im_out_y; i_out_y++)
     {
+        const int base_y = stride_y * i_out_y - padding_y;
+        const int ker_y_start = base_y < 0 ? -base_y : 0;
+        const int ker_y_end = base_y + dim_kernel_y > dim_im_in_y ? dim_im_in_y - base_y : dim_kernel_y;
         for (i_out_x = 0; i_out_x < dim_im_out_x; i_out_x++)
         {
-            for (i_ch_out = 0; i_ch_out < ch_im_out; i_ch_out++)
+            const int base_x = stride_x * i_out_x - padding_x;
+            const int ker_x_start = base_x < 0 ? -base_x : 0;
+            const int ker_x_end = base_x + dim_kernel_x > dim_im_in_x ? dim_im_in_x - base_x : dim_kernel_x;
+            q7_t *out = Im_out + i_out_y * out_row_pitch + i_out_x * out_pixel_pitch;
+
+            for (m = 0; m < mult; m++)
             {
-                // for each output
+                const q7_t *wt_m = wt + m * taps * ch_im_in;
+                for (i_ch = 0; i_ch < ch_im_in; i_ch += NNOM_DW_GROUP)
+                {
+                    const int group = ch_im_in - i_ch < NNOM_DW_GROUP ? ch_im_in - i_ch : NNOM_DW_GROUP;
+                    for (c = 0; c < group; c++)
+                    {
 #ifndef NNOM_TRUNCATE
-                int conv_out = (bias[i_ch_out] << bias_shift) + (0x1 << (out_shift - 1));
+                        acc[c] = (bias[(i_ch + c) * mult + m] << bias_shift) + (0x1 << (out_shift - 1));
 #else
-                int conv_out = bias[i_ch_out] << bias_shift;
+                        acc[c] = bias[(i_ch + c) * mult + m] << bias_shift;
 #endif
-                for (i_ker_y = 0; i_ker_y < dim_kernel_y; i_ker_y++)
-                {
-                    for (i_ker_x = 0; i_ker_x < dim_kernel_x; i_ker_x++)
+                    }
+                    for (i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
                     {
-                        int in_row = stride_y * i_out_y + i_ker_y - padding_y;
-                        int in_col = stride_x * i_out_x + i_ker_x - padding_x;
-                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in_y && in_col < dim_im_in_x)
+                        for (i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
                         {
-                            conv_out += Im_in[(in_row * dim_im_in_x + in_col) * ch_im_in + i_ch_out] *
-                                        wt[(i_ker_y * dim_kernel_x + i_ker_x) * ch_im_out + i_ch_out];
+                            const q7_t *in = Im_in + ((base_y + i_ker_y) * dim_im_in_x + base_x + i_ker_x) * ch_im_in + i_ch;
+                            const q7_t *w = wt_m + (i_ker_y * dim_kernel_x + i_ker_x) * ch_im_in + i_ch;
+                            local_mac_q7(in, w, acc, group);
                         }
                     }
+                    for (c = 0; c < group; c++)
+                        out[(i_ch + c) * mult + m] = (q7_t)__NNOM_SSAT((acc[c] >> out_shift), 8);
                 }
-                Im_out[(i_out_y * dim_im_out_x + i_out_x) * ch_im_out + i_ch_out] =
-                    (q7_t)__NNOM_SSAT((conv_out >> out_shift), 8);
             }
         }
     }
@@ -454,6 +651,61 @@ void local_fully_connected_q7_opt(const q7_t *pV,               // pointer to ve
     }
 }
 
+// q15 version, weights and bias are q15 too. the output is packed.
+void local_convolve_HWC_q15_nonsquare(const q15_t *Im_in,                // input image
+                                      const uint16_t dim_im_in_x,        // input image dimention x
+                                      const uint16_t dim_im_in_y,        // input image dimention y
+                                      const uint16_t ch_im_in,           // number of input image channels
+                                      const q15_t *wt,                   // kernel weights
+                                      const uint16_t ch_im_out,          // number of filters, i.e., output image channels
+                                      const uint16_t dim_kernel_x,       // filter kernel size x
+                                      const uint16_t dim_kernel_y,       // filter kernel size y
+                                      const uint16_t padding_x,          // padding sizes x
+                                      const uint16_t padding_y,          // padding sizes y
+                                      const uint16_t stride_x,           // stride x
+                                      const uint16_t stride_y,           // stride y
+                                      const q15_t *bias,                 // bias
+                                      const uint16_t bias_shift, const uint16_t out_shift, q15_t *Im_out, // output image
+                                      const uint16_t dim_im_out_x,       // output image dimension x
+                                      const uint16_t dim_im_out_y)       // output image dimension y
+{
+    int i, j, k, l, m, n;
+    q31_t conv_out;
+    int in_row, in_col;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out_y; j++)
+        {
+            for (k = 0; k < dim_im_out_x; k++)
+            {
+#ifndef NNOM_TRUNCATE
+                conv_out = ((q31_t)bias[i] << bias_shift) + (0x1 << (out_shift - 1));
+#else
+                conv_out = (q31_t)bias[i] << bias_shift;
+#endif
+                for (m = 0; m < dim_kernel_y; m++)
+                {
+                    for (n = 0; n < dim_kernel_x; n++)
+                    {
+                        in_row = stride_y * j + m - padding_y;
+                        in_col = stride_x * k + n - padding_x;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in_y && in_col < dim_im_in_x)
+                        {
+                            for (l = 0; l < ch_im_in; l++)
+                            {
+                                conv_out += (q31_t)Im_in[(in_row * dim_im_in_x + in_col) * ch_im_in + l] *
+                                    wt[i * ch_im_in * dim_kernel_y * dim_kernel_x + (m * dim_kernel_x + n) * ch_im_in + l];
+                            }
+                        }
+                    }
+                }
+                Im_out[i + (j * dim_im_out_x + k) * ch_im_out] = (q15_t)__NNOM_SSAT((conv_out >> out_shift), 16);
+            }
+        }
+    }
+}
+
 void local_fully_connected_q7(const q7_t *pV,               // pointer to vector
                               const q7_t *pM,               // pointer to matrix
                               const uint16_t dim_vec,       // length of the vector
@@ -478,13 +730,119 @@ void local_fully_connected_q7(const q7_t *pV,               // pointer to vector
     }
 }
 
+// q15 version of the opt one, the weights are interleaved by 4 rows like arm_fully_connected_q15_opt().
+void local_fully_connected_q15_opt(const q15_t *pV,               // pointer to vector
+                                   const q15_t *pM,               // pointer to matrix
+                                   const uint16_t dim_vec,        // length of the vector
+                                   const uint16_t num_of_rows,    // numCol of A
+                                   const uint16_t bias_shift,     // amount of left-shift for bias
+                                   const uint16_t out_shift,      // amount of right-shift for output
+                                   const q15_t *bias, q15_t *pOut) // output operand
+{
+    uint16_t rowCnt = num_of_rows >> 2;
+    const q15_t *pB = pM;
+    const q15_t *pA;
+    q15_t *pO = pOut;
+    const q15_t *pBias = bias;
+
+    while (rowCnt)
+    {
+#ifndef NNOM_TRUNCATE
+        q31_t sum = ((q31_t)(*pBias++) << bias_shift) + (0x1 << (out_shift - 1));
+        q31_t sum2 = ((q31_t)(*pBias++) << bias_shift) + (0x1 << (out_shift - 1));
+        q31_t sum3 = ((q31_t)(*pBias++) << bias_shift) + (0x1 << (out_shift - 1));
+        q31_t sum4 = ((q31_t)(*pBias++) << bias_shift) + (0x1 << (out_shift - 1));
+#else
+        q31_t sum = (q31_t)(*pBias++) << bias_shift;
+        q31_t sum2 = (q31_t)(*pBias++) << bias_shift;
+        q31_t sum3 = (q31_t)(*pBias++) << bias_shift;
+        q31_t sum4 = (q31_t)(*pBias++) << bias_shift;
+#endif
+        uint16_t colCnt = dim_vec >> 1;
+
+        pA = pV;
+        while (colCnt)
+        {
+            q15_t inA1 = *pA++;
+            q15_t inA2 = *pA++;
+
+            sum += inA1 * pB[0] + inA2 * pB[1];
+            sum2 += inA1 * pB[2] + inA2 * pB[3];
+            sum3 += inA1 * pB[4] + inA2 * pB[5];
+            sum4 += inA1 * pB[6] + inA2 * pB[7];
+            pB += 8;
+            colCnt--;
+        }
+        if (dim_vec & 0x1)
+        {
+            q15_t inA = *pA++;
+            sum += inA * pB[0];
+            sum2 += inA * pB[1];
+            sum3 += inA * pB[2];
+            sum4 += inA * pB[3];
+            pB += 4;
+        }
+        *pO++ = (q15_t)__NNOM_SSAT((sum >> out_shift), 16);
+        *pO++ = (q15_t)__NNOM_SSAT((sum2 >> out_shift), 16);
+        *pO++ = (q15_t)__NNOM_SSAT((sum3 >> out_shift), 16);
+        *pO++ = (q15_t)__NNOM_SSAT((sum4 >> out_shift), 16);
+
+        rowCnt--;
+    }
+
+    // the remaining rows are not interleaved
+    rowCnt = num_of_rows & 0x3;
+    while (rowCnt)
+    {
+#ifndef NNOM_TRUNCATE
+        q31_t ip_out = ((q31_t)(*pBias++) << bias_shift) + (0x1 << (out_shift - 1));
+#else
+        q31_t ip_out = (q31_t)(*pBias++) << bias_shift;
+#endif
+        pA = pV;
+        for (int j = 0; j < dim_vec; j++)
+            ip_out += *pA++ * *pB++;
+        *pO++ = (q15_t)__NNOM_SSAT((ip_out >> out_shift), 16);
+
+        rowCnt--;
+    }
+}
+
+// q15 version, weights and bias are q15 too.
+void local_fully_connected_q15(const q15_t *pV,               // pointer to vector
+                               const q15_t *pM,               // pointer to matrix
+                               const uint16_t dim_vec,        // length of the vector
+                               const uint16_t num_of_rows,    // numCol of A
+                               const uint16_t bias_shift,     // amount of left-shift for bias
+                               const uint16_t out_shift,      // amount of right-shift for output
+                               const q15_t *bias, q15_t *pOut) // output operand
+{
+    for (int i = 0; i < num_of_rows; i++)
+    {
+#ifndef NNOM_TRUNCATE
+        q31_t ip_out = ((q31_t)bias[i] << bias_shift) + (0x1 << (out_shift - 1));
+#else
+        q31_t ip_out = (q31_t)bias[i] << bias_shift;
+#endif
+        for (int j = 0; j < dim_vec; j++)
+        {
+            ip_out += (q31_t)pV[j] * pM[i * dim_vec + j];
+        }
+        pOut[i] = (q15_t)__NNOM_SSAT((ip_out >> out_shift), 16);
+    }
+}
+
+
+// the terms of the sum in local_softmax_q7(), by the distance to the base, 0 for the values which are ignored.
+static const q15_t nnom_softmax_exp_table[9] = {0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7, 1 << 8};
 
 void local_softmax_q7(const q7_t *vec_in, const uint32_t dim_vec, q7_t *p_out)
 {
     q31_t sum;
     int32_t i;
-    uint8_t shift;
+    int32_t d;
     q15_t base;
+    q7_t out_table[9];
     base = -257;
 
     /* We first search for the maximum */
@@ -503,15 +861,17 @@ void local_softmax_q7(const q7_t *vec_in, const uint32_t dim_vec, q7_t *p_out)
      */
     base = base - 8;
 
+    /*
+     * The values above the base are 1 to 8 from it, the others are ignored.
+     * Both the terms of the sum and the outputs only depend on this distance,
+     * so they are looked up in 9 entry tables, without branches in the loops.
+     */
     sum = 0;
-
     for (i = 0; i < dim_vec; i++)
     {
-        if (vec_in[i] > base)
-        {
-            shift = (uint8_t)__NNOM_USAT(vec_in[i] - base, 5);
-            sum += 0x1 << shift;
-        }
+        d = vec_in[i] - base;
+        d = d < 0 ? 0 : d;
+        sum += nnom_softmax_exp_table[d];
     }
 
     /* This is effectively (0x1 << 20) / sum */
@@ -522,90 +882,113 @@ void local_softmax_q7(const q7_t *vec_in, const uint32_t dim_vec, q7_t *p_out)
      * so 128 (0x1<<7) -> 100% confidence when sum = 0x1 << 8, output_base = 0x1 << 12 
      * and vec_in[i]-base = 8
      */
+    out_table[0] = 0;
+    for (d = 1; d <= 8; d++)
+        out_table[d] = (q7_t)__NNOM_SSAT((output_base >> (13 - d)), 8);
+
     for (i = 0; i < dim_vec; i++)
     {
-        if (vec_in[i] > base)
-        {
-            /* Here minimum value of 13+base-vec_in[i] will be 5 */
-            shift = (uint8_t)__NNOM_USAT(13 + base - vec_in[i], 5);
-            p_out[i] = (q7_t)__NNOM_SSAT((output_base >> shift), 8);
-        }
-        else
-        {
-            p_out[i] = 0;
-        }
+        d = vec_in[i] - base;
+        d = d < 0 ? 0 : d;
+        p_out[i] = out_table[d];
     }
 }
 
-void local_sigmoid_q7(q7_t *data, uint32_t size, uint16_t int_width)
+// look up a q7 table, indexed by the input in Q3.4 (int_width <= 3).
+// the lookups are independent, 4 of them in each round keep the load pipeline busy.
+static void local_lut_q7(q7_t *data, uint32_t size, const q7_t *table, uint16_t int_width)
 {
-    uint32_t i = size;
-    q7_t *pIn = data;
-    q7_t *pOut = data;
-    q7_t in;
-    q7_t out;
     uint16_t shift_size = 3 - int_width;
-	// saturation if int bit too large
-	if(int_width > 3)
-	{
-		while (i)
-		{
-			if(*pIn++ > 0)
-				*pOut++ = 127;
-			else
-				*pOut++ = 0;
-			i--;
-		}
-	}
-	// otherwise search table
-	else
-	{
-		while (i)
-		{
-			in = *pIn++;
-			out = nnom_sigmoid_table_q7[(uint8_t)(in >> shift_size)];
-			*pOut++ = out;
-			i--;
-		}
+    uint32_t i = 0;
+    q7_t in0, in1, in2, in3;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        in0 = data[i];
+        in1 = data[i + 1];
+        in2 = data[i + 2];
+        in3 = data[i + 3];
+        data[i] = table[(uint8_t)(in0 >> shift_size)];
+        data[i + 1] = table[(uint8_t)(in1 >> shift_size)];
+        data[i + 2] = table[(uint8_t)(in2 >> shift_size)];
+        data[i + 3] = table[(uint8_t)(in3 >> shift_size)];
+    }
+    for (; i < size; i++)
+        data[i] = table[(uint8_t)(data[i] >> shift_size)];
+}
+
+// q15 version, the table index is the top 8 bits of the input in Q3.12 (int_width <= 3),
+// the output is interpolated between the entry and the next one with the remaining bits.
+// the two products sum up like a dual 16 bits MAC (SMLAD on Cortex-M4).
+static void local_lut_q15(q15_t *data, uint32_t size, const q15_t *table, uint16_t int_width)
+{
+    uint16_t shift_size = 8 + 3 - int_width;
+    int32_t frac_mask = 0x7FF >> int_width;
+    int32_t full_frac = frac_mask + 1;
+    int32_t in, index, frac;
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        in = data[i];
+        index = in >> shift_size;
+        frac = in & frac_mask;
+        // the largest input has no next entry (the next one is the smallest input), it interpolates with itself.
+        data[i] = (q15_t)(((full_frac - frac) * table[(uint8_t)index] +
+            frac * table[(uint8_t)(index + (index != 127))]) >> shift_size);
+    }
+}
+
+// sigmoid saturates when the int bits are too large for the table
+void local_sigmoid_q7(q7_t *data, uint32_t size, uint16_t int_width)
+{
+    uint32_t i;
+    if (int_width > 3)
+    {
+        for (i = 0; i < size; i++)
+            data[i] = data[i] > 0 ? 127 : 0;
+    }
+    else
+        local_lut_q7(data, size, nnom_sigmoid_table_q7, int_width);
+}
+
+void local_sigmoid_q15(q15_t *data, uint32_t size, uint16_t int_width)
+{
+    uint32_t i;
+    if (int_width > 3)
+    {
+        for (i = 0; i < size; i++)
+            data[i] = data[i] > 0 ? 32767 : 0;
     }
+    else
+        local_lut_q15(data, size, nnom_sigmoid_table_q15, int_width);
 }
 
+// tanh saturates to the sign when the int bits are too large for the table
 void local_tanh_q7(q7_t *data, uint32_t size, uint16_t int_width)
 {
-    uint32_t i = size;
-    q7_t *pIn = data;
-    q7_t *pOut = data;
-    q7_t in;
-	q7_t out;
-	uint16_t shift_size = 3 - int_width;
-	
-	// saturation if int bit too large
-	if(int_width > 3)
-	{
-		while (i)
-		{
-			in = *pIn++;
-			if(in > 0)
-				*pOut++ = 127;
-			else if ( in == 0)
-				*pOut++ = 0;
-			else
-				*pOut++ = -128;
-			i--;
-		}
-	}
-	// otherwise search table
-	else
-	{
-		while (i)
-		{
-			in = *pIn++;
-			out = nnom_tanh_table_q7[(uint8_t)(in >> shift_size)];
-			*pOut++ = out;
-			i--;
-		}
-	}
+    uint32_t i;
+    if (int_width > 3)
+    {
+        for (i = 0; i < size; i++)
+            data[i] = (q7_t)((data[i] > 0) * 127 - (data[i] < 0) * 128);
+    }
+    else
+        local_lut_q7(data, size, nnom_tanh_table_q7, int_width);
 }
+
+void local_tanh_q15(q15_t *data, uint32_t size, uint16_t int_width)
+{
+    uint32_t i;
+    if (int_width > 3)
+    {
+        for (i = 0; i < size; i++)
+            data[i] = (q15_t)((data[i] > 0) * 32767 - (data[i] < 0) * 32768);
+    }
+    else
+        local_lut_q15(data, size, nnom_tanh_table_q15, int_width);
+}
+
 void local_relu_q7(q7_t *data, uint32_t size)
 {
     uint32_t i;
@@ -617,6 +1000,34 @@ void local_relu_q7(q7_t *data, uint32_t size)
     }
 }
 
+void local_relu_q15(q15_t *data, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = 0;
+    }
+}
+
+// q7 <-> q15, the q15 data has 8 more fractional bits. (same as arm_q7_to_q15() and arm_q15_to_q7())
+void local_q7_to_q15(const q7_t *pSrc, q15_t *pDst, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+        pDst[i] = (q15_t)pSrc[i] << 8;
+}
+
+void local_q15_to_q7(const q15_t *pSrc, q7_t *pDst, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+        pDst[i] = (q7_t)(pSrc[i] >> 8);
+}
+
 // matrix ops
 void local_mult_q7(q7_t *pSrcA,
                    q7_t *pSrcB,
@@ -72,6 +72,70 @@ nnom_status_t flatten_out_shape(nnom_layer_t *layer)
 	return NN_SUCCESS;
 }
 
+#if defined(NNOM_USING_CMSIS_NN) && defined(NNOM_CONV_CHANNEL_PADDING)
+// make the zero padded copy of the weights and bias, with ch_in aligned to 4 and ch_out aligned to 2.
+// weights are ordered as [ch_out][kernel_y][kernel_x][ch_in]
+static nnom_status_t conv2d_pad_channels(nnom_conv2d_layer_t *cl)
+{
+	const q7_t *weights = cl->weights->p_value;
+	const q7_t *bias = cl->bias->p_value;
+	uint16_t ch_in = cl->super.in->shape.c;
+	uint16_t ch_out = cl->super.out->shape.c;
+	uint32_t taps = cl->kernel.h * cl->kernel.w;
+	uint32_t weights_size;
+	uint32_t i, t;
+
+	cl->pad_ch_in = nnom_alignto(ch_in, 4);
+	cl->pad_ch_out = nnom_alignto(ch_out, 2);
+	weights_size = nnom_alignto(cl->pad_ch_out * taps * cl->pad_ch_in, 4);
+	if (cl->pad_weights == NULL)
+		cl->pad_weights = nnom_mem(weights_size + cl->pad_ch_out); // zeros
+	if (cl->pad_weights == NULL)
+		return NN_NO_MEMORY;
+	cl->pad_bias = cl->pad_weights + weights_size;
+
+	for (i = 0; i < ch_out; i++)
+	{
+		for (t = 0; t < taps; t++)
+			memcpy(cl->pad_weights + (i * taps + t) * cl->pad_ch_in, weights + (i * taps + t) * ch_in, ch_in);
+		cl->pad_bias[i] = bias[i];
+	}
+	return NN_SUCCESS;
+}
+#endif
+
+// a max pooling or an add fused into the conv (see model_fuse_layers()).
+// the conv output shape becomes the input shape of the fused layer and the layer outputs what the fused layer does.
+// the conv output is computed a band of rows at a time, the band is put at the end of the comp buf.
+static nnom_status_t conv2d_fused_out_shape(nnom_conv2d_layer_t *cl)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+	nnom_layer_t *fused = cl->fused;
+	nnom_layer_io_t *out = layer->out;
+	uint32_t band_rows = 1;
+
+	layer->stat.bytes -= shape_size(&out->shape);
+	if (fused->type == NNOM_MAXPOOL)
+	{
+		// the pooling input is hooked to the conv output
+		fused->comp_out_shape(fused);
+		band_rows = ((nnom_maxpool_layer_t *)fused)->kernel.h;
+	}
+	else
+	{
+		// the other input of the add is the conv's aux input
+		fused->in->shape = out->shape;
+		fused->out->shape = out->shape;
+		layer->in->aux->shape = layer->in->aux->hook.io->shape;
+		layer->stat.bytes += shape_size(&out->shape);
+	}
+	out->shape = fused->out->shape;
+	layer->stat.bytes += shape_size(&out->shape);
+	layer->comp->shape = shape(nnom_alignto(shape_size(&layer->comp->shape), 4) +
+		band_rows * fused->in->shape.w * fused->in->shape.c, 1, 1);
+	return NN_SUCCESS;
+}
+
 nnom_status_t conv2d_out_shape(nnom_layer_t *layer)
 {
 	nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
@@ -98,8 +162,31 @@ nnom_status_t conv2d_out_shape(nnom_layer_t *layer)
 	// bufferA size: (1D shape)
 	// 2*ch_im_in*dim_kernel*dim_kernel
 	layer->comp->shape = shape(2 * 2 * layer->in->shape.c * cl->kernel.w * cl->kernel.h, 1, 1);
+
+#if defined(NNOM_USING_CMSIS_NN) && defined(NNOM_CONV_CHANNEL_PADDING)
+	// odd channels, use the fast functions on channel padded data, except for RGB which has its own function.
+	// the comp buf holds the padded input, the padded output (if ch_out is padded) and bufferA.
+	// fused convs run on bands of rows with the basic function instead.
+	if ((in->shape.c % 4 != 0 || out->shape.c % 2 != 0) && !(in->shape.c == 3 && conv2d_is_square(cl)) &&
+		cl->fused == NULL && out->elem_size == sizeof(q7_t))
+	{
+		size_t size;
+		if (conv2d_pad_channels(cl) != NN_SUCCESS)
+			return NN_NO_MEMORY;
+		size = nnom_alignto(in->shape.h * in->shape.w * cl->pad_ch_in, 4);
+		if (cl->pad_ch_out != out->shape.c)
+			size += nnom_alignto(out->shape.h * out->shape.w * cl->pad_ch_out, 4);
+		size += 2 * 2 * cl->pad_ch_in * cl->kernel.w * cl->kernel.h;
+		layer->comp->shape = shape(size, 1, 1);
+	}
+#endif
 	// computational cost: K x K x Cin x Hour x Wout x Cout
 	layer->stat.macc = cl->kernel.w * cl->kernel.h * in->shape.c * out->shape.w * out->shape.h * out->shape.c;
+	// data: input, output, weights: K x K x Cin x Cout, bias: Cout
+	layer->stat.bytes = (shape_size(&in->shape) + shape_size(&out->shape)
+		+ cl->kernel.w * cl->kernel.h * in->shape.c * out->shape.c + out->shape.c) * out->elem_size;
+	if (cl->fused != NULL)
+		return conv2d_fused_out_shape(cl);
 	return NN_SUCCESS;
 }
 nnom_status_t dw_conv2d_out_shape(nnom_layer_t *layer)
@@ -129,6 +216,11 @@ nnom_status_t dw_conv2d_out_shape(nnom_layer_t *layer)
 
 	// computational cost: K x K x Cin x Hour x Wout x Multiplier
 	layer->stat.macc = cl->kernel.w * cl->kernel.h * in->shape.c * out->shape.w * out->shape.h * cl->filter_mult;
+	// data: input, output, weights: K x K x Cout, bias: Cout
+	layer->stat.bytes = shape_size(&in->shape) + shape_size(&out->shape)
+		+ cl->kernel.w * cl->kernel.h * out->shape.c + out->shape.c;
+	if (cl->fused != NULL)
+		return conv2d_fused_out_shape(cl);
 	return NN_SUCCESS;
 }
 
@@ -155,6 +247,8 @@ nnom_status_t dense_out_shape(nnom_layer_t *layer)
 
 	// computational cost: In * out
 	layer->stat.macc = in->shape.h * out->shape.h;
+	// data: input, output, weights: In x out, bias: out
+	layer->stat.bytes = (in->shape.h + out->shape.h + in->shape.h * out->shape.h + out->shape.h) * out->elem_size;
 	return NN_SUCCESS;
 }
 
@@ -306,6 +400,7 @@ nnom_status_t concatenate_out_shape(nnom_layer_t *layer)
 	uint32_t in_num = 0;
 	uint32_t offset;
 	int32_t shape_element_num;
+	uint32_t blocks, out_block_size, block_offset;
 
 	// for each input module, copy the shape from the output of last layer
 	in = layer->in;
@@ -358,6 +453,42 @@ nnom_status_t concatenate_out_shape(nnom_layer_t *layer)
 			*(nnom_shape_data_t *)((unsigned long)(&layer->in->shape) + i);
 	}
 
+	// the output is made of blocks, every input fills one part of each block.
+	// e.g. for the channel axis, a block is one pixel.
+	blocks = 1;
+	for (uint32_t i = 0; i < offset; i++)
+		blocks *= ((nnom_shape_axis_t *)(&layer->out->shape))->axis[i];
+	out_block_size = shape_size(&layer->out->shape) / blocks;
+
+	// set the views of the layers that write their output directly into ours (see compile_layers())
+	block_offset = 0;
+	in = layer->in;
+	while (in != NULL)
+	{
+		if (layer->out->mem != NULL && in->mem == layer->out->mem)
+		{
+			nnom_layer_io_t *src = in->hook.io;
+			src->view.offset = block_offset;
+			if (blocks == 1)
+			{
+				src->view.pixel_pitch = 0;
+				src->view.row_pitch = 0;
+			}
+			else if (offset == 1)
+			{
+				src->view.pixel_pitch = in->shape.c;
+				src->view.row_pitch = out_block_size;
+			}
+			else
+			{
+				src->view.pixel_pitch = out_block_size;
+				src->view.row_pitch = layer->out->shape.w * out_block_size;
+			}
+		}
+		block_offset += shape_size(&in->shape) / blocks;
+		in = in->aux;
+	}
+
 	return NN_SUCCESS;
 }
 
@@ -42,52 +42,348 @@ nnom_status_t flatten_run(nnom_layer_t *layer)
 	return NN_SUCCESS;
 }
 
+// output rows [row, row + rows) and columns [col, col + cols) of a conv or depthwise conv, packed in out.
+// the conv runs on the part of the input that these outputs need, with the padding on top and left adjusted to it.
+// a part of the columns needs a single input row (1D), the input columns of the other rows are not contiguous.
+static void conv2d_part_run(nnom_conv2d_layer_t *cl, uint16_t row, uint16_t rows, uint16_t col, uint16_t cols,
+	q7_t *out, q15_t *buf)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+	nnom_shape_t *in_shape = &layer->in->shape;
+	nnom_shape_t *out_shape = cl->fused != NULL ? &cl->fused->in->shape : &layer->out->shape;
+	int32_t start = row * cl->stride.h - cl->pad.h;
+	int32_t end = (row + rows - 1) * cl->stride.h - cl->pad.h + cl->kernel.h;
+	int32_t col_start = col * cl->stride.w - cl->pad.w;
+	int32_t col_end = (col + cols - 1) * cl->stride.w - cl->pad.w + cl->kernel.w;
+	uint16_t pad_top = 0, pad_left = 0;
+	uint16_t in_h, in_w;
+	q7_t *in;
+
+	if (start < 0)
+	{
+		pad_top = -start;
+		start = 0;
+	}
+	if (end > in_shape->h)
+		end = in_shape->h;
+	if (col_start < 0)
+	{
+		pad_left = -col_start;
+		col_start = 0;
+	}
+	if (col_end > in_shape->w)
+		col_end = in_shape->w;
+	in_h = end - start;
+	in_w = col_end - col_start;
+	in = (q7_t *)layer->in->mem->blk + (start * in_shape->w + col_start) * in_shape->c;
+
+	if (layer->type == NNOM_DW_CONV_2D)
+	{
+#ifdef NNOM_USING_CMSIS_NN
+		if (cl->filter_mult == 1 && in_shape->c % 2 == 0)
+		{
+			arm_depthwise_separable_conv_HWC_q7_nonsquare(in, in_w, in_h, in_shape->c,
+				cl->weights->p_value, in_shape->c,
+				cl->kernel.w, cl->kernel.h, pad_left, pad_top, cl->stride.w, cl->stride.h,
+				cl->bias->p_value, cl->bias_shift, cl->output_shift,
+				out, cols, rows, buf, NULL);
+			return;
+		}
+#endif
+		local_depthwise_separable_conv_HWC_q7_nonsquare(in, in_w, in_h, in_shape->c,
+			cl->weights->p_value, out_shape->c,
+			cl->kernel.w, cl->kernel.h, pad_left, pad_top, cl->stride.w, cl->stride.h,
+			cl->bias->p_value, cl->bias_shift, cl->output_shift,
+			out, cols, rows, out_shape->c, cols * out_shape->c, buf, NULL);
+		return;
+	}
+#ifdef NNOM_USING_CMSIS_NN
+	if (in_shape->c % 4 == 0 && out_shape->c % 2 == 0)
+	{
+		if (cl->kernel.w == 1 && cl->kernel.h == 1 && cl->stride.w == 1 && cl->stride.h == 1 &&
+			cl->pad.w == 0 && cl->pad.h == 0)
+			arm_convolve_1x1_HWC_q7_fast_nonsquare(in, in_w, in_h, in_shape->c,
+				cl->weights->p_value, out_shape->c,
+				cl->kernel.w, cl->kernel.h, pad_left, pad_top, cl->stride.w, cl->stride.h,
+				cl->bias->p_value, cl->bias_shift, cl->output_shift,
+				out, cols, rows, buf, NULL);
+		else
+			arm_convolve_HWC_q7_fast_nonsquare(in, in_w, in_h, in_shape->c,
+				cl->weights->p_value, out_shape->c,
+				cl->kernel.w, cl->kernel.h, pad_left, pad_top, cl->stride.w, cl->stride.h,
+				cl->bias->p_value, cl->bias_shift, cl->output_shift,
+				out, cols, rows, buf, NULL);
+	}
+	else
+		arm_convolve_HWC_q7_basic_nonsquare(in, in_w, in_h, in_shape->c,
+			cl->weights->p_value, out_shape->c,
+			cl->kernel.w, cl->kernel.h, pad_left, pad_top, cl->stride.w, cl->stride.h,
+			cl->bias->p_value, cl->bias_shift, cl->output_shift,
+			out, cols, rows, buf, NULL);
+#else
+	local_convolve_HWC_q7_nonsquare(in, in_w, in_h, in_shape->c,
+		cl->weights->p_value, out_shape->c,
+		cl->kernel.w, cl->kernel.h, pad_left, pad_top, cl->stride.w, cl->stride.h,
+		cl->bias->p_value, cl->bias_shift, cl->output_shift,
+		out, cols, rows, out_shape->c, cols * out_shape->c, buf, NULL);
+#endif
+}
+
+// the conv with a max pooling or an add fused (see model_fuse_layers()).
+// the conv output is computed into a band of a few rows, which is pooled or added to the output straight away.
+static nnom_status_t conv2d_fused_run(nnom_conv2d_layer_t *cl)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+	nnom_layer_t *fused = cl->fused;
+	nnom_activation_t *act = fused->actail;
+	nnom_shape_t *conv_shape = &fused->in->shape;
+	nnom_shape_t *out_shape = &layer->out->shape;
+	uint32_t row_size = conv_shape->w * conv_shape->c;
+	q15_t *buf = (q15_t *)layer->comp->mem->blk;
+	q7_t *out = nnom_io_data(layer->out);
+	q7_t *band;
+	nnom_qformat_t fmt = layer->out->qfmt;
+	int32_t row, rows, y, x, c, ky, kx, x_start, x_end;
+
+	// the conv's own activation keeps its format if it has one.
+	if (act != NULL && (act->fmt.m != 0 || act->fmt.n != 0))
+		fmt = act->fmt;
+
+	if (fused->type == NNOM_ADD)
+	{
+		int32_t oshift = ((nnom_matrix_layer_t *)fused)->oshift;
+		q7_t *other = layer->in->aux->mem->blk;
+
+		band = (q7_t *)buf + shape_size(&layer->comp->shape) - row_size;
+		for (row = 0; row < conv_shape->h; row++)
+		{
+			conv2d_part_run(cl, row, 1, 0, conv_shape->w, band, buf);
+			if (act != NULL)
+				act_direct_run(layer, act, band, row_size, fmt);
+#ifdef NNOM_USING_CMSIS_NN
+			if (oshift == 0)
+				arm_add_q7(band, other + row * row_size, out + row * row_size, row_size);
+			else
+#endif
+				local_add_q7(band, other + row * row_size, out + row * row_size, oshift, row_size);
+		}
+		return NN_SUCCESS;
+	}
+
+	// max pooling, the windows do not overlap vertically so each conv output row is computed once.
+	{
+		nnom_maxpool_layer_t *pool = (nnom_maxpool_layer_t *)fused;
+		band = (q7_t *)buf + shape_size(&layer->comp->shape) - pool->kernel.h * row_size;
+		for (y = 0; y < out_shape->h; y++)
+		{
+			row = y * pool->stride.h - pool->pad.h;
+			rows = pool->kernel.h;
+			if (row < 0)
+			{
+				rows += row;
+				row = 0;
+			}
+			if (row + rows > conv_shape->h)
+				rows = conv_shape->h - row;
+
+			conv2d_part_run(cl, row, rows, 0, conv_shape->w, band, buf);
+			if (act != NULL)
+				act_direct_run(layer, act, band, rows * row_size, fmt);
+
+			for (x = 0; x < out_shape->w; x++)
+			{
+				q7_t *pixel = out + (y * out_shape->w + x) * out_shape->c;
+				x_start = x * pool->stride.w - pool->pad.w;
+				x_end = x_start + pool->kernel.w;
+				if (x_start < 0)
+					x_start = 0;
+				if (x_end > conv_shape->w)
+					x_end = conv_shape->w;
+
+				memcpy(pixel, band + x_start * conv_shape->c, conv_shape->c);
+				for (ky = 0; ky < rows; ky++)
+				{
+					for (kx = x_start; kx < x_end; kx++)
+					{
+						q7_t *p = band + ky * row_size + kx * conv_shape->c;
+						for (c = 0; c < conv_shape->c; c++)
+							if (p[c] > pixel[c])
+								pixel[c] = p[c];
+					}
+				}
+			}
+		}
+	}
+	return NN_SUCCESS;
+}
+
 nnom_status_t dw_conv2d_run(nnom_layer_t *layer)
 {
-	nnom_status_t result = NN_SUCCESS;
 	nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
 
-	// CMSIS-NN only support 1 mulplipier in depthwise conv
-	if (cl->filter_mult != 1 || layer->in->shape.c % 2 != 0 || layer->out->shape.c % 2)
-		return NN_ARGUMENT_ERROR;
+	if (cl->fused != NULL)
+		return conv2d_fused_run(cl);
 
-	// cmsis-nn dw does not support multiplier, we need to do it by our own
 #ifdef NNOM_USING_CMSIS_NN
-	result = (nnom_status_t)arm_depthwise_separable_conv_HWC_q7_nonsquare(
-#else
-	local_depthwise_separable_conv_HWC_q7_nonsquare(
+	// CMSIS-NN only support 1 mulplipier and even channels in depthwise conv
+	if (cl->filter_mult == 1 && layer->in->shape.c % 2 == 0)
+		return (nnom_status_t)arm_depthwise_separable_conv_HWC_q7_nonsquare(
+			layer->in->mem->blk,
+			layer->in->shape.w, layer->in->shape.h, layer->in->shape.c,
+			cl->weights->p_value,
+			layer->in->shape.c,
+			cl->kernel.w, cl->kernel.h,
+			cl->pad.w, cl->pad.h,
+			cl->stride.w, cl->stride.h,
+			cl->bias->p_value,
+			cl->bias_shift, cl->output_shift,
+			nnom_io_data(layer->out),
+			layer->out->shape.w, layer->out->shape.h, (q15_t *)(layer->comp->mem->blk), NULL);
 #endif
+	// the local one takes any multiplier and channel number
+	local_depthwise_separable_conv_HWC_q7_nonsquare(
 		layer->in->mem->blk,
 		layer->in->shape.w, layer->in->shape.h, layer->in->shape.c,
 		cl->weights->p_value,
-		layer->in->shape.c,
+		layer->out->shape.c,
 		cl->kernel.w, cl->kernel.h,
 		cl->pad.w, cl->pad.h,
 		cl->stride.w, cl->stride.h,
 		cl->bias->p_value,
 		cl->bias_shift, cl->output_shift,
-		layer->out->mem->blk,
-		layer->out->shape.w, layer->out->shape.h, (q15_t *)(layer->comp->mem->blk), NULL);
+		nnom_io_data(layer->out),
+		layer->out->shape.w, layer->out->shape.h,
+		nnom_io_pixel_pitch(layer->out), nnom_io_row_pitch(layer->out),
+		(q15_t *)(layer->comp->mem->blk), NULL);
+	return NN_SUCCESS;
+}
 
+#ifdef NNOM_USING_CMSIS_NN
+// the fast CMSIS-NN convolutions, ch_in must be multiple of 4 and ch_out multiple of 2
+static nnom_status_t conv2d_fast_run(nnom_conv2d_layer_t *cl,
+	const q7_t *in, uint16_t ch_in, const q7_t *weights, const q7_t *bias, q7_t *out, uint16_t ch_out, q15_t *buf)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+
+	// 1x1 fast
+	if (cl->kernel.w == 1 && cl->kernel.h == 1 && cl->stride.w == 1 && cl->stride.h == 1 &&
+		cl->pad.w == 0 && cl->pad.h == 0)
+		return (nnom_status_t)arm_convolve_1x1_HWC_q7_fast_nonsquare(
+			in,
+			layer->in->shape.w, layer->in->shape.h, ch_in,
+			weights,
+			ch_out,
+			cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
+			bias, cl->bias_shift,
+			cl->output_shift, out, layer->out->shape.w, layer->out->shape.h,
+			buf, NULL);
+	// opt square shape
+	if (conv2d_is_square(cl))
+		return (nnom_status_t)arm_convolve_HWC_q7_fast(
+			in, layer->in->shape.w, ch_in,
+			weights,
+			ch_out, cl->kernel.w, cl->pad.w, cl->stride.w,
+			bias, cl->bias_shift,
+			cl->output_shift, out,
+			layer->out->shape.w, buf, NULL);
+	// opt none square shape
+	return (nnom_status_t)arm_convolve_HWC_q7_fast_nonsquare(
+		in,
+		layer->in->shape.w, layer->in->shape.h, ch_in,
+		weights, ch_out,
+		cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
+		bias, cl->bias_shift, cl->output_shift,
+		out,
+		layer->out->shape.w, layer->out->shape.h, buf, NULL);
+}
+
+// odd channels, run the fast functions with the weights padded on compiling.
+// the input is copied to a channel padded image in the comp buf, so is the output if ch_out is padded.
+static nnom_status_t conv2d_padded_run(nnom_conv2d_layer_t *cl)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+	uint16_t ch_in = layer->in->shape.c;
+	uint16_t ch_out = layer->out->shape.c;
+	uint32_t in_pixels = layer->in->shape.h * layer->in->shape.w;
+	uint32_t out_pixels = layer->out->shape.h * layer->out->shape.w;
+	q7_t *in = layer->in->mem->blk;
+	q7_t *out = nnom_io_data(layer->out);
+	q7_t *pad_in = layer->comp->mem->blk;
+	q7_t *pad_out = pad_in + nnom_alignto(in_pixels * cl->pad_ch_in, 4);
+	q7_t *buf = pad_out;
+	nnom_status_t result;
+	uint32_t i;
+
+	if (cl->pad_ch_out != ch_out)
+		buf += nnom_alignto(out_pixels * cl->pad_ch_out, 4);
+	else
+		pad_out = out;
+
+	for (i = 0; i < in_pixels; i++)
+	{
+		memcpy(pad_in + i * cl->pad_ch_in, in + i * ch_in, ch_in);
+		memset(pad_in + i * cl->pad_ch_in + ch_in, 0, cl->pad_ch_in - ch_in);
+	}
+
+	result = conv2d_fast_run(cl, pad_in, cl->pad_ch_in, cl->pad_weights, cl->pad_bias,
+		pad_out, cl->pad_ch_out, (q15_t *)buf);
+
+	if (pad_out != out)
+		for (i = 0; i < out_pixels; i++)
+			memcpy(out + i * ch_out, pad_out + i * cl->pad_ch_out, ch_out);
 	return result;
 }
+#endif
+
+// q15 conv (see Q15())
+static nnom_status_t conv2d_q15_run(nnom_conv2d_layer_t *cl)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+
+#ifdef NNOM_USING_CMSIS_NN
+	// ch_im_in and ch_im_out are multiple of 2
+	if (layer->in->shape.c % 2 == 0 && layer->out->shape.c % 2 == 0)
+		return (nnom_status_t)arm_convolve_HWC_q15_fast_nonsquare(
+			layer->in->mem->blk,
+			layer->in->shape.w, layer->in->shape.h, layer->in->shape.c,
+			cl->weights->p_value, layer->out->shape.c,
+			cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
+			cl->bias->p_value, cl->bias_shift, cl->output_shift,
+			nnom_io_data(layer->out),
+			layer->out->shape.w, layer->out->shape.h, (q15_t *)(layer->comp->mem->blk), NULL);
+#endif
+	local_convolve_HWC_q15_nonsquare(
+		layer->in->mem->blk,
+		layer->in->shape.w, layer->in->shape.h, layer->in->shape.c,
+		cl->weights->p_value, layer->out->shape.c,
+		cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
+		cl->bias->p_value, cl->bias_shift, cl->output_shift,
+		nnom_io_data(layer->out),
+		layer->out->shape.w, layer->out->shape.h);
+	return NN_SUCCESS;
+}
 
 nnom_status_t conv2d_run(nnom_layer_t *layer)
 {
 	nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
 
+	if (cl->fused != NULL)
+		return conv2d_fused_run(cl);
+	if (layer->out->elem_size == sizeof(q15_t))
+		return conv2d_q15_run(cl);
+
 #ifdef NNOM_USING_CMSIS_NN
 
 	//RGB
 	// ch_im_in = 3, w = h
-	if (layer->in->shape.c == 3 && layer->in->shape.h == layer->in->shape.w)
+	if (layer->in->shape.c == 3 && conv2d_is_square(cl))
 		return (nnom_status_t)arm_convolve_HWC_q7_RGB(
 			layer->in->mem->blk, layer->in->shape.w, layer->in->shape.c,
 			cl->weights->p_value,
 			layer->out->shape.c,
 			cl->kernel.w, cl->pad.w, cl->stride.w,
 			cl->bias->p_value, cl->bias_shift,
-			cl->output_shift, layer->out->mem->blk, layer->out->shape.w,
+			cl->output_shift, nnom_io_data(layer->out), layer->out->shape.w,
 			(q15_t *)(layer->comp->mem->blk), NULL);
 
 	// check if can use optimized function
@@ -95,49 +391,23 @@ nnom_status_t conv2d_run(nnom_layer_t *layer)
 	//	ch_im_out is multiple of 2
 	if (layer->in->shape.c % 4 == 0 &&
 		layer->out->shape.c % 2 == 0)
-	{
-		// 1x1 fast
-		if (cl->kernel.w == 1 && cl->kernel.h == 1)
-			return (nnom_status_t)arm_convolve_1x1_HWC_q7_fast_nonsquare(
-				layer->in->mem->blk,
-				layer->in->shape.w, layer->in->shape.h, layer->in->shape.c,
-				cl->weights->p_value,
-				layer->out->shape.c,
-				cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
-				cl->bias->p_value, cl->bias_shift,
-				cl->output_shift, layer->out->mem->blk, layer->out->shape.w, layer->out->shape.h,
-				(q15_t *)(layer->comp->mem->blk), NULL);
-		// opt square shape
-		if (layer->in->shape.h == layer->in->shape.w)
-			return (nnom_status_t)arm_convolve_HWC_q7_fast(
-				layer->in->mem->blk, layer->in->shape.w, layer->in->shape.c,
-				cl->weights->p_value,
-				layer->out->shape.c, cl->kernel.w, cl->pad.w, cl->stride.w,
-				cl->bias->p_value, cl->bias_shift,
-				cl->output_shift, layer->out->mem->blk,
-				layer->out->shape.w, (q15_t *)(layer->comp->mem->blk), NULL);
-		// opt none square shape
-		else
-			return (nnom_status_t)arm_convolve_HWC_q7_fast_nonsquare(
-				layer->in->mem->blk,
-				layer->in->shape.w, layer->in->shape.h, layer->in->shape.c,
-				cl->weights->p_value, layer->out->shape.c,
-				cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
-				cl->bias->p_value, cl->bias_shift, cl->output_shift,
-				layer->out->mem->blk,
-				layer->out->shape.w, layer->out->shape.h, (q15_t *)(layer->comp->mem->blk), NULL);
-	}
+		return conv2d_fast_run(cl, layer->in->mem->blk, layer->in->shape.c,
+			cl->weights->p_value, cl->bias->p_value,
+			nnom_io_data(layer->out), layer->out->shape.c, (q15_t *)(layer->comp->mem->blk));
+	// channels padded on compiling
+	else if (cl->pad_weights != NULL)
+		return conv2d_padded_run(cl);
 	// none optimized
 	else
 	{
 		// none opt square shape
-		if (layer->in->shape.h == layer->in->shape.w)
+		if (conv2d_is_square(cl))
 			return (nnom_status_t)arm_convolve_HWC_q7_basic(
 				layer->in->mem->blk, layer->in->shape.w, layer->in->shape.c,
 				cl->weights->p_value,
 				layer->out->shape.c, cl->kernel.w, cl->pad.w, cl->stride.w,
 				cl->bias->p_value, cl->bias_shift,
-				cl->output_shift, layer->out->mem->blk,
+				cl->output_shift, nnom_io_data(layer->out),
 				layer->out->shape.w, (q15_t *)(layer->comp->mem->blk), NULL);
 		// none opt none square shape
 		else
@@ -147,7 +417,7 @@ nnom_status_t conv2d_run(nnom_layer_t *layer)
 				cl->weights->p_value, layer->out->shape.c,
 				cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
 				cl->bias->p_value, cl->bias_shift, cl->output_shift,
-				layer->out->mem->blk,
+				nnom_io_data(layer->out),
 				layer->out->shape.w, layer->out->shape.h, (q15_t *)(layer->comp->mem->blk), NULL);
 	}
 // end of cmsis nn
@@ -159,8 +429,10 @@ nnom_status_t conv2d_run(nnom_layer_t *layer)
 				cl->weights->p_value, layer->out->shape.c,
 				cl->kernel.w, cl->kernel.h, cl->pad.w, cl->pad.h, cl->stride.w, cl->stride.h,
 				cl->bias->p_value, cl->bias_shift, cl->output_shift,
-				layer->out->mem->blk,
-				layer->out->shape.w, layer->out->shape.h, (q15_t *)(layer->comp->mem->blk), NULL);
+				nnom_io_data(layer->out),
+				layer->out->shape.w, layer->out->shape.h,
+				nnom_io_pixel_pitch(layer->out), nnom_io_row_pitch(layer->out),
+				(q15_t *)(layer->comp->mem->blk), NULL);
 	return NN_SUCCESS;
 #endif
 }
@@ -224,30 +496,22 @@ nnom_status_t cell_simple_rnn_run(nnom_layer_t *layer)
 	return NN_SUCCESS;
 }
 
-nnom_status_t rnn_run(nnom_layer_t *layer)
+// run the cell on the time steps [start, end)
+static nnom_status_t rnn_steps_run(nnom_layer_t *layer, uint32_t start, uint32_t end)
 {
-	nnom_status_t result;
+	nnom_status_t result = NN_SUCCESS;
 	nnom_rnn_layer_t *cl = (nnom_rnn_layer_t *)(layer);
-	size_t timestamps_size = layer->in->shape.w;
 	size_t feature_size    = layer->in->shape.c;
 	size_t output_size     = cl->cell->units;
 
-	// set the state buffer
-	cl->cell->state_buf = layer->comp->mem;
-
-	// currently not support stateful. and not support reserved mem block
-	if(!cl->stateful)
-		memset(cl->cell->state_buf, 0, shape_size(&layer->comp->shape));
-
-	// run
-	for (uint32_t round = 0; round < timestamps_size; round++)
+	for (uint32_t round = start; round < end; round++)
 	{
 		// set input buffer
 		cl->cell->input_buf = (q7_t*)layer->in->mem->blk + feature_size * round;
 		if(cl->return_sequence)
-			cl->cell->output_buf = (q7_t*)layer->out->mem->blk + output_size * round;
+			cl->cell->output_buf = (q7_t*)nnom_io_data(layer->out) + output_size * round;
 		else
-			cl->cell->output_buf = layer->out->mem->blk;
+			cl->cell->output_buf = nnom_io_data(layer->out);
 
 		// run it
 		result = cl->cell->run(layer);
@@ -255,11 +519,65 @@ nnom_status_t rnn_run(nnom_layer_t *layer)
 	return result;
 }
 
+nnom_status_t rnn_run(nnom_layer_t *layer)
+{
+	nnom_rnn_layer_t *cl = (nnom_rnn_layer_t *)(layer);
+
+	// set the state buffer, which is kept between runs (LAYER_BUF_RESERVED)
+	cl->cell->state_buf = layer->comp->mem->blk;
+
+	if(!cl->stateful)
+		memset(cl->cell->state_buf, 0, shape_size(&layer->comp->shape));
+
+	return rnn_steps_run(layer, 0, layer->in->shape.w);
+}
+
+// q15 dense (see Q15())
+static nnom_status_t dense_q15_run(nnom_dense_layer_t *cl)
+{
+	nnom_layer_t *layer = (nnom_layer_t *)cl;
+	nnom_status_t result = NN_SUCCESS;
+
+#if !(DENSE_WEIGHT_OPT)
+	#ifdef NNOM_USING_CMSIS_NN
+		result = (nnom_status_t)arm_fully_connected_q15(
+			layer->in->mem->blk, cl->weights->p_value,
+			layer->in->shape.h, layer->out->shape.h,
+			cl->bias_shift, cl->output_shift,
+			cl->bias->p_value, nnom_io_data(layer->out), NULL);
+	#else
+		local_fully_connected_q15(
+			layer->in->mem->blk, cl->weights->p_value,
+			layer->in->shape.h, layer->out->shape.h,
+			cl->bias_shift, cl->output_shift,
+			cl->bias->p_value, nnom_io_data(layer->out));
+	#endif
+#else
+	#ifdef NNOM_USING_CMSIS_NN
+		result = (nnom_status_t)arm_fully_connected_q15_opt(
+			layer->in->mem->blk, cl->weights->p_value,
+			layer->in->shape.h, layer->out->shape.h,
+			cl->bias_shift, cl->output_shift,
+			cl->bias->p_value, nnom_io_data(layer->out), NULL);
+	#else
+		local_fully_connected_q15_opt(
+			layer->in->mem->blk, cl->weights->p_value,
+			layer->in->shape.h, layer->out->shape.h,
+			cl->bias_shift, cl->output_shift,
+			cl->bias->p_value, nnom_io_data(layer->out));
+	#endif
+#endif
+	return result;
+}
+
 nnom_status_t dense_run(nnom_layer_t *layer)
 {
 	nnom_status_t result = NN_SUCCESS;
 	nnom_dense_layer_t *cl = (nnom_dense_layer_t *)(layer);
 
+	if (layer->out->elem_size == sizeof(q15_t))
+		return dense_q15_run(cl);
+
 	// test, optimize
 #if !(DENSE_WEIGHT_OPT)
 	#ifdef NNOM_USING_CMSIS_NN
@@ -272,7 +590,7 @@ nnom_status_t dense_run(nnom_layer_t *layer)
 			layer->in->shape.h, layer->out->shape.h,
 			cl->bias_shift, cl->output_shift,
 			cl->bias->p_value,
-			layer->out->mem->blk, (q15_t *)(layer->comp->mem->blk));
+			nnom_io_data(layer->out), (q15_t *)(layer->comp->mem->blk));
 #else
 	#ifdef NNOM_USING_CMSIS_NN
 		result = (nnom_status_t)arm_fully_connected_q7_opt(
@@ -284,12 +602,22 @@ nnom_status_t dense_run(nnom_layer_t *layer)
 			layer->in->shape.h, layer->out->shape.h,
 			cl->bias_shift, cl->output_shift,
 			cl->bias->p_value,
-			layer->out->mem->blk, (q15_t *)(layer->comp->mem->blk));
+			nnom_io_data(layer->out), (q15_t *)(layer->comp->mem->blk));
 #endif
 
 	return result;
 }
 
+// q7 <-> q15 (see QConvert())
+nnom_status_t qconvert_run(nnom_layer_t *layer)
+{
+	if (layer->out->elem_size == sizeof(q15_t))
+		local_q7_to_q15(layer->in->mem->blk, nnom_io_data(layer->out), shape_size(&layer->in->shape));
+	else
+		local_q15_to_q7(layer->in->mem->blk, nnom_io_data(layer->out), shape_size(&layer->in->shape));
+	return NN_SUCCESS;
+}
+
 nnom_status_t activation_run(nnom_layer_t *layer)
 {
 	nnom_activation_layer_t *cl = (nnom_activation_layer_t *)layer;
@@ -315,7 +643,7 @@ nnom_status_t maxpool_run(nnom_layer_t *layer)
 			cl->kernel.w, cl->pad.w, cl->stride.w,
 			layer->out->shape.w,
 			NULL,
-			layer->out->mem->blk);
+			nnom_io_data(layer->out));
 	}
 	// none square 2D, or 1D
 	else
@@ -328,8 +656,9 @@ nnom_status_t maxpool_run(nnom_layer_t *layer)
 				cl->pad.w, cl->pad.h,
 				cl->stride.w, cl->stride.h,
 				layer->out->shape.w, layer->out->shape.h,
+				nnom_io_pixel_pitch(layer->out), nnom_io_row_pitch(layer->out),
 				NULL,
-				layer->out->mem->blk);
+				nnom_io_data(layer->out));
 	}
 
 	return NN_SUCCESS;
@@ -350,7 +679,7 @@ nnom_status_t avgpool_run(nnom_layer_t *layer)
 			cl->kernel.w, cl->pad.w, cl->stride.w,
 			layer->out->shape.w,
 			layer->comp->mem->blk,
-			layer->out->mem->blk);
+			nnom_io_data(layer->out));
 	}
 	// none square 2D, or 1D
 	else
@@ -363,8 +692,9 @@ nnom_status_t avgpool_run(nnom_layer_t *layer)
 				cl->pad.w, cl->pad.h,
 				cl->stride.w, cl->stride.h,
 				layer->out->shape.w, layer->out->shape.h,
+				nnom_io_pixel_pitch(layer->out), nnom_io_row_pitch(layer->out),
 				NULL,
-				layer->out->mem->blk);
+				nnom_io_data(layer->out));
 	}
 
 	return NN_SUCCESS;
@@ -381,7 +711,7 @@ nnom_status_t sumpool_run(nnom_layer_t *layer)
 			cl->stride.w, cl->stride.h,
 			layer->out->shape.w, layer->out->shape.h,
 			layer->comp->mem->blk,
-			layer->out->mem->blk);
+			nnom_io_data(layer->out));
 
 	return NN_SUCCESS;
 }
@@ -395,7 +725,7 @@ nnom_status_t upsample_run(nnom_layer_t *layer)
 			cl->kernel.w, cl->kernel.h, 
 			layer->out->shape.w, layer->out->shape.h,
 			NULL,
-			layer->out->mem->blk);
+			nnom_io_data(layer->out));
 
 	return NN_SUCCESS;
 }
@@ -405,9 +735,9 @@ nnom_status_t softmax_run(nnom_layer_t *layer)
 {
 #ifdef NNOM_USING_CMSIS_NN
 	// temporary fixed for mutiple dimension input. 
-	arm_softmax_q7(layer->in->mem->blk, shape_size(&layer->out->shape), layer->out->mem->blk);
+	arm_softmax_q7(layer->in->mem->blk, shape_size(&layer->out->shape), nnom_io_data(layer->out));
 #else
-	local_softmax_q7(layer->in->mem->blk, shape_size(&layer->out->shape), layer->out->mem->blk);
+	local_softmax_q7(layer->in->mem->blk, shape_size(&layer->out->shape), nnom_io_data(layer->out));
 #endif
 	return NN_SUCCESS;
 }
@@ -417,72 +747,30 @@ nnom_status_t concat_run(nnom_layer_t *layer)
 	// by default, concat layer has mutiple (>=2) input and 1 output.
 	nnom_concat_layer_t *cl = (nnom_concat_layer_t *)layer;
 	nnom_shape_axis_t *out_shape = (nnom_shape_axis_t *)(&layer->out->shape); // get the shape.axis[0,1,2...] access to shape type
-	nnom_shape_axis_t *in_shape;
-	uint32_t offset;
+	uint8_t *pout = nnom_io_data(layer->out);
+	uint32_t blocks = 1;
+	uint32_t out_block_size, in_block_size;
 	nnom_layer_io_t *in;
 
-	// last axis, shape c
-	offset = cl->axis;
+	// the output is made of blocks, every input fills one part of each block.
+	// e.g. for the channel axis (2), a block is one pixel. for axis 0, there is only one block.
+	for (int i = 0; i < cl->axis; i++)
+		blocks *= out_shape->axis[i];
+	out_block_size = shape_size(&layer->out->shape) / blocks;
 
-	// concat by different axis, TODO, change to nested loop
-	// the concat axis might be different, means that, the block size for each input could be different
-	if (offset == 0)
+	in = layer->in;
+	while (in != NULL)
 	{
-		uint8_t *pin;
-		uint8_t *pout = layer->out->mem->blk;
-		in = layer->in;
-		while (in != NULL)
-		{
-			pin = in->mem->blk;
-			memcpy(pout, pin, shape_size(&in->shape));
-			pout += shape_size(&in->shape);
-
-			in = in->aux;
-		}
-	}
-	else if (offset == 1)
-	{
-		uint8_t *pin;
-		uint8_t *pout = layer->out->mem->blk;
-		uint32_t block_size;
-
-		for (int j = 0; j < out_shape->axis[0]; j++)
+		in_block_size = shape_size(&in->shape) / blocks;
+		// layers which wrote their output directly into ours are done already (see compile_layers())
+		if (in->mem != layer->out->mem)
 		{
-			in = layer->in;
-			while (in != NULL)
-			{
-				in_shape = (nnom_shape_axis_t*)(&in->shape);
-				block_size = in_shape->axis[2] * in_shape->axis[1];
-				pin = (uint8_t *)in->mem->blk + j * block_size;
-				memcpy(pout, pin, block_size);
-				pout += block_size;
-
-				in = in->aux;
-			}
-		}
-	}
-	else if (offset == 2)
-	{
-		uint32_t total_size = 0; 
-		uint8_t *pin;
-		uint8_t *pout = layer->out->mem->blk;
-		uint32_t block_size;
-
-		for (int j = 0; j < out_shape->axis[1] * out_shape->axis[0]; j++)
-		{
-			in = layer->in;
-			while (in != NULL)
-			{
-				in_shape = (nnom_shape_axis_t*)(&in->shape);
-				block_size = in_shape->axis[2];
-				pin = (uint8_t*)in->mem->blk + j * block_size;
-				memcpy(pout, pin, block_size);
-				pout += block_size;
-				total_size += block_size;
-
-				in = in->aux;
-			}
+			uint8_t *pin = in->mem->blk;
+			for (uint32_t j = 0; j < blocks; j++)
+				memcpy(pout + j * out_block_size, pin + j * in_block_size, in_block_size);
 		}
+		pout += in_block_size;
+		in = in->aux;
 	}
 
 	return NN_SUCCESS;
@@ -499,10 +787,10 @@ nnom_status_t add_run(nnom_layer_t *layer)
 	// adding the first 2 matrix
 	#ifdef NNOM_USING_CMSIS_NN
 	if(oshift == 0)
-		arm_add_q7(layer->in->mem->blk, layer->in->aux->mem->blk, layer->out->mem->blk, size);
+		arm_add_q7(layer->in->mem->blk, layer->in->aux->mem->blk, nnom_io_data(layer->out), size);
 	else
 	#endif
-		local_add_q7(layer->in->mem->blk, layer->in->aux->mem->blk, layer->out->mem->blk, oshift, size);
+		local_add_q7(layer->in->mem->blk, layer->in->aux->mem->blk, nnom_io_data(layer->out), oshift, size);
 
 	
 	// if there is 3rd or more, we should use 
@@ -514,10 +802,10 @@ nnom_status_t add_run(nnom_layer_t *layer)
 			// adding the first 2 matrix
 			#ifdef NNOM_USING_CMSIS_NN
 			if(oshift == 0)
-				arm_add_q7(in->mem->blk, layer->out->mem->blk, layer->out->mem->blk, size);
+				arm_add_q7(in->mem->blk, nnom_io_data(layer->out), nnom_io_data(layer->out), size);
 			else
 			#endif
-				local_add_q7(in->mem->blk, layer->out->mem->blk, layer->out->mem->blk, oshift, size);
+				local_add_q7(in->mem->blk, nnom_io_data(layer->out), nnom_io_data(layer->out), oshift, size);
 
 			in = in->aux;
 		}
@@ -536,10 +824,10 @@ nnom_status_t sub_run(nnom_layer_t *layer)
 	// the first 2 matrix
 	#ifdef NNOM_USING_CMSIS_NN
 	if(oshift == 0)
-		arm_sub_q7(layer->in->mem->blk, layer->in->aux->mem->blk, layer->out->mem->blk, size);
+		arm_sub_q7(layer->in->mem->blk, layer->in->aux->mem->blk, nnom_io_data(layer->out), size);
 	else
 	#endif
-		local_sub_q7(layer->in->mem->blk, layer->in->aux->mem->blk, layer->out->mem->blk, oshift, size);
+		local_sub_q7(layer->in->mem->blk, layer->in->aux->mem->blk, nnom_io_data(layer->out), oshift, size);
 
 	// if there is 3rd or more
 	if (layer->in->aux->aux != NULL)
@@ -550,10 +838,10 @@ nnom_status_t sub_run(nnom_layer_t *layer)
 			// adding the first 2 matrix
 			#ifdef NNOM_USING_CMSIS_NN
 			if(oshift == 0)
-				arm_sub_q7(in->mem->blk, layer->out->mem->blk, layer->out->mem->blk, size);
+				arm_sub_q7(in->mem->blk, nnom_io_data(layer->out), nnom_io_data(layer->out), size);
 			else
 			#endif
-				local_sub_q7(in->mem->blk, layer->out->mem->blk, layer->out->mem->blk, oshift, size);
+				local_sub_q7(in->mem->blk, nnom_io_data(layer->out), nnom_io_data(layer->out), oshift, size);
 
 			in = in->aux;
 		}
@@ -571,10 +859,10 @@ nnom_status_t mult_run(nnom_layer_t *layer)
 	// the first 2 matrix
 	#ifdef NNOM_USING_CMSIS_NN
 	if(oshift == 0)
-		arm_mult_q7(layer->in->mem->blk, layer->in->aux->mem->blk, layer->out->mem->blk, size);
+		arm_mult_q7(layer->in->mem->blk, layer->in->aux->mem->blk, nnom_io_data(layer->out), size);
 	else
 	#endif
-		local_mult_q7(layer->in->mem->blk, layer->in->aux->mem->blk, layer->out->mem->blk, oshift, size);
+		local_mult_q7(layer->in->mem->blk, layer->in->aux->mem->blk, nnom_io_data(layer->out), oshift, size);
 	
 	// if there is 3rd or more
 	if (layer->in->aux->aux != NULL)
@@ -585,13 +873,181 @@ nnom_status_t mult_run(nnom_layer_t *layer)
 			// adding the first 2 matrix
 			#ifdef NNOM_USING_CMSIS_NN
 			if(oshift == 0)
-				arm_sub_q7(in->mem->blk, layer->out->mem->blk, layer->out->mem->blk, size);
+				arm_sub_q7(in->mem->blk, nnom_io_data(layer->out), nnom_io_data(layer->out), size);
 			else
 			#endif
-				local_sub_q7(in->mem->blk, layer->out->mem->blk, layer->out->mem->blk, oshift, size);
+				local_sub_q7(in->mem->blk, nnom_io_data(layer->out), nnom_io_data(layer->out), oshift, size);
 
 			in = in->aux;
 		}
 	}
 	return NN_SUCCESS;
 }
+
+// streaming (see model_run_stream())
+// the layers below run on 1D data and only compute the output columns which are new, see nnom_io_stream_t.
+// the output columns of the last run are moved left in place, so the new ones are always at the same place.
+
+// move the columns of the last run to their place now, the new ones are computed after.
+static void stream_move(nnom_layer_io_t *io)
+{
+	uint32_t pixel = io->shape.c;
+	uint8_t *data = nnom_io_data(io);
+	uint16_t keep = io->shape.w - io->stream.head - io->stream.tail;
+
+	memmove(data + io->stream.head * pixel, data + (io->stream.head + io->stream.shift) * pixel, keep * pixel);
+}
+
+// the output columns of a sliding window (conv, pooling) which are the ones of the last run moved by shift / stride.
+// they are the ones whose windows only cover input columns of the last run.
+// return false if all of them are new.
+static bool stream_window(nnom_layer_io_t *in, nnom_layer_io_t *out, uint16_t kernel, uint16_t stride, uint16_t pad)
+{
+	nnom_io_stream_t *s = &in->stream;
+	int32_t first, last;
+
+	// 1D only, the columns of the other rows are not contiguous.
+	if (in->shape.h != 1 || s->head + s->tail >= in->shape.w || s->shift % stride != 0 || nnom_io_is_strided(out))
+		return false;
+	out->stream.shift = s->shift / stride;
+	// the first window starting after the new columns in the head, and the last one ending before the tail.
+	first = (s->head + pad + stride - 1) / stride;
+	last = (int32_t)in->shape.w - s->tail + pad - kernel;
+	if (last < 0)
+		return false;
+	last /= stride;
+	// the column must be in the output of the last run
+	if (last > (int32_t)out->shape.w - 1 - out->stream.shift)
+		last = out->shape.w - 1 - out->stream.shift;
+	if (last < first)
+		return false;
+	out->stream.head = first;
+	out->stream.tail = out->shape.w - 1 - last;
+	return true;
+}
+
+nnom_status_t input_stream_run(nnom_layer_t *layer)
+{
+	// the new input is set to the input io by model_run_stream()
+	layer->out->stream = layer->in->stream;
+	return input_run(layer);
+}
+
+nnom_status_t conv2d_stream_run(nnom_layer_t *layer)
+{
+	nnom_conv2d_layer_t *cl = (nnom_conv2d_layer_t *)layer;
+	nnom_layer_io_t *out = layer->out;
+	q7_t *data = nnom_io_data(out);
+	q15_t *buf = (q15_t *)layer->comp->mem->blk;
+
+	if (cl->fused != NULL || out->elem_size != sizeof(q7_t) ||
+		!stream_window(layer->in, out, cl->kernel.w, cl->stride.w, cl->pad.w))
+	{
+		nnom_io_stream_new(out);
+		return layer->run(layer);
+	}
+	stream_move(out);
+	if (out->stream.head > 0)
+		conv2d_part_run(cl, 0, 1, 0, out->stream.head, data, buf);
+	if (out->stream.tail > 0)
+		conv2d_part_run(cl, 0, 1, out->shape.w - out->stream.tail, out->stream.tail,
+			data + (out->shape.w - out->stream.tail) * out->shape.c, buf);
+	return NN_SUCCESS;
+}
+
+// output columns [col, col + cols) of a 1D max or average pooling, packed in out
+static void pool_part_run(nnom_layer_t *layer, uint16_t col, uint16_t cols, q7_t *out)
+{
+	nnom_maxpool_layer_t *cl = (nnom_maxpool_layer_t *)layer;
+	nnom_shape_t *in_shape = &layer->in->shape;
+	int32_t start = col * cl->stride.w - cl->pad.w;
+	int32_t end = (col + cols - 1) * cl->stride.w - cl->pad.w + cl->kernel.w;
+	uint16_t pad_left = 0;
+	q7_t *in;
+
+	if (start < 0)
+	{
+		pad_left = -start;
+		start = 0;
+	}
+	if (end > in_shape->w)
+		end = in_shape->w;
+	in = (q7_t *)layer->in->mem->blk + start * in_shape->c;
+
+	if (layer->type == NNOM_MAXPOOL)
+		local_maxpool_q7_HWC(in, end - start, in_shape->h, in_shape->c,
+			cl->kernel.w, cl->kernel.h, pad_left, cl->pad.h, cl->stride.w, cl->stride.h,
+			cols, 1, in_shape->c, cols * in_shape->c, NULL, out);
+	else
+		local_avepool_q7_HWC(in, end - start, in_shape->h, in_shape->c,
+			cl->kernel.w, cl->kernel.h, pad_left, cl->pad.h, cl->stride.w, cl->stride.h,
+			cols, 1, in_shape->c, cols * in_shape->c, NULL, out);
+}
+
+nnom_status_t pool_stream_run(nnom_layer_t *layer)
+{
+	nnom_maxpool_layer_t *cl = (nnom_maxpool_layer_t *)layer;
+	nnom_layer_io_t *out = layer->out;
+	q7_t *data = nnom_io_data(out);
+
+	// the global poolings are built on MaxPool()
+	if ((layer->type != NNOM_MAXPOOL && layer->type != NNOM_AVGPOOL) ||
+		!stream_window(layer->in, out, cl->kernel.w, cl->stride.w, cl->pad.w))
+	{
+		nnom_io_stream_new(out);
+		return layer->run(layer);
+	}
+	stream_move(out);
+	if (out->stream.head > 0)
+		pool_part_run(layer, 0, out->stream.head, data);
+	if (out->stream.tail > 0)
+		pool_part_run(layer, out->shape.w - out->stream.tail, out->stream.tail,
+			data + (out->shape.w - out->stream.tail) * out->shape.c);
+	return NN_SUCCESS;
+}
+
+nnom_status_t activation_stream_run(nnom_layer_t *layer)
+{
+	nnom_activation_layer_t *cl = (nnom_activation_layer_t *)layer;
+	nnom_io_stream_t *s = &layer->in->stream;
+	uint32_t pixel = layer->in->shape.c;
+	q7_t *data = layer->in->mem->blk;
+
+	// in place, the columns of the last run are activated already.
+	layer->out->stream = *s;
+	if (layer->in->shape.h != 1 || s->head + s->tail >= layer->in->shape.w || layer->in->elem_size != sizeof(q7_t))
+	{
+		nnom_io_stream_new(layer->out);
+		return activation_run(layer);
+	}
+	if (s->head > 0)
+		act_direct_run(layer, cl->act, data, s->head * pixel, layer->in->qfmt);
+	if (s->tail > 0)
+		act_direct_run(layer, cl->act, data + (layer->in->shape.w - s->tail) * pixel, s->tail * pixel, layer->in->qfmt);
+	return NN_SUCCESS;
+}
+
+// a stateful RNN runs each time step once, on the new ones. the others run the whole sequence again.
+nnom_status_t rnn_stream_run(nnom_layer_t *layer)
+{
+	nnom_rnn_layer_t *cl = (nnom_rnn_layer_t *)(layer);
+	nnom_layer_io_t *out = layer->out;
+	nnom_io_stream_t *s = &layer->in->stream;
+
+	if (!cl->stateful || s->head + s->tail >= layer->in->shape.w)
+	{
+		nnom_io_stream_new(out);
+		return rnn_run(layer);
+	}
+	cl->cell->state_buf = layer->comp->mem->blk;
+	if (cl->return_sequence)
+	{
+		out->stream.shift = s->shift;
+		out->stream.head = 0;
+		out->stream.tail = s->tail;
+		stream_move(out);
+	}
+	else
+		nnom_io_stream_new(out);
+	return rnn_steps_run(layer, layer->in->shape.w - s->tail, layer->in->shape.w);
+}
@@ -260,33 +260,39 @@ nnom_status_t nnom_predic(nnom_model_t *m, uint32_t *label, float *prob)
 static void layer_stat(nnom_layer_t *layer)
 {
 	// layer stat
-	NNOM_LOG(" %10s -  %8d      ",
+	NNOM_LOG(" %10s -  %8lu  %8lu      ",
 		   (char *)&default_layer_names[layer->type],
-		   layer->stat.time);
+		   (unsigned long)layer->stat.time, (unsigned long)layer->stat.cycles);
 
 	// MAC operation
 	if(layer->stat.macc == 0)
 		NNOM_LOG("            ");
 	else if (layer->stat.macc < 10000)
-		NNOM_LOG("%7d     ", layer->stat.macc);
+		NNOM_LOG("%7d     ", (int)layer->stat.macc);
 	else if (layer->stat.macc < 1000*1000)
-		NNOM_LOG("%6dk     ", layer->stat.macc/1000);
+		NNOM_LOG("%6dk     ", (int)(layer->stat.macc/1000));
 	else if (layer->stat.macc < 1000*1000*1000)
-		NNOM_LOG("%3d.%02dM     ", layer->stat.macc/(1000*1000), layer->stat.macc%(1000*1000)/(10*1000)); // xxx.xx M
+		NNOM_LOG("%3d.%02dM     ", (int)(layer->stat.macc/(1000*1000)), (int)(layer->stat.macc%(1000*1000)/(10*1000))); // xxx.xx M
 	else
-		NNOM_LOG("%3d.%02dG     ", layer->stat.macc/(1000*1000*1000), layer->stat.macc%(1000*1000*1000)/(10*1000*1000)); // xxx.xx G
+		NNOM_LOG("%3d.%02dG     ", (int)(layer->stat.macc/(1000*1000*1000)), (int)(layer->stat.macc%(1000*1000*1000)/(10*1000*1000))); // xxx.xx G
 
 	// layer efficiency
-	if (layer->stat.macc != 0)
-		NNOM_LOG("%d.%02d\n", layer->stat.macc / layer->stat.time, (layer->stat.macc * 100) / (layer->stat.time) % 100);
+	if (layer->stat.macc != 0 && layer->stat.cycles != 0)
+		NNOM_LOG("%4d.%02d  ", (int)(layer->stat.macc / layer->stat.cycles),
+			(int)((uint64_t)layer->stat.macc * 100 / layer->stat.cycles % 100));
 	else
-		NNOM_LOG("\n");
+		NNOM_LOG("         ");
+
+	// data moved
+	NNOM_LOG("%8lu\n", (unsigned long)layer->stat.bytes);
 }
 
 void model_stat(nnom_model_t *m)
 {
 	size_t total_ops = 0;
 	size_t total_time = 0;
+	size_t total_cycles = 0;
+	size_t total_bytes = 0;
 	nnom_layer_t *layer;
 	size_t run_num = 0;
 
@@ -296,24 +302,84 @@ void model_stat(nnom_model_t *m)
 	layer = m->head;
 
 	NNOM_LOG("\nPrint running stat..\n");
-	NNOM_LOG("Layer(#)        -   Time(us)     ops(MACs)   ops/us \n");
-	NNOM_LOG("--------------------------------------------------------\n");
+	NNOM_LOG("Layer(#)        -   Time(us)    cycles     ops(MACs)   MACs/cycle   bytes\n");
+	NNOM_LOG("--------------------------------------------------------------------------\n");
 	while (layer)
 	{
 		run_num++;
-		NNOM_LOG("#%-3d", run_num);
+		NNOM_LOG("#%-3d", (int)run_num);
 		total_ops += layer->stat.macc;
 		total_time += layer->stat.time;
+		total_cycles += layer->stat.cycles;
+		total_bytes += layer->stat.bytes;
 		layer_stat(layer);
 		if (layer->shortcut == NULL)
 			break;
 		layer = layer->shortcut;
 	}
 	NNOM_LOG("\nSummary:\n");
-	NNOM_LOG("Total ops (MAC): %d", total_ops);
-	NNOM_LOG("(%d.%02dM)\n", total_ops/(1000*1000), total_ops%(1000*1000)/(10000));
-	NNOM_LOG("Prediction time :%dus\n", total_time);
-	NNOM_LOG("Efficiency %d.%02d ops/us\n",
-		   (total_ops / total_time),
-		   (total_ops * 100) / (total_time) % 100);
+	NNOM_LOG("Total ops (MAC): %lu", (unsigned long)total_ops);
+	NNOM_LOG("(%d.%02dM)\n", (int)(total_ops/(1000*1000)), (int)(total_ops%(1000*1000)/(10000)));
+	NNOM_LOG("Prediction time :%luus (%lu cycles)\n", (unsigned long)total_time, (unsigned long)total_cycles);
+	NNOM_LOG("Data moved: %lu bytes\n", (unsigned long)total_bytes);
+	if (total_time != 0)
+		NNOM_LOG("Efficiency %d.%02d ops/us\n",
+			   (int)(total_ops / total_time),
+			   (int)((total_ops * 100) / (total_time) % 100));
+}
+
+void model_stat_csv(nnom_model_t *m)
+{
+	nnom_layer_t *layer;
+	size_t run_num = 0;
+
+	if (!m)
+		return;
+
+	NNOM_LOG("layer,type,time_us,cycles,macc,bytes\n");
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+	{
+		run_num++;
+		NNOM_LOG("%d,%s,%lu,%lu,%lu,%lu\n", (int)run_num, (char *)&default_layer_names[layer->type],
+			(unsigned long)layer->stat.time, (unsigned long)layer->stat.cycles,
+			(unsigned long)layer->stat.macc, (unsigned long)layer->stat.bytes);
+	}
+}
+
+static uint8_t *stat_put_u32(uint8_t *p, uint32_t value)
+{
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+	return p + 4;
+}
+
+size_t model_stat_dump(nnom_model_t *m, void *buf, size_t size)
+{
+	nnom_layer_t *layer;
+	uint32_t layer_num = 0;
+	uint8_t *p = buf;
+
+	if (!m || !buf)
+		return 0;
+
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+		layer_num++;
+	if (size < NNOM_STAT_DUMP_SIZE(layer_num))
+		return 0;
+
+	p = stat_put_u32(p, NNOM_STAT_DUMP_MAGIC);
+	p = stat_put_u32(p, NNOM_STAT_DUMP_VERSION);
+	p = stat_put_u32(p, layer_num);
+	p = stat_put_u32(p, NNOM_CYCLES_PER_US);
+	for (layer = m->head; layer != NULL; layer = layer->shortcut)
+	{
+		p = stat_put_u32(p, layer->type);
+		p = stat_put_u32(p, layer->stat.time);
+		p = stat_put_u32(p, layer->stat.cycles);
+		p = stat_put_u32(p, layer->stat.macc);
+		p = stat_put_u32(p, layer->stat.bytes);
+	}
+	return NNOM_STAT_DUMP_SIZE(layer_num);
 }
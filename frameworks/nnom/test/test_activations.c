@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2018-2019
+ * Jianjia Ma, Wearable Bio-Robotics Group (WBR)
+ * majianjia@live.com
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host test of the table driven activations of nnom_local.c.
+ * They must give the results of the previous kernels (kept below as references)
+ * and of CMSIS-NN bit for bit.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nnom.h"
+#include "nnom_local.h"
+#include "arm_nnfunctions.h"
+
+static int failures;
+
+#define CHECK(cond, ...)                  \
+	do                                    \
+	{                                     \
+		if (!(cond))                      \
+		{                                 \
+			if (failures++ < 20)          \
+				printf(__VA_ARGS__);      \
+		}                                 \
+	} while (0)
+
+// ---------------------------------------------------------------------------------------------
+// references, the kernels before they were table driven
+
+static void ref_softmax_q7(const q7_t *vec_in, const uint32_t dim_vec, q7_t *p_out)
+{
+	q31_t sum;
+	int32_t i;
+	uint8_t shift;
+	q15_t base;
+	base = -257;
+
+	for (i = 0; i < dim_vec; i++)
+	{
+		if (vec_in[i] > base)
+			base = vec_in[i];
+	}
+	base = base - 8;
+
+	sum = 0;
+	for (i = 0; i < dim_vec; i++)
+	{
+		if (vec_in[i] > base)
+		{
+			shift = (uint8_t)__NNOM_USAT(vec_in[i] - base, 5);
+			sum += 0x1 << shift;
+		}
+	}
+
+	int output_base = 0x100000 / sum;
+
+	for (i = 0; i < dim_vec; i++)
+	{
+		if (vec_in[i] > base)
+		{
+			shift = (uint8_t)__NNOM_USAT(13 + base - vec_in[i], 5);
+			p_out[i] = (q7_t)__NNOM_SSAT((output_base >> shift), 8);
+		}
+		else
+			p_out[i] = 0;
+	}
+}
+
+static void ref_sigmoid_q7(q7_t *data, uint32_t size, uint16_t int_width)
+{
+	uint32_t i = size;
+	q7_t *pIn = data;
+	q7_t *pOut = data;
+	uint16_t shift_size = 3 - int_width;
+
+	if (int_width > 3)
+	{
+		while (i)
+		{
+			if (*pIn++ > 0)
+				*pOut++ = 127;
+			else
+				*pOut++ = 0;
+			i--;
+		}
+	}
+	else
+	{
+		while (i)
+		{
+			*pOut++ = nnom_sigmoid_table_q7[(uint8_t)(*pIn++ >> shift_size)];
+			i--;
+		}
+	}
+}
+
+static void ref_tanh_q7(q7_t *data, uint32_t size, uint16_t int_width)
+{
+	uint32_t i = size;
+	q7_t *pIn = data;
+	q7_t *pOut = data;
+	q7_t in;
+	uint16_t shift_size = 3 - int_width;
+
+	if (int_width > 3)
+	{
+		while (i)
+		{
+			in = *pIn++;
+			if (in > 0)
+				*pOut++ = 127;
+			else if (in == 0)
+				*pOut++ = 0;
+			else
+				*pOut++ = -128;
+			i--;
+		}
+	}
+	else
+	{
+		while (i)
+		{
+			*pOut++ = nnom_tanh_table_q7[(uint8_t)(*pIn++ >> shift_size)];
+			i--;
+		}
+	}
+}
+
+// the q15 kernels are new, the reference is the interpolation of arm_nn_activations_direct_q15()
+// with the index wrapping like the q7 tables, the largest input interpolates with itself.
+static q15_t ref_lut_q15(q15_t in, const q15_t *table, uint16_t int_width, int is_tanh)
+{
+	int32_t shift_size = 8 + 3 - int_width;
+	int32_t full_frac = (0x7FF >> int_width) + 1;
+	int32_t index, next, frac;
+
+	if (int_width > 3)
+	{
+		if (in > 0)
+			return 32767;
+		return (is_tanh && in < 0) ? -32768 : 0;
+	}
+	index = in >> shift_size;
+	next = index == 127 ? 127 : index + 1;
+	frac = in & (full_frac - 1);
+	return (q15_t)(((full_frac - frac) * table[index & 0xFF] + frac * table[next & 0xFF]) >> shift_size);
+}
+
+// ---------------------------------------------------------------------------------------------
+
+// every q7 input, at all the offsets and sizes of the unrolled loop
+static void test_lut_q7(void)
+{
+	q7_t in[256 + 8], out[256 + 8], ref[256 + 8], cmsis[256 + 8];
+	uint16_t int_width;
+	uint32_t i, off, size;
+
+	for (i = 0; i < sizeof(in); i++)
+		in[i] = (q7_t)i;
+
+	for (int_width = 0; int_width <= 7; int_width++)
+	{
+		for (off = 0; off < 4; off++)
+		{
+			size = sizeof(in) - off - (int_width % 4);
+
+			memcpy(out, in, sizeof(in));
+			memcpy(ref, in, sizeof(in));
+			local_sigmoid_q7(out + off, size, int_width);
+			ref_sigmoid_q7(ref + off, size, int_width);
+			CHECK(!memcmp(out, ref, sizeof(in)), "sigmoid_q7 int_width %d offset %d differs\n", int_width, off);
+
+			memcpy(out, in, sizeof(in));
+			memcpy(ref, in, sizeof(in));
+			local_tanh_q7(out + off, size, int_width);
+			ref_tanh_q7(ref + off, size, int_width);
+			CHECK(!memcmp(out, ref, sizeof(in)), "tanh_q7 int_width %d offset %d differs\n", int_width, off);
+		}
+
+		// CMSIS-NN has the same tables, without the saturation
+		if (int_width > 3)
+			continue;
+		memcpy(out, in, 256);
+		memcpy(cmsis, in, 256);
+		local_sigmoid_q7(out, 256, int_width);
+		arm_nn_activations_direct_q7(cmsis, 256, int_width, ARM_SIGMOID);
+		CHECK(!memcmp(out, cmsis, 256), "sigmoid_q7 int_width %d differs from CMSIS-NN\n", int_width);
+
+		memcpy(out, in, 256);
+		memcpy(cmsis, in, 256);
+		local_tanh_q7(out, 256, int_width);
+		arm_nn_activations_direct_q7(cmsis, 256, int_width, ARM_TANH);
+		CHECK(!memcmp(out, cmsis, 256), "tanh_q7 int_width %d differs from CMSIS-NN\n", int_width);
+	}
+}
+
+// random vectors, half of them with all the values near their max, where the tables matter
+static void test_softmax_q7(void)
+{
+	q7_t in[64], out[64], ref[64];
+	uint32_t n, i, dim;
+	int32_t max;
+
+	srand(1);
+	for (n = 0; n < 200000; n++)
+	{
+		dim = 1 + rand() % 64;
+		max = rand() % 256 - 128;
+		for (i = 0; i < dim; i++)
+		{
+			if (n % 2)
+				in[i] = (q7_t)(rand() % 256 - 128);
+			else
+				in[i] = (q7_t)__NNOM_SSAT(max - rand() % 12, 8);
+		}
+		local_softmax_q7(in, dim, out);
+		ref_softmax_q7(in, dim, ref);
+		CHECK(!memcmp(out, ref, dim), "softmax_q7 vector %d of %d values differs\n", n, dim);
+	}
+}
+
+// every q15 input
+static void test_lut_q15(void)
+{
+	static q15_t out[65536], cmsis[65536];
+	uint16_t int_width;
+	int32_t i;
+
+	for (int_width = 0; int_width <= 15; int_width++)
+	{
+		for (i = 0; i < 65536; i++)
+			out[i] = (q15_t)(i - 32768);
+		local_sigmoid_q15(out, 65536, int_width);
+		for (i = 0; i < 65536; i++)
+			CHECK(out[i] == ref_lut_q15((q15_t)(i - 32768), nnom_sigmoid_table_q15, int_width, 0),
+				"sigmoid_q15 int_width %d input %d differs\n", int_width, i - 32768);
+
+		for (i = 0; i < 65536; i++)
+			out[i] = (q15_t)(i - 32768);
+		local_tanh_q15(out, 65536, int_width);
+		for (i = 0; i < 65536; i++)
+			CHECK(out[i] == ref_lut_q15((q15_t)(i - 32768), nnom_tanh_table_q15, int_width, 1),
+				"tanh_q15 int_width %d input %d differs\n", int_width, i - 32768);
+
+		// CMSIS-NN saturates the negative indexes and reads past the largest entry,
+		// the other inputs are the same (it takes 16 bits sizes, so in two halves)
+		if (int_width > 3)
+			continue;
+		for (i = 0; i < 32768; i++)
+			out[i] = cmsis[i] = (q15_t)i;
+		local_sigmoid_q15(out, 32768, int_width);
+		arm_nn_activations_direct_q15(cmsis, 16384, int_width, ARM_SIGMOID);
+		arm_nn_activations_direct_q15(cmsis + 16384, 16384, int_width, ARM_SIGMOID);
+		for (i = 0; i < 32768 && (i >> (8 + 3 - int_width)) < 127; i++)
+			CHECK(out[i] == cmsis[i], "sigmoid_q15 int_width %d input %d differs from CMSIS-NN\n", int_width, i);
+
+		for (i = 0; i < 32768; i++)
+			out[i] = cmsis[i] = (q15_t)i;
+		local_tanh_q15(out, 32768, int_width);
+		arm_nn_activations_direct_q15(cmsis, 16384, int_width, ARM_TANH);
+		arm_nn_activations_direct_q15(cmsis + 16384, 16384, int_width, ARM_TANH);
+		for (i = 0; i < 32768 && (i >> (8 + 3 - int_width)) < 127; i++)
+			CHECK(out[i] == cmsis[i], "tanh_q15 int_width %d input %d differs from CMSIS-NN\n", int_width, i);
+	}
+}
+
+int main(void)
+{
+	test_lut_q7();
+	test_softmax_q7();
+	test_lut_q15();
+
+	if (failures)
+	{
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+	printf("activations: all checks passed\n");
+	return 0;
+}
@@ -569,6 +569,21 @@ typedef struct TfLiteContext {
   TfLiteStatus (*ResizeTensorExplicit)(struct TfLiteContext* ctx,
                                        TfLiteTensor* tensor, int dims,
                                        const int* shape);
+
+  // Request a scratch buffer of `bytes` that is only used while the node runs.
+  // This method should only be used in `Prepare`; the buffer is identified by
+  // the index written to `buffer_idx`, and its memory can be fetched with
+  // `GetScratchBuffer` in `Eval`.
+  // On micro, the buffer is placed in the tensor arena by the memory planner,
+  // so it can share memory with tensors and scratch buffers of other nodes.
+  // WARNING: This is an experimental interface that is subject to change.
+  TfLiteStatus (*RequestScratchBufferInArena)(struct TfLiteContext* ctx,
+                                              size_t bytes, int* buffer_idx);
+
+  // Get the scratch buffer requested with `RequestScratchBufferInArena`. Only
+  // valid after all nodes have been prepared.
+  // WARNING: This is an experimental interface that is subject to change.
+  void* (*GetScratchBuffer)(struct TfLiteContext* ctx, int buffer_idx);
 } TfLiteContext;
 
 typedef struct TfLiteRegistration {
@@ -0,0 +1,404 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Measures the cost of a single Eval() call of the kernels that compute their
+// quantization parameters and activation ranges in Prepare(). Every kernel is
+// initialized and prepared once, like MicroInterpreter::AllocateTensors()
+// does, and then invoked kRuns times on the same tensors. Any work that moves
+// back from Prepare() into Eval() shows up as a regression here.
+// All times are in ticks of GetCurrentTimeTicks(), see micro_time.h.
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+
+namespace {
+
+using tflite::testing::CreateFloatTensor;
+using tflite::testing::CreateQuantizedBiasTensor;
+using tflite::testing::CreateQuantizedTensor;
+using tflite::testing::FloatArrayFromFloats;
+using tflite::testing::IntArrayFromInts;
+
+constexpr int kRuns = 100;
+
+// Shapes of the benchmarked layers, roughly the size of a layer of a small
+// keyword spotting or image classification model.
+constexpr int kSide = 16;
+constexpr int kDepth = 16;
+constexpr int kActivationSize = kSide * kSide * kDepth;
+constexpr int kFilterSize = 3;
+constexpr int kFullyConnectedBatches = 16;
+constexpr int kFullyConnectedDepth = kActivationSize / kFullyConnectedBatches;
+constexpr int kFullyConnectedUnits = 32;
+
+constexpr float kActivationScale = 0.05f;
+constexpr int kActivationZeroPoint = 128;
+constexpr float kWeightsScale = 0.01f;
+constexpr int kWeightsZeroPoint = 128;
+
+uint8_t input_a[kActivationSize];
+uint8_t input_b[kActivationSize];
+uint8_t output_data[kActivationSize];
+uint8_t weights[kFullyConnectedUnits * kFullyConnectedDepth];
+float bias_float[kFullyConnectedUnits];
+int32_t bias_quantized[kFullyConnectedUnits];
+
+// Scratch buffers of the CMSIS-NN kernels. Only one kernel is prepared at a
+// time, so they can all share the same memory.
+constexpr size_t kScratchBufferSize = 4096;
+alignas(16) uint8_t scratch_buffer[kScratchBufferSize];
+
+TfLiteStatus RequestScratchBuffer(TfLiteContext* context, size_t bytes,
+                                  int* buffer_idx) {
+  if (bytes > kScratchBufferSize) {
+    return kTfLiteError;
+  }
+  *buffer_idx = 0;
+  return kTfLiteOk;
+}
+
+void* GetScratchBuffer(TfLiteContext* context, int buffer_idx) {
+  return scratch_buffer;
+}
+
+void FillInputs() {
+  for (int i = 0; i < kActivationSize; ++i) {
+    input_a[i] = static_cast<uint8_t>(i * 7);
+    input_b[i] = static_cast<uint8_t>(i * 13 + 5);
+  }
+  for (size_t i = 0; i < sizeof(weights); ++i) {
+    weights[i] = static_cast<uint8_t>(i * 3 + 1);
+  }
+}
+
+// Gives a tensor the per-tensor affine quantization that the convolution
+// kernels require, using the scale and zero point in its params.
+void SetAffineQuantization(TfLiteTensor* tensor,
+                           TfLiteAffineQuantization* quantization,
+                           float* scales, int* zero_points) {
+  scales[0] = 1;
+  scales[1] = tensor->params.scale;
+  zero_points[0] = 1;
+  zero_points[1] = tensor->params.zero_point;
+  quantization->scale = FloatArrayFromFloats(scales);
+  quantization->zero_point = IntArrayFromInts(zero_points);
+  quantization->quantized_dimension = 0;
+  tensor->quantization = {kTfLiteAffineQuantization, quantization};
+}
+
+// Runs init and prepare of the kernel once and reports how long kRuns calls of
+// its invoke method take. The registrations are used directly rather than
+// through an op resolver, so kernels the application doesn't link in its
+// resolver can still be measured.
+TfLiteStatus BenchmarkKernel(const char* name,
+                             const TfLiteRegistration* registration,
+                             TfLiteTensor* tensors, int tensors_size,
+                             const int* inputs_data, const int* outputs_data,
+                             void* builtin_data,
+                             tflite::ErrorReporter* error_reporter) {
+  TfLiteContext context = {};
+  context.tensors_size = tensors_size;
+  context.tensors = tensors;
+  context.impl_ = error_reporter;
+  context.ReportError = tflite::testing::ReportOpError;
+  context.RequestScratchBufferInArena = RequestScratchBuffer;
+  context.GetScratchBuffer = GetScratchBuffer;
+  tflite::testing::PopulateOpDataAllocator(&context);
+
+  const int temporaries_data[] = {0};
+  TfLiteNode node = {};
+  node.inputs = IntArrayFromInts(inputs_data);
+  node.outputs = IntArrayFromInts(outputs_data);
+  node.temporaries = IntArrayFromInts(temporaries_data);
+  node.builtin_data = builtin_data;
+  if (registration->init) {
+    node.user_data = registration->init(&context, nullptr, 0);
+  }
+  if (registration->prepare &&
+      (registration->prepare(&context, &node) != kTfLiteOk)) {
+    error_reporter->Report("%s: prepare failed", name);
+    return kTfLiteError;
+  }
+
+  const int32_t start = tflite::GetCurrentTimeTicks();
+  for (int run = 0; run < kRuns; ++run) {
+    if (registration->invoke(&context, &node) != kTfLiteOk) {
+      error_reporter->Report("%s: invoke failed", name);
+      return kTfLiteError;
+    }
+  }
+  const int32_t ticks = tflite::GetCurrentTimeTicks() - start;
+  if (registration->free) {
+    registration->free(&context, node.user_data);
+  }
+
+  error_reporter->Report("  %s: %d ticks for %d runs", name, ticks, kRuns);
+  return kTfLiteOk;
+}
+
+TfLiteStatus BenchmarkConv(tflite::ErrorReporter* error_reporter) {
+  const int input_dims_data[] = {4, 1, kSide, kSide, kDepth};
+  const int filter_dims_data[] = {4, kDepth, kFilterSize, kFilterSize, kDepth};
+  const int bias_dims_data[] = {1, kDepth};
+  TfLiteIntArray* input_dims = IntArrayFromInts(input_dims_data);
+  TfLiteIntArray* filter_dims = IntArrayFromInts(filter_dims_data);
+  TfLiteIntArray* bias_dims = IntArrayFromInts(bias_dims_data);
+
+  TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_a, input_dims, kActivationScale,
+                            kActivationZeroPoint, "input"),
+      CreateQuantizedTensor(weights, filter_dims, kWeightsScale,
+                            kWeightsZeroPoint, "filter"),
+      CreateQuantizedBiasTensor(bias_float, bias_quantized, bias_dims,
+                                kActivationScale, kWeightsScale, "bias"),
+      CreateQuantizedTensor(output_data, input_dims, kActivationScale,
+                            kActivationZeroPoint, "output"),
+  };
+  TfLiteAffineQuantization filter_quantization;
+  float filter_scales[2];
+  int filter_zero_points[2];
+  SetAffineQuantization(&tensors[1], &filter_quantization, filter_scales,
+                        filter_zero_points);
+
+  TfLiteConvParams params = {kTfLitePaddingSame, 1, 1, kTfLiteActRelu, 1, 1};
+  const int inputs_data[] = {3, 0, 1, 2};
+  const int outputs_data[] = {1, 3};
+  return BenchmarkKernel("CONV_2D uint8",
+                         tflite::ops::micro::Register_CONV_2D(), tensors, 4,
+                         inputs_data, outputs_data, &params, error_reporter);
+}
+
+TfLiteStatus BenchmarkDepthwiseConv(tflite::ErrorReporter* error_reporter) {
+  const int input_dims_data[] = {4, 1, kSide, kSide, kDepth};
+  const int filter_dims_data[] = {4, 1, kFilterSize, kFilterSize, kDepth};
+  const int bias_dims_data[] = {1, kDepth};
+  TfLiteIntArray* input_dims = IntArrayFromInts(input_dims_data);
+  TfLiteIntArray* filter_dims = IntArrayFromInts(filter_dims_data);
+  TfLiteIntArray* bias_dims = IntArrayFromInts(bias_dims_data);
+
+  TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_a, input_dims, kActivationScale,
+                            kActivationZeroPoint, "input"),
+      CreateQuantizedTensor(weights, filter_dims, kWeightsScale,
+                            kWeightsZeroPoint, "filter"),
+      CreateQuantizedBiasTensor(bias_float, bias_quantized, bias_dims,
+                                kActivationScale, kWeightsScale, "bias"),
+      CreateQuantizedTensor(output_data, input_dims, kActivationScale,
+                            kActivationZeroPoint, "output"),
+  };
+  TfLiteAffineQuantization filter_quantization;
+  float filter_scales[2];
+  int filter_zero_points[2];
+  SetAffineQuantization(&tensors[1], &filter_quantization, filter_scales,
+                        filter_zero_points);
+
+  TfLiteDepthwiseConvParams params = {
+      kTfLitePaddingSame, 1, 1, 1, kTfLiteActRelu, 1, 1};
+  const int inputs_data[] = {3, 0, 1, 2};
+  const int outputs_data[] = {1, 3};
+  return BenchmarkKernel("DEPTHWISE_CONV_2D uint8",
+                         tflite::ops::micro::Register_DEPTHWISE_CONV_2D(),
+                         tensors, 4, inputs_data, outputs_data, &params,
+                         error_reporter);
+}
+
+TfLiteStatus BenchmarkFullyConnected(tflite::ErrorReporter* error_reporter) {
+  const int input_dims_data[] = {2, kFullyConnectedBatches,
+                                 kFullyConnectedDepth};
+  const int weights_dims_data[] = {2, kFullyConnectedUnits,
+                                   kFullyConnectedDepth};
+  const int bias_dims_data[] = {1, kFullyConnectedUnits};
+  const int output_dims_data[] = {2, kFullyConnectedBatches,
+                                  kFullyConnectedUnits};
+  TfLiteIntArray* input_dims = IntArrayFromInts(input_dims_data);
+  TfLiteIntArray* weights_dims = IntArrayFromInts(weights_dims_data);
+  TfLiteIntArray* bias_dims = IntArrayFromInts(bias_dims_data);
+  TfLiteIntArray* output_dims = IntArrayFromInts(output_dims_data);
+
+  TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_a, input_dims, kActivationScale,
+                            kActivationZeroPoint, "input"),
+      CreateQuantizedTensor(weights, weights_dims, kWeightsScale,
+                            kWeightsZeroPoint, "weights"),
+      CreateQuantizedBiasTensor(bias_float, bias_quantized, bias_dims,
+                                kActivationScale, kWeightsScale, "bias"),
+      // A larger output scale keeps the accumulators from saturating.
+      CreateQuantizedTensor(output_data, output_dims, kActivationScale * 16,
+                            kActivationZeroPoint, "output"),
+  };
+
+  TfLiteFullyConnectedParams params = {
+      kTfLiteActRelu, kTfLiteFullyConnectedWeightsFormatDefault, false};
+  const int inputs_data[] = {3, 0, 1, 2};
+  const int outputs_data[] = {1, 3};
+  return BenchmarkKernel("FULLY_CONNECTED uint8",
+                         tflite::ops::micro::Register_FULLY_CONNECTED(),
+                         tensors, 4, inputs_data, outputs_data, &params,
+                         error_reporter);
+}
+
+TfLiteStatus BenchmarkPooling(const char* name,
+                              const TfLiteRegistration* registration,
+                              tflite::ErrorReporter* error_reporter) {
+  const int input_dims_data[] = {4, 1, kSide, kSide, kDepth};
+  const int output_dims_data[] = {4, 1, kSide / 2, kSide / 2, kDepth};
+  TfLiteIntArray* input_dims = IntArrayFromInts(input_dims_data);
+  TfLiteIntArray* output_dims = IntArrayFromInts(output_dims_data);
+
+  TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_a, input_dims, kActivationScale,
+                            kActivationZeroPoint, "input"),
+      CreateQuantizedTensor(output_data, output_dims, kActivationScale,
+                            kActivationZeroPoint, "output"),
+  };
+
+  TfLitePoolParams params = {kTfLitePaddingValid, 2, 2, 2, 2, kTfLiteActRelu};
+  const int inputs_data[] = {1, 0};
+  const int outputs_data[] = {1, 1};
+  return BenchmarkKernel(name, registration, tensors, 2, inputs_data,
+                         outputs_data, &params, error_reporter);
+}
+
+TfLiteStatus BenchmarkSoftmax(tflite::ErrorReporter* error_reporter) {
+  const int dims_data[] = {2, kFullyConnectedBatches, kFullyConnectedDepth};
+  TfLiteIntArray* dims = IntArrayFromInts(dims_data);
+
+  TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_a, dims, kActivationScale,
+                            kActivationZeroPoint, "input"),
+      CreateQuantizedTensor(output_data, dims, 1.0f / 256, 0, "output"),
+  };
+
+  TfLiteSoftmaxParams params = {1.0f};
+  const int inputs_data[] = {1, 0};
+  const int outputs_data[] = {1, 1};
+  return BenchmarkKernel("SOFTMAX uint8",
+                         tflite::ops::micro::Register_SOFTMAX(), tensors, 2,
+                         inputs_data, outputs_data, &params, error_reporter);
+}
+
+template <typename Params>
+TfLiteStatus BenchmarkElementwise(const char* name,
+                                  const TfLiteRegistration* registration,
+                                  Params* params,
+                                  tflite::ErrorReporter* error_reporter) {
+  const int dims_data[] = {4, 1, kSide, kSide, kDepth};
+  TfLiteIntArray* dims = IntArrayFromInts(dims_data);
+
+  TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_a, dims, kActivationScale,
+                            kActivationZeroPoint, "input1"),
+      CreateQuantizedTensor(input_b, dims, kActivationScale * 2,
+                            kActivationZeroPoint, "input2"),
+      CreateQuantizedTensor(output_data, dims, kActivationScale * 4,
+                            kActivationZeroPoint, "output"),
+  };
+
+  const int inputs_data[] = {2, 0, 1};
+  const int outputs_data[] = {1, 2};
+  return BenchmarkKernel(name, registration, tensors, 3, inputs_data,
+                         outputs_data, params, error_reporter);
+}
+
+TfLiteStatus BenchmarkSvdf(tflite::ErrorReporter* error_reporter) {
+  constexpr int kBatches = 2;
+  constexpr int kInputSize = 32;
+  constexpr int kRank = 2;
+  constexpr int kUnits = 8;
+  constexpr int kFilters = kUnits * kRank;
+  constexpr int kMemorySize = 10;
+  static float input[kBatches * kInputSize];
+  static float weights_feature[kFilters * kInputSize];
+  static float weights_time[kFilters * kMemorySize];
+  static float activation_state[kBatches * kMemorySize * kFilters];
+  static float scratch[kBatches * kFilters];
+  static float output[kBatches * kUnits];
+  for (int i = 0; i < kBatches * kInputSize; ++i) {
+    input[i] = static_cast<float>(i % 7) * 0.1f;
+  }
+  for (int i = 0; i < kFilters * kInputSize; ++i) {
+    weights_feature[i] = static_cast<float>(i % 5) * 0.05f;
+  }
+  for (int i = 0; i < kFilters * kMemorySize; ++i) {
+    weights_time[i] = static_cast<float>(i % 3) * 0.05f;
+  }
+
+  const int input_dims_data[] = {2, kBatches, kInputSize};
+  const int weights_feature_dims_data[] = {2, kFilters, kInputSize};
+  const int weights_time_dims_data[] = {2, kFilters, kMemorySize};
+  const int activation_state_dims_data[] = {2, kBatches,
+                                            kMemorySize * kFilters};
+  const int scratch_dims_data[] = {2, kBatches, kFilters};
+  const int output_dims_data[] = {2, kBatches, kUnits};
+
+  TfLiteTensor tensors[] = {
+      CreateFloatTensor(input, IntArrayFromInts(input_dims_data), "input"),
+      CreateFloatTensor(weights_feature,
+                        IntArrayFromInts(weights_feature_dims_data),
+                        "weights_feature"),
+      CreateFloatTensor(weights_time, IntArrayFromInts(weights_time_dims_data),
+                        "weights_time"),
+      CreateFloatTensor(activation_state,
+                        IntArrayFromInts(activation_state_dims_data),
+                        "activation_state", true),
+      CreateFloatTensor(output, IntArrayFromInts(output_dims_data), "output"),
+      CreateFloatTensor(scratch, IntArrayFromInts(scratch_dims_data),
+                        "scratch"),
+  };
+
+  TfLiteSVDFParams params = {kRank, kTfLiteActNone};
+  // The scratch tensor is passed as the last input, like in svdf_test.cc.
+  const int inputs_data[] = {6, 0, 1, 2, kTfLiteOptionalTensor, 3, 5};
+  const int outputs_data[] = {1, 4};
+  return BenchmarkKernel("SVDF float", tflite::ops::micro::Register_SVDF(),
+                         tensors, 6, inputs_data, outputs_data, &params,
+                         error_reporter);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  tflite::MicroErrorReporter micro_error_reporter;
+  tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+
+  FillInputs();
+  error_reporter->Report("Kernel benchmark, %d ticks per second",
+                         tflite::ticks_per_second());
+
+  TfLiteAddParams add_params = {kTfLiteActNone};
+  TfLiteMulParams mul_params = {kTfLiteActNone};
+  if ((BenchmarkConv(error_reporter) != kTfLiteOk) ||
+      (BenchmarkDepthwiseConv(error_reporter) != kTfLiteOk) ||
+      (BenchmarkFullyConnected(error_reporter) != kTfLiteOk) ||
+      (BenchmarkPooling("AVERAGE_POOL_2D uint8",
+                        tflite::ops::micro::Register_AVERAGE_POOL_2D(),
+                        error_reporter) != kTfLiteOk) ||
+      (BenchmarkPooling("MAX_POOL_2D uint8",
+                        tflite::ops::micro::Register_MAX_POOL_2D(),
+                        error_reporter) != kTfLiteOk) ||
+      (BenchmarkSoftmax(error_reporter) != kTfLiteOk) ||
+      (BenchmarkElementwise("ADD uint8", tflite::ops::micro::Register_ADD(),
+                            &add_params, error_reporter) != kTfLiteOk) ||
+      (BenchmarkElementwise("MUL uint8", tflite::ops::micro::Register_MUL(),
+                            &mul_params, error_reporter) != kTfLiteOk) ||
+      (BenchmarkSvdf(error_reporter) != kTfLiteOk)) {
+    return 1;
+  }
+  return 0;
+}
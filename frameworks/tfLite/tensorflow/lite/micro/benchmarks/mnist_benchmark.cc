@@ -0,0 +1,134 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Measures the per-inference latency of the MNIST example model.
+//
+// Two numbers are reported:
+//  - "cold": an interpreter is created, planned with AllocateTensors() and
+//    invoked once. This is what every inference used to cost while Invoke()
+//    re-ran the `init` and `prepare` methods of all kernels.
+//  - "warm": Invoke() on an interpreter that has been planned once. This is
+//    the steady state cost of an inference.
+// A separate set of runs with a MicroProfiler attached then shows how the
+// warm inference time is split between the operators.
+// All times are in ticks of GetCurrentTimeTicks(), see micro_time.h.
+
+#include "tensorflow/lite/micro/examples/mnist/model_data.h"
+#include "tensorflow/lite/micro/kernels/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/version.h"
+
+namespace {
+
+constexpr int kTensorArenaSize = 50 * 1024;
+uint8_t tensor_arena[kTensorArenaSize];
+
+constexpr int kColdRuns = 10;
+constexpr int kWarmRuns = 100;
+
+void FillInput(TfLiteTensor* input) {
+  for (size_t i = 0; i < input->bytes; ++i) {
+    input->data.uint8[i] = static_cast<uint8_t>(i * 7);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  tflite::MicroErrorReporter micro_error_reporter;
+  tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+
+  const tflite::Model* model = ::tflite::GetModel(mnist_model_tflite_tflite);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    error_reporter->Report("Model schema version %d is not supported",
+                           model->version());
+    return 1;
+  }
+  tflite::ops::micro::AllOpsResolver resolver;
+
+  // Cold runs: plan and invoke a fresh interpreter every time.
+  uint32_t cold_ticks = 0;
+  for (int run = 0; run < kColdRuns; ++run) {
+    const int32_t start = tflite::GetCurrentTimeTicks();
+    tflite::MicroInterpreter interpreter(model, resolver, tensor_arena,
+                                         kTensorArenaSize, error_reporter);
+    if (interpreter.AllocateTensors() != kTfLiteOk) {
+      error_reporter->Report("AllocateTensors() failed");
+      return 1;
+    }
+    FillInput(interpreter.input(0));
+    if (interpreter.Invoke() != kTfLiteOk) {
+      error_reporter->Report("Invoke() failed");
+      return 1;
+    }
+    cold_ticks += static_cast<uint32_t>(tflite::GetCurrentTimeTicks() - start);
+  }
+
+  // Warm runs: plan once, invoke many times.
+  tflite::MicroInterpreter interpreter(model, resolver, tensor_arena,
+                                       kTensorArenaSize, error_reporter);
+  int32_t start = tflite::GetCurrentTimeTicks();
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    error_reporter->Report("AllocateTensors() failed");
+    return 1;
+  }
+  const uint32_t plan_ticks =
+      static_cast<uint32_t>(tflite::GetCurrentTimeTicks() - start);
+  FillInput(interpreter.input(0));
+
+  start = tflite::GetCurrentTimeTicks();
+  for (int run = 0; run < kWarmRuns; ++run) {
+    if (interpreter.Invoke() != kTfLiteOk) {
+      error_reporter->Report("Invoke() failed");
+      return 1;
+    }
+  }
+  const uint32_t warm_ticks =
+      static_cast<uint32_t>(tflite::GetCurrentTimeTicks() - start);
+
+  error_reporter->Report("MNIST benchmark, %d ticks per second",
+                         tflite::ticks_per_second());
+  error_reporter->Report("  planning (once):        %d ticks", plan_ticks);
+  error_reporter->Report("  cold inference (avg):   %d ticks",
+                         cold_ticks / kColdRuns);
+  error_reporter->Report("  warm inference (avg):   %d ticks",
+                         warm_ticks / kWarmRuns);
+  error_reporter->Report("  arena used:             %d bytes",
+                         interpreter.arena_used_bytes());
+
+  // Profiled runs: kept apart from the timed ones, since reading the timer
+  // around every operator adds some overhead of its own.
+  tflite::MicroProfiler profiler;
+  tflite::MicroInterpreter profiled_interpreter(
+      model, resolver, tensor_arena, kTensorArenaSize, error_reporter, nullptr,
+      &profiler);
+  if (profiled_interpreter.AllocateTensors() != kTfLiteOk) {
+    error_reporter->Report("AllocateTensors() failed");
+    return 1;
+  }
+  FillInput(profiled_interpreter.input(0));
+  for (int run = 0; run < kWarmRuns; ++run) {
+    if (profiled_interpreter.Invoke() != kTfLiteOk) {
+      error_reporter->Report("Invoke() failed");
+      return 1;
+    }
+  }
+  profiler.Log(error_reporter, profiled_interpreter.arena_used_bytes());
+  return 0;
+}
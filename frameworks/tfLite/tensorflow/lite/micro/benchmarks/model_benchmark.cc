@@ -0,0 +1,322 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool that runs a .tflite model with the MicroInterpreter and reports
+// how fast it is, so kernel changes can be measured without a board.
+//
+// Usage: model_benchmark [model.tflite] [runs] [batch]
+//
+// The model defaults to mnist_model_tflite.tflite in the working directory
+// and is invoked 1000 times by default. The report contains the invocations
+// per second, the time spent in each operator and the arena usage. The
+// inputs are filled with a fixed pattern and a checksum of the outputs is
+// printed, so the results of different kernel variants can be compared.
+// With a batch size, every invocation runs that many copies of the input,
+// see MicroInterpreter::SetBatchSize(), and the checksum covers the first
+// sample only, so it matches the one of unbatched runs.
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/version.h"
+
+namespace {
+
+constexpr int kTensorArenaSize = 1024 * 1024;
+uint8_t tensor_arena[kTensorArenaSize];
+
+constexpr int kDefaultRuns = 1000;
+
+bool ReadFile(const char* path, std::vector<char>* contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  contents->assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+  return true;
+}
+
+// Registers every op the micro kernels implement. Ops whose quantized
+// variants have been versioned are registered for all their versions.
+void AddAllOps(tflite::MicroMutableOpResolver* resolver) {
+  using tflite::ops::micro::Register_ABS;
+  using tflite::ops::micro::Register_ADD;
+  using tflite::ops::micro::Register_ARG_MAX;
+  using tflite::ops::micro::Register_ARG_MIN;
+  using tflite::ops::micro::Register_AVERAGE_POOL_2D;
+  using tflite::ops::micro::Register_CEIL;
+  using tflite::ops::micro::Register_CONCATENATION;
+  using tflite::ops::micro::Register_CONV_2D;
+  using tflite::ops::micro::Register_COS;
+  using tflite::ops::micro::Register_DEPTHWISE_CONV_2D;
+  using tflite::ops::micro::Register_DEQUANTIZE;
+  using tflite::ops::micro::Register_EQUAL;
+  using tflite::ops::micro::Register_FLOOR;
+  using tflite::ops::micro::Register_FULLY_CONNECTED;
+  using tflite::ops::micro::Register_GREATER;
+  using tflite::ops::micro::Register_GREATER_EQUAL;
+  using tflite::ops::micro::Register_LESS;
+  using tflite::ops::micro::Register_LESS_EQUAL;
+  using tflite::ops::micro::Register_LOG;
+  using tflite::ops::micro::Register_LOGICAL_AND;
+  using tflite::ops::micro::Register_LOGICAL_NOT;
+  using tflite::ops::micro::Register_LOGICAL_OR;
+  using tflite::ops::micro::Register_LOGISTIC;
+  using tflite::ops::micro::Register_MAX_POOL_2D;
+  using tflite::ops::micro::Register_MAXIMUM;
+  using tflite::ops::micro::Register_MINIMUM;
+  using tflite::ops::micro::Register_MUL;
+  using tflite::ops::micro::Register_NEG;
+  using tflite::ops::micro::Register_NOT_EQUAL;
+  using tflite::ops::micro::Register_PACK;
+  using tflite::ops::micro::Register_PAD;
+  using tflite::ops::micro::Register_PADV2;
+  using tflite::ops::micro::Register_PRELU;
+  using tflite::ops::micro::Register_QUANTIZE;
+  using tflite::ops::micro::Register_RELU;
+  using tflite::ops::micro::Register_RELU6;
+  using tflite::ops::micro::Register_RESHAPE;
+  using tflite::ops::micro::Register_ROUND;
+  using tflite::ops::micro::Register_RSQRT;
+  using tflite::ops::micro::Register_SIN;
+  using tflite::ops::micro::Register_SOFTMAX;
+  using tflite::ops::micro::Register_SPLIT;
+  using tflite::ops::micro::Register_SQRT;
+  using tflite::ops::micro::Register_SQUARE;
+  using tflite::ops::micro::Register_STRIDED_SLICE;
+  using tflite::ops::micro::Register_SVDF;
+  using tflite::ops::micro::Register_UNPACK;
+
+  resolver->AddBuiltin(tflite::BuiltinOperator_ADD, Register_ADD(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_AVERAGE_POOL_2D,
+                       Register_AVERAGE_POOL_2D(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_CONV_2D, Register_CONV_2D(), 1,
+                       4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_DEPTHWISE_CONV_2D,
+                       Register_DEPTHWISE_CONV_2D(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_DEQUANTIZE,
+                       Register_DEQUANTIZE(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_FULLY_CONNECTED,
+                       Register_FULLY_CONNECTED(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_MAX_POOL_2D,
+                       Register_MAX_POOL_2D(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_MUL, Register_MUL(), 1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_QUANTIZE, Register_QUANTIZE(),
+                       1, 4);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SOFTMAX, Register_SOFTMAX(), 1,
+                       4);
+
+  resolver->AddBuiltin(tflite::BuiltinOperator_ABS, Register_ABS(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_ARG_MAX, Register_ARG_MAX(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_ARG_MIN, Register_ARG_MIN(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_CEIL, Register_CEIL(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_CONCATENATION,
+                       Register_CONCATENATION(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_COS, Register_COS(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_EQUAL, Register_EQUAL(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_FLOOR, Register_FLOOR(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_GREATER, Register_GREATER(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_GREATER_EQUAL,
+                       Register_GREATER_EQUAL(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LESS, Register_LESS(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LESS_EQUAL,
+                       Register_LESS_EQUAL(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LOG, Register_LOG(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LOGICAL_AND,
+                       Register_LOGICAL_AND(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LOGICAL_NOT,
+                       Register_LOGICAL_NOT(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LOGICAL_OR,
+                       Register_LOGICAL_OR(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_LOGISTIC, Register_LOGISTIC(),
+                       1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_MAXIMUM, Register_MAXIMUM(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_MINIMUM, Register_MINIMUM(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_NEG, Register_NEG(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_NOT_EQUAL,
+                       Register_NOT_EQUAL(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_PACK, Register_PACK(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_PAD, Register_PAD(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_PADV2, Register_PADV2(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_PRELU, Register_PRELU(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_RELU, Register_RELU(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_RELU6, Register_RELU6(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_RESHAPE, Register_RESHAPE(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_ROUND, Register_ROUND(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_RSQRT, Register_RSQRT(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SIN, Register_SIN(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SPLIT, Register_SPLIT(), 1, 3);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SQRT, Register_SQRT(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SQUARE, Register_SQUARE(), 1,
+                       2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_STRIDED_SLICE,
+                       Register_STRIDED_SLICE(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_SVDF, Register_SVDF(), 1, 2);
+  resolver->AddBuiltin(tflite::BuiltinOperator_UNPACK, Register_UNPACK(), 1,
+                       2);
+}
+
+// Fills every sample of every input with the same pattern on every run, so
+// outputs are reproducible.
+void FillInputs(tflite::MicroInterpreter* interpreter) {
+  for (size_t i = 0; i < interpreter->inputs_size(); ++i) {
+    TfLiteTensor* input = interpreter->input(i);
+    const size_t sample_bytes = input->bytes / interpreter->batch_size();
+    for (size_t n = 0; n < input->bytes; ++n) {
+      input->data.uint8[n] = static_cast<uint8_t>((n % sample_bytes) * 7);
+    }
+  }
+}
+
+// FNV-1a hash over the bytes of the first sample of all outputs.
+uint32_t OutputChecksum(tflite::MicroInterpreter* interpreter) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < interpreter->outputs_size(); ++i) {
+    const TfLiteTensor* output = interpreter->output(i);
+    const size_t sample_bytes = output->bytes / interpreter->batch_size();
+    for (size_t n = 0; n < sample_bytes; ++n) {
+      hash = (hash ^ output->data.uint8[n]) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  tflite::MicroErrorReporter micro_error_reporter;
+  tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+
+  if (argc > 4) {
+    error_reporter->Report("Usage: %s [model.tflite] [runs] [batch]",
+                           argv[0]);
+    return 1;
+  }
+  const char* model_path = (argc > 1) ? argv[1] : "mnist_model_tflite.tflite";
+  const int runs = (argc > 2) ? std::atoi(argv[2]) : kDefaultRuns;
+  if (runs <= 0) {
+    error_reporter->Report("Number of runs has to be positive");
+    return 1;
+  }
+  const int batch_size = (argc > 3) ? std::atoi(argv[3]) : 1;
+
+  std::vector<char> contents;
+  if (!ReadFile(model_path, &contents)) {
+    error_reporter->Report("Couldn't read %s", model_path);
+    return 1;
+  }
+  const tflite::Model* model = tflite::GetModel(contents.data());
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    error_reporter->Report("Model schema version %d is not supported",
+                           model->version());
+    return 1;
+  }
+  tflite::MicroMutableOpResolver resolver;
+  AddAllOps(&resolver);
+
+  tflite::MicroInterpreter interpreter(model, resolver, tensor_arena,
+                                       kTensorArenaSize, error_reporter);
+  if (interpreter.SetBatchSize(batch_size) != kTfLiteOk) {
+    error_reporter->Report("SetBatchSize() failed");
+    return 1;
+  }
+  int32_t start = tflite::GetCurrentTimeTicks();
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    error_reporter->Report("AllocateTensors() failed");
+    return 1;
+  }
+  const int32_t plan_ticks = tflite::GetCurrentTimeTicks() - start;
+
+  // The first invocation warms up the caches and isn't timed.
+  FillInputs(&interpreter);
+  if (interpreter.Invoke() != kTfLiteOk) {
+    error_reporter->Report("Invoke() failed");
+    return 1;
+  }
+  uint64_t total_ticks = 0;
+  for (int run = 0; run < runs; ++run) {
+    FillInputs(&interpreter);
+    start = tflite::GetCurrentTimeTicks();
+    if (interpreter.Invoke() != kTfLiteOk) {
+      error_reporter->Report("Invoke() failed");
+      return 1;
+    }
+    total_ticks += static_cast<uint32_t>(tflite::GetCurrentTimeTicks() - start);
+  }
+  const int invocations_per_second =
+      (total_ticks > 0) ? static_cast<int>(static_cast<uint64_t>(runs) *
+                                           tflite::ticks_per_second() /
+                                           total_ticks)
+                        : 0;
+  const int samples_per_second =
+      (total_ticks > 0) ? static_cast<int>(static_cast<uint64_t>(runs) *
+                                           batch_size *
+                                           tflite::ticks_per_second() /
+                                           total_ticks)
+                        : 0;
+
+  error_reporter->Report("Model %s, %d runs of %d samples, %d ticks per second",
+                         model_path, runs, batch_size,
+                         tflite::ticks_per_second());
+  error_reporter->Report("  planning (once):        %d ticks", plan_ticks);
+  error_reporter->Report("  inference (avg):        %d ticks",
+                         static_cast<int>(total_ticks / runs));
+  error_reporter->Report("  invocations per second: %d",
+                         invocations_per_second);
+  error_reporter->Report("  samples per second:     %d",
+                         samples_per_second);
+  error_reporter->Report("  arena used:             %d bytes",
+                         static_cast<int>(interpreter.arena_used_bytes()));
+  error_reporter->Report("  output checksum:        %d",
+                         static_cast<int>(OutputChecksum(&interpreter)));
+
+  // Profiled runs are kept apart from the timed ones, since reading the timer
+  // around every operator adds some overhead of its own.
+  tflite::MicroProfiler profiler;
+  tflite::MicroInterpreter profiled_interpreter(
+      model, resolver, tensor_arena, kTensorArenaSize, error_reporter, nullptr,
+      &profiler);
+  if ((profiled_interpreter.SetBatchSize(batch_size) != kTfLiteOk) ||
+      (profiled_interpreter.AllocateTensors() != kTfLiteOk)) {
+    error_reporter->Report("AllocateTensors() failed");
+    return 1;
+  }
+  for (int run = 0; run < runs; ++run) {
+    FillInputs(&profiled_interpreter);
+    if (profiled_interpreter.Invoke() != kTfLiteOk) {
+      error_reporter->Report("Invoke() failed");
+      return 1;
+    }
+  }
+  profiler.Log(error_reporter, profiled_interpreter.arena_used_bytes());
+  return 0;
+}
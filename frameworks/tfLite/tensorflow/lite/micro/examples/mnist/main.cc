@@ -17,6 +17,7 @@
 #include "../../kernels/all_ops_resolver.h"
 #include "../../micro_error_reporter.h"
 #include "../../micro_interpreter.h"
+#include "../../micro_profiler.h"
 #include "../../../schema/schema_generated.h"
 #include "../../../version.h"
 #include "tensorflow/lite/micro/kernels/micro_ops.h"
@@ -91,13 +92,21 @@ int main(void)
   tflite::ops::micro::AllOpsResolver resolver;
 
   /* Create an area of memory to use for input, output, and intermediate arrays.
-  * The size required will depend on the model you are using, and may need to be determined by experimentation. [1] */
-  const int tensor_arena_size = 50 * 1024;
+  * The size required will depend on the model you are using. Activation buffers with disjoint lifetimes share
+  * memory, so the arena only has to hold the largest set of tensors alive at the same time (here the 28x28x32 conv
+  * output together with the 14x14x32 pooling output) plus the tensor metadata. The value was taken from
+  * interpreter.arena_used_bytes() after a successful AllocateTensors() with a larger arena. [1] */
+  const int tensor_arena_size = 33 * 1024;
   uint8_t tensor_arena[tensor_arena_size];
 
+  /* Per operator timing, measured with the DWT cycle counter. The profile of all inferences since the last
+   * 'p' command can be read back over the UART, see below. */
+  tflite::MicroProfiler profiler;
+  static uint8_t profile_buffer[tflite::MicroProfiler::kMaxSerializedSize];
+
   /* Build an interpreter to run the model with */
   tflite::MicroInterpreter interpreter(model, resolver, tensor_arena,
-                                       tensor_arena_size, error_reporter);
+                                       tensor_arena_size, error_reporter, nullptr, &profiler);
 
   /* Allocate memory from the tensor_arena for the model's tensors: */
   TfLiteStatus status = interpreter.AllocateTensors();
@@ -171,6 +180,20 @@ int main(void)
         HAL_UART_Transmit(&huart4, &c_cmd, 1, 1000);
         break;
       }
+      break;
+
+    case 'p':
+    {
+      /* Send the recorded profile as a 16 bit little endian length followed by the blob written by
+       * MicroProfiler::Serialize(), then start a new profile */
+      uint16_t profile_size = (uint16_t)profiler.Serialize(profile_buffer, sizeof(profile_buffer),
+                                                           interpreter.arena_used_bytes());
+      uint8_t size_bytes[2] = {(uint8_t)(profile_size & 0xff), (uint8_t)(profile_size >> 8)};
+      HAL_UART_Transmit(&huart4, size_bytes, 2, 1000);
+      HAL_UART_Transmit(&huart4, profile_buffer, profile_size, 1000);
+      profiler.Reset();
+      break;
+    }
     }
   }
 }
@@ -68,6 +68,7 @@ void ValidateAddGoldens(TfLiteTensor* tensors, int tensors_size,
                         float tolerance = 1e-5) {
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
 
   ::tflite::ops::micro::AllOpsResolver resolver;
   const TfLiteRegistration* registration =
@@ -24,7 +24,6 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
-#include "tensorflow/lite/micro/kernels/cmsis-nn/scratch_buffer.h"
 
 namespace tflite {
 namespace ops {
@@ -35,9 +34,10 @@ constexpr int kInputTensor = 0;
 constexpr int kFilterTensor = 1;
 constexpr int kBiasTensor = 2;
 constexpr int kOutputTensor = 0;
-constexpr int kMaxChannels = 256;
 
 const int kTensorNotAllocated = -1;
+// Marks a layer that runs without a CMSIS-NN scratch buffer.
+constexpr int kNoScratchBuffer = -1;
 
 struct OpData {
   TfLitePaddingValues padding;
@@ -46,15 +46,19 @@ struct OpData {
   int32_t output_multiplier;
   int output_shift;
 
-  // Per channel output multiplier and shift.
-  // TODO(b/141139247): Allocate these dynamically when possible.
-  int32_t per_channel_output_multiplier[kMaxChannels];
-  int32_t per_channel_output_shift[kMaxChannels];
+  // Per channel output multiplier and shift, one entry per filter scale.
+  int32_t* per_channel_output_multiplier;
+  int32_t* per_channel_output_shift;
 
   // The range of the fused activation layer. For example for kNone and
   // uint8_t these would be 0 and 255.
   int32_t output_activation_min;
   int32_t output_activation_max;
+  float float_activation_min;
+  float float_activation_max;
+
+  // Index of the scratch buffer requested in Prepare.
+  int buffer_idx;
 };
 
 inline PaddingType RuntimePaddingType(TfLitePadding padding) {
@@ -86,32 +90,122 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteNode* node,
       params->dilation_height_factor, params->dilation_width_factor, height,
       width, filter_height, filter_width, padding, &out_height, &out_width);
 
+  if (data_type == kTfLiteFloat32) {
+    CalculateActivationRange(params->activation, &data->float_activation_min,
+                             &data->float_activation_max);
+    return kTfLiteOk;
+  }
+
   // Note that quantized inference requires that all tensors have their
   // parameters set. This is usually done during quantized training.
-  if (data_type != kTfLiteFloat32) {
-    const TfLiteTensor* input = GetInput(context, node, kInputTensor);
-    const TfLiteTensor* filter = GetInput(context, node, kFilterTensor);
-    const TfLiteTensor* bias =
-        GetOptionalInputTensor(context, node, kBiasTensor);
-    TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
-
-    TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
-        context, input, filter, bias, output, params->activation,
-        &data->output_multiplier, &data->output_shift,
-        &data->output_activation_min, &data->output_activation_max,
-        data->per_channel_output_multiplier,
-        reinterpret_cast<int*>(data->per_channel_output_shift)));
-  }
-  return kTfLiteOk;
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  const TfLiteTensor* filter = GetInput(context, node, kFilterTensor);
+  const TfLiteTensor* bias = GetOptionalInputTensor(context, node, kBiasTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  TF_LITE_ENSURE_EQ(context, filter->quantization.type,
+                    kTfLiteAffineQuantization);
+  const auto* affine_quantization =
+      reinterpret_cast<TfLiteAffineQuantization*>(filter->quantization.params);
+  TF_LITE_ENSURE(context, affine_quantization);
+  TF_LITE_ENSURE(context, affine_quantization->scale);
+  const int num_channels = affine_quantization->scale->size;
+  data->per_channel_output_multiplier = reinterpret_cast<int32_t*>(
+      context->AllocateOpData(context, num_channels * sizeof(int32_t)));
+  data->per_channel_output_shift = reinterpret_cast<int32_t*>(
+      context->AllocateOpData(context, num_channels * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->per_channel_output_multiplier != nullptr);
+  TF_LITE_ENSURE(context, data->per_channel_output_shift != nullptr);
+
+  return tflite::PopulateConvolutionQuantizationParams(
+      context, input, filter, bias, output, params->activation,
+      &data->output_multiplier, &data->output_shift,
+      &data->output_activation_min, &data->output_activation_max,
+      data->per_channel_output_multiplier,
+      reinterpret_cast<int*>(data->per_channel_output_shift));
 }
 
+#if defined(ARM_MATH_DSP) && defined(ARM_MATH_LOOPUNROLL)
+// arm_convolve_1x1_s8_fast() only handles unpadded 1x1 convolutions with unit
+// stride and even channel counts.
+bool UseConv1x1Fast(int padding_width, int padding_height, int stride_width,
+                    int stride_height, int input_depth, int output_depth,
+                    int filter_width, int filter_height) {
+  return (padding_width == 0) && (padding_height == 0) &&
+         (input_depth % 4 == 0) && (output_depth % 2 == 0) &&
+         (stride_width == 1) && (stride_height == 1) && (filter_width == 1) &&
+         (filter_height == 1);
+}
+#endif
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
-  return nullptr;
+  return context->AllocateOpData(context, sizeof(OpData));
 }
 
 void Free(TfLiteContext* context, void* buffer) {}
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+  data->buffer_idx = kNoScratchBuffer;
+  auto* params = reinterpret_cast<TfLiteConvParams*>(node->builtin_data);
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  const TfLiteTensor* filter = GetInput(context, node, kFilterTensor);
+  const TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  int input_width = input->dims->data[2];
+  int input_height = input->dims->data[1];
+  int filter_width = filter->dims->data[2];
+  int filter_height = filter->dims->data[1];
+  int output_width = output->dims->data[2];
+  int output_height = output->dims->data[1];
+
+  // All per-channel quantized tensors need valid zero point and scale arrays.
+  if (input->type == kTfLiteInt8) {
+    TF_LITE_ENSURE_EQ(context, filter->quantization.type,
+                      kTfLiteAffineQuantization);
+
+    const auto* affine_quantization =
+        reinterpret_cast<TfLiteAffineQuantization*>(
+            filter->quantization.params);
+    TF_LITE_ENSURE(context, affine_quantization);
+    TF_LITE_ENSURE(context, affine_quantization->scale);
+    TF_LITE_ENSURE(context, affine_quantization->zero_point);
+    // Conv is quantized along dimension 0:
+    // https://www.tensorflow.org/lite/performance/quantization_spec
+    TF_LITE_ENSURE_EQ(context, filter->dims->data[0],
+                      affine_quantization->scale->size);
+    TF_LITE_ENSURE_EQ(context, filter->dims->data[0],
+                      affine_quantization->zero_point->size);
+  }
+
+  TF_LITE_ENSURE_STATUS(CalculateOpData(
+      context, node, params, input_width, input_height, filter_width,
+      filter_height, output_width, output_height, input->type, data));
+
+#if defined(ARM_MATH_DSP) && defined(ARM_MATH_LOOPUNROLL)
+  if (input->type != kTfLiteInt8) {
+    return kTfLiteOk;
+  }
+  const int input_depth = input->dims->data[3];
+  const int output_depth = output->dims->data[3];
+
+  // Only reserve what this layer needs, the same way Eval picks the kernel.
+  int32_t buf_size;
+  if (UseConv1x1Fast(data->padding.width, data->padding.height,
+                     params->stride_width, params->stride_height, input_depth,
+                     output_depth, filter_width, filter_height)) {
+    buf_size = arm_convolve_1x1_s8_fast_get_buffer_size(input_depth);
+  } else {
+    buf_size = arm_convolve_s8_get_buffer_size(input_depth, filter_width,
+                                               filter_height);
+  }
+  if (buf_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, buf_size, &data->buffer_idx));
+  }
+#endif
   return kTfLiteOk;
 }
 
@@ -193,16 +287,15 @@ TfLiteStatus EvalQuantizedPerChannel(
   const int output_height = output_shape.Dims(1);
   const int output_width = output_shape.Dims(2);
   int16_t* buf = nullptr;
+  if (data->buffer_idx != kNoScratchBuffer) {
+    buf = static_cast<int16_t*>(
+        context->GetScratchBuffer(context, data->buffer_idx));
+  }
 
-  if (op_params.padding_values.width == 0 &&
-      op_params.padding_values.height == 0 && (input_depth % 4 == 0) &&
-      (output_depth % 2 == 0) && op_params.stride_width == 1 &&
-      op_params.stride_height == 1 && filter_width == 1 && filter_height == 1) {
-    const int32_t buf_size =
-        arm_convolve_1x1_s8_fast_get_buffer_size(input_depth);
-    if (get_cmsis_scratch_buffer(context, &buf, buf_size) != kTfLiteOk) {
-      return kTfLiteError;
-    }
+  if (UseConv1x1Fast(op_params.padding_values.width,
+                     op_params.padding_values.height, op_params.stride_width,
+                     op_params.stride_height, input_depth, output_depth,
+                     filter_width, filter_height)) {
     if (arm_convolve_1x1_s8_fast(
             GetTensorData<int8_t>(input), input_width, input_height,
             input_depth, batches, GetTensorData<int8_t>(filter), output_depth,
@@ -216,11 +309,6 @@ TfLiteStatus EvalQuantizedPerChannel(
       return kTfLiteError;
     }
   } else {
-    const int32_t buf_size = arm_convolve_s8_get_buffer_size(
-        input_depth, filter_width, filter_height);
-    if (get_cmsis_scratch_buffer(context, &buf, buf_size) != kTfLiteOk) {
-      return kTfLiteError;
-    }
     if (arm_convolve_s8(
             GetTensorData<int8_t>(input), input_width, input_height,
             input_depth, batches, GetTensorData<int8_t>(filter), output_depth,
@@ -256,10 +344,6 @@ TfLiteStatus EvalFloat(TfLiteContext* context, TfLiteNode* node,
                        const TfLiteTensor* input, const TfLiteTensor* filter,
                        const TfLiteTensor* bias, TfLiteTensor* im2col,
                        TfLiteTensor* hwcn_weights, TfLiteTensor* output) {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRange(params->activation, &output_activation_min,
-                           &output_activation_max);
-
   ConvParams op_params;
   op_params.padding_type = RuntimePaddingType(params->padding);
   op_params.padding_values.width = data->padding.width;
@@ -268,8 +352,8 @@ TfLiteStatus EvalFloat(TfLiteContext* context, TfLiteNode* node,
   op_params.stride_height = params->stride_height;
   op_params.dilation_width_factor = params->dilation_width_factor;
   op_params.dilation_height_factor = params->dilation_height_factor;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
+  op_params.float_activation_min = data->float_activation_min;
+  op_params.float_activation_max = data->float_activation_max;
 
   reference_ops::Conv(op_params, GetTensorShape(input),
                       GetTensorData<float>(input), GetTensorShape(filter),
@@ -288,37 +372,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteTensor* filter = GetInput(context, node, kFilterTensor);
   const TfLiteTensor* bias = GetOptionalInputTensor(context, node, kBiasTensor);
 
-  int input_width = input->dims->data[2];
-  int input_height = input->dims->data[1];
-  int filter_width = filter->dims->data[2];
-  int filter_height = filter->dims->data[1];
-  int output_width = output->dims->data[2];
-  int output_height = output->dims->data[1];
-
-  OpData data;
-
-  // All per-channel quantized tensors need valid zero point and scale arrays.
-  if (input->type == kTfLiteInt8) {
-    TF_LITE_ENSURE_EQ(context, filter->quantization.type,
-                      kTfLiteAffineQuantization);
-
-    const auto* affine_quantization =
-        reinterpret_cast<TfLiteAffineQuantization*>(
-            filter->quantization.params);
-    TF_LITE_ENSURE(context, affine_quantization);
-    TF_LITE_ENSURE(context, affine_quantization->scale);
-    TF_LITE_ENSURE(context, affine_quantization->zero_point);
-    // Conv is quantized along dimension 0:
-    // https://www.tensorflow.org/lite/performance/quantization_spec
-    TF_LITE_ENSURE_EQ(context, filter->dims->data[0],
-                      affine_quantization->scale->size);
-    TF_LITE_ENSURE_EQ(context, filter->dims->data[0],
-                      affine_quantization->zero_point->size);
-  }
-
-  TF_LITE_ENSURE_STATUS(CalculateOpData(
-      context, node, params, input_width, input_height, filter_width,
-      filter_height, output_width, output_height, input->type, &data));
+  OpData& data = *(reinterpret_cast<OpData*>(node->user_data));
 
   switch (input->type) {  // Already know in/out types are same.
     case kTfLiteFloat32:
@@ -15,7 +15,6 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/pooling.h"
 
 #include "arm_nnfunctions.h"
-#include "scratch_buffer.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -31,15 +30,25 @@ namespace {
 
 constexpr int kInputTensor = 0;
 constexpr int kOutputTensor = 0;
+// Marks a layer that runs without a CMSIS-NN scratch buffer.
+constexpr int kNoScratchBuffer = -1;
 
 struct OpData {
   TfLitePaddingValues padding;
+  // The range of the fused activation layer, in the quantized domain of the
+  // output for quantized models.
+  int32_t activation_min;
+  int32_t activation_max;
+  float float_activation_min;
+  float float_activation_max;
+  // Index of the scratch buffer requested in AveragePrepare.
+  int buffer_idx;
 };
 
 TfLiteStatus CalculateOpData(const TfLiteContext* context,
                              const TfLitePoolParams* params,
-                             const TfLiteTensor* input,
-                             const TfLiteTensor* output, OpData* data) {
+                             const TfLiteTensor* input, TfLiteTensor* output,
+                             OpData* data) {
   // input: batch, height, width, channel
   int height = SizeOfDimension(input, 1);
   int width = SizeOfDimension(input, 2);
@@ -52,16 +61,30 @@ TfLiteStatus CalculateOpData(const TfLiteContext* context,
       /*dilation_rate_width=*/1, height, width, params->filter_height,
       params->filter_width, params->padding, &out_height, &out_width);
 
+  switch (output->type) {
+    case kTfLiteFloat32:
+      CalculateActivationRange(params->activation, &data->float_activation_min,
+                               &data->float_activation_max);
+      break;
+    case kTfLiteUInt8:
+      CalculateActivationRangeUint8(params->activation, output,
+                                    &data->activation_min,
+                                    &data->activation_max);
+      break;
+    case kTfLiteInt8:
+      CalculateActivationRangeInt8(params->activation, output,
+                                   &data->activation_min,
+                                   &data->activation_max);
+      break;
+    default:
+      break;
+  }
   return kTfLiteOk;
 }
 
 void AverageEvalFloat(const TfLiteContext* context, const TfLiteNode* node,
                       const TfLitePoolParams* params, const OpData* data,
                       const TfLiteTensor* input, TfLiteTensor* output) {
-  float activation_min, activation_max;
-  CalculateActivationRange(params->activation, &activation_min,
-                           &activation_max);
-
   PoolParams op_params;
   op_params.stride_height = params->stride_height;
   op_params.stride_width = params->stride_width;
@@ -69,8 +92,8 @@ void AverageEvalFloat(const TfLiteContext* context, const TfLiteNode* node,
   op_params.filter_width = params->filter_width;
   op_params.padding_values.height = data->padding.height;
   op_params.padding_values.width = data->padding.width;
-  op_params.float_activation_min = activation_min;
-  op_params.float_activation_max = activation_max;
+  op_params.float_activation_min = data->float_activation_min;
+  op_params.float_activation_max = data->float_activation_max;
   reference_ops::AveragePool(
       op_params, GetTensorShape(input), GetTensorData<float>(input),
       GetTensorShape(output), GetTensorData<float>(output));
@@ -79,10 +102,6 @@ void AverageEvalFloat(const TfLiteContext* context, const TfLiteNode* node,
 void AverageEvalUint8(const TfLiteContext* context, const TfLiteNode* node,
                       const TfLitePoolParams* params, const OpData* data,
                       const TfLiteTensor* input, TfLiteTensor* output) {
-  int32_t activation_min, activation_max;
-  CalculateActivationRangeUint8(params->activation, output, &activation_min,
-                                &activation_max);
-
   PoolParams op_params;
   op_params.stride_height = params->stride_height;
   op_params.stride_width = params->stride_width;
@@ -90,23 +109,19 @@ void AverageEvalUint8(const TfLiteContext* context, const TfLiteNode* node,
   op_params.filter_width = params->filter_width;
   op_params.padding_values.height = data->padding.height;
   op_params.padding_values.width = data->padding.width;
-  op_params.quantized_activation_min = activation_min;
-  op_params.quantized_activation_max = activation_max;
+  op_params.quantized_activation_min = data->activation_min;
+  op_params.quantized_activation_max = data->activation_max;
   reference_ops::AveragePool(
       op_params, GetTensorShape(input), GetTensorData<uint8_t>(input),
       GetTensorShape(output), GetTensorData<uint8_t>(output));
 }
 
-TfLiteStatus AverageEvalInt8(const TfLiteContext* context,
-                             const TfLiteNode* node,
+TfLiteStatus AverageEvalInt8(TfLiteContext* context, const TfLiteNode* node,
                              const TfLitePoolParams* params, const OpData* data,
                              const TfLiteTensor* input, TfLiteTensor* output) {
-  int32_t activation_min, activation_max;
-  CalculateActivationRangeInt8(params->activation, output, &activation_min,
-                               &activation_max);
-
-  TFLITE_DCHECK_LE(params->quantized_activation_min,
-                   params->quantized_activation_max);
+  const int32_t activation_min = data->activation_min;
+  const int32_t activation_max = data->activation_max;
+  TFLITE_DCHECK_LE(activation_min, activation_max);
 
   RuntimeShape input_shape = GetTensorShape(input);
   TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
@@ -114,12 +129,6 @@ TfLiteStatus AverageEvalInt8(const TfLiteContext* context,
   RuntimeShape output_shape = GetTensorShape(output);
   TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
 
-  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
-  const int output_height = output_shape.Dims(1);
-  const int output_width = output_shape.Dims(2);
   const int stride_height = params->stride_height;
   const int stride_width = params->stride_width;
 
@@ -129,12 +138,17 @@ TfLiteStatus AverageEvalInt8(const TfLiteContext* context,
   const int padding_width = data->padding.width;
 
 #if defined(ARM_MATH_DSP) && defined(ARM_MATH_LOOPUNROLL)
-  int16_t* scratch_buffer = nullptr;
-  const int32_t buffer_size =
-      arm_avgpool_s8_get_buffer_size(output_width, depth);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
 
-  TF_LITE_ENSURE_OK(
-      context, get_cmsis_scratch_buffer(context, &scratch_buffer, buffer_size));
+  int16_t* scratch_buffer = nullptr;
+  if (data->buffer_idx != kNoScratchBuffer) {
+    scratch_buffer = static_cast<int16_t*>(
+        context->GetScratchBuffer(context, data->buffer_idx));
+  }
 
   TF_LITE_ENSURE_EQ(
       context,
@@ -145,6 +159,15 @@ TfLiteStatus AverageEvalInt8(const TfLiteContext* context,
                      scratch_buffer, GetTensorData<int8_t>(output)),
       ARM_MATH_SUCCESS);
 #else
+  PoolParams op_params;
+  op_params.stride_height = stride_height;
+  op_params.stride_width = stride_width;
+  op_params.filter_height = filter_height;
+  op_params.filter_width = filter_width;
+  op_params.padding_values.height = padding_height;
+  op_params.padding_values.width = padding_width;
+  op_params.quantized_activation_min = activation_min;
+  op_params.quantized_activation_max = activation_max;
   reference_integer_ops::AveragePool(
       op_params, GetTensorShape(input), GetTensorData<int8_t>(input),
       GetTensorShape(output), GetTensorData<int8_t>(output));
@@ -156,10 +179,6 @@ TfLiteStatus AverageEvalInt8(const TfLiteContext* context,
 void MaxEvalFloat(TfLiteContext* context, TfLiteNode* node,
                   TfLitePoolParams* params, OpData* data,
                   const TfLiteTensor* input, TfLiteTensor* output) {
-  float activation_min, activation_max;
-  CalculateActivationRange(params->activation, &activation_min,
-                           &activation_max);
-
   tflite::PoolParams op_params;
   op_params.stride_height = params->stride_height;
   op_params.stride_width = params->stride_width;
@@ -167,8 +186,8 @@ void MaxEvalFloat(TfLiteContext* context, TfLiteNode* node,
   op_params.filter_width = params->filter_width;
   op_params.padding_values.height = data->padding.height;
   op_params.padding_values.width = data->padding.width;
-  op_params.float_activation_min = activation_min;
-  op_params.float_activation_max = activation_max;
+  op_params.float_activation_min = data->float_activation_min;
+  op_params.float_activation_max = data->float_activation_max;
   reference_ops::MaxPool(op_params, GetTensorShape(input),
                          GetTensorData<float>(input), GetTensorShape(output),
                          GetTensorData<float>(output));
@@ -177,10 +196,6 @@ void MaxEvalFloat(TfLiteContext* context, TfLiteNode* node,
 void MaxEvalQuantizedUInt8(TfLiteContext* context, TfLiteNode* node,
                            TfLitePoolParams* params, OpData* data,
                            const TfLiteTensor* input, TfLiteTensor* output) {
-  int32_t activation_min, activation_max;
-  CalculateActivationRangeUint8(params->activation, output, &activation_min,
-                                &activation_max);
-
   tflite::PoolParams op_params;
   op_params.stride_height = params->stride_height;
   op_params.stride_width = params->stride_width;
@@ -188,8 +203,8 @@ void MaxEvalQuantizedUInt8(TfLiteContext* context, TfLiteNode* node,
   op_params.filter_width = params->filter_width;
   op_params.padding_values.height = data->padding.height;
   op_params.padding_values.width = data->padding.width;
-  op_params.quantized_activation_min = activation_min;
-  op_params.quantized_activation_max = activation_max;
+  op_params.quantized_activation_min = data->activation_min;
+  op_params.quantized_activation_max = data->activation_max;
   reference_ops::MaxPool(op_params, GetTensorShape(input),
                          GetTensorData<uint8_t>(input), GetTensorShape(output),
                          GetTensorData<uint8_t>(output));
@@ -198,24 +213,50 @@ void MaxEvalQuantizedUInt8(TfLiteContext* context, TfLiteNode* node,
 }  // namespace
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
-  return nullptr;
+  return context->AllocateOpData(context, sizeof(OpData));
 }
 
 void Free(TfLiteContext* context, void* buffer) {}
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+  data->buffer_idx = kNoScratchBuffer;
+  auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  return CalculateOpData(context, params, input, output, data);
+}
+
+TfLiteStatus AveragePrepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(Prepare(context, node));
+
+#if defined(ARM_MATH_DSP) && defined(ARM_MATH_LOOPUNROLL)
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  if (input->type != kTfLiteInt8) {
+    return kTfLiteOk;
+  }
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+  const TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+  const int32_t buf_size = arm_avgpool_s8_get_buffer_size(
+      output->dims->data[2], output->dims->data[3]);
+  if (buf_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, buf_size, &data->buffer_idx));
+  }
+#endif
   return kTfLiteOk;
 }
 
 TfLiteStatus AverageEval(TfLiteContext* context, TfLiteNode* node) {
   auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
-  OpData data;
+  OpData& data = *(reinterpret_cast<OpData*>(node->user_data));
 
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
 
-  TF_LITE_ENSURE_STATUS(CalculateOpData(context, params, input, output, &data));
-
   // Inputs and outputs share the same type, guarenteed by the converter.
   switch (input->type) {
     case kTfLiteFloat32:
@@ -237,13 +278,11 @@ TfLiteStatus AverageEval(TfLiteContext* context, TfLiteNode* node) {
 
 TfLiteStatus MaxEval(TfLiteContext* context, TfLiteNode* node) {
   auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
-  OpData data;
+  OpData& data = *(reinterpret_cast<OpData*>(node->user_data));
 
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
 
-  TF_LITE_ENSURE_STATUS(CalculateOpData(context, params, input, output, &data));
-
   switch (input->type) {
     case kTfLiteFloat32:
       MaxEvalFloat(context, node, params, &data, input, output);
@@ -265,7 +304,7 @@ TfLiteRegistration* Register_AVERAGE_POOL_2D() {
   static TfLiteRegistration r = {
       pooling::Init,
       pooling::Free,
-      pooling::Prepare,
+      pooling::AveragePrepare,
       pooling::AverageEval,
   };
   return &r;
@@ -56,6 +56,7 @@ TfLiteStatus ValidateConvGoldens(TfLiteTensor* tensors, int tensors_size,
                                  float tolerance = 1e-5) {
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
 
   ::tflite::ops::micro::AllOpsResolver resolver;
 
@@ -90,7 +91,10 @@ TfLiteStatus ValidateConvGoldens(TfLiteTensor* tensors, int tensors_size,
   node.delegate = nullptr;
 
   if (registration->prepare) {
-    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, registration->prepare(&context, &node));
+    TfLiteStatus prepare_status = registration->prepare(&context, &node);
+    if (prepare_status != kTfLiteOk) {
+      return prepare_status;
+    }
   }
   TF_LITE_MICRO_EXPECT_NE(nullptr, registration->invoke);
   TfLiteStatus return_val = registration->invoke(&context, &node);
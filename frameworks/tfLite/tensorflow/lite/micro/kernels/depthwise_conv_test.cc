@@ -35,6 +35,7 @@ TfLiteStatus ValidateDepthwiseConvGoldens(TfLiteTensor* tensors,
                                           float tolerance = 1e-5) {
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
 
   ::tflite::ops::micro::AllOpsResolver resolver;
   const TfLiteRegistration* registration =
@@ -76,7 +77,10 @@ TfLiteStatus ValidateDepthwiseConvGoldens(TfLiteTensor* tensors,
   node.custom_initial_data_size = 0;
   node.delegate = nullptr;
   if (registration->prepare) {
-    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, registration->prepare(&context, &node));
+    TfLiteStatus prepare_status = registration->prepare(&context, &node);
+    if (prepare_status != kTfLiteOk) {
+      return prepare_status;
+    }
   }
   TF_LITE_MICRO_EXPECT_NE(nullptr, registration->invoke);
   TfLiteStatus invoke_status = registration->invoke(&context, &node);
@@ -49,6 +49,7 @@ void TestFullyConnectedFloat(
 
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
 
   ::tflite::ops::micro::AllOpsResolver resolver;
   const TfLiteRegistration* registration =
@@ -124,6 +125,7 @@ void TestFullyConnectedQuantized(
 
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
 
   ::tflite::ops::micro::AllOpsResolver resolver;
   const TfLiteRegistration* registration =
@@ -388,6 +390,93 @@ TF_LITE_MICRO_TEST(SimpleTestQuantizedInt8) {
       output_max, kTfLiteActNone, output_data);
 }
 
+// Five samples, so the batched kernels handle a full group of four samples
+// and a remainder.
+TF_LITE_MICRO_TEST(SimpleTestQuantizedInt8Batch5) {
+  using tflite::testing::F2Q32;
+  using tflite::testing::F2QS;
+
+  const float input_min = -63.5f;
+  const float input_max = 64.0f;
+  const float weights_min = -63.5f;
+  const float weights_max = 64.0f;
+  const float bias_scale = 0.25f;
+  const float output_min = -127.0f;
+  const float output_max = 128.0f;
+
+  const int input_dims_data[] = {2, 5, 10};
+  const int8_t input_data[] = {
+      F2QS(1, input_min, input_max), F2QS(2, input_min, input_max),
+      F2QS(3, input_min, input_max), F2QS(4, input_min, input_max),
+      F2QS(5, input_min, input_max), F2QS(6, input_min, input_max),
+      F2QS(7, input_min, input_max), F2QS(8, input_min, input_max),
+      F2QS(-9, input_min, input_max), F2QS(-10, input_min, input_max),
+      F2QS(1, input_min, input_max), F2QS(2, input_min, input_max),
+      F2QS(3, input_min, input_max), F2QS(4, input_min, input_max),
+      F2QS(5, input_min, input_max), F2QS(6, input_min, input_max),
+      F2QS(7, input_min, input_max), F2QS(-8, input_min, input_max),
+      F2QS(9, input_min, input_max), F2QS(-10, input_min, input_max),
+      F2QS(1, input_min, input_max), F2QS(1, input_min, input_max),
+      F2QS(1, input_min, input_max), F2QS(1, input_min, input_max),
+      F2QS(1, input_min, input_max), F2QS(1, input_min, input_max),
+      F2QS(1, input_min, input_max), F2QS(1, input_min, input_max),
+      F2QS(1, input_min, input_max), F2QS(1, input_min, input_max),
+      F2QS(0, input_min, input_max), F2QS(0, input_min, input_max),
+      F2QS(0, input_min, input_max), F2QS(0, input_min, input_max),
+      F2QS(0, input_min, input_max), F2QS(0, input_min, input_max),
+      F2QS(0, input_min, input_max), F2QS(0, input_min, input_max),
+      F2QS(0, input_min, input_max), F2QS(0, input_min, input_max),
+      F2QS(-1, input_min, input_max), F2QS(-1, input_min, input_max),
+      F2QS(-1, input_min, input_max), F2QS(-1, input_min, input_max),
+      F2QS(-1, input_min, input_max), F2QS(-1, input_min, input_max),
+      F2QS(-1, input_min, input_max), F2QS(-1, input_min, input_max),
+      F2QS(-1, input_min, input_max), F2QS(-1, input_min, input_max),
+  };
+  const int weights_dims_data[] = {2, 3, 10};
+  const int8_t weights_data[] = {
+      F2QS(1, weights_min, weights_max), F2QS(2, weights_min, weights_max),
+      F2QS(3, weights_min, weights_max), F2QS(4, weights_min, weights_max),
+      F2QS(5, weights_min, weights_max), F2QS(6, weights_min, weights_max),
+      F2QS(7, weights_min, weights_max), F2QS(8, weights_min, weights_max),
+      F2QS(9, weights_min, weights_max), F2QS(10, weights_min, weights_max),
+      F2QS(1, weights_min, weights_max), F2QS(2, weights_min, weights_max),
+      F2QS(3, weights_min, weights_max), F2QS(4, weights_min, weights_max),
+      F2QS(5, weights_min, weights_max), F2QS(6, weights_min, weights_max),
+      F2QS(7, weights_min, weights_max), F2QS(8, weights_min, weights_max),
+      F2QS(9, weights_min, weights_max), F2QS(10, weights_min, weights_max),
+      F2QS(1, weights_min, weights_max), F2QS(2, weights_min, weights_max),
+      F2QS(3, weights_min, weights_max), F2QS(4, weights_min, weights_max),
+      F2QS(5, weights_min, weights_max), F2QS(6, weights_min, weights_max),
+      F2QS(7, weights_min, weights_max), F2QS(8, weights_min, weights_max),
+      F2QS(9, weights_min, weights_max), F2QS(10, weights_min, weights_max),
+  };
+  const int bias_dims_data[] = {1, 3};
+  const int32_t bias_data[] = {
+      F2Q32(1, bias_scale),
+      F2Q32(2, bias_scale),
+      F2Q32(3, bias_scale),
+  };
+  const int8_t expected_output_data[] = {
+      F2QS(24, output_min, output_max), F2QS(25, output_min, output_max),
+      F2QS(26, output_min, output_max), F2QS(58, output_min, output_max),
+      F2QS(59, output_min, output_max), F2QS(60, output_min, output_max),
+      F2QS(56, output_min, output_max), F2QS(57, output_min, output_max),
+      F2QS(58, output_min, output_max), F2QS(1, output_min, output_max),
+      F2QS(2, output_min, output_max), F2QS(3, output_min, output_max),
+      F2QS(-54, output_min, output_max), F2QS(-53, output_min, output_max),
+      F2QS(-52, output_min, output_max),
+  };
+  const int output_dims_data[] = {2, 5, 3};
+
+  const int output_dims_count = 15;
+  int8_t output_data[output_dims_count];
+  tflite::testing::TestFullyConnectedQuantized<int8_t>(
+      input_dims_data, input_data, input_min, input_max, weights_dims_data,
+      weights_data, weights_min, weights_max, bias_dims_data, bias_data,
+      bias_scale, expected_output_data, output_dims_data, output_min,
+      output_max, kTfLiteActNone, output_data);
+}
+
 TF_LITE_MICRO_TEST(SimpleTestQuantizedUInt8Relu) {
   using tflite::testing::F2Q;
   using tflite::testing::F2Q32;
@@ -37,6 +37,10 @@ struct OpData {
 
   int32_t output_multiplier;
   int output_shift;
+
+  // Used only for float32.
+  float output_activation_min_f32;
+  float output_activation_max_f32;
 };
 
 TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteNode* node,
@@ -50,7 +54,11 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteNode* node,
 
   TF_LITE_ENSURE_EQ(context, input1->type, input2->type);
 
-  if (output->type == kTfLiteUInt8) {
+  if (output->type == kTfLiteFloat32) {
+    CalculateActivationRange(params->activation,
+                             &data->output_activation_min_f32,
+                             &data->output_activation_max_f32);
+  } else if (output->type == kTfLiteUInt8) {
     CalculateActivationRangeUint8(params->activation, output,
                                   &data->output_activation_min,
                                   &data->output_activation_max);
@@ -70,8 +78,18 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  return context->AllocateOpData(context, sizeof(OpData));
+}
+
+void Free(TfLiteContext* context, void* buffer) {}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
-  return kTfLiteOk;
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+  auto* params = reinterpret_cast<TfLiteMulParams*>(node->builtin_data);
+
+  return CalculateOpData(context, node, params, data);
 }
 
 void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
@@ -117,11 +135,9 @@ void EvalFloat(TfLiteContext* context, TfLiteNode* node,
                TfLiteMulParams* params, OpData* data,
                const TfLiteTensor* input1, const TfLiteTensor* input2,
                TfLiteTensor* output) {
-  float output_activation_min, output_activation_max;
-  CalculateActivationRange(params->activation, &output_activation_min,
-                           &output_activation_max);
   tflite::ArithmeticParams op_params;
-  SetActivationParams(output_activation_min, output_activation_max, &op_params);
+  SetActivationParams(data->output_activation_min_f32,
+                      data->output_activation_max_f32, &op_params);
 
   bool need_broadcast = reference_ops::ProcessBroadcastShapes(
       GetTensorShape(input1), GetTensorShape(input2), &op_params);
@@ -141,14 +157,12 @@ void EvalFloat(TfLiteContext* context, TfLiteNode* node,
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   auto* params = reinterpret_cast<TfLiteMulParams*>(node->builtin_data);
-  OpData data;
+  OpData& data = *(reinterpret_cast<OpData*>(node->user_data));
 
   const TfLiteTensor* input1 = GetInput(context, node, kInput1Tensor);
   const TfLiteTensor* input2 = GetInput(context, node, kInput2Tensor);
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
 
-  CalculateOpData(context, node, params, &data);
-
   switch (input1->type) {
     case kTfLiteUInt8:
     case kTfLiteInt8:
@@ -168,7 +182,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 }  // namespace mul
 
 TfLiteRegistration* Register_MUL() {
-  static TfLiteRegistration r = {nullptr, nullptr, mul::Prepare, mul::Eval};
+  static TfLiteRegistration r = {mul::Init, mul::Free, mul::Prepare,
+                                 mul::Eval};
   return &r;
 }
 
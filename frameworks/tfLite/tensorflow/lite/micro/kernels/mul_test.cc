@@ -48,6 +48,7 @@ void TestMulFloat(std::initializer_list<int> input1_dims_data,
 
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
   const TfLiteRegistration* registration =
       resolver.FindOp(tflite::BuiltinOperator_MUL, 1);
 
@@ -123,6 +124,7 @@ void TestMulQuantized(std::initializer_list<int> input1_dims_data,
 
   TfLiteContext context;
   PopulateContext(tensors, tensors_size, &context);
+  PopulateOpDataAllocator(&context);
   const TfLiteRegistration* registration =
       resolver.FindOp(tflite::BuiltinOperator_MUL, 1);
 
@@ -42,6 +42,18 @@ namespace {
  * resizing.
  */
 
+// Sizes derived from the tensor shapes in Prepare, so Eval doesn't have to.
+struct OpData {
+  int rank;
+  int batch_size;
+  int input_size;
+  int num_filters;
+  int num_units;
+  int memory_size;
+  // Only used by the hybrid op.
+  float weights_feature_scale;
+};
+
 // TODO(kreeger): upstream these reference methods into
 // `lite/kernels/reference/svdf.h`
 
@@ -136,15 +148,15 @@ inline void EvalFloatSVDF(TfLiteContext* context, TfLiteNode* node,
                           const TfLiteTensor* weights_feature,
                           const TfLiteTensor* weights_time,
                           const TfLiteTensor* bias,
-                          const TfLiteSVDFParams* params, TfLiteTensor* scratch,
-                          TfLiteTensor* activation_state,
+                          const TfLiteSVDFParams* params, const OpData* data,
+                          TfLiteTensor* scratch, TfLiteTensor* activation_state,
                           TfLiteTensor* output) {
-  const int rank = params->rank;
-  const int batch_size = input->dims->data[0];
-  const int input_size = input->dims->data[1];
-  const int num_filters = weights_feature->dims->data[0];
-  const int num_units = num_filters / rank;
-  const int memory_size = weights_time->dims->data[1];
+  const int rank = data->rank;
+  const int batch_size = data->batch_size;
+  const int input_size = data->input_size;
+  const int num_filters = data->num_filters;
+  const int num_units = data->num_units;
+  const int memory_size = data->memory_size;
 
   // Clear the activation (activation_state's leftmost column).
   // TODO(ghodrat): Add a test which initialize activation_state with invalid
@@ -191,15 +203,15 @@ inline void EvalHybridSVDF(
     TfLiteContext* context, TfLiteNode* node, const TfLiteTensor* input,
     const TfLiteTensor* weights_feature, const TfLiteTensor* weights_time,
     const TfLiteTensor* bias, const TfLiteSVDFParams* params,
-    TfLiteTensor* scratch, TfLiteTensor* scaling_factors,
+    const OpData* data, TfLiteTensor* scratch, TfLiteTensor* scaling_factors,
     TfLiteTensor* input_quantized, TfLiteTensor* activation_state,
     TfLiteTensor* output) {
-  const int rank = params->rank;
-  const int batch_size = input->dims->data[0];
-  const int input_size = input->dims->data[1];
-  const int num_filters = weights_feature->dims->data[0];
-  const int num_units = num_filters / rank;
-  const int memory_size = weights_time->dims->data[1];
+  const int rank = data->rank;
+  const int batch_size = data->batch_size;
+  const int input_size = data->input_size;
+  const int num_filters = data->num_filters;
+  const int num_units = data->num_units;
+  const int memory_size = data->memory_size;
 
   // Initialize the pointer to input.
   const float* input_ptr_batch = GetTensorData<float>(input);
@@ -211,7 +223,7 @@ inline void EvalHybridSVDF(
   float* scaling_factors_ptr = GetTensorData<float>(scaling_factors);
 
   // Initialize the weights scale.
-  const float weights_feature_scale = weights_feature->params.scale;
+  const float weights_feature_scale = data->weights_feature_scale;
 
   // Clear the activation (activation_state's leftmost column).
   // TODO(ghodrat): Add a test which initialize activation_state with invalid
@@ -288,12 +300,14 @@ constexpr int kInputActivationStateTensor = 4;
 constexpr int kOutputTensor = 0;
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
-  return nullptr;
+  return context->AllocateOpData(context, sizeof(OpData));
 }
 
 void Free(TfLiteContext* context, void* buffer) {}
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
   const auto* params = reinterpret_cast<TfLiteSVDFParams*>(node->builtin_data);
 
   // Validate Tensor Inputs (dtype depends on quantization):
@@ -438,11 +452,19 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, output->dims->data[0], batch_size);
   TF_LITE_ENSURE_EQ(context, output->dims->data[1], num_units);
 
+  data->rank = rank;
+  data->batch_size = batch_size;
+  data->input_size = input_size;
+  data->num_filters = num_filters;
+  data->num_units = num_units;
+  data->memory_size = memory_size;
+  data->weights_feature_scale = weights_feature->params.scale;
   return kTfLiteOk;
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const auto* params = reinterpret_cast<TfLiteSVDFParams*>(node->builtin_data);
+  const OpData* data = reinterpret_cast<OpData*>(node->user_data);
 
   const TfLiteTensor* input = GetInput(context, node, kInputTensor);
   const TfLiteTensor* weights_feature =
@@ -463,7 +485,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   switch (weights_feature->type) {
     case kTfLiteFloat32: {
       EvalFloatSVDF(context, node, input, weights_feature, weights_time, bias,
-                    params, scratch, activation_state, output);
+                    params, data, scratch, activation_state, output);
       return kTfLiteOk;
       break;
     }
@@ -474,9 +496,9 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       TfLiteTensor* scratch_scaling_factors = GetTemporary(context, node, 2);
       TfLiteTensor* scratch_float_weights_time = GetTemporary(context, node, 3);
       EvalHybridSVDF(context, node, input, weights_feature,
-                     scratch_float_weights_time, bias, params, scratch,
-                     scratch_scaling_factors, scratch_input_quantized,
-                     activation_state, output);
+                     scratch_float_weights_time, bias, params, data,
+                     scratch, scratch_scaling_factors,
+                     scratch_input_quantized, activation_state, output);
       return kTfLiteOk;
       break;
     }
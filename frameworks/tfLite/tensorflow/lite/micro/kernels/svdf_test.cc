@@ -129,6 +129,7 @@ void ValidateSVDFGoldens(const int batch_size, const int num_units,
                          float* expected_output, float tolerance = 1e-5f) {
   TfLiteContext context;
   PopulateContext(tensors, tensor_count, &context);
+  PopulateOpDataAllocator(&context);
 
   ::tflite::ops::micro::AllOpsResolver resolver;
   const TfLiteRegistration* registration =
@@ -0,0 +1,424 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/kernels/internal/reference/pooling.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/x86/simd_utils.h"
+
+namespace tflite {
+namespace ops {
+namespace micro {
+namespace pooling {
+
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kOutputTensor = 0;
+
+struct OpData {
+  TfLitePaddingValues padding;
+  // The range of the fused activation layer, in the quantized domain of the
+  // output for quantized models.
+  int32_t activation_min;
+  int32_t activation_max;
+  float float_activation_min;
+  float float_activation_max;
+};
+
+TfLiteStatus CalculateOpData(const TfLiteContext* context,
+                             const TfLitePoolParams* params,
+                             const TfLiteTensor* input, TfLiteTensor* output,
+                             OpData* data) {
+  // input: batch, height, width, channel
+  int height = SizeOfDimension(input, 1);
+  int width = SizeOfDimension(input, 2);
+
+  int out_height, out_width;
+
+  data->padding = ComputePaddingHeightWidth(
+      params->stride_height, params->stride_width,
+      /*dilation_rate_height=*/1,
+      /*dilation_rate_width=*/1, height, width, params->filter_height,
+      params->filter_width, params->padding, &out_height, &out_width);
+
+  switch (output->type) {
+    case kTfLiteFloat32:
+      CalculateActivationRange(params->activation, &data->float_activation_min,
+                               &data->float_activation_max);
+      break;
+    case kTfLiteUInt8:
+      CalculateActivationRangeUint8(params->activation, output,
+                                    &data->activation_min,
+                                    &data->activation_max);
+      break;
+    case kTfLiteInt8:
+      CalculateActivationRangeInt8(params->activation, output,
+                                   &data->activation_min,
+                                   &data->activation_max);
+      break;
+    default:
+      break;
+  }
+  return kTfLiteOk;
+}
+
+#if defined(TF_LITE_MICRO_X86_SIMD)
+// Quantized average pooling that sums x86::kInt32Lanes channels at once.
+// Rounding half away from zero, as the int8 reference kernel does, gives the
+// same results as the uint8 reference kernel for the non-negative uint8 sums.
+template <typename T>
+void AveragePoolSimd(const PoolParams& params, const RuntimeShape& input_shape,
+                     const T* input_data, const RuntimeShape& output_shape,
+                     T* output_data) {
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  int32 acc[x86::kInt32Lanes];
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          (out_y * params.stride_height) - params.padding_values.height;
+      int filter_y_start, filter_y_end;
+      x86::FilterTapRange(in_y_origin, 1, params.filter_height, input_height,
+                          &filter_y_start, &filter_y_end);
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin =
+            (out_x * params.stride_width) - params.padding_values.width;
+        int filter_x_start, filter_x_end;
+        x86::FilterTapRange(in_x_origin, 1, params.filter_width, input_width,
+                            &filter_x_start, &filter_x_end);
+        const int filter_count =
+            (filter_y_end - filter_y_start) * (filter_x_end - filter_x_start);
+        for (int channel_block = 0; channel_block < depth;
+             channel_block += x86::kInt32Lanes) {
+          const int lanes = std::min(x86::kInt32Lanes, depth - channel_block);
+          if (lanes == x86::kInt32Lanes) {
+            x86::Int32Vector acc_vector = x86::ZeroInt32();
+            for (int filter_y = filter_y_start; filter_y < filter_y_end;
+                 ++filter_y) {
+              for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                   ++filter_x) {
+                acc_vector = x86::AddInt32(
+                    acc_vector,
+                    x86::LoadAsInt32(
+                        input_data + Offset(input_shape, batch,
+                                            in_y_origin + filter_y,
+                                            in_x_origin + filter_x,
+                                            channel_block)));
+              }
+            }
+            x86::StoreInt32(acc_vector, acc);
+          } else {
+            // Remaining channels that don't fill a vector.
+            for (int lane = 0; lane < lanes; ++lane) {
+              acc[lane] = 0;
+              for (int filter_y = filter_y_start; filter_y < filter_y_end;
+                   ++filter_y) {
+                for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                     ++filter_x) {
+                  acc[lane] += input_data[Offset(
+                      input_shape, batch, in_y_origin + filter_y,
+                      in_x_origin + filter_x, channel_block + lane)];
+                }
+              }
+            }
+          }
+          for (int lane = 0; lane < lanes; ++lane) {
+            int32 result = (acc[lane] > 0)
+                               ? (acc[lane] + filter_count / 2) / filter_count
+                               : (acc[lane] - filter_count / 2) / filter_count;
+            result = std::max(result, params.quantized_activation_min);
+            result = std::min(result, params.quantized_activation_max);
+            output_data[Offset(output_shape, batch, out_y, out_x,
+                               channel_block + lane)] = static_cast<T>(result);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Quantized uint8 max pooling over 16 channels at once.
+void MaxPoolUint8Simd(const PoolParams& params,
+                      const RuntimeShape& input_shape, const uint8* input_data,
+                      const RuntimeShape& output_shape, uint8* output_data) {
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const uint8 activation_min =
+      static_cast<uint8>(params.quantized_activation_min);
+  const uint8 activation_max =
+      static_cast<uint8>(params.quantized_activation_max);
+  const __m128i activation_min_vector = _mm_set1_epi8(activation_min);
+  const __m128i activation_max_vector = _mm_set1_epi8(activation_max);
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          (out_y * params.stride_height) - params.padding_values.height;
+      int filter_y_start, filter_y_end;
+      x86::FilterTapRange(in_y_origin, 1, params.filter_height, input_height,
+                          &filter_y_start, &filter_y_end);
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin =
+            (out_x * params.stride_width) - params.padding_values.width;
+        int filter_x_start, filter_x_end;
+        x86::FilterTapRange(in_x_origin, 1, params.filter_width, input_width,
+                            &filter_x_start, &filter_x_end);
+        uint8* output =
+            output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        int channel = 0;
+        for (; channel <= depth - 16; channel += 16) {
+          __m128i max = _mm_setzero_si128();
+          for (int filter_y = filter_y_start; filter_y < filter_y_end;
+               ++filter_y) {
+            for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                 ++filter_x) {
+              const uint8* input =
+                  input_data + Offset(input_shape, batch,
+                                      in_y_origin + filter_y,
+                                      in_x_origin + filter_x, channel);
+              max = _mm_max_epu8(max, _mm_loadu_si128(
+                                          reinterpret_cast<const __m128i*>(
+                                              input)));
+            }
+          }
+          max = _mm_max_epu8(max, activation_min_vector);
+          max = _mm_min_epu8(max, activation_max_vector);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + channel), max);
+        }
+        // Remaining channels that don't fill a vector.
+        for (; channel < depth; ++channel) {
+          uint8 max = 0;
+          for (int filter_y = filter_y_start; filter_y < filter_y_end;
+               ++filter_y) {
+            for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                 ++filter_x) {
+              max = std::max(
+                  max, input_data[Offset(input_shape, batch,
+                                         in_y_origin + filter_y,
+                                         in_x_origin + filter_x, channel)]);
+            }
+          }
+          max = std::max(max, activation_min);
+          max = std::min(max, activation_max);
+          output[channel] = max;
+        }
+      }
+    }
+  }
+}
+#endif  // defined(TF_LITE_MICRO_X86_SIMD)
+
+void AverageEvalFloat(const TfLiteContext* context, const TfLiteNode* node,
+                      const TfLitePoolParams* params, const OpData* data,
+                      const TfLiteTensor* input, TfLiteTensor* output) {
+  PoolParams op_params;
+  op_params.stride_height = params->stride_height;
+  op_params.stride_width = params->stride_width;
+  op_params.filter_height = params->filter_height;
+  op_params.filter_width = params->filter_width;
+  op_params.padding_values.height = data->padding.height;
+  op_params.padding_values.width = data->padding.width;
+  op_params.float_activation_min = data->float_activation_min;
+  op_params.float_activation_max = data->float_activation_max;
+  reference_ops::AveragePool(
+      op_params, GetTensorShape(input), GetTensorData<float>(input),
+      GetTensorShape(output), GetTensorData<float>(output));
+}
+
+void AverageEvalUint8(const TfLiteContext* context, const TfLiteNode* node,
+                      const TfLitePoolParams* params, const OpData* data,
+                      const TfLiteTensor* input, TfLiteTensor* output) {
+  PoolParams op_params;
+  op_params.stride_height = params->stride_height;
+  op_params.stride_width = params->stride_width;
+  op_params.filter_height = params->filter_height;
+  op_params.filter_width = params->filter_width;
+  op_params.padding_values.height = data->padding.height;
+  op_params.padding_values.width = data->padding.width;
+  op_params.quantized_activation_min = data->activation_min;
+  op_params.quantized_activation_max = data->activation_max;
+#if defined(TF_LITE_MICRO_X86_SIMD)
+  AveragePoolSimd(op_params, GetTensorShape(input),
+                  GetTensorData<uint8_t>(input), GetTensorShape(output),
+                  GetTensorData<uint8_t>(output));
+#else
+  reference_ops::AveragePool(
+      op_params, GetTensorShape(input), GetTensorData<uint8_t>(input),
+      GetTensorShape(output), GetTensorData<uint8_t>(output));
+#endif
+}
+
+void AverageEvalInt8(const TfLiteContext* context, const TfLiteNode* node,
+                     const TfLitePoolParams* params, const OpData* data,
+                     const TfLiteTensor* input, TfLiteTensor* output) {
+  PoolParams op_params;
+  op_params.stride_height = params->stride_height;
+  op_params.stride_width = params->stride_width;
+  op_params.filter_height = params->filter_height;
+  op_params.filter_width = params->filter_width;
+  op_params.padding_values.height = data->padding.height;
+  op_params.padding_values.width = data->padding.width;
+  op_params.quantized_activation_min = data->activation_min;
+  op_params.quantized_activation_max = data->activation_max;
+#if defined(TF_LITE_MICRO_X86_SIMD)
+  AveragePoolSimd(op_params, GetTensorShape(input),
+                  GetTensorData<int8_t>(input), GetTensorShape(output),
+                  GetTensorData<int8_t>(output));
+#else
+  reference_integer_ops::AveragePool(
+      op_params, GetTensorShape(input), GetTensorData<int8_t>(input),
+      GetTensorShape(output), GetTensorData<int8_t>(output));
+#endif
+}
+
+void MaxEvalFloat(TfLiteContext* context, TfLiteNode* node,
+                  TfLitePoolParams* params, OpData* data,
+                  const TfLiteTensor* input, TfLiteTensor* output) {
+  tflite::PoolParams op_params;
+  op_params.stride_height = params->stride_height;
+  op_params.stride_width = params->stride_width;
+  op_params.filter_height = params->filter_height;
+  op_params.filter_width = params->filter_width;
+  op_params.padding_values.height = data->padding.height;
+  op_params.padding_values.width = data->padding.width;
+  op_params.float_activation_min = data->float_activation_min;
+  op_params.float_activation_max = data->float_activation_max;
+  reference_ops::MaxPool(op_params, GetTensorShape(input),
+                         GetTensorData<float>(input), GetTensorShape(output),
+                         GetTensorData<float>(output));
+}
+
+void MaxEvalQuantizedUInt8(TfLiteContext* context, TfLiteNode* node,
+                           TfLitePoolParams* params, OpData* data,
+                           const TfLiteTensor* input, TfLiteTensor* output) {
+  tflite::PoolParams op_params;
+  op_params.stride_height = params->stride_height;
+  op_params.stride_width = params->stride_width;
+  op_params.filter_height = params->filter_height;
+  op_params.filter_width = params->filter_width;
+  op_params.padding_values.height = data->padding.height;
+  op_params.padding_values.width = data->padding.width;
+  op_params.quantized_activation_min = data->activation_min;
+  op_params.quantized_activation_max = data->activation_max;
+#if defined(TF_LITE_MICRO_X86_SIMD)
+  MaxPoolUint8Simd(op_params, GetTensorShape(input),
+                   GetTensorData<uint8_t>(input), GetTensorShape(output),
+                   GetTensorData<uint8_t>(output));
+#else
+  reference_ops::MaxPool(op_params, GetTensorShape(input),
+                         GetTensorData<uint8_t>(input), GetTensorShape(output),
+                         GetTensorData<uint8_t>(output));
+#endif
+}
+
+}  // namespace
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  return context->AllocateOpData(context, sizeof(OpData));
+}
+
+void Free(TfLiteContext* context, void* buffer) {}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+  auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  return CalculateOpData(context, params, input, output, data);
+}
+
+TfLiteStatus AverageEval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
+  OpData& data = *(reinterpret_cast<OpData*>(node->user_data));
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  // Inputs and outputs share the same type, guarenteed by the converter.
+  switch (input->type) {
+    case kTfLiteFloat32:
+      AverageEvalFloat(context, node, params, &data, input, output);
+      break;
+    case kTfLiteUInt8:
+      AverageEvalUint8(context, node, params, &data, input, output);
+      break;
+    case kTfLiteInt8:
+      AverageEvalInt8(context, node, params, &data, input, output);
+      break;
+    default:
+      context->ReportError(context, "Input type %s is not currently supported",
+                           TfLiteTypeGetName(input->type));
+      return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MaxEval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params = reinterpret_cast<TfLitePoolParams*>(node->builtin_data);
+  OpData& data = *(reinterpret_cast<OpData*>(node->user_data));
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  switch (input->type) {
+    case kTfLiteFloat32:
+      MaxEvalFloat(context, node, params, &data, input, output);
+      break;
+    case kTfLiteUInt8:
+      MaxEvalQuantizedUInt8(context, node, params, &data, input, output);
+      break;
+    default:
+      context->ReportError(context, "Type %s not currently supported.",
+                           TfLiteTypeGetName(input->type));
+      return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace pooling
+
+TfLiteRegistration* Register_AVERAGE_POOL_2D() {
+  static TfLiteRegistration r = {
+      pooling::Init,
+      pooling::Free,
+      pooling::Prepare,
+      pooling::AverageEval,
+  };
+  return &r;
+}
+
+TfLiteRegistration* Register_MAX_POOL_2D() {
+  static TfLiteRegistration r = {pooling::Init, pooling::Free, pooling::Prepare,
+                                 pooling::MaxEval};
+  return &r;
+}
+
+}  // namespace micro
+}  // namespace ops
+}  // namespace tflite
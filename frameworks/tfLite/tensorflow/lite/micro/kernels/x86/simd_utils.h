@@ -0,0 +1,226 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_X86_SIMD_UTILS_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_X86_SIMD_UTILS_H_
+
+// Vector helpers for the x86 kernels. The kernels use AVX2 when the compiler
+// targets it (-mavx2), SSE4.1 otherwise (-msse4.1), and fall back to the
+// reference implementations when neither is available.
+//
+// All helpers work on integers only and widen before they multiply, so the
+// results are bit-exact to the scalar loops of the reference kernels.
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TF_LITE_MICRO_X86_AVX2
+#define TF_LITE_MICRO_X86_SIMD
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define TF_LITE_MICRO_X86_SSE4_1
+#define TF_LITE_MICRO_X86_SIMD
+#endif
+
+namespace tflite {
+namespace ops {
+namespace micro {
+namespace x86 {
+
+// Computes the range [*start, *end) of filter taps for which
+// `origin + dilation * tap` lies inside an input dimension of `input_size`.
+inline void FilterTapRange(int origin, int dilation, int filter_size,
+                           int input_size, int* start, int* end) {
+  *start = (origin < 0) ? (-origin + dilation - 1) / dilation : 0;
+  *end = filter_size;
+  while ((*end > *start) && (origin + dilation * (*end - 1) >= input_size)) {
+    --*end;
+  }
+}
+
+#if defined(TF_LITE_MICRO_X86_SIMD)
+
+#if defined(TF_LITE_MICRO_X86_AVX2)
+
+// Number of int32 lanes in an Int32Vector.
+constexpr int kInt32Lanes = 8;
+typedef __m256i Int32Vector;
+
+// Loads kInt32Lanes eight bit values and widens them to int32.
+inline Int32Vector LoadAsInt32(const uint8_t* data) {
+  return _mm256_cvtepu8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+}
+inline Int32Vector LoadAsInt32(const int8_t* data) {
+  return _mm256_cvtepi8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+}
+inline Int32Vector SetInt32(int32_t value) {
+  return _mm256_set1_epi32(value);
+}
+inline Int32Vector ZeroInt32() { return _mm256_setzero_si256(); }
+inline Int32Vector AddInt32(Int32Vector a, Int32Vector b) {
+  return _mm256_add_epi32(a, b);
+}
+inline Int32Vector MulInt32(Int32Vector a, Int32Vector b) {
+  return _mm256_mullo_epi32(a, b);
+}
+inline void StoreInt32(Int32Vector value, int32_t* data) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+}
+
+#else  // TF_LITE_MICRO_X86_SSE4_1
+
+constexpr int kInt32Lanes = 4;
+typedef __m128i Int32Vector;
+
+inline __m128i LoadFourBytes(const void* data) {
+  int32_t bytes;
+  std::memcpy(&bytes, data, sizeof(bytes));
+  return _mm_cvtsi32_si128(bytes);
+}
+inline Int32Vector LoadAsInt32(const uint8_t* data) {
+  return _mm_cvtepu8_epi32(LoadFourBytes(data));
+}
+inline Int32Vector LoadAsInt32(const int8_t* data) {
+  return _mm_cvtepi8_epi32(LoadFourBytes(data));
+}
+inline Int32Vector SetInt32(int32_t value) { return _mm_set1_epi32(value); }
+inline Int32Vector ZeroInt32() { return _mm_setzero_si128(); }
+inline Int32Vector AddInt32(Int32Vector a, Int32Vector b) {
+  return _mm_add_epi32(a, b);
+}
+inline Int32Vector MulInt32(Int32Vector a, Int32Vector b) {
+  return _mm_mullo_epi32(a, b);
+}
+inline void StoreInt32(Int32Vector value, int32_t* data) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+#endif  // TF_LITE_MICRO_X86_AVX2
+
+// Widens eight bit values to int16, eight at a time.
+inline __m128i LoadEightAsInt16(const uint8_t* data) {
+  return _mm_cvtepu8_epi16(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+}
+inline __m128i LoadEightAsInt16(const int8_t* data) {
+  return _mm_cvtepi8_epi16(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+}
+
+#if defined(TF_LITE_MICRO_X86_AVX2)
+inline __m256i LoadSixteenAsInt16(const uint8_t* data) {
+  return _mm256_cvtepu8_epi16(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+}
+inline __m256i LoadSixteenAsInt16(const int8_t* data) {
+  return _mm256_cvtepi8_epi16(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+}
+#endif
+
+inline int32_t HorizontalSum(__m128i value) {
+  value =
+      _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+  value =
+      _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(value);
+}
+
+// Returns sum((a[i] + a_offset) * (b[i] + b_offset)) over `size` elements.
+// The offsets are the negated zero points, so both factors fit into int16 and
+// the pairwise products of _mm_madd_epi16 can't overflow.
+template <typename T>
+inline int32_t DotProduct(const T* a, int32_t a_offset, const T* b,
+                          int32_t b_offset, int size) {
+  int i = 0;
+  __m128i acc = _mm_setzero_si128();
+#if defined(TF_LITE_MICRO_X86_AVX2)
+  const __m256i a_offset_256 = _mm256_set1_epi16(a_offset);
+  const __m256i b_offset_256 = _mm256_set1_epi16(b_offset);
+  __m256i acc_256 = _mm256_setzero_si256();
+  for (; i <= size - 16; i += 16) {
+    const __m256i a_values =
+        _mm256_add_epi16(LoadSixteenAsInt16(a + i), a_offset_256);
+    const __m256i b_values =
+        _mm256_add_epi16(LoadSixteenAsInt16(b + i), b_offset_256);
+    acc_256 = _mm256_add_epi32(acc_256, _mm256_madd_epi16(a_values, b_values));
+  }
+  acc = _mm_add_epi32(_mm256_castsi256_si128(acc_256),
+                      _mm256_extracti128_si256(acc_256, 1));
+#endif
+  const __m128i a_offset_128 = _mm_set1_epi16(a_offset);
+  const __m128i b_offset_128 = _mm_set1_epi16(b_offset);
+  for (; i <= size - 8; i += 8) {
+    const __m128i a_values =
+        _mm_add_epi16(LoadEightAsInt16(a + i), a_offset_128);
+    const __m128i b_values =
+        _mm_add_epi16(LoadEightAsInt16(b + i), b_offset_128);
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(a_values, b_values));
+  }
+  int32_t sum = HorizontalSum(acc);
+  for (; i < size; ++i) {
+    sum += (static_cast<int32_t>(a[i]) + a_offset) *
+           (static_cast<int32_t>(b[i]) + b_offset);
+  }
+  return sum;
+}
+
+// Returns the largest of `size` values.
+inline uint8_t MaxElement(const uint8_t* data, int size) {
+  int i = 0;
+  __m128i max = _mm_setzero_si128();
+  for (; i <= size - 16; i += 16) {
+    max = _mm_max_epu8(
+        max, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+  }
+  max = _mm_max_epu8(max, _mm_srli_si128(max, 8));
+  max = _mm_max_epu8(max, _mm_srli_si128(max, 4));
+  max = _mm_max_epu8(max, _mm_srli_si128(max, 2));
+  max = _mm_max_epu8(max, _mm_srli_si128(max, 1));
+  uint8_t result = static_cast<uint8_t>(_mm_cvtsi128_si32(max));
+  for (; i < size; ++i) {
+    result = (data[i] > result) ? data[i] : result;
+  }
+  return result;
+}
+inline int8_t MaxElement(const int8_t* data, int size) {
+  int i = 0;
+  __m128i max = _mm_set1_epi8(-128);
+  for (; i <= size - 16; i += 16) {
+    max = _mm_max_epi8(
+        max, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+  }
+  max = _mm_max_epi8(max, _mm_srli_si128(max, 8));
+  max = _mm_max_epi8(max, _mm_srli_si128(max, 4));
+  max = _mm_max_epi8(max, _mm_srli_si128(max, 2));
+  max = _mm_max_epi8(max, _mm_srli_si128(max, 1));
+  int8_t result = static_cast<int8_t>(_mm_cvtsi128_si32(max));
+  for (; i < size; ++i) {
+    result = (data[i] > result) ? data[i] : result;
+  }
+  return result;
+}
+
+#endif  // TF_LITE_MICRO_X86_SIMD
+
+}  // namespace x86
+}  // namespace micro
+}  // namespace ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_X86_SIMD_UTILS_H_
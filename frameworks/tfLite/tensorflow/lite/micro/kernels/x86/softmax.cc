@@ -0,0 +1,321 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/kernels/internal/reference/softmax.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/op_macros.h"
+#include "tensorflow/lite/micro/kernels/x86/simd_utils.h"
+
+namespace tflite {
+namespace ops {
+namespace micro {
+namespace activations {
+namespace {
+
+// The exponent is evaluated in the same fixed point formats as in the
+// reference kernels.
+constexpr int kScaledDiffIntegerBits = 5;
+constexpr int kAccumulationIntegerBits = 12;
+using FixedPointScaledDiff =
+    gemmlowp::FixedPoint<int32, kScaledDiffIntegerBits>;
+using FixedPointAccum = gemmlowp::FixedPoint<int32, kAccumulationIntegerBits>;
+using FixedPoint0 = gemmlowp::FixedPoint<int32, 0>;
+
+// Quantized inputs differ from the maximum of their row by 0 to 255 steps.
+constexpr int kExpTableSize = 256;
+
+struct OpData {
+  int32_t input_multiplier = 0;
+  int input_left_shift = 0;
+  int32_t input_range_radius = 0;
+  int diff_min = 0;
+  // Raw values of exp_on_negative_values() for an input that is `index`
+  // steps below the maximum of its row, or 0 for differences below diff_min,
+  // which the reference kernels skip. Those entries add nothing to the sum of
+  // the exponents and give the lowest output, just like in the reference
+  // kernels, so the results are bit-exact.
+  int32_t* exp_table = nullptr;
+};
+
+void PopulateExpTable(OpData* data) {
+  for (int i = 0; i < kExpTableSize; ++i) {
+    const int32 input_diff = -i;
+    if (input_diff >= data->diff_min) {
+      const int32 input_diff_rescaled =
+          MultiplyByQuantizedMultiplierGreaterThanOne(
+              input_diff, data->input_multiplier, data->input_left_shift);
+      data->exp_table[i] =
+          exp_on_negative_values(
+              FixedPointScaledDiff::FromRaw(input_diff_rescaled))
+              .raw();
+    } else {
+      data->exp_table[i] = 0;
+    }
+  }
+}
+
+TfLiteStatus CalculateSoftmaxOpData(TfLiteContext* context,
+                                    const TfLiteTensor* input,
+                                    TfLiteTensor* output,
+                                    const TfLiteSoftmaxParams* params,
+                                    OpData* data) {
+  if (input->type == kTfLiteUInt8 || input->type == kTfLiteInt8) {
+    if (input->type == kTfLiteUInt8) {
+      TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
+    } else {
+      TF_LITE_ENSURE_EQ(context, output->params.zero_point, -128);
+    }
+    TF_LITE_ENSURE(context, output->params.scale == 1.f / 256);
+
+    tflite::PreprocessSoftmaxScaling(
+        params->beta, input->params.scale, kScaledDiffIntegerBits,
+        &data->input_multiplier, &data->input_left_shift);
+    data->diff_min = -1.0 * tflite::CalculateInputRadius(
+                                kScaledDiffIntegerBits, data->input_left_shift);
+
+    data->exp_table = reinterpret_cast<int32_t*>(
+        context->AllocateOpData(context, kExpTableSize * sizeof(int32_t)));
+    TF_LITE_ENSURE(context, data->exp_table != nullptr);
+    PopulateExpTable(data);
+  }
+  return kTfLiteOk;
+}
+
+uint8_t MaxInRow(const uint8_t* row, int depth) {
+#if defined(TF_LITE_MICRO_X86_SIMD)
+  return x86::MaxElement(row, depth);
+#else
+  uint8_t max_in_row = 0;
+  for (int c = 0; c < depth; ++c) {
+    max_in_row = std::max(max_in_row, row[c]);
+  }
+  return max_in_row;
+#endif
+}
+
+int8_t MaxInRow(const int8_t* row, int depth) {
+#if defined(TF_LITE_MICRO_X86_SIMD)
+  return x86::MaxElement(row, depth);
+#else
+  int8_t max_in_row = -128;
+  for (int c = 0; c < depth; ++c) {
+    max_in_row = std::max(max_in_row, row[c]);
+  }
+  return max_in_row;
+#endif
+}
+
+// Quantized softmax along the last dimension that looks the exponents up in
+// OpData::exp_table instead of evaluating them twice per element. `T` is
+// uint8_t or int8_t, whose outputs are offset by 0 and -128.
+template <typename T>
+void SoftmaxQuantizedWithTable(const OpData* data, const RuntimeShape& shape,
+                               const T* input_data, T* output_data) {
+  const int32 output_zero_point = std::numeric_limits<T>::min();
+  const int trailing_dim = shape.DimensionsCount() - 1;
+  const int outer_size = FlatSizeSkipDim(shape, trailing_dim);
+  const int depth = shape.Dims(trailing_dim);
+
+  for (int i = 0; i < outer_size; ++i) {
+    const T* input_row = input_data + i * depth;
+    T* output_row = output_data + i * depth;
+    const int32 max_in_row = MaxInRow(input_row, depth);
+
+    FixedPointAccum sum_of_exps = FixedPointAccum::Zero();
+    for (int c = 0; c < depth; ++c) {
+      sum_of_exps =
+          sum_of_exps +
+          gemmlowp::Rescale<kAccumulationIntegerBits>(FixedPoint0::FromRaw(
+              data->exp_table[max_in_row - input_row[c]]));
+    }
+
+    int num_bits_over_unit;
+    FixedPoint0 shifted_scale = FixedPoint0::FromRaw(GetReciprocal(
+        sum_of_exps.raw(), kAccumulationIntegerBits, &num_bits_over_unit));
+
+    for (int c = 0; c < depth; ++c) {
+      const FixedPoint0 exp_in_0 =
+          FixedPoint0::FromRaw(data->exp_table[max_in_row - input_row[c]]);
+      const int32 unsat_output = gemmlowp::RoundingDivideByPOT(
+          (shifted_scale * exp_in_0).raw(), num_bits_over_unit + 31 - 8);
+      output_row[c] = static_cast<T>(
+          std::max(std::min(unsat_output + output_zero_point,
+                            static_cast<int32>(std::numeric_limits<T>::max())),
+                   output_zero_point));
+    }
+  }
+}
+
+void SoftmaxQuantized(const TfLiteTensor* input, TfLiteTensor* output,
+                      const RuntimeShape& shape, OpData* data) {
+  if (input->type == kTfLiteUInt8) {
+    SoftmaxQuantizedWithTable(data, shape, GetTensorData<uint8_t>(input),
+                              GetTensorData<uint8_t>(output));
+  } else {
+    SoftmaxQuantizedWithTable(data, shape, GetTensorData<int8_t>(input),
+                              GetTensorData<int8_t>(output));
+  }
+}
+
+}  // namespace
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  return context->AllocateOpData(context, sizeof(OpData));
+}
+
+void Free(TfLiteContext* context, void* buffer) {}
+
+TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE(context, node->user_data != nullptr);
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+  auto* params = reinterpret_cast<TfLiteSoftmaxParams*>(node->builtin_data);
+
+  const TfLiteTensor* input = GetInput(context, node, 0);
+  TfLiteTensor* output = GetOutput(context, node, 0);
+
+  return CalculateSoftmaxOpData(context, input, output, params, data);
+}
+
+// Takes a 1D tensor and performs softmax along it.
+void Softmax1DFloat(const TfLiteTensor* input, TfLiteTensor* output,
+                    TfLiteSoftmaxParams* params) {
+  const int input_size = input->dims->data[0];
+  tflite::reference_ops::Softmax(input->data.f, input_size, 1, params->beta,
+                                 output->data.f);
+}
+
+// Takes a 2D tensor and perform softmax along the last dimension.
+void Softmax2DFloat(const TfLiteTensor* input, TfLiteTensor* output,
+                    TfLiteSoftmaxParams* params) {
+  const int batch_size = input->dims->data[0];
+  const int input_size = input->dims->data[1];
+  tflite::reference_ops::Softmax(input->data.f, input_size, batch_size,
+                                 params->beta, output->data.f);
+}
+
+void Softmax1DQuantized(const TfLiteTensor* input, TfLiteTensor* output,
+                        TfLiteSoftmaxParams* params, OpData* data) {
+  // TODO(ahentz): this is arguably a dirty trick. Since the implementation
+  // always traverses the last dimension of a 4D tensor, we will pretend our 1D
+  // tensor is 4D in a special way. We will convert a (Y) shape into a (1,
+  // 1, 1, Y) shape.
+  const int input_size = input->dims->data[0];
+  const int32_t shape_data[4] = {1, 1, 1, input_size};
+  RuntimeShape shape(4, shape_data);
+  SoftmaxQuantized(input, output, shape, data);
+}
+
+void Softmax2DQuantized(const TfLiteTensor* input, TfLiteTensor* output,
+                        TfLiteSoftmaxParams* params, OpData* data) {
+  // TODO(ahentz): this is arguably a dirty trick. Since the implementation
+  // always traverses the last dimension of a 4D tensor, we will pretend our 2D
+  // tensor is 4D in a special way. We will convert a (X, Y) shape into a (X,
+  // 1, 1, Y) shape.
+  const int batch_size = input->dims->data[0];
+  const int input_size = input->dims->data[1];
+  const int32_t shape_data[4] = {batch_size, 1, 1, input_size};
+  RuntimeShape shape(4, shape_data);
+  SoftmaxQuantized(input, output, shape, data);
+}
+
+// Takes a 4D tensor and perform softmax along the forth dimension.
+void Softmax4DFloat(const TfLiteTensor* input, TfLiteTensor* output,
+                    TfLiteSoftmaxParams* params) {
+  SoftmaxParams op_params;
+  op_params.beta = params->beta;
+  tflite::reference_ops::Softmax(
+      op_params, GetTensorShape(input), GetTensorData<float>(input),
+      GetTensorShape(output), GetTensorData<float>(output));
+}
+
+void Softmax4DQuantized(const TfLiteTensor* input, TfLiteTensor* output,
+                        TfLiteSoftmaxParams* params, OpData* data) {
+  SoftmaxQuantized(input, output, GetTensorShape(input), data);
+}
+
+TfLiteStatus SoftmaxEval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params = reinterpret_cast<TfLiteSoftmaxParams*>(node->builtin_data);
+
+  const TfLiteTensor* input = GetInput(context, node, 0);
+  TfLiteTensor* output = GetOutput(context, node, 0);
+
+  OpData* data = reinterpret_cast<OpData*>(node->user_data);
+
+  // TODO(ahentz): consider an implementation that works for many (all?)
+  // dimensions.
+  switch (input->type) {
+    case kTfLiteFloat32: {
+      if (NumDimensions(input) == 1) {
+        Softmax1DFloat(input, output, params);
+        return kTfLiteOk;
+      }
+      if (NumDimensions(input) == 2) {
+        Softmax2DFloat(input, output, params);
+        return kTfLiteOk;
+      }
+      if (NumDimensions(input) == 4) {
+        Softmax4DFloat(input, output, params);
+        return kTfLiteOk;
+      }
+      context->ReportError(
+          context, "Only 1D, 2D and 4D tensors supported currently, got %dD.",
+          NumDimensions(input));
+      return kTfLiteError;
+    }
+    case kTfLiteInt8:
+    case kTfLiteUInt8: {
+      if (NumDimensions(input) == 1) {
+        Softmax1DQuantized(input, output, params, data);
+        return kTfLiteOk;
+      }
+      if (NumDimensions(input) == 2) {
+        Softmax2DQuantized(input, output, params, data);
+        return kTfLiteOk;
+      }
+      if (NumDimensions(input) == 4) {
+        Softmax4DQuantized(input, output, params, data);
+        return kTfLiteOk;
+      }
+      context->ReportError(
+          context, "Only 2D and 4D tensors supported currently, got %dD.",
+          NumDimensions(input));
+      return kTfLiteError;
+    }
+    default:
+      context->ReportError(
+          context,
+          "Only float32, uint8_t and int8_t supported currently, got %d.",
+          input->type);
+      return kTfLiteError;
+  }
+}
+}  // namespace activations
+
+TfLiteRegistration* Register_SOFTMAX() {
+  static TfLiteRegistration r = {activations::Init, activations::Free,
+                                 activations::SoftmaxPrepare,
+                                 activations::SoftmaxEval};
+  return &r;
+}
+
+}  // namespace micro
+}  // namespace ops
+}  // namespace tflite
@@ -41,13 +41,8 @@ void ReverseSortInPlace(int* values, int* ids, int size) {
 GreedyMemoryPlanner::GreedyMemoryPlanner(unsigned char* scratch_buffer,
                                          int scratch_buffer_size)
     : buffer_count_(0), need_to_calculate_offsets_(true) {
-  const int per_buffer_size = sizeof(BufferRequirements) +  // requirements_
-                              sizeof(int) +  // buffer_sizes_sorted_by_size_
-                              sizeof(int) +  // buffer_ids_sorted_by_size_
-                              sizeof(ListEntry) +  // buffers_sorted_by_offset_
-                              sizeof(int);         // buffer_offsets_;
   // Allocate the arrays we need within the scratch buffer arena.
-  max_buffer_count_ = scratch_buffer_size / per_buffer_size;
+  max_buffer_count_ = scratch_buffer_size / PerBufferScratchSize();
 
   unsigned char* next_free = scratch_buffer;
   requirements_ = reinterpret_cast<BufferRequirements*>(next_free);
@@ -65,6 +60,14 @@ GreedyMemoryPlanner::GreedyMemoryPlanner(unsigned char* scratch_buffer,
   buffer_offsets_ = reinterpret_cast<int*>(next_free);
 }
 
+int GreedyMemoryPlanner::PerBufferScratchSize() {
+  return sizeof(BufferRequirements) +  // requirements_
+         sizeof(int) +                 // buffer_sizes_sorted_by_size_
+         sizeof(int) +                 // buffer_ids_sorted_by_size_
+         sizeof(ListEntry) +           // buffers_sorted_by_offset_
+         sizeof(int);                  // buffer_offsets_;
+}
+
 GreedyMemoryPlanner::~GreedyMemoryPlanner() {
   // We don't own the scratch buffer, so don't deallocate anything.
 }
@@ -50,10 +50,14 @@ class GreedyMemoryPlanner : public MemoryPlanner {
   // this scratch memory, so you should enlarge it if you see an error when
   // calling AddBuffer(). The memory can be reused once you're done with the
   // planner, as long as you copy the calculated offsets to another location.
-  // Each buffer requires about 36 bytes of scratch.
+  // Each buffer requires about 36 bytes of scratch, see
+  // PerBufferScratchSize().
   GreedyMemoryPlanner(unsigned char* scratch_buffer, int scratch_buffer_size);
   ~GreedyMemoryPlanner() override;
 
+  // The number of bytes of scratch memory needed to plan a single buffer.
+  static int PerBufferScratchSize();
+
   // Record details of a buffer we want to place.
   TfLiteStatus AddBuffer(ErrorReporter* error_reporter, int size,
                          int first_time_used, int last_time_used) override;
@@ -15,7 +15,9 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/micro_allocator.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
@@ -81,33 +83,73 @@ class MicroBuiltinDataAllocator : public BuiltinDataAllocator {
 
 MicroAllocator::MicroAllocator(TfLiteContext* context, const Model* model,
                                uint8_t* tensor_arena, size_t arena_size,
-                               ErrorReporter* error_reporter)
+                               ErrorReporter* error_reporter,
+                               MemoryPlanner* memory_planner)
     : model_(model),
-      memory_allocator_(tensor_arena, arena_size),
+      owned_memory_allocator_(tensor_arena, arena_size),
+      memory_allocator_(&owned_memory_allocator_),
       error_reporter_(error_reporter),
       context_(context),
       arena_(tensor_arena),
-      arena_size_(arena_size) {
-  auto* subgraphs = model->subgraphs();
-  if (subgraphs->size() != 1) {
-    error_reporter->Report("Only 1 subgraph is currently supported.\n");
+      arena_size_(arena_size),
+      memory_planner_(memory_planner) {
+  Init(0);
+}
+
+MicroAllocator::MicroAllocator(TfLiteContext* context, const Model* model,
+                               SimpleMemoryAllocator* memory_allocator,
+                               ErrorReporter* error_reporter,
+                               MemoryPlanner* memory_planner,
+                               int subgraph_index)
+    : model_(model),
+      owned_memory_allocator_(nullptr, 0),
+      memory_allocator_(memory_allocator),
+      error_reporter_(error_reporter),
+      context_(context),
+      arena_(memory_allocator->GetBuffer()),
+      arena_size_(memory_allocator->GetBufferSize()),
+      memory_planner_(memory_planner) {
+  Init(subgraph_index);
+}
+
+void MicroAllocator::Init(int subgraph_index) {
+  auto* subgraphs = model_->subgraphs();
+  if ((subgraph_index < 0) ||
+      (subgraph_index >= static_cast<int>(subgraphs->size()))) {
+    error_reporter_->Report("Subgraph %d doesn't exist, the model has %d",
+                            subgraph_index, subgraphs->size());
     return;
   }
-  subgraph_ = (*subgraphs)[0];
+  subgraph_index_ = subgraph_index;
+  subgraph_ = (*subgraphs)[subgraph_index];
   tensors_ = subgraph_->tensors();
   operators_ = subgraph_->operators();
 
-  context_->tensors_size = tensors_->size();
-  context_->tensors =
-      reinterpret_cast<TfLiteTensor*>(memory_allocator_.AllocateFromTail(
-          sizeof(TfLiteTensor) * context_->tensors_size,
-          alignof(TfLiteTensor)));
-  if (context_->tensors == nullptr) {
+  runtime_tensors_ =
+      reinterpret_cast<TfLiteTensor*>(memory_allocator_->AllocateFromTail(
+          sizeof(TfLiteTensor) * tensors_->size(), alignof(TfLiteTensor)));
+  if (runtime_tensors_ == nullptr) {
     error_reporter_->Report(
         "Failed to allocate memory for context->tensors, %d bytes required",
-        sizeof(TfLiteTensor) * context_->tensors_size);
+        sizeof(TfLiteTensor) * tensors_->size());
+    return;
   }
+  runtime_tensors_size_ = tensors_->size();
+  context_->tensors = runtime_tensors_;
+  context_->tensors_size = runtime_tensors_size_;
   active_ = true;
+
+  // Initialize runtime tensors in context_ using the flatbuffer.
+  for (size_t i = 0; i < tensors_->size(); ++i) {
+    TfLiteStatus status =
+        InitializeRuntimeTensor(*tensors_->Get(i), model_->buffers(),
+                                error_reporter_, &runtime_tensors_[i]);
+    if (status != kTfLiteOk) {
+      error_reporter_->Report("Failed to initialize tensor %d", i);
+      active_ = false;
+      return;
+    }
+  }
 }
 
 TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
@@ -117,8 +159,8 @@ TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
     return kTfLiteError;
   }
 
-  auto* output =
-      reinterpret_cast<NodeAndRegistration*>(memory_allocator_.AllocateFromTail(
+  auto* output = reinterpret_cast<NodeAndRegistration*>(
+      memory_allocator_->AllocateFromTail(
           sizeof(NodeAndRegistration) * operators_->size(),
           alignof(NodeAndRegistration)));
   if (output == nullptr) {
@@ -128,7 +170,7 @@ TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
   }
   TfLiteStatus status = kTfLiteOk;
   auto* opcodes = model_->operator_codes();
-  MicroBuiltinDataAllocator builtin_data_allocator(&memory_allocator_);
+  MicroBuiltinDataAllocator builtin_data_allocator(memory_allocator_);
   for (size_t i = 0; i < operators_->size(); ++i) {
     const auto* op = operators_->Get(i);
     size_t index = op->opcode_index();
@@ -195,28 +237,129 @@ TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroAllocator::AllocatePersistentBuffer(size_t bytes,
+                                                      void** ptr) {
+  if (!active_) {
+    return kTfLiteError;
+  }
+  uint8_t* data = memory_allocator_->AllocateFromTail(bytes, kBufferAlignment);
+  if (data == nullptr) {
+    error_reporter_->Report(
+        "Failed to allocate persistent buffer of %d bytes, %d bytes of the "
+        "arena are already in use",
+        bytes, memory_allocator_->GetDataSize());
+    return kTfLiteError;
+  }
+  *ptr = data;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroAllocator::RequestScratchBufferInArena(int node_index,
+                                                         size_t bytes,
+                                                         int* buffer_index) {
+  if (!active_) {
+    return kTfLiteError;
+  }
+  auto* request = reinterpret_cast<ScratchBufferRequest*>(
+      memory_allocator_->AllocateFromTail(sizeof(ScratchBufferRequest),
+                                         alignof(ScratchBufferRequest)));
+  if (request == nullptr) {
+    error_reporter_->Report(
+        "Failed to allocate memory for a scratch buffer request of node %d",
+        node_index);
+    return kTfLiteError;
+  }
+  request->bytes = bytes;
+  request->node_index = node_index;
+  request->next = scratch_buffer_requests_;
+  scratch_buffer_requests_ = request;
+  *buffer_index = scratch_buffer_count_;
+  ++scratch_buffer_count_;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroAllocator::SetBatchSize(int batch_size) {
+  if (!active_) {
+    return kTfLiteError;
+  }
+  if (batch_size < 1) {
+    error_reporter_->Report("Invalid batch size %d", batch_size);
+    return kTfLiteError;
+  }
+  for (size_t i = 0; i < runtime_tensors_size_; ++i) {
+    TfLiteTensor* tensor = &runtime_tensors_[i];
+    if (tensor->allocation_type != kTfLiteArenaRw) {
+      continue;
+    }
+    if ((tensor->dims->size == 0) || (tensor->dims->data[0] != batch_size_)) {
+      error_reporter_->Report(
+          "Tensor %d can't be batched, its leading dimension isn't 1", i);
+      return kTfLiteError;
+    }
+  }
+  for (size_t i = 0; i < runtime_tensors_size_; ++i) {
+    TfLiteTensor* tensor = &runtime_tensors_[i];
+    if (tensor->allocation_type == kTfLiteArenaRw) {
+      tensor->bytes = (tensor->bytes / batch_size_) * batch_size;
+      tensor->dims->data[0] = batch_size;
+    }
+  }
+  batch_size_ = batch_size;
+  return kTfLiteOk;
+}
+
+void* MicroAllocator::GetScratchBuffer(int buffer_index) const {
+  if ((scratch_buffers_ == nullptr) || (buffer_index < 0) ||
+      (buffer_index >= scratch_buffer_count_)) {
+    return nullptr;
+  }
+  return scratch_buffers_[buffer_index];
+}
+
 TfLiteStatus MicroAllocator::FinishTensorAllocation() {
   if (!active_) {
     return kTfLiteError;
   }
 
-  // Initialize runtime tensors in context_ using the flatbuffer.
+  if (scratch_buffer_count_ > 0) {
+    scratch_buffers_ =
+        reinterpret_cast<uint8_t**>(memory_allocator_->AllocateFromTail(
+            sizeof(uint8_t*) * scratch_buffer_count_, alignof(uint8_t*)));
+    if (scratch_buffers_ == nullptr) {
+      error_reporter_->Report(
+          "Failed to allocate memory for %d scratch buffers",
+          scratch_buffer_count_);
+      return kTfLiteError;
+    }
+  }
+
+  // Variable tensors keep their state across invocations, so they are placed
+  // in the tail. The head is reused by every subgraph and every other model
+  // sharing the arena.
   for (size_t i = 0; i < tensors_->size(); ++i) {
-    TF_LITE_ENSURE_STATUS(
-        InitializeRuntimeTensor(*tensors_->Get(i), model_->buffers(),
-                                error_reporter_, &context_->tensors[i]));
+    TfLiteTensor* tensor = &runtime_tensors_[i];
+    if (tensors_->Get(i)->is_variable() && (tensor->data.raw == nullptr)) {
+      tensor->data.uint8 =
+          memory_allocator_->AllocateFromTail(tensor->bytes, kBufferAlignment);
+      if (tensor->data.uint8 == nullptr) {
+        error_reporter_->Report(
+            "Failed to allocate %d bytes for variable tensor %d",
+            tensor->bytes, i);
+        return kTfLiteError;
+      }
+    }
   }
 
   // tensor_info is only used in this function.
   SimpleMemoryAllocator tmp_allocator =
-      memory_allocator_.CreateChildAllocator();
+      memory_allocator_->CreateChildAllocator();
   TensorInfo* tensor_info =
       reinterpret_cast<TensorInfo*>(tmp_allocator.AllocateFromTail(
           sizeof(TensorInfo) * tensors_->size(), alignof(TensorInfo)));
   if (tensor_info == nullptr) {
     error_reporter_->Report(
         "Failed to allocate memory for tensor_info, %d bytes required",
-        sizeof(TfLiteTensor) * context_->tensors_size);
+        sizeof(TensorInfo) * tensors_->size());
     return kTfLiteError;
   }
 
@@ -224,7 +367,7 @@ TfLiteStatus MicroAllocator::FinishTensorAllocation() {
   for (size_t i = 0; i < tensors_->size(); ++i) {
     TensorInfo* current = &tensor_info[i];
     current->flatbuffer_tensor = &(*(tensors_->Get(i)));
-    current->runtime_tensor = &context_->tensors[i];
+    current->runtime_tensor = &runtime_tensors_[i];
     const bool is_variable = current->flatbuffer_tensor->is_variable();
     if (is_variable) {
       current->first_created = 0;
@@ -252,20 +395,22 @@ TfLiteStatus MicroAllocator::FinishTensorAllocation() {
     current->last_used = operators_->size() - 1;
   }
 
-  // Figure out when the first and last use of each tensor is.
+  // Figure out when the first and last use of each tensor is. A tensor has to
+  // stay alive until its last consumer has run, and it is created by its
+  // earliest producer.
   for (int i = (operators_->size() - 1); i >= 0; --i) {
     const auto* op = operators_->Get(i);
     for (size_t n = 0; n < op->inputs()->size(); ++n) {
       const int tensor_index = op->inputs()->Get(n);
       TensorInfo* current = &tensor_info[tensor_index];
-      if ((current->last_used == -1) || (current->last_used > i)) {
+      if ((current->last_used == -1) || (current->last_used < i)) {
         current->last_used = i;
       }
     }
     for (size_t n = 0; n < op->outputs()->size(); ++n) {
       const int tensor_index = op->outputs()->Get(n);
       TensorInfo* current = &tensor_info[tensor_index];
-      if ((current->first_created == -1) || (current->first_created < i)) {
+      if ((current->first_created == -1) || (current->first_created > i)) {
         current->first_created = i;
       }
     }
@@ -295,50 +440,156 @@ TfLiteStatus MicroAllocator::FinishTensorAllocation() {
   uint8_t* aligned_arena = AlignPointerUp(arena_, kBufferAlignment);
   const size_t alignment_loss = (aligned_arena - arena_);
 
-  // Remaining arena size that memory planner can use for calculating offsets.
-  int remaining_arena_size =
-      arena_size_ - (tmp_allocator.GetDataSize() + alignment_loss);
-  GreedyMemoryPlanner planner(aligned_arena, remaining_arena_size);
-
-  // Add the tensors to our allocation plan.
-  for (size_t i = 0; i < tensors_->size(); ++i) {
-    TensorInfo* current = &tensor_info[i];
-    if (current->needs_allocating) {
-      size_t bytes_required;
-      size_t type_size;
-      TF_LITE_ENSURE_STATUS(BytesRequiredForTensor(*current->flatbuffer_tensor,
-                                                   &bytes_required, &type_size,
-                                                   error_reporter_));
-      size_t aligned_bytes_required =
-          AlignSizeUp(bytes_required, kBufferAlignment);
-      TF_LITE_ENSURE_STATUS(
-          planner.AddBuffer(error_reporter_, aligned_bytes_required,
-                            current->first_created, current->last_used));
-    }
-  }
-
   // Actual size available for placing tensors. This includes memory held by the
   // tensor info array, which will be released.
   int actual_available_arena_size =
-      arena_size_ - (memory_allocator_.GetDataSize() + alignment_loss);
-  // Make sure we have enough room.
-  if (planner.GetMaximumMemorySize() > actual_available_arena_size) {
+      arena_size_ - (memory_allocator_->GetDataSize() + alignment_loss);
+
+  // Use the offline computed layout if it covers all buffers we have to place.
+  const int32_t* offline_offsets = nullptr;
+  TF_LITE_ENSURE_STATUS(GetOfflinePlannedOffsets(&offline_offsets));
+  if ((offline_offsets != nullptr) && (batch_size_ != 1)) {
     error_reporter_->Report(
-        "Arena size is too small for activation buffers. Needed %d but only %d "
-        "was available.",
-        planner.GetMaximumMemorySize(), remaining_arena_size);
-    return kTfLiteError;
+        "Offline memory plan is for a single sample, planning a batch of %d "
+        "on the device instead",
+        batch_size_);
+    offline_offsets = nullptr;
+  }
+  for (size_t i = 0; (offline_offsets != nullptr) && (i < tensors_->size());
+       ++i) {
+    if (tensor_info[i].needs_allocating &&
+        (offline_offsets[i] == kOfflineMemAllocNoOffset)) {
+      error_reporter_->Report(
+          "Offline memory plan has no offset for tensor %d, planning on the "
+          "device instead",
+          i);
+      offline_offsets = nullptr;
+    }
   }
 
-  // Figure out the actual memory addresses for each buffer, based on the plan.
-  int planner_index = 0;
-  for (size_t i = 0; i < tensors_->size(); ++i) {
-    TensorInfo* current = &tensor_info[i];
-    if (current->needs_allocating) {
+  if (offline_offsets != nullptr) {
+    int head_size = 0;
+    for (size_t i = 0; i < tensors_->size(); ++i) {
+      TensorInfo* current = &tensor_info[i];
+      if (current->needs_allocating) {
+        const int offset = offline_offsets[i];
+        if ((offset < 0) || ((offset % kBufferAlignment) != 0)) {
+          error_reporter_->Report(
+              "Offline memory plan has an invalid offset %d for tensor %d",
+              offset, i);
+          return kTfLiteError;
+        }
+        const int end =
+            offset + AlignSizeUp(current->runtime_tensor->bytes,
+                                 kBufferAlignment);
+        head_size = std::max(head_size, end);
+        current->runtime_tensor->data.uint8 = aligned_arena + offset;
+      }
+    }
+    // The offline plan doesn't know about scratch buffers. Each of them only
+    // lives while its node runs, so they can all share the space behind the
+    // planned buffers.
+    int scratch_size = 0;
+    int buffer_index = scratch_buffer_count_ - 1;
+    for (const ScratchBufferRequest* request = scratch_buffer_requests_;
+         request != nullptr; request = request->next, --buffer_index) {
+      scratch_size = std::max<int>(
+          scratch_size, AlignSizeUp(request->bytes, kBufferAlignment));
+      scratch_buffers_[buffer_index] = aligned_arena + head_size;
+    }
+    head_size += scratch_size;
+    if (head_size > actual_available_arena_size) {
+      error_reporter_->Report(
+          "Arena size is too small for activation buffers. Needed %d but only "
+          "%d was available.",
+          head_size, actual_available_arena_size);
+      return kTfLiteError;
+    }
+    if (!memory_allocator_->ReserveHead(alignment_loss + head_size)) {
+      error_reporter_->Report(
+          "Failed to reserve %d bytes for activation buffers at the head of "
+          "the arena, its tail is in the way.",
+          static_cast<int>(alignment_loss) + head_size);
+      return kTfLiteError;
+    }
+    used_bytes_ = std::max<size_t>(
+        tmp_allocator.GetDataSize() + alignment_loss,
+        memory_allocator_->GetDataSize() + memory_allocator_->GetHeadSize());
+  } else {
+    // Remaining arena size that memory planner can use for calculating
+    // offsets.
+    int remaining_arena_size =
+        arena_size_ - (tmp_allocator.GetDataSize() + alignment_loss);
+    GreedyMemoryPlanner greedy_planner(aligned_arena, remaining_arena_size);
+    MemoryPlanner& planner =
+        memory_planner_ ? *memory_planner_ : greedy_planner;
+
+    // Add the tensors to our allocation plan.
+    for (size_t i = 0; i < tensors_->size(); ++i) {
+      TensorInfo* current = &tensor_info[i];
+      if (current->needs_allocating) {
+        // The runtime size includes the batch, see SetBatchSize().
+        size_t aligned_bytes_required =
+            AlignSizeUp(current->runtime_tensor->bytes, kBufferAlignment);
+        TF_LITE_ENSURE_STATUS(
+            planner.AddBuffer(error_reporter_, aligned_bytes_required,
+                              current->first_created, current->last_used));
+      }
+    }
+    for (const ScratchBufferRequest* request = scratch_buffer_requests_;
+         request != nullptr; request = request->next) {
+      TF_LITE_ENSURE_STATUS(planner.AddBuffer(
+          error_reporter_, AlignSizeUp(request->bytes, kBufferAlignment),
+          request->node_index, request->node_index));
+    }
+
+    // Make sure we have enough room.
+    if (planner.GetMaximumMemorySize() > actual_available_arena_size) {
+      error_reporter_->Report(
+          "Arena size is too small for activation buffers. Needed %d but only "
+          "%d was available.",
+          planner.GetMaximumMemorySize(), actual_available_arena_size);
+      return kTfLiteError;
+    }
+
+    // The arena has to hold the final layout as well as the tensor info array
+    // and the scratch data of the default planner while planning.
+    size_t planning_bytes = tmp_allocator.GetDataSize() + alignment_loss;
+    if (memory_planner_ == nullptr) {
+      planning_bytes += GreedyMemoryPlanner::PerBufferScratchSize() *
+                        planner.GetBufferCount();
+    }
+    if (!memory_allocator_->ReserveHead(alignment_loss +
+                                        planner.GetMaximumMemorySize())) {
+      error_reporter_->Report(
+          "Failed to reserve %d bytes for activation buffers at the head of "
+          "the arena, its tail is in the way.",
+          static_cast<int>(alignment_loss) + planner.GetMaximumMemorySize());
+      return kTfLiteError;
+    }
+    const size_t layout_bytes =
+        memory_allocator_->GetDataSize() + memory_allocator_->GetHeadSize();
+    used_bytes_ = std::max(planning_bytes, layout_bytes);
+
+    // Figure out the actual memory addresses for each buffer, based on the
+    // plan.
+    int planner_index = 0;
+    for (size_t i = 0; i < tensors_->size(); ++i) {
+      TensorInfo* current = &tensor_info[i];
+      if (current->needs_allocating) {
+        int offset;
+        TF_LITE_ENSURE_STATUS(planner.GetOffsetForBuffer(
+            error_reporter_, planner_index, &offset));
+        current->runtime_tensor->data.uint8 = aligned_arena + offset;
+        ++planner_index;
+      }
+    }
+    for (int buffer_index = scratch_buffer_count_ - 1; buffer_index >= 0;
+         --buffer_index) {
       int offset;
-      TF_LITE_ENSURE_STATUS(
-          planner.GetOffsetForBuffer(error_reporter_, planner_index, &offset));
-      current->runtime_tensor->data.uint8 = aligned_arena + offset;
+      TF_LITE_ENSURE_STATUS(planner.GetOffsetForBuffer(
+          error_reporter_, planner_index, &offset));
+      scratch_buffers_[buffer_index] = aligned_arena + offset;
       ++planner_index;
     }
   }
@@ -362,6 +613,63 @@ TfLiteStatus MicroAllocator::FinishTensorAllocation() {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroAllocator::GetOfflinePlannedOffsets(
+    const int32_t** offsets) {
+  *offsets = nullptr;
+  const auto* metadata = model_->metadata();
+  if (metadata == nullptr) {
+    return kTfLiteOk;
+  }
+  for (size_t i = 0; i < metadata->size(); ++i) {
+    const auto* entry = metadata->Get(i);
+    if ((entry->name() == nullptr) ||
+        (strncmp(entry->name()->c_str(), kOfflineMemAllocMetadata,
+                 sizeof(kOfflineMemAllocMetadata)) != 0)) {
+      continue;
+    }
+    const auto* buffer = model_->buffers()->Get(entry->buffer());
+    if ((buffer == nullptr) || (buffer->data() == nullptr) ||
+        (buffer->data()->size() <
+         kOfflineMemAllocHeaderSize * sizeof(int32_t))) {
+      error_reporter_->Report("Offline memory plan is truncated");
+      return kTfLiteError;
+    }
+    const int32_t* data =
+        reinterpret_cast<const int32_t*>(buffer->data()->data());
+    const int32_t version = flatbuffers::EndianScalar(data[0]);
+    const int32_t subgraph_index = flatbuffers::EndianScalar(data[1]);
+    const int32_t tensor_count = flatbuffers::EndianScalar(data[2]);
+    if (version != kOfflineMemAllocVersion) {
+      error_reporter_->Report("Unsupported offline memory plan version %d",
+                              version);
+      return kTfLiteError;
+    }
+    // The plan covers a single subgraph, the others are planned on the
+    // device.
+    if (subgraph_index != subgraph_index_) {
+      return kTfLiteOk;
+    }
+    const size_t expected_size =
+        (kOfflineMemAllocHeaderSize + tensors_->size()) * sizeof(int32_t);
+    if (buffer->data()->size() < expected_size) {
+      error_reporter_->Report("Offline memory plan is truncated");
+      return kTfLiteError;
+    }
+    if (tensor_count != static_cast<int32_t>(tensors_->size())) {
+      error_reporter_->Report(
+          "Offline memory plan for subgraph %d with %d tensors doesn't match "
+          "the model",
+          subgraph_index, tensor_count);
+      return kTfLiteError;
+    }
+    // Offline plans are only written for little-endian targets, so the
+    // offsets can be used in place.
+    *offsets = data + kOfflineMemAllocHeaderSize;
+    return kTfLiteOk;
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroAllocator::InitializeRuntimeTensor(
     const tflite::Tensor& flatbuffer_tensor,
     const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
@@ -421,7 +729,7 @@ TfLiteStatus MicroAllocator::InitializeRuntimeTensor(
   // Copy the shape of the tensor from the serialized data into the runtime
   // form. We have to allocate memory for this.
   result->dims =
-      reinterpret_cast<TfLiteIntArray*>(memory_allocator_.AllocateFromTail(
+      reinterpret_cast<TfLiteIntArray*>(memory_allocator_->AllocateFromTail(
           TfLiteIntArrayGetSizeInBytes(flatbuffer_tensor.shape()->Length()),
           alignof(TfLiteIntArray)));
   result->dims->size = flatbuffer_tensor.shape()->Length();
@@ -435,27 +743,23 @@ TfLiteStatus MicroAllocator::InitializeRuntimeTensor(
       src_quantization->zero_point() &&
       (src_quantization->zero_point()->size() > 0)) {
     result->params.scale = src_quantization->scale()->Get(0);
-    // This magic handles issues with little-endianness.
-    for (unsigned int b = 0; b < sizeof(int64_t); ++b)
-      *(reinterpret_cast<char*>(&result->params.zero_point) + b) =
-          *(reinterpret_cast<const char*>(
-                src_quantization->zero_point()->Data()) +
-            b);
+    // The serialized zero point is an int64, the runtime one an int32. Copying
+    // all eight bytes would overwrite the allocation type behind it.
     result->params.zero_point =
-        flatbuffers::EndianScalar(result->params.zero_point);
+        static_cast<int32_t>(src_quantization->zero_point()->Get(0));
 
     // Populate per-channel quantization params.
     int channels = src_quantization->scale()->size();
     TfLiteAffineQuantization* quantization =
         reinterpret_cast<TfLiteAffineQuantization*>(
-            memory_allocator_.AllocateFromTail(
+            memory_allocator_->AllocateFromTail(
                 sizeof(TfLiteAffineQuantization),
                 alignof(TfLiteAffineQuantization)));
     quantization->zero_point =
-        reinterpret_cast<TfLiteIntArray*>(memory_allocator_.AllocateFromTail(
+        reinterpret_cast<TfLiteIntArray*>(memory_allocator_->AllocateFromTail(
             TfLiteIntArrayGetSizeInBytes(channels), alignof(TfLiteIntArray)));
     quantization->scale =
-        reinterpret_cast<TfLiteFloatArray*>(memory_allocator_.AllocateFromTail(
+        reinterpret_cast<TfLiteFloatArray*>(memory_allocator_->AllocateFromTail(
             TfLiteFloatArrayGetSizeInBytes(channels),
             alignof(TfLiteFloatArray)));
     quantization->zero_point->size = channels;
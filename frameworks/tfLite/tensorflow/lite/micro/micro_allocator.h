@@ -18,6 +18,7 @@ limitations under the License.
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "tensorflow/lite/micro/memory_planner/memory_planner.h"
 #include "tensorflow/lite/micro/simple_memory_allocator.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
@@ -28,26 +29,70 @@ typedef struct {
   const TfLiteRegistration* registration;
 } NodeAndRegistration;
 
+// Name of the model metadata entry that holds an offline computed layout of the
+// activation buffers, as written by tools/offline_memory_planner.cc. The
+// referenced buffer contains little-endian int32 values:
+//   [0]        format version, kOfflineMemAllocVersion
+//   [1]        index of the subgraph the layout is for
+//   [2]        number of tensors N in that subgraph
+//   [3, 3 + N) offset of each tensor from the aligned start of the arena, or
+//              kOfflineMemAllocNoOffset if it doesn't live in the arena.
+// Offsets are multiples of kOfflineMemAllocAlignment.
+constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
+constexpr int32_t kOfflineMemAllocVersion = 0;
+constexpr int32_t kOfflineMemAllocNoOffset = -1;
+constexpr int kOfflineMemAllocAlignment = 16;
+constexpr int kOfflineMemAllocHeaderSize = 3;
+
 // Allocator responsible for allocating memory for all intermediate tensors
 // necessary to invoke a model.
+//
+// The arena is split in two parts:
+//  - The tail holds everything that lives as long as the model, like the
+//    runtime tensor structs, nodes and kernel op data.
+//  - The head holds the activation buffers. Their placement is computed by a
+//    MemoryPlanner from the lifetime of each tensor, so buffers that are never
+//    needed at the same time share memory.
+// Each allocator plans one subgraph of the model. Allocators of different
+// subgraphs or models can share an arena through a common
+// SimpleMemoryAllocator. Their activation buffers then overlap, so only one of
+// them can be invoked at a time, and inputs have to be filled right before
+// and outputs read right after invoking it.
 class MicroAllocator {
  public:
   // The lifetime of the model, tensor allocator and error reporter must be at
   // least as long as that of the allocator object, since the allocator needs
   // them to be accessible during its entire lifetime.
+  // If no `memory_planner` is given, a GreedyMemoryPlanner is used that keeps
+  // its scratch data in the arena while planning. A custom planner has to be
+  // empty and must outlive the call to FinishTensorAllocation().
   MicroAllocator(TfLiteContext* context, const Model* model,
                  uint8_t* tensor_arena, size_t arena_size,
-                 ErrorReporter* error_reporter);
+                 ErrorReporter* error_reporter,
+                 MemoryPlanner* memory_planner = nullptr);
+
+  // Plans subgraph `subgraph_index` of the model in the arena managed by
+  // `memory_allocator`, which may be shared with other allocators.
+  MicroAllocator(TfLiteContext* context, const Model* model,
+                 SimpleMemoryAllocator* memory_allocator,
+                 ErrorReporter* error_reporter,
+                 MemoryPlanner* memory_planner = nullptr,
+                 int subgraph_index = 0);
 
   // Sets up all of the data structure members for a runtime tensor based on the
-  // contents of a serialized tensor.
+  // contents of a serialized tensor. This is done for every tensor of the model
+  // during construction, so that kernels can inspect shapes, types and
+  // quantization parameters in their `prepare` step before any activation
+  // buffers have been planned.
   TfLiteStatus InitializeRuntimeTensor(
       const tflite::Tensor& flatbuffer_tensor,
       const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
       ErrorReporter* error_reporter, TfLiteTensor* result);
 
   // Runs through the model and allocates all necessary input, output and
-  // intermediate tensors.
+  // intermediate tensors. If the model carries an offline computed layout (see
+  // kOfflineMemAllocMetadata) that covers every activation buffer, the offsets
+  // are taken as they are and no planning happens on the device.
   // WARNING: doing any allocation after calling this method has the risk of
   // corrupting tensor data so this method should be the last method to be
   // called in this class.
@@ -60,19 +105,82 @@ class MicroAllocator {
       const OpResolver& op_resolver,
       NodeAndRegistration** node_and_registrations);
 
+  // Allocates a buffer that stays valid for the whole lifetime of the
+  // interpreter, typically to hold op data computed once in a kernel's `init`
+  // or `prepare` step. The buffer is placed in the tail of the arena, so it
+  // must be requested before FinishTensorAllocation().
+  TfLiteStatus AllocatePersistentBuffer(size_t bytes, void** ptr);
+
+  // Registers a scratch buffer of `bytes` for the node at `node_index`. The
+  // buffer is planned together with the activation buffers and only lives
+  // while that node runs. Must be called before FinishTensorAllocation().
+  TfLiteStatus RequestScratchBufferInArena(int node_index, size_t bytes,
+                                           int* buffer_index);
+
+  // Makes the subgraph process `batch_size` samples per invocation by scaling
+  // the leading dimension of every tensor that lives in the arena, i.e. all
+  // inputs, outputs, intermediate and variable tensors, which have to have a
+  // leading dimension of 1 in the model. Weights are left untouched. The
+  // activation buffers grow by the same factor. Must be called before the
+  // kernels are prepared, since they derive their loop bounds from the
+  // shapes, and can be called again to change the batch size until then.
+  TfLiteStatus SetBatchSize(int batch_size);
+  int batch_size() const { return batch_size_; }
+
+  // Returns the memory of a scratch buffer requested with
+  // RequestScratchBufferInArena(), or nullptr before FinishTensorAllocation().
+  void* GetScratchBuffer(int buffer_index) const;
+
+  // Returns the high-water mark of the arena in bytes, i.e. the smallest arena
+  // that the model could have been allocated in, including the temporary data
+  // needed while planning. For a shared arena this includes all users that
+  // were planned before. Only valid after FinishTensorAllocation().
+  size_t used_bytes() const { return used_bytes_; }
+
+  // Runtime tensors of the subgraph, which the constructor also stores in the
+  // context.
+  TfLiteTensor* runtime_tensors() const { return runtime_tensors_; }
+  size_t runtime_tensors_size() const { return runtime_tensors_size_; }
+
  private:
+  void Init(int subgraph_index);
+
+  // Looks up the offline computed arena offsets in the model metadata. Sets
+  // `offsets` to nullptr if the model doesn't carry a layout for the subgraph.
+  TfLiteStatus GetOfflinePlannedOffsets(const int32_t** offsets);
+
+  // Scratch buffer requests are kept in a list in the tail of the arena until
+  // they are planned, the resulting addresses in an array indexed by the
+  // buffer index.
+  struct ScratchBufferRequest {
+    size_t bytes;
+    int node_index;
+    ScratchBufferRequest* next;
+  };
+
   const Model* model_;
-  SimpleMemoryAllocator memory_allocator_;
+  // Only used if the allocator isn't given a shared one.
+  SimpleMemoryAllocator owned_memory_allocator_;
+  SimpleMemoryAllocator* memory_allocator_;
   ErrorReporter* error_reporter_;
   TfLiteContext* context_;
   uint8_t* arena_;
   size_t arena_size_;
+  MemoryPlanner* memory_planner_;
+  size_t used_bytes_ = 0;
+  int batch_size_ = 1;
+  ScratchBufferRequest* scratch_buffer_requests_ = nullptr;
+  int scratch_buffer_count_ = 0;
+  uint8_t** scratch_buffers_ = nullptr;
   // Indicating if the allocator is ready for allocation.
   bool active_ = false;
 
+  int subgraph_index_ = 0;
   const SubGraph* subgraph_;
   const flatbuffers::Vector<flatbuffers::Offset<Operator>>* operators_;
   const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors_;
+  TfLiteTensor* runtime_tensors_ = nullptr;
+  size_t runtime_tensors_size_ = 0;
 };
 
 }  // namespace tflite
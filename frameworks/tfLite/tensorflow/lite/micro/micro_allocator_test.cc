@@ -17,9 +17,27 @@ limitations under the License.
 
 #include <cstdint>
 
+#include "tensorflow/lite/micro/memory_planner/linear_memory_planner.h"
 #include "tensorflow/lite/micro/test_helpers.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
+namespace tflite {
+namespace testing {
+namespace {
+
+bool BuffersOverlap(const uint8_t* a, size_t a_bytes, const uint8_t* b,
+                    size_t b_bytes) {
+  return (a < b + b_bytes) && (b < a + a_bytes);
+}
+
+bool TensorsOverlap(const TfLiteTensor& a, const TfLiteTensor& b) {
+  return BuffersOverlap(a.data.uint8, a.bytes, b.data.uint8, b.bytes);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
 TF_LITE_MICRO_TESTS_BEGIN
 
 TF_LITE_MICRO_TEST(TestInitializeRuntimeTensor) {
@@ -114,6 +132,205 @@ TF_LITE_MICRO_TEST(TestFinishTensorAllocation) {
                           context.tensors[0].data.raw);
   TF_LITE_MICRO_EXPECT_NE(context.tensors[1].data.raw,
                           context.tensors[2].data.raw);
+  TF_LITE_MICRO_EXPECT_GT(allocator.used_bytes(), 0);
+  TF_LITE_MICRO_EXPECT_LE(allocator.used_bytes(), arena_size);
+}
+
+TF_LITE_MICRO_TEST(TestSharedTensorLifetime) {
+  const tflite::Model* model = tflite::testing::GetComplexMockModel();
+  TfLiteContext context;
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(5, context.tensors_size);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.FinishTensorAllocation());
+
+  // The model input is read by the first and the last op, so it must not share
+  // memory with any tensor that is created in between.
+  const TfLiteTensor* tensors = context.tensors;
+  TF_LITE_MICRO_EXPECT_FALSE(
+      tflite::testing::TensorsOverlap(tensors[0], tensors[2]));
+  TF_LITE_MICRO_EXPECT_FALSE(
+      tflite::testing::TensorsOverlap(tensors[0], tensors[3]));
+  TF_LITE_MICRO_EXPECT_FALSE(
+      tflite::testing::TensorsOverlap(tensors[0], tensors[4]));
+  TF_LITE_MICRO_EXPECT_FALSE(
+      tflite::testing::TensorsOverlap(tensors[2], tensors[3]));
+  TF_LITE_MICRO_EXPECT_FALSE(
+      tflite::testing::TensorsOverlap(tensors[3], tensors[4]));
+  // The first intermediate tensor is dead once the last op runs, so the
+  // output can reuse its memory.
+  TF_LITE_MICRO_EXPECT_EQ(tensors[2].data.raw, tensors[4].data.raw);
+}
+
+TF_LITE_MICRO_TEST(TestCustomMemoryPlanner) {
+  const tflite::Model* model = tflite::testing::GetComplexMockModel();
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+
+  TfLiteContext greedy_context;
+  tflite::MicroAllocator greedy_allocator(&greedy_context, model, arena,
+                                          arena_size, micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, greedy_allocator.FinishTensorAllocation());
+
+  TfLiteContext linear_context;
+  tflite::LinearMemoryPlanner linear_planner;
+  tflite::MicroAllocator linear_allocator(&linear_context, model, arena,
+                                          arena_size, micro_test::reporter,
+                                          &linear_planner);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, linear_allocator.FinishTensorAllocation());
+  TF_LITE_MICRO_EXPECT_EQ(4, linear_planner.GetBufferCount());
+
+  // Without reuse every activation gets its own buffer.
+  const TfLiteTensor* tensors = linear_context.tensors;
+  TF_LITE_MICRO_EXPECT_FALSE(
+      tflite::testing::TensorsOverlap(tensors[2], tensors[4]));
+}
+
+TF_LITE_MICRO_TEST(TestUsedBytesIsSufficient) {
+  const tflite::Model* model = tflite::testing::GetComplexMockModel();
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+
+  TfLiteContext context;
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.FinishTensorAllocation());
+  const size_t used_bytes = allocator.used_bytes();
+  TF_LITE_MICRO_EXPECT_LT(used_bytes, arena_size);
+
+  // Leave room for the alignment of the tail allocations, which depends on
+  // where the arena ends.
+  constexpr size_t kAlignmentSlack = 16;
+  TfLiteContext small_context;
+  tflite::MicroAllocator small_allocator(&small_context, model, arena,
+                                         used_bytes + kAlignmentSlack,
+                                         micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, small_allocator.FinishTensorAllocation());
+}
+
+TF_LITE_MICRO_TEST(TestOfflinePlannedOffsets) {
+  // Input at 32, the weight tensor lives in the flatbuffer and both
+  // intermediates and the output share the first 32 bytes.
+  const int32_t offsets[] = {32, -1, 0, 16, 0};
+  const tflite::Model* model =
+      tflite::testing::GetComplexMockModelWithOfflinePlan(offsets);
+  TfLiteContext context;
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+  tflite::LinearMemoryPlanner planner;
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter, &planner);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.FinishTensorAllocation());
+
+  // The offline plan is used as it is, without asking the planner.
+  TF_LITE_MICRO_EXPECT_EQ(0, planner.GetBufferCount());
+  const TfLiteTensor* tensors = context.tensors;
+  const uint8_t* arena_start = tensors[2].data.uint8;
+  TF_LITE_MICRO_EXPECT_EQ(32, tensors[0].data.uint8 - arena_start);
+  TF_LITE_MICRO_EXPECT_EQ(16, tensors[3].data.uint8 - arena_start);
+  TF_LITE_MICRO_EXPECT_EQ(0, tensors[4].data.uint8 - arena_start);
+  TF_LITE_MICRO_EXPECT_EQ(0, reinterpret_cast<uintptr_t>(arena_start) % 16);
+  TF_LITE_MICRO_EXPECT_LE(static_cast<size_t>(48), allocator.used_bytes());
+}
+
+TF_LITE_MICRO_TEST(TestIncompleteOfflinePlanFallsBack) {
+  // The model input has no offset, so the allocator has to plan by itself.
+  const int32_t offsets[] = {-1, -1, 0, 16, 0};
+  const tflite::Model* model =
+      tflite::testing::GetComplexMockModelWithOfflinePlan(offsets);
+  TfLiteContext context;
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+  tflite::LinearMemoryPlanner planner;
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter, &planner);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.FinishTensorAllocation());
+  TF_LITE_MICRO_EXPECT_EQ(4, planner.GetBufferCount());
+}
+
+TF_LITE_MICRO_TEST(TestOfflinePlanMisalignedOffset) {
+  const int32_t offsets[] = {40, -1, 0, 16, 0};
+  const tflite::Model* model =
+      tflite::testing::GetComplexMockModelWithOfflinePlan(offsets);
+  TfLiteContext context;
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, allocator.FinishTensorAllocation());
+}
+
+TF_LITE_MICRO_TEST(TestScratchBuffers) {
+  const tflite::Model* model = tflite::testing::GetComplexMockModel();
+  TfLiteContext context;
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter);
+  int first_index = -1;
+  int second_index = -1;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.RequestScratchBufferInArena(
+                                         1, 20, &first_index));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.RequestScratchBufferInArena(
+                                         2, 8, &second_index));
+  TF_LITE_MICRO_EXPECT_EQ(0, first_index);
+  TF_LITE_MICRO_EXPECT_EQ(1, second_index);
+  TF_LITE_MICRO_EXPECT_EQ(nullptr, allocator.GetScratchBuffer(first_index));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.FinishTensorAllocation());
+
+  uint8_t* first = static_cast<uint8_t*>(allocator.GetScratchBuffer(0));
+  uint8_t* second = static_cast<uint8_t*>(allocator.GetScratchBuffer(1));
+  TF_LITE_MICRO_EXPECT_NE(nullptr, first);
+  TF_LITE_MICRO_EXPECT_NE(nullptr, second);
+  TF_LITE_MICRO_EXPECT_EQ(nullptr, allocator.GetScratchBuffer(2));
+  TF_LITE_MICRO_EXPECT_EQ(0, reinterpret_cast<uintptr_t>(first) % 16);
+  TF_LITE_MICRO_EXPECT_EQ(0, reinterpret_cast<uintptr_t>(second) % 16);
+
+  // A scratch buffer must not share memory with the tensors its node reads
+  // and writes, or with the model input that stays alive throughout.
+  const TfLiteTensor* tensors = context.tensors;
+  TF_LITE_MICRO_EXPECT_FALSE(tflite::testing::BuffersOverlap(
+      first, 20, tensors[0].data.uint8, tensors[0].bytes));
+  TF_LITE_MICRO_EXPECT_FALSE(tflite::testing::BuffersOverlap(
+      first, 20, tensors[2].data.uint8, tensors[2].bytes));
+  TF_LITE_MICRO_EXPECT_FALSE(tflite::testing::BuffersOverlap(
+      first, 20, tensors[3].data.uint8, tensors[3].bytes));
+  TF_LITE_MICRO_EXPECT_FALSE(tflite::testing::BuffersOverlap(
+      second, 8, tensors[0].data.uint8, tensors[0].bytes));
+  TF_LITE_MICRO_EXPECT_FALSE(tflite::testing::BuffersOverlap(
+      second, 8, tensors[3].data.uint8, tensors[3].bytes));
+  TF_LITE_MICRO_EXPECT_FALSE(tflite::testing::BuffersOverlap(
+      second, 8, tensors[4].data.uint8, tensors[4].bytes));
+}
+
+TF_LITE_MICRO_TEST(TestScratchBuffersWithOfflinePlan) {
+  const int32_t offsets[] = {32, -1, 0, 16, 0};
+  const tflite::Model* model =
+      tflite::testing::GetComplexMockModelWithOfflinePlan(offsets);
+  TfLiteContext context;
+  constexpr size_t arena_size = 2048;
+  uint8_t arena[arena_size];
+  tflite::MicroAllocator allocator(&context, model, arena, arena_size,
+                                   micro_test::reporter);
+  int first_index;
+  int second_index;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.RequestScratchBufferInArena(
+                                         0, 20, &first_index));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.RequestScratchBufferInArena(
+                                         2, 8, &second_index));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, allocator.FinishTensorAllocation());
+
+  // Both go behind the offline planned buffers and share their memory.
+  const uint8_t* arena_start = context.tensors[2].data.uint8;
+  TF_LITE_MICRO_EXPECT_EQ(
+      48, static_cast<uint8_t*>(allocator.GetScratchBuffer(first_index)) -
+              arena_start);
+  TF_LITE_MICRO_EXPECT_EQ(
+      48, static_cast<uint8_t*>(allocator.GetScratchBuffer(second_index)) -
+              arena_start);
+  TF_LITE_MICRO_EXPECT_LE(static_cast<size_t>(80), allocator.used_bytes());
 }
 
 TF_LITE_MICRO_TESTS_END
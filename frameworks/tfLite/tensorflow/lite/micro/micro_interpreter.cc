@@ -14,6 +14,9 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/micro/micro_interpreter.h"
 
+#include <algorithm>
+#include <new>
+
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
 #include "tensorflow/lite/micro/compatibility.h"
@@ -58,33 +61,92 @@ void ReportOpError(struct TfLiteContext* context, const char* format, ...) {
   va_end(args);
 }
 
+// Like ScopedProfile, but reports the subgraph the event belongs to.
+class ScopedSubgraphProfile {
+ public:
+  ScopedSubgraphProfile(Profiler* profiler, const char* tag,
+                        Profiler::EventType event_type,
+                        uint32_t event_metadata, int subgraph_index)
+      : profiler_(profiler), event_handle_(0) {
+    if (profiler_ != nullptr) {
+      event_handle_ = profiler_->BeginEvent(tag, event_type, event_metadata,
+                                            subgraph_index);
+    }
+  }
+
+  ~ScopedSubgraphProfile() {
+    if (profiler_ != nullptr) {
+      profiler_->EndEvent(event_handle_);
+    }
+  }
+
+ private:
+  Profiler* profiler_;
+  uint32_t event_handle_;
+};
+
 }  // namespace
 
 MicroInterpreter::MicroInterpreter(const Model* model,
                                    const OpResolver& op_resolver,
                                    uint8_t* tensor_arena,
                                    size_t tensor_arena_size,
-                                   ErrorReporter* error_reporter)
+                                   ErrorReporter* error_reporter,
+                                   MemoryPlanner* memory_planner,
+                                   Profiler* profiler)
+    : model_(model),
+      op_resolver_(op_resolver),
+      error_reporter_(error_reporter),
+      owned_arena_(tensor_arena, tensor_arena_size),
+      arena_(&owned_arena_),
+      profiler_(profiler) {
+  Init(memory_planner);
+}
+
+MicroInterpreter::MicroInterpreter(const Model* model,
+                                   const OpResolver& op_resolver,
+                                   SimpleMemoryAllocator* shared_arena,
+                                   ErrorReporter* error_reporter,
+                                   MemoryPlanner* memory_planner,
+                                   Profiler* profiler)
     : model_(model),
       op_resolver_(op_resolver),
       error_reporter_(error_reporter),
-      allocator_(&context_, model_, tensor_arena, tensor_arena_size,
-                 error_reporter_),
-      tensors_allocated_(false) {
+      owned_arena_(nullptr, 0),
+      arena_(shared_arena),
+      profiler_(profiler) {
+  Init(memory_planner);
+}
+
+void MicroInterpreter::Init(MemoryPlanner* memory_planner) {
   const flatbuffers::Vector<flatbuffers::Offset<SubGraph>>* subgraphs =
-      model->subgraphs();
-  if (subgraphs->size() != 1) {
-    error_reporter->Report("Only 1 subgraph is currently supported.\n");
-    initialization_status_ = kTfLiteError;
+      model_->subgraphs();
+  if ((subgraphs == nullptr) || (subgraphs->size() == 0)) {
+    error_reporter_->Report("Model has no subgraphs");
     return;
   }
   subgraph_ = (*subgraphs)[0];
-  tensors_ = subgraph_->tensors();
-  operators_ = subgraph_->operators();
 
   context_.impl_ = static_cast<void*>(this);
   context_.ReportError = ReportOpError;
   context_.recommended_num_threads = 1;
+  context_.profiler = profiler_;
+
+  subgraphs_ = reinterpret_cast<SubgraphAllocation*>(arena_->AllocateFromTail(
+      sizeof(SubgraphAllocation) * subgraphs->size(),
+      alignof(SubgraphAllocation)));
+  if (subgraphs_ == nullptr) {
+    error_reporter_->Report("Failed to allocate memory for %d subgraphs",
+                            subgraphs->size());
+    return;
+  }
+  for (size_t i = 0; i < subgraphs->size(); ++i) {
+    // A custom planner can only plan a single subgraph.
+    new (&subgraphs_[i])
+        SubgraphAllocation(&context_, model_, arena_, error_reporter_,
+                           (i == 0) ? memory_planner : nullptr, i);
+    ++subgraphs_size_;
+  }
 
   // If the system is big endian then convert weights from the flatbuffer from
   // little to big endian on startup so that it does not need to be done during
@@ -92,13 +154,17 @@ MicroInterpreter::MicroInterpreter(const Model* model,
   // NOTE: This requires that the flatbuffer is held in memory which can be
   // modified by this process.
   if (!FLATBUFFERS_LITTLEENDIAN) {
-    for (size_t t = 0; t < tensors_size(); ++t) {
-      TfLiteTensor* thisTensor = &context_.tensors[t];
-      if (thisTensor->allocation_type == kTfLiteMmapRo)
-        CorrectTensorEndianness(thisTensor);
+    for (size_t s = 0; s < subgraphs_size_; ++s) {
+      const MicroAllocator& allocator = subgraphs_[s].allocator;
+      for (size_t t = 0; t < allocator.runtime_tensors_size(); ++t) {
+        TfLiteTensor* thisTensor = &allocator.runtime_tensors()[t];
+        if (thisTensor->allocation_type == kTfLiteMmapRo)
+          CorrectTensorEndianness(thisTensor);
+      }
     }
   }
 
+  UseSubgraph(&subgraphs_[0]);
   initialization_status_ = kTfLiteOk;
 }
 
@@ -139,31 +205,139 @@ void MicroInterpreter::CorrectTensorDataEndianness(T* data, int32_t size) {
   }
 }
 
-TfLiteStatus MicroInterpreter::AllocateTensors() {
-  TF_LITE_ENSURE_OK(&context_, allocator_.AllocateNodeAndRegistrations(
-                                   op_resolver_, &node_and_registrations_));
-  TF_LITE_ENSURE_OK(&context_, allocator_.FinishTensorAllocation());
+MicroInterpreter::~MicroInterpreter() {
+  if (tensors_allocated_) {
+    for (size_t s = 0; s < subgraphs_size_; ++s) {
+      FreeSubgraph(&subgraphs_[s]);
+    }
+  }
+  for (size_t s = 0; s < subgraphs_size_; ++s) {
+    subgraphs_[s].~SubgraphAllocation();
+  }
+}
 
-  tensors_allocated_ = true;
+MicroInterpreter::SubgraphAllocation* MicroInterpreter::GetSubgraph(
+    int subgraph_index) const {
+  if ((subgraph_index < 0) ||
+      (subgraph_index >= static_cast<int>(subgraphs_size_))) {
+    error_reporter_->Report("Subgraph index %d out of range (length is %d)",
+                            subgraph_index, subgraphs_size_);
+    return nullptr;
+  }
+  return &subgraphs_[subgraph_index];
+}
+
+void MicroInterpreter::UseSubgraph(SubgraphAllocation* subgraph) {
+  current_subgraph_ = subgraph;
+  context_.tensors = subgraph->allocator.runtime_tensors();
+  context_.tensors_size = subgraph->allocator.runtime_tensors_size();
+}
+
+void* MicroInterpreter::AllocateOpData(TfLiteContext* context, size_t size) {
+  MicroInterpreter* interpreter =
+      static_cast<MicroInterpreter*>(context->impl_);
+  void* data = nullptr;
+  if (interpreter->current_subgraph_->allocator.AllocatePersistentBuffer(
+          size, &data) != kTfLiteOk) {
+    return nullptr;
+  }
+  return data;
+}
+
+void MicroInterpreter::DeallocateOpData(TfLiteContext* context,
+                                        void* buffer) {
+  // Op data lives in the arena for the life time of the interpreter.
+}
+
+TfLiteStatus MicroInterpreter::RequestScratchBufferInArena(
+    TfLiteContext* context, size_t bytes, int* buffer_idx) {
+  MicroInterpreter* interpreter =
+      static_cast<MicroInterpreter*>(context->impl_);
+  return interpreter->current_subgraph_->allocator.RequestScratchBufferInArena(
+      interpreter->preparing_node_index_, bytes, buffer_idx);
+}
+
+void* MicroInterpreter::GetScratchBuffer(TfLiteContext* context,
+                                         int buffer_idx) {
+  MicroInterpreter* interpreter =
+      static_cast<MicroInterpreter*>(context->impl_);
+  return interpreter->current_subgraph_->allocator.GetScratchBuffer(
+      buffer_idx);
+}
+
+TfLiteStatus MicroInterpreter::SetBatchSize(int batch_size) {
+  if (initialization_status_ != kTfLiteOk) {
+    error_reporter_->Report(
+        "SetBatchSize() called after initialization failed\n");
+    return kTfLiteError;
+  }
+  if (tensors_allocated_) {
+    error_reporter_->Report(
+        "SetBatchSize() has to be called before AllocateTensors()");
+    return kTfLiteError;
+  }
+  for (size_t s = 0; s < subgraphs_size_; ++s) {
+    if (subgraphs_[s].allocator.SetBatchSize(batch_size) != kTfLiteOk) {
+      // Keep all subgraphs at the same batch size.
+      for (size_t r = 0; r < s; ++r) {
+        subgraphs_[r].allocator.SetBatchSize(batch_size_);
+      }
+      return kTfLiteError;
+    }
+  }
+  batch_size_ = batch_size;
   return kTfLiteOk;
 }
 
-TfLiteStatus MicroInterpreter::Invoke() {
+TfLiteStatus MicroInterpreter::AllocateTensors() {
   if (initialization_status_ != kTfLiteOk) {
-    error_reporter_->Report("Invoke() called after initialization failed\n");
+    error_reporter_->Report(
+        "AllocateTensors() called after initialization failed\n");
     return kTfLiteError;
   }
+  if (tensors_allocated_) {
+    return kTfLiteOk;
+  }
 
-  // Ensure tensors are allocated before the interpreter is invoked to avoid
-  // difficult to debug segfaults.
-  if (!tensors_allocated_) {
-    AllocateTensors();
+  // Subgraphs are planned one after the other. Each of them adds its
+  // persistent data to the tail of the arena, while all of them share the
+  // head for their activation buffers.
+  for (size_t s = 0; s < subgraphs_size_; ++s) {
+    if (PrepareSubgraph(&subgraphs_[s]) != kTfLiteOk) {
+      // The failed subgraph freed its kernels, the ones before are freed
+      // here. Their arena is used up, so the interpreter can't be retried.
+      for (size_t r = 0; r < s; ++r) {
+        FreeSubgraph(&subgraphs_[r]);
+      }
+      initialization_status_ = kTfLiteError;
+      return kTfLiteError;
+    }
   }
+  UseSubgraph(&subgraphs_[0]);
+  context_.GetScratchBuffer = GetScratchBuffer;
 
-  // Init method is not yet implemented.
-  for (size_t i = 0; i < operators_->size(); ++i) {
-    auto* node = &(node_and_registrations_[i].node);
-    auto* registration = node_and_registrations_[i].registration;
+  tensors_allocated_ = true;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::PrepareSubgraph(SubgraphAllocation* subgraph) {
+  UseSubgraph(subgraph);
+  MicroAllocator& allocator = subgraph->allocator;
+  NodeAndRegistration*& node_and_registrations =
+      subgraph->node_and_registrations;
+  const size_t operators_size = subgraph->subgraph->operators()->size();
+  TF_LITE_ENSURE_OK(&context_, allocator.AllocateNodeAndRegistrations(
+                                   op_resolver_, &node_and_registrations));
+
+  // Kernels may only claim persistent memory while they are initialized and
+  // prepared, since the remaining arena is handed to the memory planner
+  // afterwards.
+  context_.AllocateOpData = AllocateOpData;
+  context_.DeallocateOpData = DeallocateOpData;
+
+  for (size_t i = 0; i < operators_size; ++i) {
+    auto* node = &(node_and_registrations[i].node);
+    auto* registration = node_and_registrations[i].registration;
     size_t init_data_size;
     const char* init_data;
     if (registration->builtin_code == BuiltinOperator_CUSTOM) {
@@ -179,26 +353,83 @@ TfLiteStatus MicroInterpreter::Invoke() {
     }
   }
 
-  for (size_t i = 0; i < operators_->size(); ++i) {
-    auto* node = &(node_and_registrations_[i].node);
-    auto* registration = node_and_registrations_[i].registration;
+  context_.RequestScratchBufferInArena = RequestScratchBufferInArena;
+  for (size_t i = 0; i < operators_size; ++i) {
+    auto* node = &(node_and_registrations[i].node);
+    auto* registration = node_and_registrations[i].registration;
     if (registration->prepare) {
+      preparing_node_index_ = i;
       TfLiteStatus prepare_status = registration->prepare(&context_, node);
       if (prepare_status != kTfLiteOk) {
         error_reporter_->Report(
             "Node %s (number %d) failed to prepare with status %d",
             OpNameFromRegistration(registration), i, prepare_status);
+        preparing_node_index_ = -1;
+        context_.AllocateOpData = nullptr;
+        context_.RequestScratchBufferInArena = nullptr;
+        FreeSubgraph(subgraph);
         return kTfLiteError;
       }
     }
   }
+  preparing_node_index_ = -1;
+
+  context_.AllocateOpData = nullptr;
+  context_.RequestScratchBufferInArena = nullptr;
+
+  if (allocator.FinishTensorAllocation() != kTfLiteOk) {
+    FreeSubgraph(subgraph);
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+void MicroInterpreter::FreeSubgraph(SubgraphAllocation* subgraph) {
+  UseSubgraph(subgraph);
+  for (size_t i = 0; i < subgraph->subgraph->operators()->size(); ++i) {
+    auto* node = &(subgraph->node_and_registrations[i].node);
+    auto* registration = subgraph->node_and_registrations[i].registration;
+    if (registration->free) {
+      registration->free(&context_, node->user_data);
+    }
+  }
+}
 
-  for (size_t i = 0; i < operators_->size(); ++i) {
-    auto* node = &(node_and_registrations_[i].node);
-    auto* registration = node_and_registrations_[i].registration;
+TfLiteStatus MicroInterpreter::Invoke() { return Invoke(0); }
+
+TfLiteStatus MicroInterpreter::Invoke(int subgraph_index) {
+  if (initialization_status_ != kTfLiteOk) {
+    error_reporter_->Report("Invoke() called after initialization failed\n");
+    return kTfLiteError;
+  }
+
+  // Ensure tensors are allocated before the interpreter is invoked to avoid
+  // difficult to debug segfaults.
+  if (!tensors_allocated_) {
+    TF_LITE_ENSURE_OK(&context_, AllocateTensors());
+  }
+
+  SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  if (subgraph == nullptr) {
+    return kTfLiteError;
+  }
+  UseSubgraph(subgraph);
+
+  ScopedSubgraphProfile invoke_profile(profiler_, "Invoke",
+                                       Profiler::EventType::DEFAULT, 0,
+                                       subgraph_index);
+  for (size_t i = 0; i < subgraph->subgraph->operators()->size(); ++i) {
+    auto* node = &(subgraph->node_and_registrations[i].node);
+    auto* registration = subgraph->node_and_registrations[i].registration;
 
     if (registration->invoke) {
-      TfLiteStatus invoke_status = registration->invoke(&context_, node);
+      TfLiteStatus invoke_status;
+      {
+        ScopedSubgraphProfile operator_profile(
+            profiler_, OpNameFromRegistration(registration),
+            Profiler::EventType::OPERATOR_INVOKE_EVENT, i, subgraph_index);
+        invoke_status = registration->invoke(&context_, node);
+      }
       if (invoke_status != kTfLiteOk) {
         error_reporter_->Report(
             "Node %s (number %d) failed to invoke with status %d",
@@ -207,49 +438,75 @@ TfLiteStatus MicroInterpreter::Invoke() {
       }
     }
   }
+  return kTfLiteOk;
+}
 
-  // This is actually a no-op.
-  // TODO(wangtz): Consider removing this code to slightly reduce binary size.
-  for (size_t i = 0; i < operators_->size(); ++i) {
-    auto* node = &(node_and_registrations_[i].node);
-    auto* registration = node_and_registrations_[i].registration;
-    if (registration->free) {
-      registration->free(&context_, node->user_data);
-    }
+size_t MicroInterpreter::arena_used_bytes() const {
+  size_t used_bytes = 0;
+  for (size_t s = 0; s < subgraphs_size_; ++s) {
+    used_bytes = std::max(used_bytes, subgraphs_[s].allocator.used_bytes());
   }
-  return kTfLiteOk;
+  return used_bytes;
+}
+
+size_t MicroInterpreter::tensors_size(int subgraph_index) const {
+  const SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  return (subgraph != nullptr) ? subgraph->allocator.runtime_tensors_size()
+                               : 0;
+}
+
+size_t MicroInterpreter::inputs_size(int subgraph_index) const {
+  const SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  return (subgraph != nullptr) ? subgraph->subgraph->inputs()->Length() : 0;
+}
+
+size_t MicroInterpreter::outputs_size(int subgraph_index) const {
+  const SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  return (subgraph != nullptr) ? subgraph->subgraph->outputs()->Length() : 0;
 }
 
-TfLiteTensor* MicroInterpreter::input(size_t index) {
-  const flatbuffers::Vector<int32_t>* inputs = subgraph_->inputs();
+TfLiteTensor* MicroInterpreter::input(size_t index, int subgraph_index) {
+  SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  if (subgraph == nullptr) {
+    return nullptr;
+  }
+  const flatbuffers::Vector<int32_t>* inputs = subgraph->subgraph->inputs();
   const size_t length = inputs->size();
   if ((index < 0) || (index >= length)) {
     error_reporter_->Report("Input index %d out of range (length is %d)", index,
                             length);
     return nullptr;
   }
-  return &(context_.tensors[inputs->Get(index)]);
+  return &(subgraph->allocator.runtime_tensors()[inputs->Get(index)]);
 }
 
-TfLiteTensor* MicroInterpreter::output(size_t index) {
-  const flatbuffers::Vector<int32_t>* outputs = subgraph_->outputs();
+TfLiteTensor* MicroInterpreter::output(size_t index, int subgraph_index) {
+  SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  if (subgraph == nullptr) {
+    return nullptr;
+  }
+  const flatbuffers::Vector<int32_t>* outputs = subgraph->subgraph->outputs();
   const size_t length = outputs->size();
   if ((index < 0) || (index >= outputs->size())) {
     error_reporter_->Report("Output index %d out of range (length is %d)",
                             index, length);
     return nullptr;
   }
-  return &(context_.tensors[outputs->Get(index)]);
+  return &(subgraph->allocator.runtime_tensors()[outputs->Get(index)]);
 }
 
-TfLiteTensor* MicroInterpreter::tensor(size_t index) {
-  const size_t length = tensors_size();
-  if ((index < 0) || (index >= tensors_size())) {
+TfLiteTensor* MicroInterpreter::tensor(size_t index, int subgraph_index) {
+  SubgraphAllocation* subgraph = GetSubgraph(subgraph_index);
+  if (subgraph == nullptr) {
+    return nullptr;
+  }
+  const size_t length = subgraph->allocator.runtime_tensors_size();
+  if ((index < 0) || (index >= length)) {
     error_reporter_->Report("Tensor index %d out of range (length is %d)",
                             index, length);
     return nullptr;
   }
-  return &context_.tensors[index];
+  return &subgraph->allocator.runtime_tensors()[index];
 }
 
 struct pairTfLiteNodeAndRegistration MicroInterpreter::node_and_registration(
@@ -258,7 +515,7 @@ struct pairTfLiteNodeAndRegistration MicroInterpreter::node_and_registration(
   struct pairTfLiteNodeAndRegistration tfNodeRegiPair;
   auto opcodes = model_->operator_codes();
   {
-    const auto* op = operators_->Get(node_index);
+    const auto* op = subgraph_->operators()->Get(node_index);
     size_t index = op->opcode_index();
     if (index < 0 || index >= opcodes->size()) {
       error_reporter_->Report("Missing registration for opcode_index %d\n",
@@ -18,8 +18,11 @@ limitations under the License.
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/core/api/op_resolver.h"
+#include "tensorflow/lite/core/api/profiler.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/micro/memory_planner/memory_planner.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/simple_memory_allocator.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/type_to_tflitetype.h"
 
@@ -35,18 +38,81 @@ class MicroInterpreter {
   // function.
   // The interpreter doesn't do any deallocation of any of the pointed-to
   // objects, ownership remains with the caller.
+  // An optional `memory_planner` replaces the default greedy layout of the
+  // activation buffers in the arena, see MicroAllocator.
+  // If a `profiler` is given, every Invoke() and every kernel invocation in it
+  // is reported as an event, see MicroProfiler.
+  // Every subgraph of the model is planned in the arena. Their activation
+  // buffers share the head of the arena, see Invoke(int).
+  // A custom `memory_planner` is only used for subgraph 0.
   MicroInterpreter(const Model* model, const OpResolver& op_resolver,
                    uint8_t* tensor_arena, size_t tensor_arena_size,
-                   ErrorReporter* error_reporter);
-
-  // Runs through the model and allocates all necessary input, output and
-  // intermediate tensors.
+                   ErrorReporter* error_reporter,
+                   MemoryPlanner* memory_planner = nullptr,
+                   Profiler* profiler = nullptr);
+
+  // Uses an arena that is shared with other interpreters which never run at
+  // the same time, for example a wake-word model followed by a classifier:
+  //   tflite::SimpleMemoryAllocator shared_arena(tensor_arena, kArenaSize);
+  //   tflite::MicroInterpreter kws(kws_model, resolver, &shared_arena, ...);
+  //   tflite::MicroInterpreter classifier(model, resolver, &shared_arena, ...);
+  // The persistent data of all interpreters is stacked in the tail of the
+  // arena, while their activation buffers overlap in the head, which only has
+  // to fit the largest model. Invoking one interpreter therefore overwrites
+  // the inputs and outputs of all others: fill the inputs right before
+  // Invoke() and read the outputs right after it. Variable tensors are kept
+  // in the tail and survive. All interpreters sharing the arena have to call
+  // AllocateTensors() before any of them is invoked.
+  MicroInterpreter(const Model* model, const OpResolver& op_resolver,
+                   SimpleMemoryAllocator* shared_arena,
+                   ErrorReporter* error_reporter,
+                   MemoryPlanner* memory_planner = nullptr,
+                   Profiler* profiler = nullptr);
+
+  // Calls the `free` method of every kernel that was initialized by
+  // AllocateTensors().
+  ~MicroInterpreter();
+
+  // Makes every Invoke() run a batch of `batch_size` samples through each
+  // layer before moving on to the next one, instead of one sample. Must be
+  // called before AllocateTensors(). The inputs and outputs of all subgraphs
+  // then hold the samples one after the other along their leading dimension,
+  // so input(0)->bytes and the arena needed for the activation buffers grow
+  // by `batch_size`, while weights and op data stay the same:
+  //   interpreter.SetBatchSize(8);
+  //   interpreter.AllocateTensors();
+  //   ... fill 8 samples into interpreter.input(0), Invoke() ...
+  // Kernels reuse their weights across the batch, e.g. fully connected layers
+  // apply every weight they read to several samples.
+  // All tensors computed at runtime need a leading dimension of 1 in the
+  // model.
+  TfLiteStatus SetBatchSize(int batch_size);
+  int batch_size() const { return batch_size_; }
+
+  // Plans the execution of the model. This runs through the model and
+  // allocates all necessary input, output and intermediate tensors, and calls
+  // the `init` and `prepare` methods of every kernel exactly once. Any state a
+  // kernel computes in these methods is kept for all subsequent calls to
+  // Invoke(). If a kernel fails to prepare or the arena is too small, the
+  // kernels are freed again and the interpreter can't be used anymore.
   TfLiteStatus AllocateTensors();
 
+  // Runs the `invoke` method of every kernel of subgraph 0 in execution order.
+  // The model has to be planned with AllocateTensors() first, otherwise this
+  // will be done on the first call.
   TfLiteStatus Invoke();
 
-  size_t tensors_size() const { return context_.tensors_size; }
-  TfLiteTensor* tensor(size_t tensor_index);
+  // Runs the given subgraph. All subgraphs place their activation buffers at
+  // the same memory, so running one overwrites the inputs and outputs of the
+  // others, just like interpreters sharing an arena.
+  TfLiteStatus Invoke(int subgraph_index);
+
+  size_t subgraphs_size() const { return subgraphs_size_; }
+
+  // The accessors below refer to subgraph 0 unless a `subgraph_index` is
+  // given.
+  size_t tensors_size(int subgraph_index = 0) const;
+  TfLiteTensor* tensor(size_t tensor_index, int subgraph_index = 0);
   template <class T>
   T* typed_tensor(int tensor_index) {
     if (TfLiteTensor* tensor_ptr = tensor(tensor_index)) {
@@ -57,8 +123,8 @@ class MicroInterpreter {
     return nullptr;
   }
 
-  TfLiteTensor* input(size_t index);
-  size_t inputs_size() const { return subgraph_->inputs()->Length(); }
+  TfLiteTensor* input(size_t index, int subgraph_index = 0);
+  size_t inputs_size(int subgraph_index = 0) const;
   const flatbuffers::Vector<int32_t>& inputs() const {
     return *subgraph_->inputs();
   }
@@ -73,8 +139,8 @@ class MicroInterpreter {
     return nullptr;
   }
 
-  TfLiteTensor* output(size_t index);
-  size_t outputs_size() const { return subgraph_->outputs()->Length(); }
+  TfLiteTensor* output(size_t index, int subgraph_index = 0);
+  size_t outputs_size(int subgraph_index = 0) const;
   const flatbuffers::Vector<int32_t>& outputs() const {
     return *subgraph_->outputs();
   }
@@ -91,31 +157,88 @@ class MicroInterpreter {
 
   TfLiteStatus initialization_status() const { return initialization_status_; }
 
+  // Returns how many bytes of the tensor arena the model actually needs. This
+  // can be used to size the arena for a model once AllocateTensors() has
+  // succeeded with a generously sized arena. For a shared arena this includes
+  // all interpreters that were allocated before.
+  size_t arena_used_bytes() const;
+
   ErrorReporter* error_reporter() { return error_reporter_; }
 
-  size_t operators_size() const { return operators_->size(); }
+  size_t operators_size() const { return subgraph_->operators()->size(); }
   struct pairTfLiteNodeAndRegistration node_and_registration(int node_index);
 
  private:
+  // Allocator and nodes of one subgraph, placed in the tail of the arena.
+  struct SubgraphAllocation {
+    SubgraphAllocation(TfLiteContext* context, const Model* model,
+                       SimpleMemoryAllocator* memory_allocator,
+                       ErrorReporter* error_reporter,
+                       MemoryPlanner* memory_planner, int subgraph_index)
+        : allocator(context, model, memory_allocator, error_reporter,
+                    memory_planner, subgraph_index),
+          subgraph((*model->subgraphs())[subgraph_index]) {}
+
+    MicroAllocator allocator;
+    const SubGraph* subgraph;
+    NodeAndRegistration* node_and_registrations = nullptr;
+  };
+
+  void Init(MemoryPlanner* memory_planner);
+
+  // Returns the subgraph or reports an error and returns nullptr if the index
+  // is out of range.
+  SubgraphAllocation* GetSubgraph(int subgraph_index) const;
+
+  // Points the context at the runtime tensors of `subgraph`, so its kernels
+  // can be initialized, prepared, invoked or freed.
+  void UseSubgraph(SubgraphAllocation* subgraph);
+
+  // Initializes and prepares the kernels of `subgraph` and plans its memory.
+  // On failure the kernels that were initialized are freed again.
+  TfLiteStatus PrepareSubgraph(SubgraphAllocation* subgraph);
+
+  // Calls the `free` method of all the kernels of `subgraph`.
+  void FreeSubgraph(SubgraphAllocation* subgraph);
+
+  // Backs TfLiteContext::AllocateOpData. Only available while the kernels are
+  // initialized and prepared in AllocateTensors().
+  static void* AllocateOpData(TfLiteContext* context, size_t size);
+  static void DeallocateOpData(TfLiteContext* context, void* buffer);
+
+  // Back the scratch buffer methods of TfLiteContext. Requests are only
+  // accepted while the kernels are prepared, the buffers can be fetched once
+  // AllocateTensors() succeeded.
+  static TfLiteStatus RequestScratchBufferInArena(TfLiteContext* context,
+                                                  size_t bytes,
+                                                  int* buffer_idx);
+  static void* GetScratchBuffer(TfLiteContext* context, int buffer_idx);
+
   void CorrectTensorEndianness(TfLiteTensor* tensorCorr);
 
   template <class T>
   void CorrectTensorDataEndianness(T* data, int32_t size);
 
-  NodeAndRegistration* node_and_registrations_;
-
   const Model* model_;
   const OpResolver& op_resolver_;
   ErrorReporter* error_reporter_;
   TfLiteContext context_ = {};
-  MicroAllocator allocator_;
-  bool tensors_allocated_;
-
-  TfLiteStatus initialization_status_;
-  const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors_;
-  const flatbuffers::Vector<flatbuffers::Offset<Operator>>* operators_;
-
+  // Only used if the interpreter isn't given a shared arena.
+  SimpleMemoryAllocator owned_arena_;
+  SimpleMemoryAllocator* arena_;
+  // Subgraph 0, which the accessors without a subgraph index refer to.
   const SubGraph* subgraph_;
+  SubgraphAllocation* subgraphs_ = nullptr;
+  size_t subgraphs_size_ = 0;
+  // Subgraph the context currently refers to.
+  SubgraphAllocation* current_subgraph_ = nullptr;
+  bool tensors_allocated_ = false;
+  int batch_size_ = 1;
+  Profiler* profiler_;
+  // Index of the node whose `prepare` method is running.
+  int preparing_node_index_ = -1;
+
+  TfLiteStatus initialization_status_ = kTfLiteError;
 };
 
 }  // namespace tflite
@@ -20,31 +20,70 @@ limitations under the License.
 
 namespace tflite {
 namespace {
+
+// Counts how often each of the mock kernel methods has been called.
+int init_calls = 0;
+int prepare_calls = 0;
+int invoke_calls = 0;
+int free_calls = 0;
+// MockPrepare() fails on this call, counted from 1, and never if it's 0.
+int failing_prepare_call = 0;
+
+struct MockOpData {
+  int32_t invoke_count;
+  int scratch_buffer_index;
+};
+
 void* MockInit(TfLiteContext* context, const char* buffer, size_t length) {
   // We don't support delegate in TFL micro. This is a weak check to test if
   // context struct being zero-initialized.
   TF_LITE_MICRO_EXPECT_EQ(nullptr,
                           context->ReplaceNodeSubsetsWithDelegateKernels);
-  // Do nothing.
-  return nullptr;
+  ++init_calls;
+  // Persistent op data is only available during initialization.
+  TF_LITE_MICRO_EXPECT_NE(nullptr, context->AllocateOpData);
+  MockOpData* op_data = reinterpret_cast<MockOpData*>(
+      context->AllocateOpData(context, sizeof(MockOpData)));
+  TF_LITE_MICRO_EXPECT_NE(nullptr, op_data);
+  op_data->invoke_count = 0;
+  op_data->scratch_buffer_index = -1;
+  return op_data;
 }
 
-void MockFree(TfLiteContext* context, void* buffer) {
-  // Do nothing.
-}
+void MockFree(TfLiteContext* context, void* buffer) { ++free_calls; }
 
 TfLiteStatus MockPrepare(TfLiteContext* context, TfLiteNode* node) {
-  return kTfLiteOk;
+  ++prepare_calls;
+  if (prepare_calls == failing_prepare_call) {
+    return kTfLiteError;
+  }
+  // Scratch buffers can only be requested while preparing.
+  TF_LITE_MICRO_EXPECT_NE(nullptr, context->RequestScratchBufferInArena);
+  MockOpData* op_data = reinterpret_cast<MockOpData*>(node->user_data);
+  return context->RequestScratchBufferInArena(context, sizeof(int32_t),
+                                              &op_data->scratch_buffer_index);
 }
 
 TfLiteStatus MockInvoke(TfLiteContext* context, TfLiteNode* node) {
+  // Op data set up in init has to survive across invocations.
+  MockOpData* op_data = reinterpret_cast<MockOpData*>(node->user_data);
+  ++op_data->invoke_count;
+  ++invoke_calls;
+  TF_LITE_MICRO_EXPECT_EQ(nullptr, context->RequestScratchBufferInArena);
+  int32_t* scratch = reinterpret_cast<int32_t*>(
+      context->GetScratchBuffer(context, op_data->scratch_buffer_index));
+  TF_LITE_MICRO_EXPECT_NE(nullptr, scratch);
   const TfLiteTensor* input = &context->tensors[node->inputs->data[0]];
   const int32_t* input_data = input->data.i32;
   const TfLiteTensor* weight = &context->tensors[node->inputs->data[1]];
   const uint8_t* weight_data = weight->data.uint8;
   TfLiteTensor* output = &context->tensors[node->outputs->data[0]];
   int32_t* output_data = output->data.i32;
-  output_data[0] = input_data[0] + weight_data[0];
+  // Batched models have one element per sample.
+  for (size_t i = 0; i < output->bytes / sizeof(int32_t); ++i) {
+    scratch[0] = input_data[i] + weight_data[0];
+    output_data[i] = scratch[0];
+  }
   return kTfLiteOk;
 }
 
@@ -104,4 +143,206 @@ TF_LITE_MICRO_TEST(TestInterpreter) {
   TF_LITE_MICRO_EXPECT_EQ(42, output->data.i32[0]);
 }
 
+TF_LITE_MICRO_TEST(TestKernelsArePreparedOnce) {
+  const tflite::Model* model = tflite::testing::GetMockModel();
+  TF_LITE_MICRO_EXPECT_NE(nullptr, model);
+  tflite::MockOpResolver mock_resolver;
+  constexpr size_t allocator_buffer_size = 1024;
+  uint8_t allocator_buffer[allocator_buffer_size];
+  tflite::init_calls = 0;
+  tflite::prepare_calls = 0;
+  tflite::invoke_calls = 0;
+  tflite::free_calls = 0;
+  {
+    tflite::MicroInterpreter interpreter(model, mock_resolver,
+                                         allocator_buffer,
+                                         allocator_buffer_size,
+                                         micro_test::reporter);
+    TF_LITE_MICRO_EXPECT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+    TF_LITE_MICRO_EXPECT_EQ(1, tflite::init_calls);
+    TF_LITE_MICRO_EXPECT_EQ(1, tflite::prepare_calls);
+    TF_LITE_MICRO_EXPECT_EQ(0, tflite::invoke_calls);
+
+    // A second call must not plan the model again.
+    TF_LITE_MICRO_EXPECT_EQ(interpreter.AllocateTensors(), kTfLiteOk);
+    TF_LITE_MICRO_EXPECT_EQ(1, tflite::init_calls);
+
+    interpreter.input(0)->data.i32[0] = 21;
+    for (int i = 0; i < 3; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+      TF_LITE_MICRO_EXPECT_EQ(42, interpreter.output(0)->data.i32[0]);
+    }
+    TF_LITE_MICRO_EXPECT_EQ(1, tflite::init_calls);
+    TF_LITE_MICRO_EXPECT_EQ(1, tflite::prepare_calls);
+    TF_LITE_MICRO_EXPECT_EQ(3, tflite::invoke_calls);
+    TF_LITE_MICRO_EXPECT_EQ(0, tflite::free_calls);
+  }
+  // Kernels are freed together with the interpreter.
+  TF_LITE_MICRO_EXPECT_EQ(1, tflite::free_calls);
+}
+
+TF_LITE_MICRO_TEST(TestMultipleSubgraphs) {
+  const tflite::Model* model = tflite::testing::GetMultiSubgraphMockModel();
+  TF_LITE_MICRO_EXPECT_NE(nullptr, model);
+  tflite::MockOpResolver mock_resolver;
+  constexpr size_t allocator_buffer_size = 2048;
+  uint8_t allocator_buffer[allocator_buffer_size];
+  tflite::init_calls = 0;
+  tflite::prepare_calls = 0;
+  tflite::free_calls = 0;
+  {
+    tflite::MicroInterpreter interpreter(model, mock_resolver,
+                                         allocator_buffer,
+                                         allocator_buffer_size,
+                                         micro_test::reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.initialization_status());
+    TF_LITE_MICRO_EXPECT_EQ(2, interpreter.subgraphs_size());
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    TF_LITE_MICRO_EXPECT_EQ(2, tflite::init_calls);
+    TF_LITE_MICRO_EXPECT_EQ(2, tflite::prepare_calls);
+    TF_LITE_MICRO_EXPECT_EQ(1, interpreter.inputs_size(1));
+    TF_LITE_MICRO_EXPECT_EQ(1, interpreter.outputs_size(1));
+    TF_LITE_MICRO_EXPECT_EQ(3, interpreter.tensors_size(1));
+    TF_LITE_MICRO_EXPECT_EQ(nullptr, interpreter.input(0, 2));
+
+    for (int i = 0; i < 2; ++i) {
+      interpreter.input(0, 0)->data.i32[0] = 21;
+      TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+      TF_LITE_MICRO_EXPECT_EQ(42, interpreter.output(0)->data.i32[0]);
+
+      interpreter.input(0, 1)->data.i32[0] = 21;
+      TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke(1));
+      TF_LITE_MICRO_EXPECT_EQ(23, interpreter.output(0, 1)->data.i32[0]);
+    }
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.Invoke(2));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(2, tflite::free_calls);
+}
+
+TF_LITE_MICRO_TEST(TestKernelsAreFreedWhenPrepareFails) {
+  const tflite::Model* model = tflite::testing::GetMultiSubgraphMockModel();
+  TF_LITE_MICRO_EXPECT_NE(nullptr, model);
+  tflite::MockOpResolver mock_resolver;
+  constexpr size_t allocator_buffer_size = 2048;
+  uint8_t allocator_buffer[allocator_buffer_size];
+  tflite::init_calls = 0;
+  tflite::prepare_calls = 0;
+  tflite::invoke_calls = 0;
+  tflite::free_calls = 0;
+  // The kernel of subgraph 1 fails, after the one of subgraph 0 is prepared.
+  tflite::failing_prepare_call = 2;
+  {
+    tflite::MicroInterpreter interpreter(model, mock_resolver,
+                                         allocator_buffer,
+                                         allocator_buffer_size,
+                                         micro_test::reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.AllocateTensors());
+    TF_LITE_MICRO_EXPECT_EQ(2, tflite::init_calls);
+    TF_LITE_MICRO_EXPECT_EQ(2, tflite::free_calls);
+
+    // The interpreter is not planned again.
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.AllocateTensors());
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.Invoke());
+    TF_LITE_MICRO_EXPECT_EQ(2, tflite::init_calls);
+    TF_LITE_MICRO_EXPECT_EQ(2, tflite::prepare_calls);
+    TF_LITE_MICRO_EXPECT_EQ(0, tflite::invoke_calls);
+  }
+  // The kernels are not freed twice.
+  TF_LITE_MICRO_EXPECT_EQ(2, tflite::free_calls);
+  tflite::failing_prepare_call = 0;
+}
+
+TF_LITE_MICRO_TEST(TestInterpretersShareArena) {
+  const tflite::Model* model = tflite::testing::GetMockModel();
+  const tflite::Model* complex_model = tflite::testing::GetComplexMockModel();
+  tflite::MockOpResolver mock_resolver;
+  constexpr size_t allocator_buffer_size = 4096;
+  uint8_t allocator_buffer[allocator_buffer_size];
+
+  size_t separate_bytes = 0;
+  {
+    tflite::MicroInterpreter interpreter(model, mock_resolver,
+                                         allocator_buffer,
+                                         allocator_buffer_size,
+                                         micro_test::reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    separate_bytes += interpreter.arena_used_bytes();
+  }
+  {
+    tflite::MicroInterpreter interpreter(complex_model, mock_resolver,
+                                         allocator_buffer,
+                                         allocator_buffer_size,
+                                         micro_test::reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    separate_bytes += interpreter.arena_used_bytes();
+  }
+
+  tflite::SimpleMemoryAllocator shared_arena(allocator_buffer,
+                                             allocator_buffer_size);
+  tflite::MicroInterpreter first(model, mock_resolver, &shared_arena,
+                                 micro_test::reporter);
+  tflite::MicroInterpreter second(complex_model, mock_resolver, &shared_arena,
+                                  micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, first.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, second.AllocateTensors());
+  // The activation buffers of both models share the head of the arena.
+  TF_LITE_MICRO_EXPECT_LE(first.arena_used_bytes(),
+                          second.arena_used_bytes());
+  TF_LITE_MICRO_EXPECT_LT(second.arena_used_bytes(), separate_bytes);
+
+  for (int i = 0; i < 2; ++i) {
+    first.input(0)->data.i32[0] = 21;
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, first.Invoke());
+    TF_LITE_MICRO_EXPECT_EQ(42, first.output(0)->data.i32[0]);
+
+    // Each of the three ops adds the weight of 21.
+    second.input(0)->data.i32[0] = 0;
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, second.Invoke());
+    TF_LITE_MICRO_EXPECT_EQ(63, second.output(0)->data.i32[0]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestBatchedInvoke) {
+  const tflite::Model* model = tflite::testing::GetMockModel();
+  tflite::MockOpResolver mock_resolver;
+  constexpr size_t allocator_buffer_size = 1024;
+  uint8_t allocator_buffer[allocator_buffer_size];
+
+  size_t single_sample_bytes = 0;
+  {
+    tflite::MicroInterpreter interpreter(model, mock_resolver,
+                                         allocator_buffer,
+                                         allocator_buffer_size,
+                                         micro_test::reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    single_sample_bytes = interpreter.arena_used_bytes();
+  }
+
+  tflite::MicroInterpreter interpreter(model, mock_resolver, allocator_buffer,
+                                       allocator_buffer_size,
+                                       micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.SetBatchSize(0));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.SetBatchSize(32));
+  TF_LITE_MICRO_EXPECT_EQ(32, interpreter.batch_size());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.SetBatchSize(2));
+  TF_LITE_MICRO_EXPECT_LT(single_sample_bytes, interpreter.arena_used_bytes());
+
+  TfLiteTensor* input = interpreter.input(0);
+  TF_LITE_MICRO_EXPECT_EQ(1, input->dims->size);
+  TF_LITE_MICRO_EXPECT_EQ(32, input->dims->data[0]);
+  TF_LITE_MICRO_EXPECT_EQ(128, input->bytes);
+  for (int i = 0; i < 32; ++i) {
+    input->data.i32[i] = 10 * i;
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+
+  TfLiteTensor* output = interpreter.output(0);
+  TF_LITE_MICRO_EXPECT_EQ(32, output->dims->data[0]);
+  TF_LITE_MICRO_EXPECT_EQ(128, output->bytes);
+  for (int i = 0; i < 32; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(10 * i + 21, output->data.i32[i]);
+  }
+}
+
 TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,172 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_profiler.h"
+
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+namespace {
+
+// Handle returned for events that didn't fit into the record table.
+constexpr uint32_t kDroppedEvent = MicroProfiler::kMaxRecords;
+
+uint8_t* WriteUint32(uint32_t value, uint8_t* out) {
+  for (int byte = 0; byte < 4; ++byte) {
+    out[byte] = static_cast<uint8_t>(value >> (8 * byte));
+  }
+  return out + 4;
+}
+
+}  // namespace
+
+MicroProfiler::MicroProfiler()
+    : MicroProfiler(GetCurrentTimeTicks, ticks_per_second()) {}
+
+MicroProfiler::MicroProfiler(TimerFunction timer, int32_t ticks_per_second)
+    : timer_(timer), ticks_per_second_(ticks_per_second) {}
+
+uint32_t MicroProfiler::BeginEvent(const char* tag, EventType event_type,
+                                   uint32_t event_metadata,
+                                   uint32_t event_subgraph_index) {
+  // Events repeat in the same order on every invocation, so the record after
+  // the previous one is the most likely match.
+  int record = -1;
+  for (int i = 0; i < num_records_; ++i) {
+    const int candidate = (last_record_ + 1 + i) % num_records_;
+    const Record& current = records_[candidate];
+    if ((current.event_type == event_type) &&
+        (current.event_metadata == event_metadata) &&
+        (current.event_subgraph_index == event_subgraph_index) &&
+        (current.tag == tag)) {
+      record = candidate;
+      break;
+    }
+  }
+  if (record == -1) {
+    if (num_records_ == kMaxRecords) {
+      return kDroppedEvent;
+    }
+    record = num_records_;
+    ++num_records_;
+    records_[record].tag = tag;
+    records_[record].event_type = event_type;
+    records_[record].event_metadata = event_metadata;
+    records_[record].event_subgraph_index = event_subgraph_index;
+    records_[record].calls = 0;
+    records_[record].total_ticks = 0;
+  }
+  last_record_ = record;
+  // Read the timer last, so the lookup isn't attributed to the event.
+  records_[record].start_ticks = timer_();
+  return record;
+}
+
+void MicroProfiler::EndEvent(uint32_t event_handle) {
+  const int32_t end_ticks = timer_();
+  if (event_handle >= static_cast<uint32_t>(num_records_)) {
+    return;
+  }
+  Record& record = records_[event_handle];
+  // Unsigned arithmetic copes with one wrap-around of the timer.
+  record.total_ticks += static_cast<uint32_t>(end_ticks) -
+                        static_cast<uint32_t>(record.start_ticks);
+  ++record.calls;
+}
+
+void MicroProfiler::Reset() {
+  num_records_ = 0;
+  last_record_ = -1;
+}
+
+void MicroProfiler::Log(ErrorReporter* error_reporter,
+                        size_t arena_used_bytes) const {
+  uint64_t operator_ticks = 0;
+  for (int i = 0; i < num_records_; ++i) {
+    if (records_[i].event_type == EventType::OPERATOR_INVOKE_EVENT) {
+      operator_ticks += records_[i].total_ticks;
+    }
+  }
+
+  error_reporter->Report("Profile, %d ticks per second", ticks_per_second_);
+  error_reporter->Report("  node op calls avg_ticks percent");
+  for (int i = 0; i < num_records_; ++i) {
+    const Record& record = records_[i];
+    const int average =
+        (record.calls > 0) ? static_cast<int>(record.total_ticks / record.calls)
+                           : 0;
+    if (record.event_type == EventType::OPERATOR_INVOKE_EVENT) {
+      const int percent =
+          (operator_ticks > 0)
+              ? static_cast<int>((record.total_ticks * 100) / operator_ticks)
+              : 0;
+      if (record.event_subgraph_index == 0) {
+        error_reporter->Report("  %d %s %d %d %d", record.event_metadata,
+                               record.tag, record.calls, average, percent);
+      } else {
+        // Nodes of other subgraphs are printed as subgraph:node.
+        error_reporter->Report("  %d:%d %s %d %d %d",
+                               record.event_subgraph_index,
+                               record.event_metadata, record.tag, record.calls,
+                               average, percent);
+      }
+    } else {
+      error_reporter->Report("  - %s %d %d", record.tag, record.calls,
+                             average);
+    }
+  }
+  error_reporter->Report("  arena used: %d bytes",
+                         static_cast<int>(arena_used_bytes));
+}
+
+size_t MicroProfiler::SerializedSize() const {
+  return kSerializedHeaderSize + num_records_ * kSerializedRecordSize;
+}
+
+size_t MicroProfiler::Serialize(uint8_t* buffer, size_t buffer_size,
+                                size_t arena_used_bytes) const {
+  const size_t size = SerializedSize();
+  if (buffer_size < size) {
+    return 0;
+  }
+  uint8_t* out = buffer;
+  out = WriteUint32(kSerializedMagic, out);
+  out = WriteUint32(kSerializedVersion, out);
+  out = WriteUint32(num_records_, out);
+  out = WriteUint32(ticks_per_second_, out);
+  out = WriteUint32(arena_used_bytes, out);
+  for (int i = 0; i < num_records_; ++i) {
+    const Record& record = records_[i];
+    out = WriteUint32(static_cast<uint32_t>(record.event_type), out);
+    out = WriteUint32(
+        record.event_metadata | (record.event_subgraph_index << 16), out);
+    out = WriteUint32(record.calls, out);
+    out = WriteUint32(static_cast<uint32_t>(record.total_ticks), out);
+    out = WriteUint32(static_cast<uint32_t>(record.total_ticks >> 32), out);
+    int n = 0;
+    for (; (n < kSerializedTagLength) && (record.tag != nullptr) &&
+           (record.tag[n] != 0);
+         ++n) {
+      out[n] = record.tag[n];
+    }
+    for (; n < kSerializedTagLength; ++n) {
+      out[n] = 0;
+    }
+    out += kSerializedTagLength;
+  }
+  return size;
+}
+
+}  // namespace tflite
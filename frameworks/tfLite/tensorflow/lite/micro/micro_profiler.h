@@ -0,0 +1,118 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_PROFILER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/core/api/profiler.h"
+#include "tensorflow/lite/micro/compatibility.h"
+
+namespace tflite {
+
+// Profiler for the MicroInterpreter that accumulates the ticks spent in every
+// event, so the cost of each operator can be averaged over many invocations.
+// Events are identified by their type, tag, metadata, which for operator
+// events is the node index, and subgraph index. All storage is static, at
+// most kMaxRecords different events are recorded and any further ones are
+// dropped.
+//
+// Typical use:
+//   tflite::MicroProfiler profiler;
+//   tflite::MicroInterpreter interpreter(model, resolver, arena, arena_size,
+//                                        error_reporter, nullptr, &profiler);
+//   ... AllocateTensors() and Invoke() ...
+//   profiler.Log(error_reporter, interpreter.arena_used_bytes());
+class MicroProfiler : public Profiler {
+ public:
+  // Returns the current time in ticks, see GetCurrentTimeTicks().
+  typedef int32_t (*TimerFunction)();
+
+  static constexpr int kMaxRecords = 32;
+
+  // Uses GetCurrentTimeTicks() and ticks_per_second() from micro_time.h.
+  MicroProfiler();
+  // Uses a custom timer, for example a hardware timer of the target.
+  MicroProfiler(TimerFunction timer, int32_t ticks_per_second);
+
+  uint32_t BeginEvent(const char* tag, EventType event_type,
+                      uint32_t event_metadata,
+                      uint32_t event_subgraph_index) override;
+  void EndEvent(uint32_t event_handle) override;
+
+  // Drops all recorded events.
+  void Reset();
+
+  // Prints one line per recorded event with its number of calls, its average
+  // ticks per call and, for operators, its share of the time spent in all
+  // operators, followed by the arena usage.
+  void Log(ErrorReporter* error_reporter, size_t arena_used_bytes) const;
+
+  // Writes the recorded events in a compact binary format to `buffer`, see
+  // the layout below, and returns the number of bytes written, or 0 if the
+  // buffer is too small. All values are little-endian.
+  //   header: uint32 kSerializedMagic, uint32 version, uint32 record count,
+  //           int32 ticks per second, uint32 arena used bytes
+  //   record: uint32 event type, uint32 metadata with the subgraph index in
+  //           the upper 16 bits, uint32 calls,
+  //           uint32 total ticks low word, uint32 total ticks high word,
+  //           kSerializedTagLength bytes of tag, zero padded
+  size_t Serialize(uint8_t* buffer, size_t buffer_size,
+                   size_t arena_used_bytes) const;
+
+  // Size that Serialize() needs for the currently recorded events.
+  size_t SerializedSize() const;
+
+  static constexpr uint32_t kSerializedMagic = 0x5046504d;  // "MPFP"
+  static constexpr uint32_t kSerializedVersion = 1;
+  static constexpr int kSerializedTagLength = 24;
+  static constexpr size_t kSerializedHeaderSize = 5 * 4;
+  static constexpr size_t kSerializedRecordSize = 5 * 4 + kSerializedTagLength;
+  // Buffer size that is large enough for any profile.
+  static constexpr size_t kMaxSerializedSize =
+      kSerializedHeaderSize + kMaxRecords * kSerializedRecordSize;
+
+  int num_records() const { return num_records_; }
+  uint32_t calls(int record) const { return records_[record].calls; }
+  uint64_t total_ticks(int record) const {
+    return records_[record].total_ticks;
+  }
+  const char* tag(int record) const { return records_[record].tag; }
+
+ private:
+  struct Record {
+    const char* tag;
+    EventType event_type;
+    uint32_t event_metadata;
+    uint32_t event_subgraph_index;
+    uint32_t calls;
+    uint64_t total_ticks;
+    int32_t start_ticks;
+  };
+
+  TimerFunction timer_;
+  int32_t ticks_per_second_;
+  Record records_[kMaxRecords];
+  int num_records_ = 0;
+  int last_record_ = -1;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_PROFILER_H_
@@ -0,0 +1,153 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_profiler.h"
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace tflite {
+namespace {
+
+// Timer that advances by 10 ticks on every reading.
+int32_t fake_ticks = 0;
+int32_t FakeTimer() {
+  fake_ticks += 10;
+  return fake_ticks;
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+TfLiteStatus MockInvoke(TfLiteContext* context, TfLiteNode* node) {
+  // Reading the timer once inside the kernel makes it cost 10 ticks more.
+  FakeTimer();
+  return kTfLiteOk;
+}
+
+class MockOpResolver : public OpResolver {
+ public:
+  const TfLiteRegistration* FindOp(BuiltinOperator op,
+                                   int version) const override {
+    return nullptr;
+  }
+  const TfLiteRegistration* FindOp(const char* op, int version) const override {
+    static TfLiteRegistration r = {nullptr,
+                                   nullptr,
+                                   nullptr,
+                                   MockInvoke,
+                                   nullptr,
+                                   BuiltinOperator_CUSTOM,
+                                   "mock_custom"};
+    return &r;
+  }
+};
+
+}  // namespace
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestEventsAreAccumulated) {
+  tflite::MicroProfiler profiler(tflite::FakeTimer, 1000);
+  for (int i = 0; i < 3; ++i) {
+    const uint32_t outer = profiler.BeginEvent(
+        "outer", tflite::Profiler::EventType::DEFAULT, 0, 0);
+    const uint32_t inner = profiler.BeginEvent(
+        "op", tflite::Profiler::EventType::OPERATOR_INVOKE_EVENT, 1, 0);
+    profiler.EndEvent(inner);
+    profiler.EndEvent(outer);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.num_records());
+  TF_LITE_MICRO_EXPECT_EQ(3u, profiler.calls(0));
+  TF_LITE_MICRO_EXPECT_EQ(3u, profiler.calls(1));
+  // Each inner event spans one timer reading, each outer one spans three.
+  TF_LITE_MICRO_EXPECT_EQ(30u, profiler.total_ticks(1));
+  TF_LITE_MICRO_EXPECT_EQ(90u, profiler.total_ticks(0));
+
+  profiler.Reset();
+  TF_LITE_MICRO_EXPECT_EQ(0, profiler.num_records());
+}
+
+TF_LITE_MICRO_TEST(TestEventsBeyondCapacityAreDropped) {
+  tflite::MicroProfiler profiler(tflite::FakeTimer, 1000);
+  for (int i = 0; i < tflite::MicroProfiler::kMaxRecords + 1; ++i) {
+    const uint32_t handle = profiler.BeginEvent(
+        "op", tflite::Profiler::EventType::OPERATOR_INVOKE_EVENT, i, 0);
+    profiler.EndEvent(handle);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(tflite::MicroProfiler::kMaxRecords,
+                          profiler.num_records());
+}
+
+TF_LITE_MICRO_TEST(TestSerialize) {
+  tflite::MicroProfiler profiler(tflite::FakeTimer, 1000);
+  const uint32_t handle = profiler.BeginEvent(
+      "CONV_2D", tflite::Profiler::EventType::OPERATOR_INVOKE_EVENT, 7, 0);
+  profiler.EndEvent(handle);
+
+  uint8_t buffer[128];
+  TF_LITE_MICRO_EXPECT_EQ(
+      0, profiler.Serialize(buffer, profiler.SerializedSize() - 1, 1234));
+  const size_t size = profiler.Serialize(buffer, sizeof(buffer), 1234);
+  TF_LITE_MICRO_EXPECT_EQ(profiler.SerializedSize(), size);
+  TF_LITE_MICRO_EXPECT_EQ(tflite::MicroProfiler::kSerializedMagic,
+                          tflite::ReadUint32(buffer));
+  TF_LITE_MICRO_EXPECT_EQ(1u, tflite::ReadUint32(buffer + 8));
+  TF_LITE_MICRO_EXPECT_EQ(1000u, tflite::ReadUint32(buffer + 12));
+  TF_LITE_MICRO_EXPECT_EQ(1234u, tflite::ReadUint32(buffer + 16));
+  const uint8_t* record = buffer + 20;
+  TF_LITE_MICRO_EXPECT_EQ(1u, tflite::ReadUint32(record));
+  TF_LITE_MICRO_EXPECT_EQ(7u, tflite::ReadUint32(record + 4));
+  TF_LITE_MICRO_EXPECT_EQ(1u, tflite::ReadUint32(record + 8));
+  TF_LITE_MICRO_EXPECT_EQ(10u, tflite::ReadUint32(record + 12));
+  TF_LITE_MICRO_EXPECT_EQ(0u, tflite::ReadUint32(record + 16));
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::testing::TestStrcmp(
+                                 "CONV_2D", reinterpret_cast<const char*>(
+                                                record + 20)));
+}
+
+TF_LITE_MICRO_TEST(TestInterpreterReportsOperators) {
+  const tflite::Model* model = tflite::testing::GetComplexMockModel();
+  tflite::MockOpResolver mock_resolver;
+  constexpr size_t allocator_buffer_size = 2048;
+  uint8_t allocator_buffer[allocator_buffer_size];
+  tflite::MicroProfiler profiler(tflite::FakeTimer, 1000);
+  tflite::MicroInterpreter interpreter(model, mock_resolver, allocator_buffer,
+                                       allocator_buffer_size,
+                                       micro_test::reporter, nullptr,
+                                       &profiler);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(0, profiler.num_records());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+
+  // One record for Invoke() and one for each of the three nodes.
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.num_records());
+  TF_LITE_MICRO_EXPECT_EQ(
+      0, tflite::testing::TestStrcmp("Invoke", profiler.tag(0)));
+  for (int i = 1; i < 4; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(
+        0, tflite::testing::TestStrcmp("mock_custom", profiler.tag(i)));
+    TF_LITE_MICRO_EXPECT_EQ(2u, profiler.calls(i));
+    TF_LITE_MICRO_EXPECT_EQ(40u, profiler.total_ticks(i));
+  }
+  profiler.Log(micro_test::reporter, interpreter.arena_used_bytes());
+}
+
+TF_LITE_MICRO_TESTS_END
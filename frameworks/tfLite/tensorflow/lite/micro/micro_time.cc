@@ -0,0 +1,88 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Reference implementation of the timer functions that are required for a
+// platform to support profiling and benchmarking of TensorFlow Lite for
+// Microcontrollers.
+// On Cortex-M3/M4/M7 cores the DWT cycle counter is used, so one tick is one
+// CPU cycle. On hosts with a POSIX C library, clock_gettime() is used with a
+// resolution of one microsecond. On all other platforms timing is not
+// available and both functions return 0.
+
+#include "tensorflow/lite/micro/micro_time.h"
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define TF_LITE_MICRO_TIME_DWT
+#elif defined(__linux__) || defined(__APPLE__)
+#define TF_LITE_MICRO_TIME_POSIX
+#include <time.h>
+#endif
+
+#ifdef TF_LITE_MICRO_TIME_DWT
+// Core clock frequency, provided by the CMSIS system file of the device.
+extern "C" uint32_t SystemCoreClock;
+#endif
+
+namespace tflite {
+
+#ifdef TF_LITE_MICRO_TIME_DWT
+namespace {
+
+// Debug Exception and Monitor Control Register and Data Watchpoint and Trace
+// unit registers, see the ARMv7-M Architecture Reference Manual.
+volatile uint32_t* const kDemcr = reinterpret_cast<uint32_t*>(0xE000EDFC);
+volatile uint32_t* const kDwtCtrl = reinterpret_cast<uint32_t*>(0xE0001000);
+volatile uint32_t* const kDwtCyccnt = reinterpret_cast<uint32_t*>(0xE0001004);
+constexpr uint32_t kDemcrTrcena = (1 << 24);
+constexpr uint32_t kDwtCtrlCyccntena = (1 << 0);
+
+void EnableCycleCounter() {
+  if ((*kDwtCtrl & kDwtCtrlCyccntena) == 0) {
+    *kDemcr |= kDemcrTrcena;
+    *kDwtCyccnt = 0;
+    *kDwtCtrl |= kDwtCtrlCyccntena;
+  }
+}
+
+}  // namespace
+
+int32_t ticks_per_second() { return static_cast<int32_t>(SystemCoreClock); }
+
+int32_t GetCurrentTimeTicks() {
+  EnableCycleCounter();
+  return static_cast<int32_t>(*kDwtCyccnt);
+}
+
+#elif defined(TF_LITE_MICRO_TIME_POSIX)
+
+int32_t ticks_per_second() { return 1000000; }
+
+int32_t GetCurrentTimeTicks() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  const uint32_t us = static_cast<uint32_t>(now.tv_sec) * 1000000u +
+                      static_cast<uint32_t>(now.tv_nsec / 1000);
+  return static_cast<int32_t>(us);
+}
+
+#else
+
+int32_t ticks_per_second() { return 0; }
+
+int32_t GetCurrentTimeTicks() { return 0; }
+
+#endif
+
+}  // namespace tflite
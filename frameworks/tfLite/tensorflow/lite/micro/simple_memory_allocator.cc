@@ -30,7 +30,7 @@ uint8_t* SimpleMemoryAllocator::AllocateFromTail(size_t size,
   uint8_t* current_data = previous_free - size;
   uint8_t* aligned_result = AlignPointerDown(current_data, alignment);
   size_t aligned_size = (previous_free - aligned_result);
-  if ((data_size_ + aligned_size) > data_size_max_) {
+  if ((data_size_ + aligned_size + head_size_) > data_size_max_) {
     // TODO(petewarden): Add error reporting beyond returning null!
     return nullptr;
   }
@@ -38,6 +38,17 @@ uint8_t* SimpleMemoryAllocator::AllocateFromTail(size_t size,
   return aligned_result;
 }
 
+bool SimpleMemoryAllocator::ReserveHead(size_t size) {
+  if (size <= head_size_) {
+    return true;
+  }
+  if ((data_size_ + size) > data_size_max_) {
+    return false;
+  }
+  head_size_ = size;
+  return true;
+}
+
 SimpleMemoryAllocator SimpleMemoryAllocator::CreateChildAllocator() {
   // Note that the parameterized constructor initializes data_size_ to 0 which
   // is not what we expected.
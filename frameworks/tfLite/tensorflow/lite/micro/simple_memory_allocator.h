@@ -22,9 +22,16 @@ limitations under the License.
 
 namespace tflite {
 
-// TODO(petewarden): This allocator never frees up or reuses  any memory, even
-// though we have enough information about lifetimes of the tensors to do so.
-// This makes it pretty wasteful, so we should use a more intelligent method.
+// Hands out memory from the tail of the tensor arena for data that has to live
+// as long as the model, like tensor metadata and kernel op data. Nothing is
+// ever freed except by destroying a child allocator. Activation buffers are not
+// allocated here: MicroAllocator places them in the head of the arena using a
+// MemoryPlanner, so that tensors with disjoint lifetimes share memory.
+//
+// One allocator can be shared by several MicroAllocators, for example of two
+// interpreters that run one after the other. Their persistent data is stacked
+// in the tail, while their activation buffers all start at the head, which
+// then only has to be as large as that of the biggest model.
 class SimpleMemoryAllocator {
  public:
   SimpleMemoryAllocator(uint8_t* buffer, size_t buffer_size)
@@ -37,6 +44,17 @@ class SimpleMemoryAllocator {
 
   int GetDataSize() const { return data_size_; }
 
+  // Reserves the first `size` bytes of the buffer for activation buffers, so
+  // that later tail allocations can't overlap them. Every user of a shared
+  // arena places its activations at the start of the buffer, so only the
+  // largest reservation counts. Returns false if the head would run into the
+  // tail.
+  bool ReserveHead(size_t size);
+  size_t GetHeadSize() const { return head_size_; }
+
+  uint8_t* GetBuffer() const { return data_; }
+  size_t GetBufferSize() const { return data_size_max_; }
+
   // Child allocator is something like a temporary allocator. Memory allocated
   // by the child allocator will be freed once the child allocator is
   // deallocated. Child allocator could be cascaded to have for example
@@ -51,6 +69,7 @@ class SimpleMemoryAllocator {
 
  private:
   int data_size_ = 0;
+  size_t head_size_ = 0;
   size_t data_size_max_;
   uint8_t* data_;
   SimpleMemoryAllocator* parent_allocator_ = nullptr;
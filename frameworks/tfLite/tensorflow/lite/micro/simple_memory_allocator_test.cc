@@ -84,4 +84,22 @@ TF_LITE_MICRO_TEST(TestChildAllocator) {
   TF_LITE_MICRO_EXPECT_EQ(fourth, first - 16);
 }
 
+TF_LITE_MICRO_TEST(TestReserveHead) {
+  constexpr size_t arena_size = 1024;
+  uint8_t arena[arena_size];
+  tflite::SimpleMemoryAllocator allocator(arena, arena_size);
+
+  TF_LITE_MICRO_EXPECT_NE(nullptr, allocator.AllocateFromTail(256, 1));
+  TF_LITE_MICRO_EXPECT_TRUE(allocator.ReserveHead(512));
+  // Only the largest reservation counts.
+  TF_LITE_MICRO_EXPECT_TRUE(allocator.ReserveHead(128));
+  TF_LITE_MICRO_EXPECT_EQ(512, allocator.GetHeadSize());
+
+  // The tail can't grow into the head and vice versa.
+  TF_LITE_MICRO_EXPECT_EQ(nullptr, allocator.AllocateFromTail(257, 1));
+  TF_LITE_MICRO_EXPECT_NE(nullptr, allocator.AllocateFromTail(256, 1));
+  TF_LITE_MICRO_EXPECT_FALSE(allocator.ReserveHead(513));
+  TF_LITE_MICRO_EXPECT_EQ(512, allocator.GetHeadSize());
+}
+
 TF_LITE_MICRO_TESTS_END
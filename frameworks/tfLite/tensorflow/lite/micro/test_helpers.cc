@@ -17,6 +17,8 @@ limitations under the License.
 
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/tensor_utils.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_utils.h"
 
 namespace tflite {
@@ -47,7 +49,7 @@ class StackAllocator : public flatbuffers::Allocator {
     return *inst;
   }
 
-  static constexpr size_t kStackAllocatorSize = 4096;
+  static constexpr size_t kStackAllocatorSize = 8192;
 
  private:
   uint8_t data_backing_[kStackAllocatorSize];
@@ -55,6 +57,24 @@ class StackAllocator : public flatbuffers::Allocator {
   int data_size_;
 };
 
+// Backing store of the op data handed out by PopulateOpDataAllocator().
+constexpr size_t kOpDataBufferSize = 4096;
+constexpr size_t kOpDataAlignment = 16;
+uint8_t op_data_buffer[kOpDataBufferSize + kOpDataAlignment];
+size_t op_data_used = 0;
+
+void* AllocateOpDataForTest(TfLiteContext* context, size_t size) {
+  uint8_t* start = AlignPointerUp(op_data_buffer, kOpDataAlignment);
+  const size_t offset = AlignSizeUp(op_data_used, kOpDataAlignment);
+  if ((offset + size) > kOpDataBufferSize) {
+    return nullptr;
+  }
+  op_data_used = offset + size;
+  return start + offset;
+}
+
+void DeallocateOpDataForTest(TfLiteContext* context, void* buffer) {}
+
 flatbuffers::FlatBufferBuilder* BuilderInstance() {
   static char inst_memory[sizeof(flatbuffers::FlatBufferBuilder)];
   static flatbuffers::FlatBufferBuilder* inst =
@@ -126,6 +146,191 @@ const Model* BuildMockModel() {
   return model;
 }
 
+// Builds a chain of three mock ops in which the model input is consumed by the
+// first and the last op, so its lifetime spans the whole graph:
+//   t2 = op(t0, t1), t3 = op(t2, t1), t4 = op(t3, t1, t0)
+// If `offline_offsets` is given, it is stored as the offline memory plan of the
+// model with one entry per tensor.
+const Model* BuildComplexMockModel(const int32_t* offline_offsets) {
+  using flatbuffers::Offset;
+  flatbuffers::FlatBufferBuilder* builder = BuilderInstance();
+
+  constexpr size_t buffer_data_size = 1;
+  const uint8_t buffer_data[buffer_data_size] = {21};
+  constexpr size_t tensors_size = 5;
+  constexpr size_t offline_plan_size =
+      kOfflineMemAllocHeaderSize + tensors_size;
+  int32_t offline_plan[offline_plan_size] = {kOfflineMemAllocVersion, 0,
+                                             tensors_size};
+  if (offline_offsets != nullptr) {
+    for (size_t i = 0; i < tensors_size; ++i) {
+      offline_plan[kOfflineMemAllocHeaderSize + i] = offline_offsets[i];
+    }
+  }
+  const size_t buffers_size = (offline_offsets != nullptr) ? 3 : 2;
+  const Offset<Buffer> buffers[] = {
+      CreateBuffer(*builder),
+      CreateBuffer(*builder,
+                   builder->CreateVector(buffer_data, buffer_data_size)),
+      CreateBuffer(*builder,
+                   builder->CreateVector(
+                       reinterpret_cast<const uint8_t*>(offline_plan),
+                       sizeof(offline_plan)))};
+  constexpr size_t metadata_size = 1;
+  const Offset<Metadata> metadata[metadata_size] = {
+      CreateMetadata(*builder, builder->CreateString(kOfflineMemAllocMetadata),
+                     2)};
+  constexpr size_t weight_shape_size = 1;
+  const int32_t weight_shape[weight_shape_size] = {1};
+  constexpr size_t tensor_shape_size = 1;
+  const int32_t tensor_shape[tensor_shape_size] = {4};
+  const Offset<Tensor> tensors[tensors_size] = {
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_INT32, 0,
+                   builder->CreateString("test_input_tensor"), 0, false),
+      CreateTensor(*builder,
+                   builder->CreateVector(weight_shape, weight_shape_size),
+                   TensorType_UINT8, 1,
+                   builder->CreateString("test_weight_tensor"), 0, false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_INT32, 0,
+                   builder->CreateString("test_intermediate_tensor_1"), 0,
+                   false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_INT32, 0,
+                   builder->CreateString("test_intermediate_tensor_2"), 0,
+                   false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_INT32, 0,
+                   builder->CreateString("test_output_tensor"), 0, false),
+  };
+  constexpr size_t inputs_size = 1;
+  const int32_t inputs[inputs_size] = {0};
+  constexpr size_t outputs_size = 1;
+  const int32_t outputs[outputs_size] = {4};
+  constexpr size_t operator_outputs_size = 1;
+  const int32_t operator_0_inputs[] = {0, 1};
+  const int32_t operator_0_outputs[operator_outputs_size] = {2};
+  const int32_t operator_1_inputs[] = {2, 1};
+  const int32_t operator_1_outputs[operator_outputs_size] = {3};
+  const int32_t operator_2_inputs[] = {3, 1, 0};
+  const int32_t operator_2_outputs[operator_outputs_size] = {4};
+  constexpr size_t operators_size = 3;
+  const Offset<Operator> operators[operators_size] = {
+      CreateOperator(*builder, 0, builder->CreateVector(operator_0_inputs, 2),
+                     builder->CreateVector(operator_0_outputs,
+                                           operator_outputs_size),
+                     BuiltinOptions_NONE),
+      CreateOperator(*builder, 0, builder->CreateVector(operator_1_inputs, 2),
+                     builder->CreateVector(operator_1_outputs,
+                                           operator_outputs_size),
+                     BuiltinOptions_NONE),
+      CreateOperator(*builder, 0, builder->CreateVector(operator_2_inputs, 3),
+                     builder->CreateVector(operator_2_outputs,
+                                           operator_outputs_size),
+                     BuiltinOptions_NONE),
+  };
+  constexpr size_t subgraphs_size = 1;
+  const Offset<SubGraph> subgraphs[subgraphs_size] = {
+      CreateSubGraph(*builder, builder->CreateVector(tensors, tensors_size),
+                     builder->CreateVector(inputs, inputs_size),
+                     builder->CreateVector(outputs, outputs_size),
+                     builder->CreateVector(operators, operators_size),
+                     builder->CreateString("test_subgraph"))};
+  constexpr size_t operator_codes_size = 1;
+  const Offset<OperatorCode> operator_codes[operator_codes_size] = {
+      CreateOperatorCodeDirect(*builder, BuiltinOperator_CUSTOM, "mock_custom",
+                               0)};
+  const Offset<Model> model_offset = CreateModel(
+      *builder, 0, builder->CreateVector(operator_codes, operator_codes_size),
+      builder->CreateVector(subgraphs, subgraphs_size),
+      builder->CreateString("test_model"),
+      builder->CreateVector(buffers, buffers_size), 0,
+      (offline_offsets != nullptr)
+          ? builder->CreateVector(metadata, metadata_size)
+          : 0);
+  FinishModelBuffer(*builder, model_offset);
+  void* model_pointer = builder->GetBufferPointer();
+  const Model* model = flatbuffers::GetRoot<Model>(model_pointer);
+  return model;
+}
+
+// Builds a model with two subgraphs that both run a single mock op on their
+// input and a weight, which is 21 in subgraph 0 and 2 in subgraph 1.
+const Model* BuildMultiSubgraphMockModel() {
+  using flatbuffers::Offset;
+  flatbuffers::FlatBufferBuilder* builder = BuilderInstance();
+
+  constexpr size_t buffer_data_size = 1;
+  const uint8_t buffer_0_data[buffer_data_size] = {21};
+  const uint8_t buffer_1_data[buffer_data_size] = {2};
+  constexpr size_t buffers_size = 3;
+  const Offset<Buffer> buffers[buffers_size] = {
+      CreateBuffer(*builder),
+      CreateBuffer(*builder,
+                   builder->CreateVector(buffer_0_data, buffer_data_size)),
+      CreateBuffer(*builder,
+                   builder->CreateVector(buffer_1_data, buffer_data_size))};
+  constexpr size_t tensor_shape_size = 1;
+  const int32_t tensor_shape[tensor_shape_size] = {1};
+  constexpr size_t inputs_size = 1;
+  const int32_t inputs[inputs_size] = {0};
+  constexpr size_t outputs_size = 1;
+  const int32_t outputs[outputs_size] = {2};
+  constexpr size_t operator_inputs_size = 2;
+  const int32_t operator_inputs[operator_inputs_size] = {0, 1};
+  constexpr size_t operator_outputs_size = 1;
+  const int32_t operator_outputs[operator_outputs_size] = {2};
+  constexpr size_t subgraphs_size = 2;
+  Offset<SubGraph> subgraphs[subgraphs_size];
+  for (size_t i = 0; i < subgraphs_size; ++i) {
+    constexpr size_t tensors_size = 3;
+    const Offset<Tensor> tensors[tensors_size] = {
+        CreateTensor(*builder,
+                     builder->CreateVector(tensor_shape, tensor_shape_size),
+                     TensorType_INT32, 0,
+                     builder->CreateString("test_input_tensor"), 0, false),
+        CreateTensor(*builder,
+                     builder->CreateVector(tensor_shape, tensor_shape_size),
+                     TensorType_UINT8, 1 + i,
+                     builder->CreateString("test_weight_tensor"), 0, false),
+        CreateTensor(*builder,
+                     builder->CreateVector(tensor_shape, tensor_shape_size),
+                     TensorType_INT32, 0,
+                     builder->CreateString("test_output_tensor"), 0, false),
+    };
+    constexpr size_t operators_size = 1;
+    const Offset<Operator> operators[operators_size] = {CreateOperator(
+        *builder, 0,
+        builder->CreateVector(operator_inputs, operator_inputs_size),
+        builder->CreateVector(operator_outputs, operator_outputs_size),
+        BuiltinOptions_NONE)};
+    subgraphs[i] =
+        CreateSubGraph(*builder, builder->CreateVector(tensors, tensors_size),
+                       builder->CreateVector(inputs, inputs_size),
+                       builder->CreateVector(outputs, outputs_size),
+                       builder->CreateVector(operators, operators_size),
+                       builder->CreateString("test_subgraph"));
+  }
+  constexpr size_t operator_codes_size = 1;
+  const Offset<OperatorCode> operator_codes[operator_codes_size] = {
+      CreateOperatorCodeDirect(*builder, BuiltinOperator_CUSTOM, "mock_custom",
+                               0)};
+  const Offset<Model> model_offset = CreateModel(
+      *builder, 0, builder->CreateVector(operator_codes, operator_codes_size),
+      builder->CreateVector(subgraphs, subgraphs_size),
+      builder->CreateString("test_model"),
+      builder->CreateVector(buffers, buffers_size));
+  FinishModelBuffer(*builder, model_offset);
+  void* model_pointer = builder->GetBufferPointer();
+  const Model* model = flatbuffers::GetRoot<Model>(model_pointer);
+  return model;
+}
+
 }  // namespace
 
 const Model* GetMockModel() {
@@ -136,6 +341,26 @@ const Model* GetMockModel() {
   return model;
 }
 
+const Model* GetComplexMockModel() {
+  static Model* model = nullptr;
+  if (!model) {
+    model = const_cast<Model*>(BuildComplexMockModel(nullptr));
+  }
+  return model;
+}
+
+const Model* GetComplexMockModelWithOfflinePlan(const int32_t* offsets) {
+  return BuildComplexMockModel(offsets);
+}
+
+const Model* GetMultiSubgraphMockModel() {
+  static Model* model = nullptr;
+  if (!model) {
+    model = const_cast<Model*>(BuildMultiSubgraphMockModel());
+  }
+  return model;
+}
+
 const Tensor* Create1dFlatbufferTensor(int size) {
   using flatbuffers::Offset;
   flatbuffers::FlatBufferBuilder* builder = BuilderInstance();
@@ -207,6 +432,12 @@ void ReportOpError(struct TfLiteContext* context, const char* format, ...) {
   va_end(args);
 }
 
+void PopulateOpDataAllocator(TfLiteContext* context) {
+  op_data_used = 0;
+  context->AllocateOpData = AllocateOpDataForTest;
+  context->DeallocateOpData = DeallocateOpDataForTest;
+}
+
 // Create a TfLiteIntArray from an array of ints.  The first element in the
 // supplied array must be the size of the array expressed as an int.
 TfLiteIntArray* IntArrayFromInts(const int* int_array) {
@@ -28,6 +28,19 @@ namespace testing {
 // Returns an example flatbuffer TensorFlow Lite model.
 const Model* GetMockModel();
 
+// Returns a flatbuffer model with three ops, in which the model input is also
+// consumed by the last op.
+const Model* GetComplexMockModel();
+
+// Returns the model of GetComplexMockModel() with an offline memory plan that
+// places each of its five tensors at the given arena offset. A new model is
+// built on every call.
+const Model* GetComplexMockModelWithOfflinePlan(const int32_t* offsets);
+
+// Returns a flatbuffer model with two subgraphs of one op each, like
+// GetMockModel() but with a weight of 21 in subgraph 0 and of 2 in subgraph 1.
+const Model* GetMultiSubgraphMockModel();
+
 // Builds a one-dimensional flatbuffer tensor of the given size.
 const Tensor* Create1dFlatbufferTensor(int size);
 
@@ -47,6 +60,11 @@ void ReportOpError(struct TfLiteContext* context, const char* format, ...);
 void PopulateContext(TfLiteTensor* tensors, int tensors_size,
                      TfLiteContext* context);
 
+// Sets up TfLiteContext::AllocateOpData for tests that call the methods of a
+// kernel registration directly. The op data comes from a static buffer that
+// is reused by the next call, so only one kernel can be tested at a time.
+void PopulateOpDataAllocator(TfLiteContext* context);
+
 // Create a TfLiteIntArray from an array of ints.  The first element in the
 // supplied array must be the size of the array expressed as an int.
 TfLiteIntArray* IntArrayFromInts(const int* int_array);
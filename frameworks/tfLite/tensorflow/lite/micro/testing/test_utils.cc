@@ -0,0 +1,170 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/testing/test_utils.h"
+
+namespace tflite {
+namespace testing {
+
+namespace {
+
+TfLiteTensor CreateQuantizedTensor(TfLiteType type, void* data,
+                                   TfLiteIntArray* dims, const char* name,
+                                   float scale, int zero_point, size_t size,
+                                   bool is_variable) {
+  TfLiteTensor result;
+  result.type = type;
+  result.data.raw = static_cast<char*>(data);
+  result.dims = dims;
+  result.params = {scale, zero_point};
+  result.quantization = {kTfLiteAffineQuantization, nullptr};
+  result.allocation_type = kTfLiteMemNone;
+  result.bytes = ElementCount(*dims) * size;
+  result.allocation = nullptr;
+  result.name = name;
+  result.is_variable = is_variable;
+  return result;
+}
+
+}  // namespace
+
+// Declared in test_helpers.h, the tests are the only users of micro_test's
+// reporter.
+void PopulateContext(TfLiteTensor* tensors, int tensors_size,
+                     TfLiteContext* context) {
+  context->tensors_size = tensors_size;
+  context->tensors = tensors;
+  context->impl_ = static_cast<void*>(micro_test::reporter);
+  context->GetExecutionPlan = nullptr;
+  context->ResizeTensor = nullptr;
+  context->ReportError = ReportOpError;
+  context->AddTensors = nullptr;
+  context->GetNodeAndRegistration = nullptr;
+  context->ReplaceNodeSubsetsWithDelegateKernels = nullptr;
+  context->recommended_num_threads = 1;
+  context->GetExternalContext = nullptr;
+  context->SetExternalContext = nullptr;
+
+  for (int i = 0; i < tensors_size; ++i) {
+    if (context->tensors[i].is_variable) {
+      ResetVariableTensor(&context->tensors[i]);
+    }
+  }
+}
+
+uint8_t F2Q(float value, float min, float max) {
+  int32_t result = ZeroPointFromMinMax<uint8_t>(min, max) +
+                   (value / ScaleFromMinMax<uint8_t>(min, max)) + 0.5f;
+  if (result < std::numeric_limits<uint8_t>::min()) {
+    result = std::numeric_limits<uint8_t>::min();
+  }
+  if (result > std::numeric_limits<uint8_t>::max()) {
+    result = std::numeric_limits<uint8_t>::max();
+  }
+  return result;
+}
+
+int8_t F2QS(float value, float min, float max) {
+  return F2Q(value, min, max) + std::numeric_limits<int8_t>::min();
+}
+
+int32_t F2Q32(float value, float scale) {
+  double quantized = value / scale;
+  if (quantized > std::numeric_limits<int32_t>::max()) {
+    quantized = std::numeric_limits<int32_t>::max();
+  } else if (quantized < std::numeric_limits<int32_t>::min()) {
+    quantized = std::numeric_limits<int32_t>::min();
+  }
+  return static_cast<int32_t>(quantized);
+}
+
+TfLiteTensor CreateFloatTensor(std::initializer_list<float> data,
+                               TfLiteIntArray* dims, const char* name,
+                               bool is_variable) {
+  return CreateFloatTensor(data.begin(), dims, name, is_variable);
+}
+
+TfLiteTensor CreateBoolTensor(std::initializer_list<bool> data,
+                              TfLiteIntArray* dims, const char* name,
+                              bool is_variable) {
+  return CreateBoolTensor(data.begin(), dims, name, is_variable);
+}
+
+TfLiteTensor CreateQuantizedTensor(const uint8_t* data, TfLiteIntArray* dims,
+                                   const char* name, float min, float max,
+                                   bool is_variable) {
+  return CreateQuantizedTensor(
+      kTfLiteUInt8, const_cast<uint8_t*>(data), dims, name,
+      ScaleFromMinMax<uint8_t>(min, max),
+      ZeroPointFromMinMax<uint8_t>(min, max), sizeof(uint8_t), is_variable);
+}
+
+TfLiteTensor CreateQuantizedTensor(std::initializer_list<uint8_t> data,
+                                   TfLiteIntArray* dims, const char* name,
+                                   float min, float max, bool is_variable) {
+  return CreateQuantizedTensor(data.begin(), dims, name, min, max,
+                               is_variable);
+}
+
+TfLiteTensor CreateQuantizedTensor(const int8_t* data, TfLiteIntArray* dims,
+                                   const char* name, float min, float max,
+                                   bool is_variable) {
+  return CreateQuantizedTensor(
+      kTfLiteInt8, const_cast<int8_t*>(data), dims, name,
+      ScaleFromMinMax<int8_t>(min, max), ZeroPointFromMinMax<int8_t>(min, max),
+      sizeof(int8_t), is_variable);
+}
+
+TfLiteTensor CreateQuantizedTensor(std::initializer_list<int8_t> data,
+                                   TfLiteIntArray* dims, const char* name,
+                                   float min, float max, bool is_variable) {
+  return CreateQuantizedTensor(data.begin(), dims, name, min, max,
+                               is_variable);
+}
+
+TfLiteTensor CreateQuantizedTensor(float* data, uint8_t* quantized_data,
+                                   TfLiteIntArray* dims, const char* name,
+                                   bool is_variable) {
+  float scale;
+  SymmetricQuantize(data, dims, quantized_data, &scale);
+  return CreateQuantizedTensor(kTfLiteUInt8, quantized_data, dims, name, scale,
+                               128, sizeof(uint8_t), is_variable);
+}
+
+TfLiteTensor CreateQuantizedTensor(float* data, int8_t* quantized_data,
+                                   TfLiteIntArray* dims, const char* name,
+                                   bool is_variable) {
+  float scale;
+  SignedSymmetricQuantize(data, dims, quantized_data, &scale);
+  return CreateQuantizedTensor(kTfLiteInt8, quantized_data, dims, name, scale,
+                               0, sizeof(int8_t), is_variable);
+}
+
+TfLiteTensor CreateQuantized32Tensor(const int32_t* data, TfLiteIntArray* dims,
+                                     const char* name, float scale,
+                                     bool is_variable) {
+  // Quantized int32 tensors always have a zero point of 0.
+  return CreateQuantizedTensor(kTfLiteInt32, const_cast<int32_t*>(data), dims,
+                               name, scale, 0, sizeof(int32_t), is_variable);
+}
+
+TfLiteTensor CreateQuantized32Tensor(std::initializer_list<int32_t> data,
+                                     TfLiteIntArray* dims, const char* name,
+                                     float scale, bool is_variable) {
+  return CreateQuantized32Tensor(data.begin(), dims, name, scale, is_variable);
+}
+
+}  // namespace testing
+}  // namespace tflite
@@ -0,0 +1,310 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool that plans the activation buffers of a model ahead of time and
+// stores the result in the model metadata, so MicroAllocator can place the
+// tensors without running a memory planner on the device.
+//
+// Usage: offline_memory_planner <input.tflite> <output.tflite> [iterations]
+//
+// The layout uses the same lifetime rules as MicroAllocator. A set of greedy
+// first-fit placements in different orders is tried first, followed by
+// `iterations` randomized orders (1000 by default). The search stops early
+// once a layout reaches the lower bound, the largest sum of buffer sizes that
+// are live at the same time.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+struct BufferRequirements {
+  int tensor_index;
+  int size;
+  int first_created;
+  int last_used;
+};
+
+bool LifetimesOverlap(const BufferRequirements& a,
+                      const BufferRequirements& b) {
+  return (a.first_created <= b.last_used) && (b.first_created <= a.last_used);
+}
+
+// Places the buffers in the given order, each at the lowest offset that
+// doesn't collide with an already placed buffer it shares time with. Returns
+// the resulting arena size.
+int PlaceFirstFit(const std::vector<BufferRequirements>& buffers,
+                  const std::vector<int>& order, std::vector<int>* offsets) {
+  offsets->assign(buffers.size(), -1);
+  std::vector<std::pair<int, int>> taken;
+  int arena_size = 0;
+  for (const int index : order) {
+    const BufferRequirements& current = buffers[index];
+    taken.clear();
+    for (size_t other = 0; other < buffers.size(); ++other) {
+      if (((*offsets)[other] != -1) &&
+          LifetimesOverlap(current, buffers[other])) {
+        taken.emplace_back((*offsets)[other],
+                           (*offsets)[other] + buffers[other].size);
+      }
+    }
+    std::sort(taken.begin(), taken.end());
+    int candidate = 0;
+    for (const auto& range : taken) {
+      if (candidate + current.size <= range.first) {
+        break;
+      }
+      candidate = std::max(candidate, range.second);
+    }
+    (*offsets)[index] = candidate;
+    arena_size = std::max(arena_size, candidate + current.size);
+  }
+  return arena_size;
+}
+
+int LowerBound(const std::vector<BufferRequirements>& buffers, int op_count) {
+  int bound = 0;
+  for (int op = 0; op <= op_count; ++op) {
+    int live = 0;
+    for (const auto& buffer : buffers) {
+      if ((buffer.first_created <= op) && (op <= buffer.last_used)) {
+        live += buffer.size;
+      }
+    }
+    bound = std::max(bound, live);
+  }
+  return bound;
+}
+
+// Mirrors the lifetime analysis of MicroAllocator::FinishTensorAllocation().
+bool CollectBuffers(const tflite::Model* model,
+                    tflite::ErrorReporter* error_reporter,
+                    std::vector<BufferRequirements>* buffers) {
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  const auto* tensors = subgraph->tensors();
+  const auto* operators = subgraph->operators();
+  const int op_count = operators->size();
+
+  std::vector<int> first_created(tensors->size(), -1);
+  std::vector<int> last_used(tensors->size(), -1);
+  for (size_t i = 0; i < subgraph->inputs()->size(); ++i) {
+    first_created[subgraph->inputs()->Get(i)] = 0;
+  }
+  for (size_t i = 0; i < subgraph->outputs()->size(); ++i) {
+    last_used[subgraph->outputs()->Get(i)] = op_count - 1;
+  }
+  for (int i = op_count - 1; i >= 0; --i) {
+    const auto* op = operators->Get(i);
+    for (size_t n = 0; n < op->inputs()->size(); ++n) {
+      const int tensor_index = op->inputs()->Get(n);
+      if (tensor_index < 0) continue;
+      last_used[tensor_index] = std::max(last_used[tensor_index], i);
+    }
+    for (size_t n = 0; n < op->outputs()->size(); ++n) {
+      const int tensor_index = op->outputs()->Get(n);
+      if ((first_created[tensor_index] == -1) ||
+          (first_created[tensor_index] > i)) {
+        first_created[tensor_index] = i;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < tensors->size(); ++i) {
+    const tflite::Tensor* tensor = tensors->Get(i);
+    const auto* buffer = model->buffers()->Get(tensor->buffer());
+    const bool has_data = (buffer != nullptr) && (buffer->data() != nullptr) &&
+                          (buffer->data()->size() > 0);
+    const bool is_read_only = (first_created[i] == -1);
+    // Variable tensors are kept in the tail of the arena.
+    if (has_data || is_read_only || tensor->is_variable()) {
+      continue;
+    }
+    if (last_used[i] == -1) {
+      error_reporter->Report("Tensor %d has an invalid lifetime", i);
+      return false;
+    }
+    size_t bytes_required;
+    size_t type_size;
+    if (tflite::BytesRequiredForTensor(*tensor, &bytes_required, &type_size,
+                                       error_reporter) != kTfLiteOk) {
+      return false;
+    }
+    BufferRequirements requirements;
+    requirements.tensor_index = i;
+    requirements.size = tflite::AlignSizeUp(
+        bytes_required, tflite::kOfflineMemAllocAlignment);
+    requirements.first_created = first_created[i];
+    requirements.last_used = last_used[i];
+    buffers->push_back(requirements);
+  }
+  return true;
+}
+
+bool ReadFile(const char* path, std::vector<char>* contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  contents->assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+  return true;
+}
+
+bool WriteFile(const char* path, const uint8_t* data, size_t size) {
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(data), size);
+  return static_cast<bool>(file);
+}
+
+// Stores the plan in the kOfflineMemAllocMetadata entry, replacing an older
+// plan if there is one.
+void AddPlanToModel(const std::vector<int32_t>& plan,
+                    tflite::ModelT* model) {
+  std::unique_ptr<tflite::BufferT> buffer(new tflite::BufferT);
+  for (const int32_t value : plan) {
+    for (int byte = 0; byte < 4; ++byte) {
+      buffer->data.push_back(
+          static_cast<uint8_t>((static_cast<uint32_t>(value) >> (8 * byte))));
+    }
+  }
+
+  for (auto& metadata : model->metadata) {
+    if (metadata->name == tflite::kOfflineMemAllocMetadata) {
+      model->buffers[metadata->buffer] = std::move(buffer);
+      return;
+    }
+  }
+  std::unique_ptr<tflite::MetadataT> metadata(new tflite::MetadataT);
+  metadata->name = tflite::kOfflineMemAllocMetadata;
+  metadata->buffer = model->buffers.size();
+  model->buffers.push_back(std::move(buffer));
+  model->metadata.push_back(std::move(metadata));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  tflite::MicroErrorReporter micro_error_reporter;
+  tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+
+  if ((argc != 3) && (argc != 4)) {
+    error_reporter->Report(
+        "Usage: %s <input.tflite> <output.tflite> [iterations]", argv[0]);
+    return 1;
+  }
+  const int iterations = (argc == 4) ? std::atoi(argv[3]) : 1000;
+
+  std::vector<char> contents;
+  if (!ReadFile(argv[1], &contents)) {
+    error_reporter->Report("Couldn't read %s", argv[1]);
+    return 1;
+  }
+  const tflite::Model* model = tflite::GetModel(contents.data());
+  if (model->subgraphs()->size() != 1) {
+    error_reporter->Report("Only models with a single subgraph are supported");
+    return 1;
+  }
+  std::vector<BufferRequirements> buffers;
+  if (!CollectBuffers(model, error_reporter, &buffers)) {
+    return 1;
+  }
+  const int op_count = model->subgraphs()->Get(0)->operators()->size();
+  const int lower_bound = LowerBound(buffers, op_count);
+
+  std::vector<int> order(buffers.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  auto lifetime = [&buffers](int i) {
+    return buffers[i].last_used - buffers[i].first_created + 1;
+  };
+  const std::vector<std::function<bool(int, int)>> heuristics = {
+      // Largest first, this is what GreedyMemoryPlanner does.
+      [&](int a, int b) { return buffers[a].size > buffers[b].size; },
+      [&](int a, int b) { return lifetime(a) > lifetime(b); },
+      [&](int a, int b) {
+        return buffers[a].size * lifetime(a) > buffers[b].size * lifetime(b);
+      },
+      [&](int a, int b) {
+        return buffers[a].first_created < buffers[b].first_created;
+      },
+  };
+
+  std::vector<int> offsets;
+  std::vector<int> best_offsets;
+  int greedy_size = 0;
+  int best_size = 0;
+  for (size_t h = 0; h < heuristics.size(); ++h) {
+    std::stable_sort(order.begin(), order.end(), heuristics[h]);
+    const int size = PlaceFirstFit(buffers, order, &offsets);
+    if (h == 0) {
+      greedy_size = size;
+    }
+    if ((best_offsets.empty()) || (size < best_size)) {
+      best_size = size;
+      best_offsets = offsets;
+    }
+  }
+  std::mt19937 generator(0);
+  for (int i = 0; (i < iterations) && (best_size > lower_bound); ++i) {
+    std::shuffle(order.begin(), order.end(), generator);
+    const int size = PlaceFirstFit(buffers, order, &offsets);
+    if (size < best_size) {
+      best_size = size;
+      best_offsets = offsets;
+    }
+  }
+
+  const auto* tensors = model->subgraphs()->Get(0)->tensors();
+  std::vector<int32_t> plan = {tflite::kOfflineMemAllocVersion, 0,
+                               static_cast<int32_t>(tensors->size())};
+  plan.resize(tflite::kOfflineMemAllocHeaderSize + tensors->size(),
+              tflite::kOfflineMemAllocNoOffset);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    plan[tflite::kOfflineMemAllocHeaderSize + buffers[i].tensor_index] =
+        best_offsets[i];
+  }
+
+  std::unique_ptr<tflite::ModelT> model_t =
+      tflite::UnPackModel(contents.data());
+  AddPlanToModel(plan, model_t.get());
+  flatbuffers::FlatBufferBuilder builder;
+  tflite::FinishModelBuffer(builder,
+                            tflite::Model::Pack(builder, model_t.get()));
+  if (!WriteFile(argv[2], builder.GetBufferPointer(), builder.GetSize())) {
+    error_reporter->Report("Couldn't write %s", argv[2]);
+    return 1;
+  }
+
+  error_reporter->Report("Planned %d buffers",
+                         static_cast<int>(buffers.size()));
+  error_reporter->Report("Greedy memory planner: %d bytes", greedy_size);
+  error_reporter->Report("Offline plan: %d bytes", best_size);
+  error_reporter->Report("Lower bound: %d bytes", lower_bound);
+  return 0;
+}
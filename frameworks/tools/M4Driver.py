@@ -61,3 +61,23 @@ class M4Driver:
         prediction = self.ser.read(1)
         if prediction != []:
             return prediction
+
+    def predictPipelined(self, images, depth=2):
+        """ Yields the predictions of the mnist images, depth images are in flight
+
+        The next image is sent before the prediction of the previous one is read,
+        so it is transferred while the network runs. Only for firmware with a
+        double buffered input (st), the others lose the image sent meanwhile.
+
+        images: (np.array[n][28*28]) with the mnist images
+        depth: (int) number of images sent ahead, at most the input buffers of the firmware
+        returns: generator of the predictions read from the serial device
+        """
+        sent = 0
+        for image in images:
+            if sent >= depth:
+                yield self.ser.read(1)
+            self.ser.write(b'c' + bytes(bytearray(image)))
+            sent = sent + 1
+        for _ in range(min(sent, depth)):
+            yield self.ser.read(1)
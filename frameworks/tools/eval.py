@@ -4,11 +4,12 @@ Sends mnist images to the STM32F29 where a neural network runs and predicts the
 Predictions are compared to true labels.
 
 Example use:
-    python3 eval.py /dev/ttyUSB0 100
+    python3 eval.py /dev/ttyUSB0 100 [pipelined]
 
 :Params
     - /dev/ttyUSB0 name of serial device (see M4Driver.py for more information)
     - 100 number of test images to evaluate the neural net on
+    - pipelined send the next image while the network runs (st firmware only)
 
 :Author: Raphael Zingg zing@zhaw.ch
 :Copyright: 2020 ZHAW / Institute of Embedded Systems
@@ -23,6 +24,7 @@ from M4Driver import M4Driver
 # -------------------------------------------------------------------------------------------------
 SER_DEV = str(sys.argv[1])
 NUM_TEST = int(sys.argv[2])
+PIPELINED = len(sys.argv) > 3 and sys.argv[3] == 'pipelined'
 
 # -------------------------------------------------------------------------------------------------
 # Get data, only test set is required
@@ -51,10 +53,13 @@ elif fw == 4:
 print('\n\nFirmware running on target:' + rb_fw + ' evaluate:' + str(NUM_TEST) + ' samples!\n\n')
 wrong_pred = 0
 target_pred = []
-for i in range(0, NUM_TEST):
+if PIPELINED:
+    predictions = m4d.predictPipelined(X_TEST[0:NUM_TEST].reshape(NUM_TEST, 28*28))
+else:
+    predictions = (m4d.predict(X_TEST[i].reshape(1, 28*28)) for i in range(0, NUM_TEST))
+for i, ret in enumerate(predictions):
 
     # get prediction
-    ret = m4d.predict(X_TEST[i].reshape(1, 28*28))
     target_pred.append(struct.unpack('1B', ret)[0])
     print(str(i) + ' Target:' + str(target_pred[-1]) + ' Label:' + str(Y_TEST[i]))
 